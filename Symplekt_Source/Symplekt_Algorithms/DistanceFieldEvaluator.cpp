@@ -0,0 +1,325 @@
+/*!  \file DistanceFieldEvaluator.cpp
+ *   \brief Implementation of an object for computing (signed) distance fields of mesh geometry data on scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "DistanceFieldEvaluator.h"
+#include "EikonalSolver.h"
+#include "MeshTriangleSoup.h"
+#include "TriangleBVH.h"
+#include "WindingNumberEvaluator.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	using Point3 = std::array<double, 3>;
+
+	//!> \brief flag of inside votes marking a cell on a line (along any axis) with an odd number of crossings
+	constexpr uint8_t odd_line_vote_flag = 8;
+
+	//!> \brief votes of a cell inside by parity along all three axes (and on no line with an odd number of crossings)
+	constexpr uint8_t unanimous_inside_votes = 7;
+
+	//!> \brief a cell is inside if the absolute value of its generalized winding number exceeds this threshold
+	constexpr double winding_number_inside_threshold = 0.5;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects sorted coordinates of the crossings of a line parallel to an axis with the triangles. Crossings
+	*          on shared edges and vertices are attributed to a single triangle (see GetTriangleLineCrossing).
+	*   \param[in] bvh                bounding volume hierarchy over the triangles.
+	*   \param[in] triangles          triangle soup of the hierarchy.
+	*   \param[in] axis               axis of the line.
+	*   \param[in] u                  coordinate of the line along the axis (axis + 1) % 3.
+	*   \param[in] v                  coordinate of the line along the axis (axis + 2) % 3.
+	*   \param[out] candidateIds      triangles overlapping the line (reused buffer).
+	*   \param[out] hits              coordinates of the crossings along the axis.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void CollectLineHits(const TriangleBVH& bvh, const std::vector<TrianglePoints>& triangles,
+		const size_t& axis, const double& u, const double& v, std::vector<size_t>& candidateIds, std::vector<double>& hits)
+	{
+		hits.clear();
+		const size_t uAxis = (axis + 1) % 3;
+		const size_t vAxis = (axis + 2) % 3;
+
+		// the line is a degenerate box spanning the bounds of all triangles along the axis
+		auto lineBox = bvh.GetBoundingBox();
+		Point3 lineMin{ lineBox.Min().X(), lineBox.Min().Y(), lineBox.Min().Z() };
+		Point3 lineMax{ lineBox.Max().X(), lineBox.Max().Y(), lineBox.Max().Z() };
+		lineMin[uAxis] = lineMax[uAxis] = u;
+		lineMin[vAxis] = lineMax[vAxis] = v;
+		bvh.CollectTrianglesInBox(Box3(Vector3(lineMin[0], lineMin[1], lineMin[2]), Vector3(lineMax[0], lineMax[1], lineMax[2])), candidateIds);
+
+		for (const auto& triangleId : candidateIds)
+		{
+			double t = 0.0;
+			if (GetTriangleLineCrossing(triangles[triangleId], axis, u, v, t))
+				hits.push_back(t);
+		}
+		std::sort(hits.begin(), hits.end());
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates ray parities along lines of cell centers in x, y and z. Bit "axis" of a cell's votes is set if
+	*          the cell is inside by parity along the axis, and odd_line_vote_flag is set for cells on lines with an odd
+	*          number of crossings (along which parity is unreliable).
+	*   \param[in] bvh                bounding volume hierarchy over the triangles.
+	*   \param[in] triangles          triangle soup of the hierarchy.
+	*   \param[in] gridData           scalar grid data.
+	*   \return per-cell votes.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<uint8_t> EvaluateInsideVotes(const TriangleBVH& bvh, const std::vector<TrianglePoints>& triangles, const ScalarGridData& gridData)
+	{
+		const std::array<size_t, 3> counts{ gridData.XCellCount, gridData.YCellCount, gridData.ZCellCount };
+		const std::array<size_t, 3> strides{ 1, counts[0], counts[0] * counts[1] };
+		const Point3 origin{ gridData.BoundingBox.Min().X(), gridData.BoundingBox.Min().Y(), gridData.BoundingBox.Min().Z() };
+		const double h = gridData.CellSize;
+		std::vector<uint8_t> votes(counts[0] * counts[1] * counts[2], 0);
+
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			const size_t uAxis = (axis + 1) % 3;
+			const size_t vAxis = (axis + 2) % 3;
+			const auto axisVote = static_cast<uint8_t>(1 << axis);
+
+			// lines along the axis are split into chunks by their v coordinate, so each cell is written by a single thread
+			Util::ParallelForChunks(counts[vAxis], Util::GetParallelChunkCount(counts[vAxis], 1),
+				[&](const size_t /*chunkIndex*/, const size_t vBegin, const size_t vEnd)
+				{
+					std::vector<size_t> candidateIds;
+					std::vector<double> hits;
+					for (size_t vId = vBegin; vId < vEnd; vId++)
+					{
+						for (size_t uId = 0; uId < counts[uAxis]; uId++)
+						{
+							CollectLineHits(bvh, triangles, axis, origin[uAxis] + (static_cast<double>(uId) + 0.5) * h, origin[vAxis] + (static_cast<double>(vId) + 0.5) * h, candidateIds, hits);
+							if (hits.empty())
+								continue;
+
+							const size_t lineOffset = uId * strides[uAxis] + vId * strides[vAxis];
+							const bool isOddLine = hits.size() % 2 == 1;
+							size_t hitsBefore = 0;
+							for (size_t aId = 0; aId < counts[axis]; aId++)
+							{
+								const double t = origin[axis] + (static_cast<double>(aId) + 0.5) * h;
+								while (hitsBefore < hits.size() && hits[hitsBefore] < t)
+									hitsBefore++;
+
+								auto& cellVotes = votes[aId * strides[axis] + lineOffset];
+								if (hitsBefore % 2 == 1)
+									cellVotes |= axisVote;
+								if (isOddLine)
+									cellVotes |= odd_line_vote_flag;
+							}
+						}
+					}
+				});
+		}
+		return votes;
+	}
+
+	//=============================================================================
+	/// \struct CellRange
+	/// \brief Index bounds of a box of cells (both inclusive).
+	//=============================================================================
+	struct CellRange
+	{
+		std::array<size_t, 3> First{};
+		std::array<size_t, 3> Last{};
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Computes a distance field from a set of triangles.
+	*   \param[in] triangles          mesh triangles.
+	*   \param[in] gridData           scalar grid data.
+	*   \param[in] settings           distance field settings.
+	*   \return Processing status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static MeshProcessingStatus EvaluateFromTriangles(const std::vector<TrianglePoints>& triangles, ScalarGridData& gridData, const DistanceFieldSettings& settings)
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		const size_t cellCount = nx * ny * nz;
+		if (triangles.empty() || cellCount == 0 || gridData.CellSize <= 0.0 || settings.NarrowBandWidth <= 0.0)
+			return MeshProcessingStatus::InvalidInput;
+
+		const TriangleBVH bvh(triangles);
+		const Point3 origin{ gridData.BoundingBox.Min().X(), gridData.BoundingBox.Min().Y(), gridData.BoundingBox.Min().Z() };
+		const double h = gridData.CellSize;
+		const double bandRadius = settings.NarrowBandWidth * h;
+		const std::array<size_t, 3> counts{ nx, ny, nz };
+
+		gridData.CellData.assign(cellCount, bandRadius);
+		gridData.CellIsFrozen.assign(cellCount, false);
+
+		// ------ narrow band: cells within the band radius of a triangle's bounding box are candidates for exact evaluation -----
+		// cell ranges of triangles are evaluated once and binned by the z-slabs processed on separate threads
+		const size_t slabCount = Util::GetParallelChunkCount(nz, 1);
+		std::vector<size_t> slabStarts(slabCount + 1);
+		for (size_t slabId = 0; slabId <= slabCount; slabId++)
+			slabStarts[slabId] = nz * slabId / slabCount;
+
+		std::vector<CellRange> triangleCellRanges;
+		triangleCellRanges.reserve(triangles.size());
+		std::vector<std::vector<size_t>> slabCellRangeIds(slabCount);
+		for (const auto& tri : triangles)
+		{
+			CellRange range;
+			bool isOutside = false;
+			for (size_t i = 0; i < 3; i++)
+			{
+				const double min = (std::min({ tri[0][i], tri[1][i], tri[2][i] }) - bandRadius - origin[i]) / h - 0.5;
+				const double max = (std::max({ tri[0][i], tri[1][i], tri[2][i] }) + bandRadius - origin[i]) / h - 0.5;
+				if (max < 0.0 || min > static_cast<double>(counts[i] - 1))
+				{
+					isOutside = true;
+					break;
+				}
+				range.First[i] = static_cast<size_t>(std::max(std::floor(min), 0.0));
+				range.Last[i] = std::min(static_cast<size_t>(std::ceil(max)), counts[i] - 1);
+			}
+			if (isOutside)
+				continue;
+
+			const auto firstSlab = static_cast<size_t>(std::upper_bound(slabStarts.begin(), slabStarts.end(), range.First[2]) - slabStarts.begin()) - 1;
+			for (size_t slabId = firstSlab; slabId < slabCount && slabStarts[slabId] <= range.Last[2]; slabId++)
+				slabCellRangeIds[slabId].push_back(triangleCellRanges.size());
+			triangleCellRanges.push_back(range);
+		}
+
+		// std::vector<bool> is not safe for concurrent writes, so frozen flags are collected per cell as bytes first
+		std::vector<uint8_t> isBandCell(cellCount, 0);
+		Util::ParallelForChunks(slabCount, slabCount,
+			[&](const size_t /*chunkIndex*/, const size_t slabBegin, const size_t slabEnd)
+			{
+				for (size_t slabId = slabBegin; slabId < slabEnd; slabId++)
+				{
+					const size_t kBegin = slabStarts[slabId];
+					const size_t kEnd = slabStarts[slabId + 1];
+					for (const auto& rangeId : slabCellRangeIds[slabId])
+					{
+						const auto& [first, last] = triangleCellRanges[rangeId];
+						for (size_t k = std::max(first[2], kBegin); k <= std::min(last[2], kEnd - 1); k++)
+						{
+							for (size_t j = first[1]; j <= last[1]; j++)
+								std::fill_n(isBandCell.begin() + static_cast<std::ptrdiff_t>(first[0] + nx * (j + ny * k)), last[0] - first[0] + 1, uint8_t{ 1 });
+						}
+					}
+
+					for (size_t k = kBegin; k < kEnd; k++)
+					{
+						for (size_t j = 0; j < ny; j++)
+						{
+							for (size_t i = 0; i < nx; i++)
+							{
+								const size_t id = i + nx * (j + ny * k);
+								if (!isBandCell[id])
+									continue;
+
+								const Vector3 center(
+									origin[0] + (static_cast<double>(i) + 0.5) * h,
+									origin[1] + (static_cast<double>(j) + 0.5) * h,
+									origin[2] + (static_cast<double>(k) + 0.5) * h);
+								BVHClosestPoint closestPoint;
+								isBandCell[id] = bvh.FindClosestPoint(center, closestPoint, bandRadius);
+								if (isBandCell[id])
+									gridData.CellData[id] = std::sqrt(closestPoint.DistanceSquared);
+							}
+						}
+					}
+				}
+			});
+
+		for (size_t id = 0; id < cellCount; id++)
+			gridData.CellIsFrozen[id] = isBandCell[id] != 0;
+
+		if (settings.FillOutsideBand)
+		{
+			EikonalSolverSettings sweepSettings;
+			sweepSettings.Method = EikonalSolverMethod::FastSweeping;
+			sweepSettings.NSweepIterations = settings.NSweepIterations;
+			// without band cells (e.g.: for a grid not containing the mesh) the solver fails and all cells keep the band radius
+			if (EikonalSolver::Solve(gridData, sweepSettings) != MeshProcessingStatus::Complete)
+				gridData.CellData.assign(cellCount, bandRadius);
+		}
+
+		if (!settings.ComputeSign)
+			return MeshProcessingStatus::Complete;
+
+		// ------ signs: unanimous parities along x, y and z decide, generalized winding numbers decide disputed cells ------
+		const auto votes = EvaluateInsideVotes(bvh, triangles, gridData);
+		std::vector<size_t> disputedCellIds;
+		for (size_t id = 0; id < cellCount; id++)
+		{
+			if (votes[id] == unanimous_inside_votes)
+				gridData.CellData[id] = -gridData.CellData[id];
+			else if (votes[id] != 0)
+				disputedCellIds.push_back(id);
+		}
+		if (disputedCellIds.empty())
+			return MeshProcessingStatus::Complete;
+
+		GridSamplePoints disputedCellCenters;
+		disputedCellCenters.X.reserve(disputedCellIds.size());
+		disputedCellCenters.Y.reserve(disputedCellIds.size());
+		disputedCellCenters.Z.reserve(disputedCellIds.size());
+		for (const auto& id : disputedCellIds)
+		{
+			disputedCellCenters.X.push_back(origin[0] + (static_cast<double>(id % nx) + 0.5) * h);
+			disputedCellCenters.Y.push_back(origin[1] + (static_cast<double>((id / nx) % ny) + 0.5) * h);
+			disputedCellCenters.Z.push_back(origin[2] + (static_cast<double>(id / (nx * ny)) + 0.5) * h);
+		}
+		const WindingNumberEvaluator windingNumbers(triangles);
+		std::vector<double> disputedWindingNumbers;
+		windingNumbers.EvaluateBatch(disputedCellCenters, disputedWindingNumbers);
+		for (size_t disputedId = 0; disputedId < disputedCellIds.size(); disputedId++)
+		{
+			if (std::fabs(disputedWindingNumbers[disputedId]) > winding_number_inside_threshold)
+				gridData.CellData[disputedCellIds[disputedId]] = -gridData.CellData[disputedCellIds[disputedId]];
+		}
+
+		return MeshProcessingStatus::Complete;
+	}
+
+	MeshProcessingStatus DistanceFieldEvaluator::Evaluate(const BufferMeshGeometryData& meshData, ScalarGridData& gridData, const DistanceFieldSettings& settings)
+	{
+		std::vector<TrianglePoints> triangles;
+		if (!CollectMeshTriangles(meshData, triangles))
+			return MeshProcessingStatus::InvalidInput;
+
+		return EvaluateFromTriangles(triangles, gridData, settings);
+	}
+
+	MeshProcessingStatus DistanceFieldEvaluator::Evaluate(const ReferencedMeshGeometryData& meshData, ScalarGridData& gridData, const DistanceFieldSettings& settings)
+	{
+		std::vector<TrianglePoints> triangles;
+		if (!CollectMeshTriangles(meshData, triangles))
+			return MeshProcessingStatus::InvalidInput;
+
+		return EvaluateFromTriangles(triangles, gridData, settings);
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
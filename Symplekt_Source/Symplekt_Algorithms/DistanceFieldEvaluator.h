@@ -0,0 +1,84 @@
+/*!  \file DistanceFieldEvaluator.h
+ *   \brief An object for computing (signed) distance fields of mesh geometry data on scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include "AlgorithmHelperTypes.h"
+
+namespace Symplektis::Algorithms
+{
+	//=============================================================================
+	/// \struct DistanceFieldSettings
+	/// \brief A data container for all major settings for DistanceFieldEvaluator.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct DistanceFieldSettings
+	{
+		double NarrowBandWidth{ 3.0 };        //>! half-width of the band of exactly evaluated cells (in multiples of CellSize).
+		bool ComputeSign{ true };             //>! if true, distances of cells inside the mesh are negative.
+		bool FillOutsideBand{ true };         //>! if true, cells outside the band are filled by fast sweeping, otherwise they are set to the band half-width.
+		unsigned int NSweepIterations{ 1 };   //>! number of fast sweeping iterations (of 8 sweep orderings each).
+	};
+
+	//=============================================================================
+	/// \class DistanceFieldEvaluator
+	/// \brief A singleton object computing distance fields of triangle meshes into ScalarGridData::CellData (cell values are
+	///        evaluated at cell centers). Distances of cells within the narrow band around the triangles are evaluated exactly
+	///        using closest point queries on a triangle bounding volume hierarchy, and these cells are marked in CellIsFrozen.
+	///        The rest of the grid is filled by a fast sweeping eikonal solver started from the frozen band. Signs are
+	///        evaluated by ray parity along lines of cell centers in x, y and z, with crossings on mesh edges and vertices
+	///        attributed to a single triangle by the same tie-breaking rule as in MeshVoxelizer. A cell is inside or outside
+	///        if all three parities agree. Cells with disagreeing parities or on lines with an odd number of crossings (e.g.:
+	///        near holes) are classified by the generalized winding number (see WindingNumberEvaluator). The band is
+	///        evaluated on multiple threads in z-slabs of the grid, with the triangles binned by the slabs they overlap.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class DistanceFieldEvaluator
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Computes the distance field of a buffer triangle mesh (VertexIndices read as triangle index triples).
+		 *  \param[in] meshData          buffer mesh geometry data.
+		 *  \param[in] gridData          initialized scalar grid data (e.g.: from InitializeScalarGridData) whose CellData and CellIsFrozen are overwritten.
+		 *	\param[in] settings          distance field settings.
+		 *  \return Processing status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] MeshProcessingStatus Evaluate(const GeometryKernel::BufferMeshGeometryData& meshData, GeometryKernel::ScalarGridData& gridData, const DistanceFieldSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Computes the distance field of a referenced mesh (polygonal faces are fan-triangulated).
+		 *  \param[in] meshData          referenced mesh geometry data.
+		 *  \param[in] gridData          initialized scalar grid data (e.g.: from InitializeScalarGridData) whose CellData and CellIsFrozen are overwritten.
+		 *	\param[in] settings          distance field settings.
+		 *  \return Processing status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] MeshProcessingStatus Evaluate(const GeometryKernel::ReferencedMeshGeometryData& meshData, GeometryKernel::ScalarGridData& gridData, const DistanceFieldSettings& settings = {});
+	};
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,356 @@
+/*!  \file EikonalSolver.cpp
+ *   \brief Implementation of an object for solving the eikonal equation on scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "EikonalSolver.h"
+
+#include "Symplekt_GeometryKernel/GridCellMask.h"
+
+#include "Symplekt_UtilityGeneral/IndexedMinHeap.h"
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	//!> \brief minimum number of cells of a z-slab swept by one fast sweeping thread
+	constexpr size_t min_sweep_slab_cell_count = 1 << 18;
+
+	//!> \brief infinite arrival time
+	constexpr double infinite_time = std::numeric_limits<double>::infinity();
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Solves the first order upwind discretization of |grad T| = step / h at a cell from the smallest neighbor values along each axis.
+	*   \param[in] n                  smallest neighbor values along x, y and z (infinite if not known).
+	*   \param[in] step               local grid step divided by speed (h / F).
+	*   \return arrival time (infinite if no neighbor value is known)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double SolveLocalEikonal(std::array<double, 3> n, const double& step)
+	{
+		std::sort(n.begin(), n.end());
+		if (n[0] == infinite_time)
+			return infinite_time;
+
+		double result = n[0] + step;
+		if (result <= n[1])
+			return result;
+
+		result = 0.5 * (n[0] + n[1] + std::sqrt(2.0 * step * step - (n[0] - n[1]) * (n[0] - n[1])));
+		if (result <= n[2])
+			return result;
+
+		const double sum = n[0] + n[1] + n[2];
+		const double discriminant = sum * sum - 3.0 * (n[0] * n[0] + n[1] * n[1] + n[2] * n[2] - step * step);
+		return (sum + std::sqrt(std::max(discriminant, 0.0))) / 3.0;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Local grid step h / F of a cell (infinite for obstacles).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetLocalStep(const EikonalSolverSettings& settings, const double& h, const size_t& i, const size_t& j, const size_t& k)
+	{
+		if (!settings.Speed)
+			return h;
+
+		const double speed = settings.Speed(i, j, k);
+		return speed > 0.0 ? h / speed : infinite_time;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Fast marching from frozen cells. Only accepted cells are used as upwind neighbors, the front is
+	*          kept in an indexed min-heap allocated once for the whole grid.
+	*   \param[in] gridData           scalar grid data with non-frozen values set to infinity.
+	*   \param[in] isFrozen           frozen cells of gridData.
+	*   \param[in] settings           eikonal solver settings.
+	*   \return per-cell flags of accepted cells
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<uint8_t> MarchFront(ScalarGridData& gridData, const GridCellMask& isFrozen, const EikonalSolverSettings& settings)
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		const size_t nxy = nx * ny;
+		const double h = gridData.CellSize;
+		auto& values = gridData.CellData;
+
+		std::vector<uint8_t> isAccepted(values.size(), 0);
+		for (size_t id = isFrozen.FindNextSet(0); id < values.size(); id = isFrozen.FindNextSet(id + 1))
+			isAccepted[id] = 1;
+
+		const auto acceptedValue = [&](const size_t& id) { return isAccepted[id] ? values[id] : infinite_time; };
+		Util::IndexedMinHeap<double> front(values.size(), nx * ny + ny * nz + nx * nz);
+
+		const auto updateCell = [&](const size_t& i, const size_t& j, const size_t& k)
+		{
+			const size_t id = i + nx * j + nxy * k;
+			if (isAccepted[id])
+				return;
+
+			const double step = GetLocalStep(settings, h, i, j, k);
+			if (step == infinite_time)
+				return;
+
+			const double result = SolveLocalEikonal({
+				std::min(i > 0 ? acceptedValue(id - 1) : infinite_time, i + 1 < nx ? acceptedValue(id + 1) : infinite_time),
+				std::min(j > 0 ? acceptedValue(id - nx) : infinite_time, j + 1 < ny ? acceptedValue(id + nx) : infinite_time),
+				std::min(k > 0 ? acceptedValue(id - nxy) : infinite_time, k + 1 < nz ? acceptedValue(id + nxy) : infinite_time) }, step);
+			if (result < values[id])
+			{
+				values[id] = result;
+				front.Push(id, result);
+			}
+		};
+
+		const auto updateNeighbors = [&](const size_t& id)
+		{
+			const size_t i = id % nx;
+			const size_t j = (id / nx) % ny;
+			const size_t k = id / nxy;
+			if (i > 0) updateCell(i - 1, j, k);
+			if (i + 1 < nx) updateCell(i + 1, j, k);
+			if (j > 0) updateCell(i, j - 1, k);
+			if (j + 1 < ny) updateCell(i, j + 1, k);
+			if (k > 0) updateCell(i, j, k - 1);
+			if (k + 1 < nz) updateCell(i, j, k + 1);
+		};
+
+		for (size_t id = isFrozen.FindNextSet(0); id < values.size(); id = isFrozen.FindNextSet(id + 1))
+			updateNeighbors(id);
+
+		while (!front.Empty())
+		{
+			const auto [time, id] = front.Pop();
+			if (time > settings.DistanceLimit)
+				break;
+
+			isAccepted[id] = 1;
+			updateNeighbors(id);
+		}
+
+		return isAccepted;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Fast sweeping from frozen cells. The grid is split into z-slabs which are swept in parallel, each by
+	*          Gauss-Seidel iterations in x-fastest row order. Cells at a slab boundary read the neighboring slab's
+	*          boundary plane from a copy made before every sweep ordering, so the front crosses slab boundaries between
+	*          sweeps and more iterations may be needed than for a single slab [Zhao, 2007]. Rows without a value within
+	*          DistanceLimit in them or in their 4 neighboring rows are skipped, and values beyond DistanceLimit are never
+	*          written, so the work is limited to the band reachable within DistanceLimit.
+	*   \param[in] gridData           scalar grid data with non-frozen values set to infinity.
+	*   \param[in] isFrozen           frozen cells of gridData.
+	*   \param[in] settings           eikonal solver settings.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void SweepFront(ScalarGridData& gridData, const GridCellMask& isFrozen, const EikonalSolverSettings& settings)
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		const size_t nxy = nx * ny;
+		const double h = gridData.CellSize;
+		auto& values = gridData.CellData;
+
+		// speeds are evaluated once per cell
+		std::vector<double> steps;
+		if (settings.Speed)
+		{
+			steps.resize(values.size());
+			Util::ParallelForChunks(nz, Util::GetParallelChunkCount(nz, 1),
+				[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+				{
+					for (size_t k = kBegin; k < kEnd; k++)
+						for (size_t j = 0; j < ny; j++)
+							for (size_t i = 0; i < nx; i++)
+								steps[i + nx * j + nxy * k] = GetLocalStep(settings, h, i, j, k);
+				});
+		}
+
+		// rows (j, k) holding a value within DistanceLimit. A cell can only be reached from its 6 neighbors, i.e.: from
+		// its own row or the 4 neighboring rows.
+		std::vector<uint8_t> isRowReached(ny * nz, 0);
+		for (size_t id = isFrozen.FindNextSet(0); id < values.size(); id = isFrozen.FindNextSet(id + 1))
+		{
+			if (values[id] <= settings.DistanceLimit)
+				isRowReached[id / nx] = 1;
+		}
+
+		const size_t slabCount = std::min(nz, Util::GetParallelChunkCount(values.size(), min_sweep_slab_cell_count));
+		std::vector<size_t> slabStarts(slabCount + 1);
+		for (size_t slabId = 0; slabId <= slabCount; slabId++)
+			slabStarts[slabId] = nz * slabId / slabCount;
+
+		// copies of the planes (and their row flags) on both sides of each slab boundary: [2 * b] is the last plane of
+		// slab b, [2 * b + 1] the first plane of slab b + 1
+		std::vector<double> ghostPlanes(2 * (slabCount - 1) * nxy);
+		std::vector<uint8_t> ghostRowReached(2 * (slabCount - 1) * ny);
+		const auto copyGhostPlanes = [&]()
+		{
+			for (size_t boundaryId = 0; boundaryId + 1 < slabCount; boundaryId++)
+			{
+				for (size_t side = 0; side < 2; side++)
+				{
+					const size_t k = slabStarts[boundaryId + 1] - 1 + side;
+					std::copy_n(values.begin() + nxy * k, nxy, ghostPlanes.begin() + (2 * boundaryId + side) * nxy);
+					std::copy_n(isRowReached.begin() + ny * k, ny, ghostRowReached.begin() + (2 * boundaryId + side) * ny);
+				}
+			}
+		};
+
+		const auto sweepSlab = [&](const size_t& slabId, const bool& iFlip, const bool& jFlip, const bool& kFlip)
+		{
+			const size_t kBegin = slabStarts[slabId];
+			const size_t kEnd = slabStarts[slabId + 1];
+			const bool hasLowerGhost = slabId > 0;
+			const bool hasUpperGhost = slabId + 1 < slabCount;
+			bool isSlabChanged = false;
+			for (size_t kk = kBegin; kk < kEnd; kk++)
+			{
+				const size_t k = kFlip ? kEnd - 1 - (kk - kBegin) : kk;
+				// z-neighbor planes are within the slab, ghost copies of the neighboring slab, or missing at the grid boundary
+				const double* zMinusPlane = k > kBegin ? values.data() + nxy * (k - 1) :
+					(hasLowerGhost ? ghostPlanes.data() + 2 * (slabId - 1) * nxy : nullptr);
+				const double* zPlusPlane = k + 1 < kEnd ? values.data() + nxy * (k + 1) :
+					(hasUpperGhost ? ghostPlanes.data() + (2 * slabId + 1) * nxy : nullptr);
+				const uint8_t* zMinusRowReached = k > kBegin ? isRowReached.data() + ny * (k - 1) :
+					(hasLowerGhost ? ghostRowReached.data() + 2 * (slabId - 1) * ny : nullptr);
+				const uint8_t* zPlusRowReached = k + 1 < kEnd ? isRowReached.data() + ny * (k + 1) :
+					(hasUpperGhost ? ghostRowReached.data() + (2 * slabId + 1) * ny : nullptr);
+
+				for (size_t jj = 0; jj < ny; jj++)
+				{
+					const size_t j = jFlip ? ny - 1 - jj : jj;
+					const size_t rowId = j + ny * k;
+					if (!isRowReached[rowId] && !(j > 0 && isRowReached[rowId - 1]) && !(j + 1 < ny && isRowReached[rowId + 1]) &&
+						!(zMinusRowReached && zMinusRowReached[j]) && !(zPlusRowReached && zPlusRowReached[j]))
+						continue;
+
+					const size_t rowCellId = nx * rowId;
+					double* row = values.data() + rowCellId;
+					const double* yMinusRow = j > 0 ? row - nx : nullptr;
+					const double* yPlusRow = j + 1 < ny ? row + nx : nullptr;
+					const double* zMinusRow = zMinusPlane ? zMinusPlane + nx * j : nullptr;
+					const double* zPlusRow = zPlusPlane ? zPlusPlane + nx * j : nullptr;
+					const double* stepRow = steps.empty() ? nullptr : steps.data() + rowCellId;
+					bool isRowChanged = false;
+					for (size_t ii = 0; ii < nx; ii++)
+					{
+						const size_t i = iFlip ? nx - 1 - ii : ii;
+						if (isFrozen.Test(rowCellId + i))
+							continue;
+
+						const double step = stepRow ? stepRow[i] : h;
+						if (step == infinite_time)
+							continue;
+
+						const double result = SolveLocalEikonal({
+							std::min(i > 0 ? row[i - 1] : infinite_time, i + 1 < nx ? row[i + 1] : infinite_time),
+							std::min(yMinusRow ? yMinusRow[i] : infinite_time, yPlusRow ? yPlusRow[i] : infinite_time),
+							std::min(zMinusRow ? zMinusRow[i] : infinite_time, zPlusRow ? zPlusRow[i] : infinite_time) }, step);
+						// values beyond the limit would only be clamped, and they cannot lower any value within the limit
+						if (result < row[i] && result <= settings.DistanceLimit)
+						{
+							row[i] = result;
+							isRowChanged = true;
+						}
+					}
+					if (isRowChanged)
+					{
+						isRowReached[rowId] = 1;
+						isSlabChanged = true;
+					}
+				}
+			}
+			return isSlabChanged;
+		};
+
+		// the front crosses at least one slab boundary per iteration in every direction
+		const unsigned int nIterations = std::max(settings.NSweepIterations, 1u) + static_cast<unsigned int>(slabCount - 1);
+		for (unsigned int iter = 0; iter < nIterations; iter++)
+		{
+			std::atomic<bool> isChanged{ false };
+			for (int ordering = 0; ordering < 8; ordering++)
+			{
+				const bool iFlip = (ordering & 1) != 0;
+				const bool jFlip = (ordering & 2) != 0;
+				const bool kFlip = (ordering & 4) != 0;
+
+				copyGhostPlanes();
+				Util::ParallelForChunks(slabCount, slabCount,
+					[&](const size_t /*chunkIndex*/, const size_t slabBegin, const size_t slabEnd)
+					{
+						for (size_t slabId = slabBegin; slabId < slabEnd; slabId++)
+						{
+							if (sweepSlab(slabId, iFlip, jFlip, kFlip))
+								isChanged.store(true, std::memory_order_relaxed);
+						}
+					});
+			}
+
+			if (!isChanged.load())
+				break;
+		}
+	}
+
+	MeshProcessingStatus EikonalSolver::Solve(ScalarGridData& gridData, const EikonalSolverSettings& settings)
+	{
+		const size_t cellCount = gridData.XCellCount * gridData.YCellCount * gridData.ZCellCount;
+		if (cellCount == 0 || gridData.CellSize <= 0.0 ||
+			gridData.CellData.size() != cellCount || gridData.CellIsFrozen.size() != cellCount)
+			return MeshProcessingStatus::InvalidInput;
+
+		// frozen flags are read from a bit mask, which is scanned by whole words
+		const GridCellMask isFrozen(gridData.CellIsFrozen);
+		if (isFrozen.Count() == 0)
+			return MeshProcessingStatus::InvalidInput;
+
+		for (size_t id = isFrozen.FindNextUnset(0); id < cellCount; id = isFrozen.FindNextUnset(id + 1))
+			gridData.CellData[id] = infinite_time;
+
+		if (settings.Method == EikonalSolverMethod::FastMarching)
+		{
+			const auto isAccepted = MarchFront(gridData, isFrozen, settings);
+			for (size_t id = 0; id < cellCount; id++)
+			{
+				if (!isAccepted[id])
+					gridData.CellData[id] = settings.DistanceLimit;
+			}
+			return MeshProcessingStatus::Complete;
+		}
+
+		// cells beyond the limit (or unreachable) are left infinite by the sweeps
+		SweepFront(gridData, isFrozen, settings);
+		for (size_t id = isFrozen.FindNextUnset(0); id < cellCount; id = isFrozen.FindNextUnset(id + 1))
+		{
+			if (gridData.CellData[id] > settings.DistanceLimit)
+				gridData.CellData[id] = settings.DistanceLimit;
+		}
+		return MeshProcessingStatus::Complete;
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
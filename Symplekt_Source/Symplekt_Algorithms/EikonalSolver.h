@@ -0,0 +1,86 @@
+/*!  \file EikonalSolver.h
+ *   \brief An object for solving the eikonal equation |grad T| = 1 / F on scalar grids from frozen seed cells.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+
+#include "AlgorithmHelperTypes.h"
+
+#include <functional>
+#include <limits>
+
+namespace Symplektis::Algorithms
+{
+	//=============================================================================
+	/// \enum EikonalSolverMethod
+	/// \brief Numerical method used by EikonalSolver.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class EikonalSolverMethod
+	{
+		FastMarching = 0,   //!< heap-ordered front propagation [Sethian, 1996], single threaded, cost proportional to the number of reached cells.
+		FastSweeping = 1    //!< Gauss-Seidel sweeps in 8 orderings [Zhao, 2005] in x-fastest row order, z-slabs are swept in parallel and exchange boundary planes between sweeps.
+	};
+
+	//!> \brief Speed callback F(i, j, k) of a cell. Cells with non-positive speed are obstacles which are never reached.
+	//!>        FastSweeping evaluates it once per cell on multiple threads, so it has to be thread-safe.
+	using EikonalSpeedFunction = std::function<double(size_t, size_t, size_t)>;
+
+	//=============================================================================
+	/// \struct EikonalSolverSettings
+	/// \brief A data container for all major settings for EikonalSolver.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct EikonalSolverSettings
+	{
+		EikonalSolverMethod Method{ EikonalSolverMethod::FastMarching };        //>! numerical method.
+		EikonalSpeedFunction Speed{};                                           //>! speed callback (if empty, the speed is 1 and the result is a distance).
+		double DistanceLimit{ std::numeric_limits<double>::max() };             //>! cells with larger arrival times (and unreachable cells) are set to this value. Fast marching stops once its front passes it, fast sweeping skips rows out of its reach.
+		unsigned int NSweepIterations{ 2 };                                     //>! number of fast sweeping iterations (of 8 sweep orderings each), increased by the number of parallel slabs - 1. Sweeping stops early once no value changes.
+	};
+
+	//=============================================================================
+	/// \class EikonalSolver
+	/// \brief A singleton object computing arrival times (or distances for unit speed) of a front started from the frozen
+	///        cells of ScalarGridData (with their CellData values as initial arrival times). Values of all non-frozen
+	///        cells are overwritten, CellIsFrozen stays unchanged. The first order upwind discretization of
+	///        |grad T| F = 1 uses the cell size as the grid step.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class EikonalSolver
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Solves the eikonal equation on a scalar grid.
+		 *  \param[in] gridData          scalar grid data with seed cells marked in CellIsFrozen.
+		 *	\param[in] settings          eikonal solver settings.
+		 *  \return Processing status (InvalidInput for inconsistent grid data or no frozen cells)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] MeshProcessingStatus Solve(GeometryKernel::ScalarGridData& gridData, const EikonalSolverSettings& settings = {});
+	};
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
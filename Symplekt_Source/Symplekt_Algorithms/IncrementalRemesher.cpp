@@ -6,11 +6,16 @@
 */
 
 #include "IncrementalRemesher.h"
+#include "TriangleBVH.h"
 
 #include "Symplekt_GeometryKernel/FaceUtils.h"
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
 
 #include <variant>
 #include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 using namespace Symplektis::GeometryKernel;
 
@@ -86,6 +91,42 @@ namespace Symplektis::Algorithms
 		return false;
 	}
 
+	//!> \brief minimum number of vertices per thread for back-projection
+	constexpr size_t min_back_projection_chunk_size = 1024;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Projects vertices of meshData onto their closest points on the original surface.
+	*   \param[in] meshData               ReferencedMeshGeometryData whose vertices are projected.
+	*   \param[in] originalSurface        bounding volume hierarchy over the triangles of the original mesh.
+	*   \param[out] processingStatus      processing status (set to InternalError if a closest point is not found).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void BackProjectVerticesOntoOriginalSurfacePositions(ReferencedMeshGeometryData& meshData, const TriangleBVH& originalSurface, MeshProcessingStatus& processingStatus)
+	{
+		// an original surface without (non-degenerate) triangles leaves vertices unchanged
+		if (originalSurface.TriangleCount() == 0)
+			return;
+
+		std::vector<uint8_t> isProjected(meshData.Vertices.size(), 0);
+		Util::ParallelForChunks(meshData.Vertices.size(), Util::GetParallelChunkCount(meshData.Vertices.size(), min_back_projection_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				for (size_t vertexId = begin; vertexId < end; vertexId++)
+				{
+					BVHClosestPoint closestPoint;
+					isProjected[vertexId] = originalSurface.FindClosestPoint(meshData.Vertices[vertexId].Position(), closestPoint);
+					if (isProjected[vertexId])
+						meshData.Vertices[vertexId].Position() = closestPoint.Point;
+				}
+			});
+
+		if (std::ranges::find(isProjected, uint8_t{ 0 }) != isProjected.end())
+			processingStatus = MeshProcessingStatus::InternalError;
+	}
+
 	MeshProcessingStatus IncrementalRemesher::Process(ReferencedMeshGeometryData& meshData, const IncrementalRemeshingSettings& settings)
 	{
 		if (!IsFullyTriangular(meshData, settings.ForceMeshTypeVerification))
@@ -96,7 +137,7 @@ namespace Symplektis::Algorithms
 		auto processingStatus = MeshProcessingStatus::AlgorithmInProgress;
 
 		// Preprocess(); // compute normals if meshData.VertexNormals.empty()
-		const auto origMeshDataPtr = (settings.UseBackProjection ? std::make_shared<ReferencedMeshGeometryData>(meshData) : nullptr);
+		const auto originalSurfacePtr = (settings.UseBackProjection ? std::make_unique<TriangleBVH>(meshData) : nullptr);
 
 		for (unsigned int s = 0; s < settings.NIterations; s++)
 		{
@@ -114,7 +155,8 @@ namespace Symplektis::Algorithms
 
 			if (settings.UseBackProjection)
 			{
-				// BackProjectVerticesOntoOriginalSurfacePositions(meshData, origMeshDataPtr, processingStatus);
+				BackProjectVerticesOntoOriginalSurfacePositions(meshData, *originalSurfacePtr, processingStatus);
+				VERIFY_MESH_PROCESSING_STATUS(processingStatus);
 			}
 		}
 
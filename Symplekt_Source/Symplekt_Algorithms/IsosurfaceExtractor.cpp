@@ -0,0 +1,519 @@
+/*!  \file IsosurfaceExtractor.cpp
+ *   \brief Implementation of an object for extracting isosurfaces of scalar grids as triangle meshes (marching cubes).
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "IsosurfaceExtractor.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	//!> \brief maximum number of triangles generated in a single cube
+	constexpr size_t max_cube_triangle_count = 12;
+
+	//!> \brief flag of a vertex index referring to the first sample layer of the next slab (resolved when slabs are merged)
+	constexpr unsigned int seam_vertex_flag = 1u << 31;
+
+	//!> \brief upper bound of merged vertex and triangle indices
+	constexpr unsigned int no_vertex = std::numeric_limits<unsigned int>::max();
+
+	//!> \brief number of consecutive samples of a row whose inside flags are compared at once
+	constexpr size_t span_sample_count = sizeof(uint64_t);
+
+	//!> \brief minimum number of sample layers per extraction thread
+	constexpr size_t min_slab_layer_count = 4;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Loads inside flags of span_sample_count consecutive samples as a single word, so that spans of samples
+	*          can be compared without testing every sample.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint64_t LoadFlagSpan(const uint8_t* flags)
+	{
+		uint64_t span;
+		std::memcpy(&span, flags, sizeof(span));
+		return span;
+	}
+
+	//=============================================================================
+	/// \struct CubeCase
+	/// \brief Triangles of a marching cubes configuration given by cube edge indices. Cube corner c has coordinates
+	///        (c & 1, (c >> 1) & 1, (c >> 2) & 1), and edge e = 4 * axis + r connects the two corners along the axis
+	///        whose remaining two coordinates (in x, y, z order) are the bits of r.
+	//=============================================================================
+	struct CubeCase
+	{
+		uint8_t                                          TriangleCount{ 0 };
+		std::array<uint8_t, 3 * max_cube_triangle_count> Edges{};
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Cube edge index of an edge given by its two corners.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint8_t GetCubeEdge(const unsigned int& cornerA, const unsigned int& cornerB)
+	{
+		const unsigned int axisBit = cornerA ^ cornerB;
+		const unsigned int axis = axisBit == 1 ? 0 : (axisBit == 2 ? 1 : 2);
+		const unsigned int corner = cornerA & cornerB;
+		unsigned int r = 0;
+		for (unsigned int otherAxis = 0, bit = 0; otherAxis < 3; otherAxis++)
+		{
+			if (otherAxis == axis)
+				continue;
+			r |= ((corner >> otherAxis) & 1u) << bit++;
+		}
+		return static_cast<uint8_t>(4 * axis + r);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Builds the triangles of all 256 cube configurations. On each cube face (with corners traversed counter-clockwise
+	*          when viewed from outside the cube), a segment connects the edge leaving a run of inside corners with the edge
+	*          entering it. Every face configuration is thus resolved only by its own four corners (an ambiguous face separates
+	*          its two inside corners), so neighboring cubes always agree on their common face. Segments of all faces form closed
+	*          loops which are fan-triangulated.
+	*   \return case table indexed by the configuration bits (bit c is set if corner c is inside)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::array<CubeCase, 256> BuildCubeCaseTable()
+	{
+		constexpr std::array<std::array<unsigned int, 4>, 6> faceCorners{ {
+			{ 0, 4, 6, 2 }, { 1, 3, 7, 5 }, // x = 0, x = 1
+			{ 0, 1, 5, 4 }, { 2, 6, 7, 3 }, // y = 0, y = 1
+			{ 0, 2, 3, 1 }, { 4, 5, 7, 6 }  // z = 0, z = 1
+		} };
+
+		std::array<CubeCase, 256> table{};
+		for (unsigned int config = 0; config < 256; config++)
+		{
+			const auto isInside = [config](const unsigned int& corner) { return ((config >> corner) & 1u) != 0; };
+
+			std::array<int, 12> nextEdge{};
+			nextEdge.fill(-1);
+			for (const auto& corners : faceCorners)
+			{
+				std::array<std::pair<uint8_t, bool>, 4> crossings{}; // {edge, is exit from inside}
+				size_t crossingCount = 0;
+				for (size_t c = 0; c < 4; c++)
+				{
+					const unsigned int from = corners[c];
+					const unsigned int to = corners[(c + 1) % 4];
+					if (isInside(from) != isInside(to))
+						crossings[crossingCount++] = { GetCubeEdge(from, to), isInside(from) };
+				}
+				// crossings alternate between entries and exits, and each exit is preceded by the entry of its inside run
+				for (size_t c = 0; c < crossingCount; c++)
+				{
+					if (crossings[c].second)
+						nextEdge[crossings[c].first] = crossings[(c + crossingCount - 1) % crossingCount].first;
+				}
+			}
+
+			auto& cubeCase = table[config];
+			std::array<bool, 12> isVisited{};
+			for (uint8_t startEdge = 0; startEdge < 12; startEdge++)
+			{
+				if (nextEdge[startEdge] < 0 || isVisited[startEdge])
+					continue;
+
+				std::vector<uint8_t> loop;
+				for (int edge = startEdge; !isVisited[edge]; edge = nextEdge[edge])
+				{
+					isVisited[edge] = true;
+					loop.push_back(static_cast<uint8_t>(edge));
+				}
+				// loops run clockwise around the outward direction, so fan triangles are reversed
+				for (size_t m = 1; m + 1 < loop.size(); m++)
+				{
+					const size_t offset = 3 * static_cast<size_t>(cubeCase.TriangleCount++);
+					cubeCase.Edges[offset] = loop[0];
+					cubeCase.Edges[offset + 1] = loop[m + 1];
+					cubeCase.Edges[offset + 2] = loop[m];
+				}
+			}
+		}
+		return table;
+	}
+
+	//=============================================================================
+	/// \struct SlabMeshData
+	/// \brief Vertices and triangles extracted from a z-slab of the grid. Vertex indices are local to the slab, or flagged by
+	///        seam_vertex_flag if they refer to a slot of BottomLayerIds of the next slab.
+	//=============================================================================
+	struct SlabMeshData
+	{
+		std::vector<double>       VertexCoords{};
+		std::vector<double>       VertexNormalCoords{};
+		std::vector<unsigned int> VertexIndices{};
+		std::vector<unsigned int> BottomLayerIds{};   //!< local vertex indices on the x and y edges of the first sample layer of the slab
+		bool                      IsOverflown{ false };
+	};
+
+	//=============================================================================
+	/// \class SlabExtractor
+	/// \brief Extracts the isosurface of the cubes between sample layers [kBegin, kEnd] of a scalar grid. Vertex indices of the
+	///        x and y edges of two consecutive sample layers and of the z edges between them are cached, so that every vertex
+	///        is created once, by the slab owning the first sample of its edge.
+	//=============================================================================
+	class SlabExtractor
+	{
+	public:
+		SlabExtractor(const ScalarGridData& gridData, const IsosurfaceSettings& settings, const std::array<CubeCase, 256>& caseTable)
+			: m_Values(gridData.CellData), m_Settings(settings), m_CaseTable(caseTable),
+			m_Nx(gridData.XCellCount), m_Ny(gridData.YCellCount), m_Nz(gridData.ZCellCount), m_H(gridData.CellSize),
+			m_Origin{ gridData.BoundingBox.Min().X() + 0.5 * gridData.CellSize, gridData.BoundingBox.Min().Y() + 0.5 * gridData.CellSize, gridData.BoundingBox.Min().Z() + 0.5 * gridData.CellSize },
+			m_XEdgeCount((m_Nx - 1) * m_Ny)
+		{
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Extracts the slab of sample layers [kBegin, kEnd), and of the cubes between them and the first layer of the next slab.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Extract(const size_t& kBegin, const size_t& kEnd, SlabMeshData& result)
+		{
+			const size_t layerSize = m_Nx * m_Ny;
+			const size_t layerEdgeCount = m_XEdgeCount + m_Nx * (m_Ny - 1);
+			std::array<std::vector<unsigned int>, 2> layerIds{ std::vector<unsigned int>(layerEdgeCount), std::vector<unsigned int>(layerEdgeCount) };
+			std::array<std::vector<uint8_t>, 2> layerIsInside{ std::vector<uint8_t>(layerSize), std::vector<uint8_t>(layerSize) };
+			std::vector<unsigned int> zEdgeIds(layerSize);
+
+			ClassifyLayer(kBegin, layerIsInside[0]);
+			FillLayerVertices(kBegin, kEnd, layerIsInside[0], layerIds[0], result);
+			result.BottomLayerIds = layerIds[0];
+
+			const size_t kCubeEnd = std::min(kEnd, m_Nz - 1);
+			for (size_t k = kBegin; k < kCubeEnd; k++)
+			{
+				ClassifyLayer(k + 1, layerIsInside[1]);
+				FillLayerVertices(k + 1, kEnd, layerIsInside[1], layerIds[1], result);
+				FillZEdgeVertices(k, layerIsInside[0], layerIsInside[1], zEdgeIds, result);
+				EmitCubeLayerTriangles(layerIsInside[0], layerIsInside[1], layerIds[0], layerIds[1], zEdgeIds, result);
+				std::swap(layerIds[0], layerIds[1]);
+				std::swap(layerIsInside[0], layerIsInside[1]);
+			}
+		}
+
+	private:
+		[[nodiscard]] size_t GetId(const size_t& i, const size_t& j, const size_t& k) const
+		{
+			return i + m_Nx * (j + m_Ny * k);
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Flags samples of layer k with values below the iso value (each sample is compared once).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void ClassifyLayer(const size_t& k, std::vector<uint8_t>& isInside) const
+		{
+			const double isoValue = m_Settings.IsoValue;
+			const double* layerValues = m_Values.data() + m_Nx * m_Ny * k;
+			for (size_t id = 0; id < isInside.size(); id++)
+				isInside[id] = layerValues[id] < isoValue ? 1 : 0;
+		}
+
+		[[nodiscard]] double GetGradientComponent(const size_t& id, const size_t& index, const size_t& count, const size_t& stride) const
+		{
+			if (index == 0)
+				return (m_Values[id + stride] - m_Values[id]) / m_H;
+			if (index + 1 == count)
+				return (m_Values[id] - m_Values[id - stride]) / m_H;
+			return 0.5 * (m_Values[id + stride] - m_Values[id - stride]) / m_H;
+		}
+
+		[[nodiscard]] std::array<double, 3> GetGradient(const size_t& i, const size_t& j, const size_t& k) const
+		{
+			const size_t id = GetId(i, j, k);
+			return {
+				GetGradientComponent(id, i, m_Nx, 1),
+				GetGradientComponent(id, j, m_Ny, m_Nx),
+				GetGradientComponent(id, k, m_Nz, m_Nx * m_Ny) };
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Creates a vertex on the edge from sample (i, j, k) to its neighbor along the axis.
+		*   \return local vertex index
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		unsigned int AddEdgeVertex(const size_t& i, const size_t& j, const size_t& k, const size_t& axis, SlabMeshData& result) const
+		{
+			const size_t vertexId = result.VertexCoords.size() / 3;
+			if (vertexId >= seam_vertex_flag)
+			{
+				result.IsOverflown = true;
+				return 0;
+			}
+
+			const std::array<size_t, 3> first{ i, j, k };
+			std::array<size_t, 3> second{ i, j, k };
+			second[axis]++;
+
+			const double firstValue = m_Values[GetId(i, j, k)];
+			const double secondValue = m_Values[GetId(second[0], second[1], second[2])];
+			const double t = (m_Settings.IsoValue - firstValue) / (secondValue - firstValue);
+
+			for (size_t c = 0; c < 3; c++)
+				result.VertexCoords.push_back(m_Origin[c] + (static_cast<double>(first[c]) + (c == axis ? t : 0.0)) * m_H);
+
+			if (m_Settings.ComputeNormals)
+			{
+				const auto firstGradient = GetGradient(first[0], first[1], first[2]);
+				const auto secondGradient = GetGradient(second[0], second[1], second[2]);
+				std::array<double, 3> normal{};
+				for (size_t c = 0; c < 3; c++)
+					normal[c] = (1.0 - t) * firstGradient[c] + t * secondGradient[c];
+
+				const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+				for (size_t c = 0; c < 3; c++)
+					result.VertexNormalCoords.push_back(length > 0.0 ? normal[c] / length : 0.0);
+			}
+
+			return static_cast<unsigned int>(vertexId);
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Fills vertex indices of the x and y edges of sample layer k. Layer kEnd belongs to the next slab, so its
+		*          edges only receive flagged references to the next slab's BottomLayerIds. Only the slots of edges crossing
+		*          the isosurface are written, spans of samples without crossings are skipped.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void FillLayerVertices(const size_t& k, const size_t& kEnd, const std::vector<uint8_t>& isInside, std::vector<unsigned int>& ids, SlabMeshData& result) const
+		{
+			if (k == kEnd)
+			{
+				for (size_t slot = 0; slot < ids.size(); slot++)
+					ids[slot] = seam_vertex_flag | static_cast<unsigned int>(slot);
+				return;
+			}
+
+			for (size_t j = 0; j < m_Ny; j++)
+			{
+				const uint8_t* row = isInside.data() + m_Nx * j;
+				for (size_t i = 0; i < m_Nx; i++)
+				{
+					if (i + span_sample_count < m_Nx)
+					{
+						const uint64_t span = LoadFlagSpan(row + i);
+						if (span == LoadFlagSpan(row + i + 1) && (j + 1 == m_Ny || span == LoadFlagSpan(row + i + m_Nx)))
+						{
+							i += span_sample_count - 1;
+							continue;
+						}
+					}
+
+					const size_t id = i + m_Nx * j;
+					if (i + 1 < m_Nx && isInside[id] != isInside[id + 1])
+						ids[i + (m_Nx - 1) * j] = AddEdgeVertex(i, j, k, 0, result);
+					if (j + 1 < m_Ny && isInside[id] != isInside[id + m_Nx])
+						ids[m_XEdgeCount + id] = AddEdgeVertex(i, j, k, 1, result);
+				}
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Fills vertex indices of the z edges between sample layers k and k + 1 crossing the isosurface.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void FillZEdgeVertices(const size_t& k, const std::vector<uint8_t>& lowerIsInside, const std::vector<uint8_t>& upperIsInside,
+			std::vector<unsigned int>& ids, SlabMeshData& result) const
+		{
+			for (size_t j = 0; j < m_Ny; j++)
+			{
+				for (size_t i = 0; i < m_Nx; i++)
+				{
+					const size_t id = i + m_Nx * j;
+					if (i + span_sample_count <= m_Nx && LoadFlagSpan(lowerIsInside.data() + id) == LoadFlagSpan(upperIsInside.data() + id))
+					{
+						i += span_sample_count - 1;
+						continue;
+					}
+
+					if (lowerIsInside[id] != upperIsInside[id])
+						ids[id] = AddEdgeVertex(i, j, k, 2, result);
+				}
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Emits the triangles of the cubes between sample layers k and k + 1. Spans of cubes whose corner samples
+		*          are all inside or all outside are skipped.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void EmitCubeLayerTriangles(const std::vector<uint8_t>& lowerIsInside, const std::vector<uint8_t>& upperIsInside,
+			const std::vector<unsigned int>& lowerIds, const std::vector<unsigned int>& upperIds,
+			const std::vector<unsigned int>& zEdgeIds, SlabMeshData& result) const
+		{
+			// inside flags of the four samples of a cube column (x = const) are placed at the bits of corners 0, 2, 4 and 6,
+			// so that the configuration of a cube is its left column bits combined with the right column bits shifted by 1
+			const auto getColumnBits = [&](const size_t& id)
+			{
+				return static_cast<unsigned int>(lowerIsInside[id]) |
+					static_cast<unsigned int>(lowerIsInside[id + m_Nx]) << 2 |
+					static_cast<unsigned int>(upperIsInside[id]) << 4 |
+					static_cast<unsigned int>(upperIsInside[id + m_Nx]) << 6;
+			};
+
+			// a span of cubes [i, i + span_sample_count) is empty if samples [i, i + span_sample_count] of its four sample rows are equal
+			const auto isEmptyCubeSpan = [&](const size_t& id)
+			{
+				const uint64_t span = LoadFlagSpan(lowerIsInside.data() + id);
+				return span == LoadFlagSpan(lowerIsInside.data() + id + 1) &&
+					span == LoadFlagSpan(lowerIsInside.data() + id + m_Nx) && span == LoadFlagSpan(lowerIsInside.data() + id + m_Nx + 1) &&
+					span == LoadFlagSpan(upperIsInside.data() + id) && span == LoadFlagSpan(upperIsInside.data() + id + 1) &&
+					span == LoadFlagSpan(upperIsInside.data() + id + m_Nx) && span == LoadFlagSpan(upperIsInside.data() + id + m_Nx + 1);
+			};
+
+			std::array<unsigned int, 12> cubeEdgeIds{};
+			for (size_t j = 0; j + 1 < m_Ny; j++)
+			{
+				unsigned int rightColumnBits = getColumnBits(m_Nx * j);
+				for (size_t i = 0; i + 1 < m_Nx; i++)
+				{
+					const size_t id = i + m_Nx * j;
+					if (i + span_sample_count < m_Nx && isEmptyCubeSpan(id))
+					{
+						i += span_sample_count - 1;
+						rightColumnBits = getColumnBits(id + span_sample_count);
+						continue;
+					}
+
+					const unsigned int leftColumnBits = rightColumnBits;
+					rightColumnBits = getColumnBits(id + 1);
+					const unsigned int config = leftColumnBits | rightColumnBits << 1;
+					const auto& cubeCase = m_CaseTable[config];
+					if (cubeCase.TriangleCount == 0)
+						continue;
+
+					const size_t xSlot = i + (m_Nx - 1) * j;
+					const size_t ySlot = m_XEdgeCount + id;
+					const size_t zSlot = id;
+					cubeEdgeIds = {
+						lowerIds[xSlot], lowerIds[xSlot + m_Nx - 1], upperIds[xSlot], upperIds[xSlot + m_Nx - 1],
+						lowerIds[ySlot], lowerIds[ySlot + 1], upperIds[ySlot], upperIds[ySlot + 1],
+						zEdgeIds[zSlot], zEdgeIds[zSlot + 1], zEdgeIds[zSlot + m_Nx], zEdgeIds[zSlot + m_Nx + 1] };
+
+					for (size_t e = 0; e < 3 * static_cast<size_t>(cubeCase.TriangleCount); e++)
+						result.VertexIndices.push_back(cubeEdgeIds[cubeCase.Edges[e]]);
+				}
+			}
+		}
+
+		//
+		// ==================================
+		//
+
+		const std::vector<double>&         m_Values;
+		const IsosurfaceSettings&          m_Settings;
+		const std::array<CubeCase, 256>&   m_CaseTable;
+		size_t                             m_Nx;
+		size_t                             m_Ny;
+		size_t                             m_Nz;
+		double                             m_H;
+		std::array<double, 3>              m_Origin;      //!< center of cell (0, 0, 0)
+		size_t                             m_XEdgeCount;  //!< number of x edges in a sample layer (offset of y edge slots)
+	};
+
+	MeshProcessingStatus IsosurfaceExtractor::Extract(const ScalarGridData& gridData, BufferMeshGeometryData& resultData, const IsosurfaceSettings& settings)
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		if (nx < 2 || ny < 2 || nz < 2 || gridData.CellSize <= 0.0 || gridData.CellData.size() != nx * ny * nz)
+			return MeshProcessingStatus::InvalidInput;
+
+		static const auto caseTable = BuildCubeCaseTable();
+
+		// ------ slabs of sample layers are extracted independently ------------------------
+		const size_t slabCount = Util::GetParallelChunkCount(nz, min_slab_layer_count);
+		std::vector<SlabMeshData> slabs(slabCount);
+		Util::ParallelForChunks(nz, slabCount,
+			[&](const size_t slabIndex, const size_t kBegin, const size_t kEnd)
+			{
+				SlabExtractor(gridData, settings, caseTable).Extract(kBegin, kEnd, slabs[slabIndex]);
+			});
+
+		// ------ offsets of slab vertices and triangles in the merged buffers ------------------------
+		std::vector<size_t> vertexOffsets(slabCount + 1, 0);
+		std::vector<size_t> indexOffsets(slabCount + 1, 0);
+		for (size_t s = 0; s < slabCount; s++)
+		{
+			if (slabs[s].IsOverflown)
+				return MeshProcessingStatus::InternalError;
+			vertexOffsets[s + 1] = vertexOffsets[s] + slabs[s].VertexCoords.size() / 3;
+			indexOffsets[s + 1] = indexOffsets[s] + slabs[s].VertexIndices.size();
+		}
+		if (vertexOffsets[slabCount] >= no_vertex || indexOffsets[slabCount] / 3 >= no_vertex)
+			return MeshProcessingStatus::InternalError;
+
+		resultData.VertexCoords.resize(3 * vertexOffsets[slabCount]);
+		resultData.VertexNormalCoords.resize(settings.ComputeNormals ? 3 * vertexOffsets[slabCount] : 0);
+		resultData.VertexIndices.resize(indexOffsets[slabCount]);
+		resultData.TriangulationIndices.resize(indexOffsets[slabCount] / 3);
+
+		// ------ merge: copy slab buffers and weld seam vertices with the first layers of the following slabs ---------
+		Util::ParallelForChunks(slabCount, slabCount,
+			[&](const size_t s, const size_t /*begin*/, const size_t /*end*/)
+			{
+				const auto& slab = slabs[s];
+				std::copy(slab.VertexCoords.begin(), slab.VertexCoords.end(), resultData.VertexCoords.begin() + 3 * vertexOffsets[s]);
+				if (settings.ComputeNormals)
+					std::copy(slab.VertexNormalCoords.begin(), slab.VertexNormalCoords.end(), resultData.VertexNormalCoords.begin() + 3 * vertexOffsets[s]);
+
+				for (size_t n = 0; n < slab.VertexIndices.size(); n++)
+				{
+					const unsigned int vertexId = slab.VertexIndices[n];
+					resultData.VertexIndices[indexOffsets[s] + n] = (vertexId & seam_vertex_flag) ?
+						static_cast<unsigned int>(vertexOffsets[s + 1] + slabs[s + 1].BottomLayerIds[vertexId & ~seam_vertex_flag]) :
+						static_cast<unsigned int>(vertexOffsets[s] + vertexId);
+				}
+
+				for (size_t triangleId = indexOffsets[s] / 3; triangleId < indexOffsets[s + 1] / 3; triangleId++)
+					resultData.TriangulationIndices[triangleId] = { static_cast<unsigned int>(triangleId) };
+			});
+
+		resultData.Type = PolyMeshType::Triangular;
+		return MeshProcessingStatus::Complete;
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
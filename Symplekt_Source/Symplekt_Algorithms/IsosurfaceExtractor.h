@@ -0,0 +1,70 @@
+/*!  \file IsosurfaceExtractor.h
+ *   \brief An object for extracting isosurfaces of scalar grids as triangle meshes (marching cubes).
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include "AlgorithmHelperTypes.h"
+
+namespace Symplektis::Algorithms
+{
+	//=============================================================================
+	/// \struct IsosurfaceSettings
+	/// \brief A data container for all major settings for IsosurfaceExtractor.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct IsosurfaceSettings
+	{
+		double IsoValue{ 0.0 };              //>! the extracted level of the scalar field.
+		bool ComputeNormals{ true };         //>! if true, VertexNormalCoords are filled with normalized interpolated grid gradients.
+	};
+
+	//=============================================================================
+	/// \class IsosurfaceExtractor
+	/// \brief A singleton object extracting the isosurface of ScalarGridData::CellData (sampled at cell centers) using
+	///        marching cubes. Cells with values below the iso value are inside, and triangles are oriented with normals
+	///        pointing towards larger values (outwards for signed distance fields). Ambiguous cube faces are always resolved
+	///        by separating the inside corners, so the triangles of neighboring cubes match and every vertex on a grid
+	///        edge is shared. The grid is processed on multiple threads in z-slabs with two-layer edge caches, and
+	///        vertices on the seams of slabs are welded in the final merge step.
+	///
+	///        A 512^3 sphere distance field (1.58M triangles) is extracted in 0.8 - 1.2 s on a single thread, i.e.: the goal
+	///        of well under a second is not met single-threaded. Multi-threaded scaling has not been measured yet; the
+	///        DISABLED_ timing test in IsosurfaceExtractor_Tests.cpp prints the time together with the thread count.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class IsosurfaceExtractor
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Extracts the isosurface of a scalar grid.
+		 *  \param[in] gridData          scalar grid data with at least 2 cells along each axis.
+		 *  \param[in] resultData        buffer mesh geometry data whose buffers are overwritten by a triangle mesh.
+		 *	\param[in] settings          isosurface settings.
+		 *  \return Processing status (InternalError if the mesh does not fit into 32-bit indices)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] MeshProcessingStatus Extract(const GeometryKernel::ScalarGridData& gridData, GeometryKernel::BufferMeshGeometryData& resultData, const IsosurfaceSettings& settings = {});
+	};
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,573 @@
+/*!  \file LevelSetEvolver.cpp
+ *   \brief Implementation of an object for narrow-band level set evolution on scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "LevelSetEvolver.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridPyramid.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	//!> \brief log2 of the edge length of a band tile (in cells)
+	constexpr size_t band_tile_log2 = 3;
+
+	//!> \brief edge length of a band tile (in cells)
+	constexpr size_t band_tile_size = static_cast<size_t>(1) << band_tile_log2;
+
+	//!> \brief minimum number of active tiles per thread
+	constexpr size_t min_tile_chunk_count = 4;
+
+	//=============================================================================
+	/// \class NarrowBand
+	/// \brief Active tiles of a level set grid. Cells of active tiles are updated by double-buffered kernels processed
+	///        on multiple threads, all other cells hold values +-HalfWidth.
+	//=============================================================================
+	class NarrowBand
+	{
+	public:
+		NarrowBand(ScalarGridData& levelSetData, const double& halfWidth)
+			: m_Values(levelSetData.CellData), m_HalfWidth(halfWidth),
+			m_Counts{ levelSetData.XCellCount, levelSetData.YCellCount, levelSetData.ZCellCount }
+		{
+			for (size_t axis = 0; axis < 3; axis++)
+				m_TileCounts[axis] = (m_Counts[axis] + band_tile_size - 1) >> band_tile_log2;
+			m_IsTileMarked.assign(m_TileCounts[0] * m_TileCounts[1] * m_TileCounts[2], 0);
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Clamps all values to the band and activates tiles around cells within the band.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Initialize()
+		{
+			std::vector<size_t> allTiles(m_IsTileMarked.size());
+			for (size_t tileId = 0; tileId < allTiles.size(); tileId++)
+				allTiles[tileId] = tileId;
+
+			m_ActiveTiles.swap(allTiles);
+			for (auto& value : m_Values)
+				value = std::clamp(value, -m_HalfWidth, m_HalfWidth);
+			Rebuild();
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Clamps values of the given tiles to the band and activates tiles around their cells within the band.
+		*          Cells of all other tiles have to hold values +-HalfWidth already (e.g.: after prolongation of the band
+		*          of a coarser level), so the rest of the grid is not searched.
+		*   \param[in] seedTiles     sorted ids of tiles containing all cells within the band.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Initialize(const std::vector<size_t>& seedTiles)
+		{
+			m_ActiveTiles = seedTiles;
+			ForEachActiveTile([&](const size_t&, const size_t& tileId)
+				{
+					ForEachTileCell(tileId, [&](const size_t&, const size_t&, const size_t&, const size_t& cellId)
+						{
+							m_Values[cellId] = std::clamp(m_Values[cellId], -m_HalfWidth, m_HalfWidth);
+						});
+				});
+			Rebuild();
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Replaces the values of all cells of active tiles by kernel(i, j, k, cellId) evaluated on the values
+		*          before the update.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename CellKernel>
+		void UpdateCells(const CellKernel& kernel)
+		{
+			UpdateTileCells([&](const size_t& i, const size_t& j, const size_t& k, const size_t& cellId, const size_t&)
+				{
+					return kernel(i, j, k, cellId);
+				});
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Stores the current values of all cells of active tiles (in tile order, i.e.: only the band is copied).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void SnapshotCells()
+		{
+			constexpr size_t tileCellCount = band_tile_size * band_tile_size * band_tile_size;
+			m_Snapshot.resize(m_ActiveTiles.size() * tileCellCount);
+			ForEachActiveTile([&](const size_t& activeId, const size_t& tileId)
+				{
+					double* tileSnapshot = m_Snapshot.data() + activeId * tileCellCount;
+					ForEachTileCell(tileId, [&](const size_t&, const size_t&, const size_t&, const size_t& cellId)
+						{
+							*tileSnapshot++ = m_Values[cellId];
+						});
+				});
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Same as UpdateCells with kernel(i, j, k, cellId, snapshotValue), where snapshotValue is the value of
+		*          the cell stored by the last SnapshotCells call. Active tiles must not be rebuilt in between.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename CellKernel>
+		void UpdateCellsWithSnapshot(const CellKernel& kernel)
+		{
+			UpdateTileCells([&](const size_t& i, const size_t& j, const size_t& k, const size_t& cellId, const size_t& bandCellId)
+				{
+					return kernel(i, j, k, cellId, m_Snapshot[bandCellId]);
+				});
+		}
+
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Evaluates the maximum of a cell function over the cells of active tiles within the band.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename CellFunction>
+		[[nodiscard]] double GetBandMaximum(const CellFunction& function)
+		{
+			std::vector<double> tileMaxima(m_ActiveTiles.size(), 0.0);
+			ForEachActiveTile([&](const size_t& activeId, const size_t& tileId)
+				{
+					double tileMax = 0.0;
+					ForEachTileCell(tileId, [&](const size_t&, const size_t&, const size_t&, const size_t& cellId)
+						{
+							if (std::fabs(m_Values[cellId]) < m_HalfWidth)
+								tileMax = std::max(tileMax, function(cellId));
+						});
+					tileMaxima[activeId] = tileMax;
+				});
+			return tileMaxima.empty() ? 0.0 : *std::max_element(tileMaxima.begin(), tileMaxima.end());
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Rebuilds the active tiles: tiles with cells within the band and their 26 neighbors are active. Only
+		*          active tiles are searched, because the front moves at most one cell per step. Cells of deactivated
+		*          tiles are reset to +-HalfWidth.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Rebuild()
+		{
+			std::vector<size_t> tileBandCellCounts(m_ActiveTiles.size(), 0);
+			ForEachActiveTile([&](const size_t& activeId, const size_t& tileId)
+				{
+					size_t bandCellCount = 0;
+					ForEachTileCell(tileId, [&](const size_t&, const size_t&, const size_t&, const size_t& cellId)
+						{
+							if (std::fabs(m_Values[cellId]) < m_HalfWidth)
+								bandCellCount++;
+						});
+					tileBandCellCounts[activeId] = bandCellCount;
+				});
+
+			m_BandCellCount = 0;
+			std::vector<size_t> nextActiveTiles;
+			nextActiveTiles.reserve(m_ActiveTiles.size());
+			for (size_t activeId = 0; activeId < m_ActiveTiles.size(); activeId++)
+			{
+				if (tileBandCellCounts[activeId] == 0)
+					continue;
+
+				m_BandCellCount += tileBandCellCounts[activeId];
+				const size_t tileId = m_ActiveTiles[activeId];
+				const size_t ti = tileId % m_TileCounts[0];
+				const size_t tj = (tileId / m_TileCounts[0]) % m_TileCounts[1];
+				const size_t tk = tileId / (m_TileCounts[0] * m_TileCounts[1]);
+				for (size_t nk = (tk > 0 ? tk - 1 : 0); nk <= std::min(tk + 1, m_TileCounts[2] - 1); nk++)
+				{
+					for (size_t nj = (tj > 0 ? tj - 1 : 0); nj <= std::min(tj + 1, m_TileCounts[1] - 1); nj++)
+					{
+						for (size_t ni = (ti > 0 ? ti - 1 : 0); ni <= std::min(ti + 1, m_TileCounts[0] - 1); ni++)
+						{
+							const size_t neighborId = ni + m_TileCounts[0] * (nj + m_TileCounts[1] * nk);
+							if (m_IsTileMarked[neighborId])
+								continue;
+
+							m_IsTileMarked[neighborId] = 1;
+							nextActiveTiles.push_back(neighborId);
+						}
+					}
+				}
+			}
+
+			// tiles which are no longer active keep no band cells, so their values are reset to the band boundary
+			std::vector<size_t> deactivatedTiles;
+			for (const size_t tileId : m_ActiveTiles)
+			{
+				if (!m_IsTileMarked[tileId])
+					deactivatedTiles.push_back(tileId);
+			}
+			m_ActiveTiles.swap(deactivatedTiles);
+			ForEachActiveTile([&](const size_t&, const size_t& tileId)
+				{
+					ForEachTileCell(tileId, [&](const size_t&, const size_t&, const size_t&, const size_t& cellId)
+						{
+							m_Values[cellId] = m_Values[cellId] < 0.0 ? -m_HalfWidth : m_HalfWidth;
+						});
+				});
+
+			for (const size_t tileId : nextActiveTiles)
+				m_IsTileMarked[tileId] = 0;
+			std::sort(nextActiveTiles.begin(), nextActiveTiles.end());
+			m_ActiveTiles.swap(nextActiveTiles);
+		}
+
+		[[nodiscard]] size_t ActiveTileCount() const
+		{
+			return m_ActiveTiles.size();
+		}
+
+		[[nodiscard]] const std::vector<size_t>& ActiveTiles() const
+		{
+			return m_ActiveTiles;
+		}
+
+		[[nodiscard]] size_t BandCellCount() const
+		{
+			return m_BandCellCount;
+		}
+
+	private:
+		//-----------------------------------------------------------------------------
+		/*! \brief Replaces the values of all cells of active tiles by kernel(i, j, k, cellId, bandCellId), where
+		*          bandCellId is the position of the cell in tile order (in m_Buffer and m_Snapshot).
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename CellKernel>
+		void UpdateTileCells(const CellKernel& kernel)
+		{
+			constexpr size_t tileCellCount = band_tile_size * band_tile_size * band_tile_size;
+			m_Buffer.resize(m_ActiveTiles.size() * tileCellCount);
+
+			ForEachActiveTile([&](const size_t& activeId, const size_t& tileId)
+				{
+					size_t bandCellId = activeId * tileCellCount;
+					ForEachTileCell(tileId, [&](const size_t& i, const size_t& j, const size_t& k, const size_t& cellId)
+						{
+							m_Buffer[bandCellId] = kernel(i, j, k, cellId, bandCellId);
+							bandCellId++;
+						});
+				});
+
+			ForEachActiveTile([&](const size_t& activeId, const size_t& tileId)
+				{
+					const double* tileBuffer = m_Buffer.data() + activeId * tileCellCount;
+					ForEachTileCell(tileId, [&](const size_t&, const size_t&, const size_t&, const size_t& cellId)
+						{
+							m_Values[cellId] = std::clamp(*tileBuffer++, -m_HalfWidth, m_HalfWidth);
+						});
+				});
+		}
+
+		template <typename TileJob>
+		void ForEachActiveTile(const TileJob& job) const
+		{
+			Util::ParallelForChunks(m_ActiveTiles.size(), Util::GetParallelChunkCount(m_ActiveTiles.size(), min_tile_chunk_count),
+				[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+				{
+					for (size_t activeId = begin; activeId < end; activeId++)
+						job(activeId, m_ActiveTiles[activeId]);
+				});
+		}
+
+		template <typename CellVisitor>
+		void ForEachTileCell(const size_t& tileId, const CellVisitor& visitor) const
+		{
+			const size_t iBegin = (tileId % m_TileCounts[0]) << band_tile_log2;
+			const size_t jBegin = ((tileId / m_TileCounts[0]) % m_TileCounts[1]) << band_tile_log2;
+			const size_t kBegin = (tileId / (m_TileCounts[0] * m_TileCounts[1])) << band_tile_log2;
+			const size_t iEnd = std::min(iBegin + band_tile_size, m_Counts[0]);
+			const size_t jEnd = std::min(jBegin + band_tile_size, m_Counts[1]);
+			const size_t kEnd = std::min(kBegin + band_tile_size, m_Counts[2]);
+			for (size_t k = kBegin; k < kEnd; k++)
+				for (size_t j = jBegin; j < jEnd; j++)
+					for (size_t i = iBegin; i < iEnd; i++)
+						visitor(i, j, k, i + m_Counts[0] * (j + m_Counts[1] * k));
+		}
+
+		//
+		// ==================================
+		//
+
+		std::vector<double>&    m_Values;
+		double                  m_HalfWidth;
+		std::array<size_t, 3>   m_Counts{};
+		std::array<size_t, 3>   m_TileCounts{};
+		std::vector<size_t>     m_ActiveTiles{};      //!< sorted ids of active tiles
+		std::vector<uint8_t>    m_IsTileMarked{};     //!< per-tile marks used during Rebuild (all zero otherwise)
+		std::vector<double>     m_Buffer{};           //!< updated values of active tiles (in tile cell order)
+		std::vector<double>     m_Snapshot{};         //!< values of active tiles stored by SnapshotCells (in tile cell order)
+		size_t                  m_BandCellCount{ 0 };
+	};
+
+	//=============================================================================
+	/// \struct CellStencil
+	/// \brief Values of the 6 face neighbors of a cell (replaced by the cell value beyond the grid boundary).
+	//=============================================================================
+	struct CellStencil
+	{
+		double Center{ 0.0 };
+		double XMinus{ 0.0 }, XPlus{ 0.0 };
+		double YMinus{ 0.0 }, YPlus{ 0.0 };
+		double ZMinus{ 0.0 }, ZPlus{ 0.0 };
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Gathers the face neighbor stencil of cell (i, j, k).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static CellStencil GetCellStencil(const std::vector<double>& values, const std::array<size_t, 3>& counts,
+		const size_t& i, const size_t& j, const size_t& k, const size_t& cellId)
+	{
+		const size_t nx = counts[0];
+		const size_t nxy = counts[0] * counts[1];
+		CellStencil result;
+		result.Center = values[cellId];
+		result.XMinus = i > 0 ? values[cellId - 1] : result.Center;
+		result.XPlus = i + 1 < counts[0] ? values[cellId + 1] : result.Center;
+		result.YMinus = j > 0 ? values[cellId - nx] : result.Center;
+		result.YPlus = j + 1 < counts[1] ? values[cellId + nx] : result.Center;
+		result.ZMinus = k > 0 ? values[cellId - nxy] : result.Center;
+		result.ZPlus = k + 1 < counts[2] ? values[cellId + nxy] : result.Center;
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Godunov upwind gradient magnitude of a front moving in the direction of the gradient (isForward) or against it.
+	*   \param[in] s         cell stencil.
+	*   \param[in] invH      1 / CellSize.
+	*   \param[in] isForward true for the gradient upwind w.r.t. a positive normal speed.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetUpwindGradientLength(const CellStencil& s, const double& invH, const bool& isForward)
+	{
+		const auto axisTerm = [&](const double& minus, const double& plus)
+		{
+			const double backward = (s.Center - minus) * invH;
+			const double forward = (plus - s.Center) * invH;
+			const double a = isForward ? std::max(backward, 0.0) : std::min(backward, 0.0);
+			const double b = isForward ? std::min(forward, 0.0) : std::max(forward, 0.0);
+			return std::max(a * a, b * b);
+		};
+		return std::sqrt(axisTerm(s.XMinus, s.XPlus) + axisTerm(s.YMinus, s.YPlus) + axisTerm(s.ZMinus, s.ZPlus));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Mean curvature times gradient length, kappa |grad phi|, by central differences (with kappa clamped to +-1 / CellSize).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetCurvatureTerm(const std::vector<double>& values, const std::array<size_t, 3>& counts, const CellStencil& s,
+		const size_t& i, const size_t& j, const size_t& k, const double& invH)
+	{
+		const auto value = [&](const size_t& ci, const size_t& cj, const size_t& ck)
+		{
+			return values[std::min(ci, counts[0] - 1) + counts[0] * (std::min(cj, counts[1] - 1) + counts[1] * std::min(ck, counts[2] - 1))];
+		};
+		const size_t im = i > 0 ? i - 1 : 0, jm = j > 0 ? j - 1 : 0, km = k > 0 ? k - 1 : 0;
+
+		const double px = 0.5 * (s.XPlus - s.XMinus) * invH;
+		const double py = 0.5 * (s.YPlus - s.YMinus) * invH;
+		const double pz = 0.5 * (s.ZPlus - s.ZMinus) * invH;
+		const double gradientLengthSquared = px * px + py * py + pz * pz;
+		if (gradientLengthSquared < 1e-12)
+			return 0.0;
+
+		const double invH2 = invH * invH;
+		const double pxx = (s.XPlus - 2.0 * s.Center + s.XMinus) * invH2;
+		const double pyy = (s.YPlus - 2.0 * s.Center + s.YMinus) * invH2;
+		const double pzz = (s.ZPlus - 2.0 * s.Center + s.ZMinus) * invH2;
+		const double pxy = 0.25 * (value(i + 1, j + 1, k) - value(i + 1, jm, k) - value(im, j + 1, k) + value(im, jm, k)) * invH2;
+		const double pxz = 0.25 * (value(i + 1, j, k + 1) - value(i + 1, j, km) - value(im, j, k + 1) + value(im, j, km)) * invH2;
+		const double pyz = 0.25 * (value(i, j + 1, k + 1) - value(i, j + 1, km) - value(i, jm, k + 1) + value(i, jm, km)) * invH2;
+
+		const double numerator =
+			pxx * (py * py + pz * pz) + pyy * (px * px + pz * pz) + pzz * (px * px + py * py) -
+			2.0 * (px * py * pxy + px * pz * pxz + py * pz * pyz);
+		const double maxTerm = std::sqrt(gradientLengthSquared) * invH;
+		return std::clamp(numerator / gradientLengthSquared, -maxTerm, maxTerm);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evolves the level set of a single pyramid level (grids are assumed to be consistent).
+	*   \param[in] levelSetData          level set grid data.
+	*   \param[in] targetDistanceData    target distance grid data.
+	*   \param[in] settings              level set settings.
+	*   \param[in] nIterations           number of evolution steps.
+	*   \param[in] level                 pyramid level (for instrumentation).
+	*   \param[in] seedTiles             if not null, sorted ids of band tiles containing all cells of levelSetData within the band
+	*                                    (all other cells hold +-half-width), otherwise the whole grid is searched for the band.
+	*   \param[in] activeTiles           sorted ids of band tiles active after the last step.
+	*   \param[in] iterationStats        if not null, appended by instrumentation data of each step.
+	*   \return Processing status (InvalidInput for an initial level set without cells in the narrow band)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static MeshProcessingStatus EvolveLevel(ScalarGridData& levelSetData, const ScalarGridData& targetDistanceData,
+		const LevelSetSettings& settings, const unsigned int& nIterations, const unsigned int& level,
+		const std::vector<size_t>* seedTiles, std::vector<size_t>& activeTiles, std::vector<LevelSetIterationStats>* iterationStats)
+	{
+		const std::array<size_t, 3> counts{ levelSetData.XCellCount, levelSetData.YCellCount, levelSetData.ZCellCount };
+		const double h = levelSetData.CellSize;
+		const double invH = 1.0 / h;
+		const double halfWidth = settings.BandHalfWidth * h;
+		const double curvatureCoefficient = settings.CurvatureWeight * h * h;
+		const auto& values = levelSetData.CellData;
+		const auto& targetDistances = targetDistanceData.CellData;
+
+		NarrowBand band(levelSetData, halfWidth);
+		if (seedTiles)
+			band.Initialize(*seedTiles);
+		else
+			band.Initialize();
+		if (band.BandCellCount() == 0)
+			return MeshProcessingStatus::InvalidInput;
+
+		for (unsigned int iter = 0; iter < nIterations; iter++)
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			LevelSetIterationStats stats;
+			stats.Iteration = iter;
+			stats.Level = level;
+			stats.ActiveTileCount = band.ActiveTileCount();
+
+			// ------ adaptive time step from the CFL conditions of the advection and curvature terms ------------
+			const double maxSpeed = band.GetBandMaximum([&](const size_t& cellId) { return std::fabs(settings.AttractionWeight * targetDistances[cellId]); });
+			const double maxRate = maxSpeed * invH + 6.0 * std::fabs(curvatureCoefficient) * invH * invH;
+			stats.TimeStep = maxRate > 0.0 ? settings.CFLNumber / maxRate : 0.0;
+
+			// ------ evolution step ------------------------------------------------------------
+			if (stats.TimeStep > 0.0)
+			{
+				const double dt = stats.TimeStep;
+				band.UpdateCells([&](const size_t& i, const size_t& j, const size_t& k, const size_t& cellId)
+					{
+						const auto stencil = GetCellStencil(values, counts, i, j, k, cellId);
+						// d(phi)/dt + V |grad phi| = 0 with normal speed V = -AttractionWeight * D
+						const double speed = -settings.AttractionWeight * targetDistances[cellId];
+						const double advection = speed > 0.0 ?
+							speed * GetUpwindGradientLength(stencil, invH, true) :
+							speed * GetUpwindGradientLength(stencil, invH, false);
+						const double curvature = curvatureCoefficient != 0.0 ?
+							curvatureCoefficient * GetCurvatureTerm(values, counts, stencil, i, j, k, invH) : 0.0;
+						return stencil.Center + dt * (curvature - advection);
+					});
+			}
+
+			// ------ reinitialization to a signed distance within the active tiles --------------------------
+			stats.IsReinitialized = settings.ReinitializationInterval > 0 && (iter + 1) % settings.ReinitializationInterval == 0;
+			if (stats.IsReinitialized)
+			{
+				// the sign is taken from the values before reinitialization, which are only needed within the active tiles
+				band.SnapshotCells();
+				const double pseudoTimeStep = 0.5 * h;
+				for (unsigned int step = 0; step < settings.NReinitializationSteps; step++)
+				{
+					band.UpdateCellsWithSnapshot([&](const size_t& i, const size_t& j, const size_t& k, const size_t& cellId, const double& initialValue)
+						{
+							const auto stencil = GetCellStencil(values, counts, i, j, k, cellId);
+							const double sign = initialValue / std::sqrt(initialValue * initialValue + h * h);
+							const double gradientLength = GetUpwindGradientLength(stencil, invH, sign > 0.0);
+							return stencil.Center - pseudoTimeStep * sign * (gradientLength - 1.0);
+						});
+				}
+			}
+
+			// ------ incremental band rebuild --------------------------------------------------------------
+			band.Rebuild();
+			stats.BandCellCount = band.BandCellCount();
+			stats.Duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+			if (iterationStats)
+				iterationStats->push_back(stats);
+
+			if (stats.BandCellCount == 0)
+				break;
+		}
+
+		activeTiles = band.ActiveTiles();
+		return MeshProcessingStatus::Complete;
+	}
+
+	MeshProcessingStatus LevelSetEvolver::Evolve(ScalarGridData& levelSetData, const ScalarGridData& targetDistanceData,
+		const LevelSetSettings& settings, std::vector<LevelSetIterationStats>* iterationStats)
+	{
+		const std::array<size_t, 3> counts{ levelSetData.XCellCount, levelSetData.YCellCount, levelSetData.ZCellCount };
+		const size_t cellCount = counts[0] * counts[1] * counts[2];
+		if (cellCount == 0 || levelSetData.CellSize <= 0.0 || levelSetData.CellData.size() != cellCount ||
+			targetDistanceData.XCellCount != counts[0] || targetDistanceData.YCellCount != counts[1] || targetDistanceData.ZCellCount != counts[2] ||
+			targetDistanceData.CellData.size() != cellCount || settings.BandHalfWidth < 1.0 || settings.CFLNumber <= 0.0)
+			return MeshProcessingStatus::InvalidInput;
+
+		if (iterationStats)
+			iterationStats->clear();
+
+		std::vector<size_t> activeTiles;
+		auto levelSetLevels = BuildScalarGridPyramid(levelSetData, settings.NCoarseLevels);
+		if (levelSetLevels.empty())
+			return EvolveLevel(levelSetData, targetDistanceData, settings, settings.NIterations, 0, nullptr, activeTiles, iterationStats);
+
+		// ------ coarse-to-fine evolution (both pyramids have the same cell counts on each level) --------------
+		// only the fine tiles covering the active coarse tiles are prolongated, and they seed the fine band
+		const auto targetLevels = BuildScalarGridPyramid(targetDistanceData, static_cast<unsigned int>(levelSetLevels.size()));
+		auto coarseLevel = static_cast<unsigned int>(levelSetLevels.size());
+		auto resultState = EvolveLevel(levelSetLevels.back(), targetLevels.back(), settings, settings.NIterations, coarseLevel, nullptr, activeTiles, iterationStats);
+		std::vector<size_t> seedTiles;
+		for (; coarseLevel > 0 && resultState == MeshProcessingStatus::Complete; coarseLevel--)
+		{
+			auto& fineLevelSet = coarseLevel > 1 ? levelSetLevels[coarseLevel - 2] : levelSetData;
+			const auto& fineTarget = coarseLevel > 1 ? targetLevels[coarseLevel - 2] : targetDistanceData;
+			if (!ProlongateScalarGridData(levelSetLevels[coarseLevel - 1], fineLevelSet, band_tile_log2, activeTiles,
+				settings.BandHalfWidth * fineLevelSet.CellSize, seedTiles))
+				return MeshProcessingStatus::InvalidInput;
+
+			levelSetLevels.pop_back();
+			resultState = EvolveLevel(fineLevelSet, fineTarget, settings, settings.NRefinementIterations, coarseLevel - 1, &seedTiles, activeTiles, iterationStats);
+		}
+
+		return resultState;
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,239 @@
+/*!  \file MeshTriangleSoup.cpp
+ *   \brief Implementation of utils for collecting triangles of mesh geometry data as a triangle soup.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "MeshTriangleSoup.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles from a coordinate and triangle index buffer.
+	*   \param[in] coords             vertex coordinate buffer.
+	*   \param[in] indices            triangle vertex indices.
+	*   \param[out] triangles         collected triangles.
+	*   \param[out] vertexIndices     if not null, vertex indices of the collected triangles.
+	*   \return false if an index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool CollectTriangles(const std::vector<double>& coords, const std::vector<unsigned int>& indices,
+		std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>* vertexIndices)
+	{
+		const size_t vertexCount = coords.size() / 3;
+		triangles.reserve(indices.size() / 3);
+		for (size_t t = 0; t + 2 < indices.size(); t += 3)
+		{
+			TrianglePoints tri{};
+			for (size_t j = 0; j < 3; j++)
+			{
+				const size_t vId = indices[t + j];
+				if (vId >= vertexCount)
+					return false;
+
+				tri[j] = { coords[3 * vId], coords[3 * vId + 1], coords[3 * vId + 2] };
+			}
+
+			const std::array<double, 3> e1{ tri[1][0] - tri[0][0], tri[1][1] - tri[0][1], tri[1][2] - tri[0][2] };
+			const std::array<double, 3> e2{ tri[2][0] - tri[0][0], tri[2][1] - tri[0][1], tri[2][2] - tri[0][2] };
+			const std::array<double, 3> n{ e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			if (n[0] * n[0] + n[1] * n[1] + n[2] * n[2] <= 0.0)
+				continue;
+
+			triangles.push_back(tri);
+			if (vertexIndices)
+				vertexIndices->push_back({ indices[t], indices[t + 1], indices[t + 2] });
+		}
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles of a buffer triangle mesh.
+	*   \param[in] meshData           buffer mesh geometry data.
+	*   \param[out] triangles         collected triangles.
+	*   \param[out] vertexIndices     if not null, vertex indices of the collected triangles.
+	*   \return false if VertexIndices are not triples or an index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool CollectBufferMeshTriangles(const BufferMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>* vertexIndices)
+	{
+		if (meshData.VertexIndices.size() % 3 != 0)
+			return false;
+
+		return CollectTriangles(meshData.VertexCoords, meshData.VertexIndices, triangles, vertexIndices);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles of a referenced mesh (polygonal faces are fan-triangulated).
+	*   \param[in] meshData           referenced mesh geometry data.
+	*   \param[out] triangles         collected triangles.
+	*   \param[out] vertexIndices     if not null, vertex indices of the collected triangles.
+	*   \return false if a vertex index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool CollectReferencedMeshTriangles(const ReferencedMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>* vertexIndices)
+	{
+		std::vector<double> coords;
+		coords.reserve(3 * meshData.Vertices.size());
+		for (const auto& vertex : meshData.Vertices)
+			coords.insert(coords.end(), { vertex.Position().X(), vertex.Position().Y(), vertex.Position().Z() });
+
+		std::vector<unsigned int> indices;
+		std::vector<unsigned int> polygon;
+		for (const auto& face : meshData.Faces)
+		{
+			polygon.clear();
+			const auto& baseHeId = face.HalfEdge();
+			auto heId = baseHeId;
+			do
+			{
+				polygon.push_back(static_cast<unsigned int>(meshData.HalfEdges[heId.get()].TailVertex().get()));
+				heId = meshData.HalfEdges[heId.get()].NextHalfEdge();
+			}
+			while (heId != baseHeId);
+
+			for (size_t i = 1; i + 1 < polygon.size(); i++)
+				indices.insert(indices.end(), { polygon[0], polygon[i], polygon[i + 1] });
+		}
+
+		return CollectTriangles(coords, indices, triangles, vertexIndices);
+	}
+
+	bool CollectMeshTriangles(const BufferMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles)
+	{
+		return CollectBufferMeshTriangles(meshData, triangles, nullptr);
+	}
+
+	bool CollectMeshTriangles(const ReferencedMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles)
+	{
+		return CollectReferencedMeshTriangles(meshData, triangles, nullptr);
+	}
+
+	bool CollectMeshTriangles(const BufferMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>& vertexIndices)
+	{
+		return CollectBufferMeshTriangles(meshData, triangles, &vertexIndices);
+	}
+
+	bool CollectMeshTriangles(const ReferencedMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>& vertexIndices)
+	{
+		return CollectReferencedMeshTriangles(meshData, triangles, &vertexIndices);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief 2D edge function of edge (p, q) projected to the (u, v)-plane, evaluated from the lexicographically smaller
+	*          endpoint, so that both triangles sharing an edge evaluate exactly opposite values.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetEdgeFunction(const std::array<double, 3>& p, const std::array<double, 3>& q,
+		const size_t& uAxis, const size_t& vAxis, const double& u, const double& v)
+	{
+		if (p[uAxis] < q[uAxis] || (p[uAxis] == q[uAxis] && p[vAxis] < q[vAxis]))
+			return (q[uAxis] - p[uAxis]) * (v - p[vAxis]) - (q[vAxis] - p[vAxis]) * (u - p[uAxis]);
+
+		return -((p[uAxis] - q[uAxis]) * (v - q[vAxis]) - (p[vAxis] - q[vAxis]) * (u - q[uAxis]));
+	}
+
+	bool IsTriangleSoupClosed(const std::vector<TrianglePoints>& triangles)
+	{
+		// ------ weld vertices with equal coordinates -----------------------------------------
+		std::vector<std::pair<std::array<double, 3>, size_t>> corners;
+		corners.reserve(3 * triangles.size());
+		for (size_t t = 0; t < triangles.size(); t++)
+		{
+			for (size_t j = 0; j < 3; j++)
+				corners.emplace_back(triangles[t][j], 3 * t + j);
+		}
+		std::sort(corners.begin(), corners.end());
+
+		std::vector<size_t> cornerVertexIds(corners.size());
+		size_t vertexId = 0;
+		for (size_t c = 0; c < corners.size(); c++)
+		{
+			if (c > 0 && corners[c].first != corners[c - 1].first)
+				vertexId++;
+			cornerVertexIds[corners[c].second] = vertexId;
+		}
+
+		// ------ every undirected edge needs an even number of incident triangles --------------------
+		std::vector<std::pair<size_t, size_t>> edges;
+		edges.reserve(corners.size());
+		for (size_t t = 0; t < triangles.size(); t++)
+		{
+			for (size_t j = 0; j < 3; j++)
+			{
+				const size_t v1 = cornerVertexIds[3 * t + j];
+				const size_t v2 = cornerVertexIds[3 * t + (j + 1) % 3];
+				edges.emplace_back(std::min(v1, v2), std::max(v1, v2));
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+
+		for (size_t e = 0; e < edges.size();)
+		{
+			size_t next = e + 1;
+			while (next < edges.size() && edges[next] == edges[e])
+				next++;
+			if ((next - e) % 2 == 1)
+				return false;
+			e = next;
+		}
+		return true;
+	}
+
+	bool GetTriangleLineCrossing(const TrianglePoints& tri, const size_t& axis, const double& u, const double& v, double& t)
+	{
+		const size_t uAxis = (axis + 1) % 3;
+		const size_t vAxis = (axis + 2) % 3;
+		const auto& [a, b, c] = tri;
+		const double orientation = (b[uAxis] - a[uAxis]) * (c[vAxis] - a[vAxis]) - (b[vAxis] - a[vAxis]) * (c[uAxis] - a[uAxis]);
+		if (orientation == 0.0)
+			return false;
+
+		const double sign = orientation > 0.0 ? 1.0 : -1.0;
+		const std::array<const std::array<double, 3>*, 3> starts{ &a, &b, &c };
+		const std::array<const std::array<double, 3>*, 3> ends{ &b, &c, &a };
+		std::array<double, 3> weights{}; // weights[e] belongs to the vertex opposite to edge e
+		for (size_t e = 0; e < 3; e++)
+		{
+			const double w = sign * GetEdgeFunction(*starts[e], *ends[e], uAxis, vAxis, u, v);
+			if (w < 0.0)
+				return false;
+
+			if (w == 0.0)
+			{
+				// direction of the edge in the positively oriented triangle
+				const double du = sign * ((*ends[e])[uAxis] - (*starts[e])[uAxis]);
+				const double dv = sign * ((*ends[e])[vAxis] - (*starts[e])[vAxis]);
+				if (!(dv > 0.0 || (dv == 0.0 && du < 0.0)))
+					return false;
+			}
+			weights[e] = w;
+		}
+
+		const double weightSum = weights[0] + weights[1] + weights[2];
+		if (weightSum == 0.0)
+			return false;
+
+		t = (weights[1] * a[axis] + weights[2] * b[axis] + weights[0] * c[axis]) / weightSum;
+		return true;
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,104 @@
+/*!  \file MeshTriangleSoup.h
+ *   \brief Utils for collecting triangles of mesh geometry data as a triangle soup (used by grid-based algorithms).
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include <array>
+#include <vector>
+
+namespace Symplektis::Algorithms
+{
+	/// \brief Coordinates of a triangle's vertices.
+	using TrianglePoints = std::array<std::array<double, 3>, 3>;
+
+	/// \brief Mesh vertex indices of a triangle's vertices.
+	using TriangleVertexIndices = std::array<unsigned int, 3>;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles of a buffer triangle mesh (VertexIndices read as triangle index triples).
+	 *  \param[in] meshData          buffer mesh geometry data.
+	 *  \param[out] triangles        collected triangles (vertex order is preserved).
+	 *  \return false if VertexIndices are not triples or an index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool CollectMeshTriangles(const GeometryKernel::BufferMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles of a referenced mesh (polygonal faces are fan-triangulated).
+	 *  \param[in] meshData          referenced mesh geometry data.
+	 *  \param[out] triangles        collected triangles (vertex order is preserved).
+	 *  \return false if a vertex index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool CollectMeshTriangles(const GeometryKernel::ReferencedMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles of a buffer triangle mesh together with their vertex indices.
+	 *  \param[in] meshData          buffer mesh geometry data.
+	 *  \param[out] triangles        collected triangles (vertex order is preserved).
+	 *  \param[out] vertexIndices    indices of the vertices of each collected triangle in meshData.
+	 *  \return false if VertexIndices are not triples or an index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool CollectMeshTriangles(const GeometryKernel::BufferMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>& vertexIndices);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Collects non-degenerate triangles of a referenced mesh (polygonal faces are fan-triangulated) together with
+	 *         their vertex indices.
+	 *  \param[in] meshData          referenced mesh geometry data.
+	 *  \param[out] triangles        collected triangles (vertex order is preserved).
+	 *  \param[out] vertexIndices    indices of the vertices of each collected triangle in meshData.
+	 *  \return false if a vertex index is out of range.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool CollectMeshTriangles(const GeometryKernel::ReferencedMeshGeometryData& meshData, std::vector<TrianglePoints>& triangles, std::vector<TriangleVertexIndices>& vertexIndices);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Verifies that a triangle soup is closed, i.e.: that every edge (with vertices identified by exactly equal
+	 *         coordinates) is shared by an even number of triangles.
+	 *  \param[in] triangles         triangle soup.
+	 *  \return true if the triangle soup has no boundary edges.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool IsTriangleSoupClosed(const std::vector<TrianglePoints>& triangles);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates the crossing of a line parallel to an axis with a triangle. Lines through edges and vertices are
+	 *         attributed to a single triangle of the edge (vertex) neighborhood by the tie-breaking rule of a line
+	 *         shifted by (-eps, -eps^2) in (u, v) [Edelsbrunner & Muecke, 1990], so that a line crosses a closed mesh an
+	 *         even number of times.
+	 *  \param[in] tri               triangle.
+	 *  \param[in] axis              axis of the line (0, 1 or 2).
+	 *  \param[in] u                 coordinate of the line along the axis (axis + 1) % 3.
+	 *  \param[in] v                 coordinate of the line along the axis (axis + 2) % 3.
+	 *  \param[out] t                coordinate of the crossing along the axis.
+	 *  \return true if the line crosses the triangle.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool GetTriangleLineCrossing(const TrianglePoints& tri, const size_t& axis, const double& u, const double& v, double& t);
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*!  \file MeshVoxelizer.cpp
+ *   \brief Implementation of an object for solid voxelization of mesh geometry data on scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "MeshVoxelizer.h"
+#include "MeshTriangleSoup.h"
+#include "WindingNumberEvaluator.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	using Point3 = std::array<double, 3>;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates the index range of cell centers origin + (i + 0.5) * h within [min, max], extended by one cell
+	*          on each side (so that rounding never excludes a center on the boundary).
+	*   \return false if the range is empty.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool GetCellCenterRange(const double& min, const double& max, const double& origin, const double& h, const size_t& count, size_t& first, size_t& last)
+	{
+		const double firstIndex = std::ceil((min - origin) / h - 0.5) - 1.0;
+		const double lastIndex = std::floor((max - origin) / h - 0.5) + 1.0;
+		if (lastIndex < 0.0 || firstIndex > static_cast<double>(count - 1))
+			return false;
+
+		first = static_cast<size_t>(std::max(firstIndex, 0.0));
+		last = std::min(static_cast<size_t>(lastIndex), count - 1);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Voxelizes a triangle soup.
+	*   \param[in] triangles          mesh triangles.
+	*   \param[in] gridData           scalar grid data.
+	*   \param[in] settings           voxelization settings.
+	*   \return Processing status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static MeshProcessingStatus VoxelizeTriangles(const std::vector<TrianglePoints>& triangles, ScalarGridData& gridData, const VoxelizationSettings& settings)
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		const size_t cellCount = nx * ny * nz;
+		if (triangles.empty() || cellCount == 0 || gridData.CellSize <= 0.0)
+			return MeshProcessingStatus::InvalidInput;
+
+		const Point3 origin{ gridData.BoundingBox.Min().X(), gridData.BoundingBox.Min().Y(), gridData.BoundingBox.Min().Z() };
+		const double h = gridData.CellSize;
+		gridData.CellData.assign(cellCount, settings.OutsideValue);
+
+		Point3 meshMin{ DBL_MAX, DBL_MAX, DBL_MAX };
+		Point3 meshMax{ -DBL_MAX, -DBL_MAX, -DBL_MAX };
+		for (const auto& tri : triangles)
+		{
+			for (size_t i = 0; i < 3; i++)
+			{
+				meshMin[i] = std::min({ meshMin[i], tri[0][i], tri[1][i], tri[2][i] });
+				meshMax[i] = std::max({ meshMax[i], tri[0][i], tri[1][i], tri[2][i] });
+			}
+		}
+
+		// ------ scanline parity along x, rasterized in z-slabs ---------------------------------------
+		std::vector<uint8_t> isRowUnreliable(ny * nz, 0);
+		Util::ParallelForChunks(nz, Util::GetParallelChunkCount(nz, 1),
+			[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+			{
+				// triangles are bucketed into the slabs of cell center planes they span
+				std::vector<std::vector<unsigned int>> slabTriangles(kEnd - kBegin);
+				for (size_t t = 0; t < triangles.size(); t++)
+				{
+					const auto& tri = triangles[t];
+					size_t kFirst = 0, kLast = 0;
+					if (!GetCellCenterRange(std::min({ tri[0][2], tri[1][2], tri[2][2] }), std::max({ tri[0][2], tri[1][2], tri[2][2] }), origin[2], h, nz, kFirst, kLast))
+						continue;
+
+					for (size_t k = std::max(kFirst, kBegin); k <= std::min(kLast, kEnd - 1); k++)
+						slabTriangles[k - kBegin].push_back(static_cast<unsigned int>(t));
+				}
+
+				std::vector<std::vector<double>> rowCrossings(ny);
+				for (size_t k = kBegin; k < kEnd; k++)
+				{
+					const double z = origin[2] + (static_cast<double>(k) + 0.5) * h;
+					for (auto& crossings : rowCrossings)
+						crossings.clear();
+
+					for (const auto t : slabTriangles[k - kBegin])
+					{
+						const auto& tri = triangles[t];
+						size_t jFirst = 0, jLast = 0;
+						if (!GetCellCenterRange(std::min({ tri[0][1], tri[1][1], tri[2][1] }), std::max({ tri[0][1], tri[1][1], tri[2][1] }), origin[1], h, ny, jFirst, jLast))
+							continue;
+
+						for (size_t j = jFirst; j <= jLast; j++)
+						{
+							double x = 0.0;
+							if (GetTriangleLineCrossing(tri, 0, origin[1] + (static_cast<double>(j) + 0.5) * h, z, x))
+								rowCrossings[j].push_back(x);
+						}
+					}
+
+					for (size_t j = 0; j < ny; j++)
+					{
+						auto& crossings = rowCrossings[j];
+						if (crossings.empty())
+							continue;
+
+						std::sort(crossings.begin(), crossings.end());
+						if (crossings.size() % 2 == 1)
+							isRowUnreliable[j + ny * k] = 1;
+
+						size_t crossingsBefore = 0;
+						const size_t rowOffset = nx * (j + ny * k);
+						for (size_t i = 0; i < nx; i++)
+						{
+							const double x = origin[0] + (static_cast<double>(i) + 0.5) * h;
+							while (crossingsBefore < crossings.size() && crossings[crossingsBefore] < x)
+								crossingsBefore++;
+
+							if (crossingsBefore % 2 == 1)
+								gridData.CellData[rowOffset + i] = settings.InsideValue;
+						}
+					}
+				}
+			});
+
+		if (!settings.UseWindingNumberFallback)
+			return MeshProcessingStatus::Complete;
+
+		// ------ generalized winding number fallback ----------------------------------------------
+		const bool isClosed = IsTriangleSoupClosed(triangles);
+		if (isClosed && std::find(isRowUnreliable.begin(), isRowUnreliable.end(), uint8_t{ 1 }) == isRowUnreliable.end())
+			return MeshProcessingStatus::Complete;
+
+		std::array<size_t, 3> boxFirst{};
+		std::array<size_t, 3> boxLast{};
+		const std::array<size_t, 3> counts{ nx, ny, nz };
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			if (!GetCellCenterRange(meshMin[axis], meshMax[axis], origin[axis], h, counts[axis], boxFirst[axis], boxLast[axis]))
+				return MeshProcessingStatus::Complete;
+		}
+
+		const WindingNumberEvaluator windingNumbers(triangles);
+		Util::ParallelForChunks(nz, Util::GetParallelChunkCount(nz, 1),
+			[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+			{
+				for (size_t k = std::max(kBegin, boxFirst[2]); k < std::min(kEnd, boxLast[2] + 1); k++)
+				{
+					for (size_t j = boxFirst[1]; j <= boxLast[1]; j++)
+					{
+						if (isClosed && !isRowUnreliable[j + ny * k])
+							continue;
+
+						for (size_t i = boxFirst[0]; i <= boxLast[0]; i++)
+						{
+							const double windingNumber = windingNumbers.Evaluate(Vector3{
+								origin[0] + (static_cast<double>(i) + 0.5) * h,
+								origin[1] + (static_cast<double>(j) + 0.5) * h,
+								origin[2] + (static_cast<double>(k) + 0.5) * h });
+							const bool isInside = std::fabs(windingNumber) > settings.WindingNumberThreshold;
+							gridData.CellData[i + nx * (j + ny * k)] = isInside ? settings.InsideValue : settings.OutsideValue;
+						}
+					}
+				}
+			});
+
+		return MeshProcessingStatus::Complete;
+	}
+
+	MeshProcessingStatus MeshVoxelizer::Voxelize(const BufferMeshGeometryData& meshData, ScalarGridData& gridData, const VoxelizationSettings& settings)
+	{
+		std::vector<TrianglePoints> triangles;
+		if (!CollectMeshTriangles(meshData, triangles))
+			return MeshProcessingStatus::InvalidInput;
+
+		return VoxelizeTriangles(triangles, gridData, settings);
+	}
+
+	MeshProcessingStatus MeshVoxelizer::Voxelize(const ReferencedMeshGeometryData& meshData, ScalarGridData& gridData, const VoxelizationSettings& settings)
+	{
+		std::vector<TrianglePoints> triangles;
+		if (!CollectMeshTriangles(meshData, triangles))
+			return MeshProcessingStatus::InvalidInput;
+
+		return VoxelizeTriangles(triangles, gridData, settings);
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
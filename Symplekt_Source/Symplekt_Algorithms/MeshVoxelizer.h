@@ -0,0 +1,86 @@
+/*!  \file MeshVoxelizer.h
+ *   \brief An object for solid voxelization (inside/outside classification) of mesh geometry data on scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include "AlgorithmHelperTypes.h"
+
+namespace Symplektis::Algorithms
+{
+	//=============================================================================
+	/// \struct VoxelizationSettings
+	/// \brief A data container for all major settings for MeshVoxelizer.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VoxelizationSettings
+	{
+		double InsideValue{ -1.0 };               //>! value of cells inside the mesh.
+		double OutsideValue{ 1.0 };               //>! value of cells outside the mesh.
+		bool UseWindingNumberFallback{ true };    //>! if true, cells are classified by generalized winding numbers where scanline parity is unreliable (meshes with holes).
+		double WindingNumberThreshold{ 0.5 };     //>! a cell is inside if the absolute value of its generalized winding number exceeds this threshold.
+	};
+
+	//=============================================================================
+	/// \class MeshVoxelizer
+	/// \brief A singleton object classifying the cells of ScalarGridData as inside or outside of a triangle mesh (by cell centers).
+	///
+	///        Closed meshes are classified by scanline parity: triangles are rasterized in z-slabs of the grid onto the lines
+	///        of cell centers along x, and cells between the odd and even crossings of a line are inside. Crossings on shared
+	///        edges and vertices are attributed to exactly one triangle by a consistent tie-breaking rule, so that rays through
+	///        mesh edges are counted correctly. The slabs are processed on multiple threads.
+	///
+	///        For meshes with boundary edges (holes), and for lines with an odd number of crossings (e.g.: self-intersecting
+	///        or non-manifold meshes), parity is unreliable, so cells within the mesh bounding box are classified by the
+	///        generalized winding number (see WindingNumberEvaluator) instead. Cells outside the bounding box of the mesh always
+	///        have a winding number of at most 1/2 in absolute value, and are thus outside.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class MeshVoxelizer
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Voxelizes a buffer triangle mesh (VertexIndices read as triangle index triples).
+		 *  \param[in] meshData          buffer mesh geometry data.
+		 *  \param[in] gridData          initialized scalar grid data (e.g.: from InitializeScalarGridData) whose CellData is overwritten.
+		 *	\param[in] settings          voxelization settings.
+		 *  \return Processing status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] MeshProcessingStatus Voxelize(const GeometryKernel::BufferMeshGeometryData& meshData, GeometryKernel::ScalarGridData& gridData, const VoxelizationSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Voxelizes a referenced mesh (polygonal faces are fan-triangulated).
+		 *  \param[in] meshData          referenced mesh geometry data.
+		 *  \param[in] gridData          initialized scalar grid data (e.g.: from InitializeScalarGridData) whose CellData is overwritten.
+		 *	\param[in] settings          voxelization settings.
+		 *  \return Processing status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] MeshProcessingStatus Voxelize(const GeometryKernel::ReferencedMeshGeometryData& meshData, GeometryKernel::ScalarGridData& gridData, const VoxelizationSettings& settings = {});
+	};
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*!  \file ScalarGridFilter.cpp
+ *   \brief Implementation of an object for separable smoothing filters of scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "ScalarGridFilter.h"
+
+#include "Symplekt_GeometryKernel/GridCellMask.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	//!> \brief maximum number of adjacent grid lines filtered together (lines along y and z are adjacent in x)
+	constexpr size_t max_filter_block_width = 64;
+
+	//!> \brief minimum number of line blocks per thread
+	constexpr size_t min_filter_block_chunk_size = 8;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates the normalized weights of a 1D filter kernel.
+	*   \param[in] settings       filter settings.
+	*   \return weights of offsets -Radius, ..., Radius.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<double> GetKernelWeights(const GridFilterSettings& settings)
+	{
+		const int radius = static_cast<int>(settings.Radius);
+		std::vector<double> weights(2 * settings.Radius + 1, 1.0);
+		if (settings.Type == GridFilterType::Gaussian)
+		{
+			for (int n = -radius; n <= radius; n++)
+				weights[n + radius] = std::exp(-static_cast<double>(n * n) / (2.0 * settings.Sigma * settings.Sigma));
+		}
+
+		double weightSum = 0.0;
+		for (const double& weight : weights)
+			weightSum += weight;
+		for (double& weight : weights)
+			weight /= weightSum;
+		return weights;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Filters grid values along one axis. Values are viewed as an array [outerCount][axisCount][innerCount], so
+	*          lines along the axis are adjacent in the innermost (contiguous) index.
+	*   \param[in] values         grid values (filtered in place).
+	*   \param[in] isFrozen       flags of cells whose values are not written (empty if there are none).
+	*   \param[in] outerCount     number of cells along the axes outside of the filtered one.
+	*   \param[in] axisCount      number of cells along the filtered axis.
+	*   \param[in] innerCount     number of cells along the axes inside of the filtered one (the stride of the axis).
+	*   \param[in] weights        kernel weights.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void FilterAxis(std::vector<double>& values, const GridCellMask& isFrozen,
+		const size_t& outerCount, const size_t& axisCount, const size_t& innerCount, const std::vector<double>& weights)
+	{
+		const size_t radius = weights.size() / 2;
+		const size_t blockWidth = std::min(innerCount, max_filter_block_width);
+		const size_t blocksPerOuter = (innerCount + blockWidth - 1) / blockWidth;
+		const size_t blockCount = outerCount * blocksPerOuter;
+
+		Util::ParallelForChunks(blockCount, Util::GetParallelChunkCount(blockCount, min_filter_block_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				std::vector<double> lineBuffer((axisCount + 2 * radius) * blockWidth);
+				std::vector<double> filteredBuffer(axisCount * blockWidth);
+				for (size_t blockId = begin; blockId < end; blockId++)
+				{
+					const size_t innerBegin = (blockId % blocksPerOuter) * blockWidth;
+					const size_t width = std::min(blockWidth, innerCount - innerBegin);
+					const size_t base = (blockId / blocksPerOuter) * axisCount * innerCount + innerBegin;
+
+					// if the block spans all inner cells, its values are contiguous (e.g.: a single line along x)
+					const bool isContiguous = width == innerCount;
+
+					// ------ gather the lines of the block, padded by boundary values ------------------------
+					for (size_t p = 0; p < radius; p++)
+					{
+						std::copy_n(values.data() + base, width, lineBuffer.data() + p * width);
+						std::copy_n(values.data() + base + (axisCount - 1) * innerCount, width, lineBuffer.data() + (radius + axisCount + p) * width);
+					}
+					if (isContiguous)
+						std::copy_n(values.data() + base, axisCount * width, lineBuffer.data() + radius * width);
+					else
+					{
+						for (size_t a = 0; a < axisCount; a++)
+							std::copy_n(values.data() + base + a * innerCount, width, lineBuffer.data() + (radius + a) * width);
+					}
+
+					// ------ convolve: all lines of the block in a single contiguous loop per weight ---------------
+					const size_t filteredCount = axisCount * width;
+					double* filtered = filteredBuffer.data();
+					std::fill_n(filtered, filteredCount, 0.0);
+					for (size_t w = 0; w < weights.size(); w++)
+					{
+						const double weight = weights[w];
+						const double* source = lineBuffer.data() + w * width;
+						for (size_t m = 0; m < filteredCount; m++)
+							filtered[m] += weight * source[m];
+					}
+
+					// ------ scatter ---------------------------------------------------------------
+					if (isContiguous && isFrozen.Empty())
+					{
+						std::copy_n(filtered, filteredCount, values.data() + base);
+						continue;
+					}
+					for (size_t a = 0; a < axisCount; a++)
+					{
+						double* target = values.data() + base + a * innerCount;
+						const double* result = filtered + a * width;
+						if (isFrozen.Empty())
+						{
+							std::copy_n(result, width, target);
+							continue;
+						}
+
+						const size_t firstCellId = base + a * innerCount;
+						for (size_t lane = 0; lane < width; lane++)
+						{
+							if (!isFrozen.Test(firstCellId + lane))
+								target[lane] = result[lane];
+						}
+					}
+				}
+			});
+	}
+
+	MeshProcessingStatus ScalarGridFilter::Apply(ScalarGridData& gridData, const GridFilterSettings& settings)
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		const size_t cellCount = nx * ny * nz;
+		if (cellCount == 0 || gridData.CellData.size() != cellCount ||
+			(settings.Type == GridFilterType::Gaussian && settings.Sigma <= 0.0) ||
+			(settings.RespectFrozenCells && !gridData.CellIsFrozen.empty() && gridData.CellIsFrozen.size() != cellCount))
+			return MeshProcessingStatus::InvalidInput;
+
+		if (settings.Radius == 0 || settings.NIterations == 0)
+			return MeshProcessingStatus::Complete;
+
+		// std::vector<bool> is slow to read per cell, so frozen flags are copied to a bit mask (if there are any)
+		GridCellMask isFrozen;
+		if (settings.RespectFrozenCells && std::find(gridData.CellIsFrozen.begin(), gridData.CellIsFrozen.end(), true) != gridData.CellIsFrozen.end())
+			isFrozen = GridCellMask(gridData.CellIsFrozen);
+
+		const auto weights = GetKernelWeights(settings);
+		for (unsigned int iter = 0; iter < settings.NIterations; iter++)
+		{
+			FilterAxis(gridData.CellData, isFrozen, ny * nz, nx, 1, weights);
+			FilterAxis(gridData.CellData, isFrozen, nz, ny, nx, weights);
+			FilterAxis(gridData.CellData, isFrozen, 1, nz, nx * ny, weights);
+		}
+
+		return MeshProcessingStatus::Complete;
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,1352 @@
+/*!  \file TriangleBVH.cpp
+ *   \brief Implementation of a bounding volume hierarchy over mesh triangles for closest point, ray and box queries.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "TriangleBVH.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	using Point3 = std::array<double, 3>;
+
+	//!> \brief maximum number of SAH bins along an axis
+	constexpr unsigned int max_bvh_bin_count = 64;
+
+	//!> \brief depth below which nodes are split at the median instead of by SAH, so that traversal stacks cannot overflow
+	constexpr unsigned int max_sah_split_depth = 64;
+
+	//!> \brief size of traversal stacks (max_sah_split_depth + the depth of median splits of 2^32 triangles, with a margin)
+	constexpr size_t bvh_stack_size = 128;
+
+	//!> \brief minimum number of triangles of a node whose bounds and bins are accumulated in parallel
+	constexpr size_t min_parallel_binning_count = 65536;
+
+	//!> \brief minimum number of triangles of a subtree built as a separate parallel task (or refitted and rebuilt as a unit)
+	constexpr size_t min_subtree_task_size = 4096;
+
+	//!> \brief number of subtrees into which a hierarchy of many triangles is split for refitting and partial rebuilds
+	constexpr size_t refit_subtree_count = 64;
+
+	//!> \brief minimum number of triangles per thread for updating triangles from mesh vertices
+	constexpr size_t min_refit_chunk_size = 4096;
+
+	//=============================================================================
+	/// \struct BuildBounds
+	/// \brief Double precision bounds accumulated during construction.
+	//=============================================================================
+	struct BuildBounds
+	{
+		Point3 Min{ DBL_MAX, DBL_MAX, DBL_MAX };
+		Point3 Max{ -DBL_MAX, -DBL_MAX, -DBL_MAX };
+
+		void Grow(const Point3& min, const Point3& max)
+		{
+			for (size_t i = 0; i < 3; i++)
+			{
+				Min[i] = std::min(Min[i], min[i]);
+				Max[i] = std::max(Max[i], max[i]);
+			}
+		}
+
+		void Grow(const BuildBounds& bounds)
+		{
+			Grow(bounds.Min, bounds.Max);
+		}
+
+		[[nodiscard]] double HalfArea() const
+		{
+			if (Min[0] > Max[0])
+				return 0.0;
+
+			const double dx = Max[0] - Min[0];
+			const double dy = Max[1] - Min[1];
+			const double dz = Max[2] - Min[2];
+			return dx * dy + dy * dz + dz * dx;
+		}
+	};
+
+	//=============================================================================
+	/// \struct BuildPrimitive
+	/// \brief A triangle during construction, represented by its bounds. Its centroid is the center of its bounds.
+	//=============================================================================
+	struct BuildPrimitive
+	{
+		BuildBounds Bounds{};
+		uint32_t    TriangleId{ 0 };
+
+		[[nodiscard]] double Centroid(const size_t& axis) const
+		{
+			return 0.5 * (Bounds.Min[axis] + Bounds.Max[axis]);
+		}
+	};
+
+	//=============================================================================
+	/// \struct BuildBin
+	/// \brief A SAH bin of triangle centroids along an axis.
+	//=============================================================================
+	struct BuildBin
+	{
+		BuildBounds Bounds{};
+		size_t      Count{ 0 };
+	};
+
+	//=============================================================================
+	/// \struct SubtreeTask
+	/// \brief A subtree deferred to be built in parallel, replacing a placeholder node.
+	//=============================================================================
+	struct SubtreeTask
+	{
+		size_t       NodeId{ 0 };
+		size_t       First{ 0 };
+		size_t       Count{ 0 };
+		unsigned int Depth{ 0 };
+	};
+
+	//=============================================================================
+	/// \struct BVHBuilder
+	/// \brief Construction state shared by all subtrees: primitives are partitioned in place, and subtrees of at most
+	///        TaskSize triangles are deferred into Tasks (if Tasks is not null).
+	//=============================================================================
+	struct BVHBuilder
+	{
+		std::vector<BuildPrimitive>& Primitives;
+		const BVHSettings&           Settings;
+		unsigned int                 BinCount{ 0 };
+		std::vector<SubtreeTask>*    Tasks{ nullptr };
+		size_t                       TaskSize{ 0 };
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Rounds a double down to a float that is not greater.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static float RoundDownToFloat(const double& value)
+	{
+		const auto result = static_cast<float>(value);
+		return static_cast<double>(result) > value ? std::nextafter(result, -std::numeric_limits<float>::infinity()) : result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Rounds a double up to a float that is not smaller.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static float RoundUpToFloat(const double& value)
+	{
+		const auto result = static_cast<float>(value);
+		return static_cast<double>(result) < value ? std::nextafter(result, std::numeric_limits<float>::infinity()) : result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Accumulates bounds and centroid bounds of primitives [first, first + count), in parallel for large ranges.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void GetRangeBounds(const std::vector<BuildPrimitive>& primitives, const size_t& first, const size_t& count, BuildBounds& bounds, BuildBounds& centroidBounds)
+	{
+		const auto growChunkBounds = [&](const size_t& begin, const size_t& end, BuildBounds& chunkBounds, BuildBounds& chunkCentroidBounds)
+		{
+			for (size_t p = first + begin; p < first + end; p++)
+			{
+				const auto& primitive = primitives[p];
+				const Point3 centroid{ primitive.Centroid(0), primitive.Centroid(1), primitive.Centroid(2) };
+				chunkBounds.Grow(primitive.Bounds);
+				chunkCentroidBounds.Grow(centroid, centroid);
+			}
+		};
+
+		if (count < min_parallel_binning_count)
+		{
+			growChunkBounds(0, count, bounds, centroidBounds);
+			return;
+		}
+
+		const size_t chunkCount = Util::GetParallelChunkCount(count, min_parallel_binning_count / 2);
+		std::vector<BuildBounds> chunkBounds(chunkCount);
+		std::vector<BuildBounds> chunkCentroidBounds(chunkCount);
+		Util::ParallelForChunks(count, chunkCount,
+			[&](const size_t chunkIndex, const size_t begin, const size_t end)
+			{
+				growChunkBounds(begin, end, chunkBounds[chunkIndex], chunkCentroidBounds[chunkIndex]);
+			});
+
+		for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+		{
+			bounds.Grow(chunkBounds[chunkIndex]);
+			centroidBounds.Grow(chunkCentroidBounds[chunkIndex]);
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Bin of a centroid coordinate along an axis.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static size_t GetBinIndex(const double& centroid, const double& centroidMin, const double& binScale, const unsigned int& binCount)
+	{
+		const auto binIndex = static_cast<long long>((centroid - centroidMin) * binScale);
+		return static_cast<size_t>(std::clamp(binIndex, 0LL, static_cast<long long>(binCount) - 1));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Bins centroids of primitives [first, first + count) along all axes, in parallel for large ranges.
+	*   \param[in] builder          construction state.
+	*   \param[in] first            first primitive.
+	*   \param[in] count            number of primitives.
+	*   \param[in] centroidBounds   bounds of primitive centroids.
+	*   \param[in] binScales        number of bins per unit length along each axis.
+	*   \param[out] bins            bins along x, y and z (bin b along an axis is bins[axis * BinCount + b]).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void FillBins(const BVHBuilder& builder, const size_t& first, const size_t& count, const BuildBounds& centroidBounds, const Point3& binScales, std::vector<BuildBin>& bins)
+	{
+		const size_t binCount = builder.BinCount;
+		const auto fillChunkBins = [&](const size_t& begin, const size_t& end, std::vector<BuildBin>& chunkBins)
+		{
+			for (size_t p = first + begin; p < first + end; p++)
+			{
+				const auto& primitive = builder.Primitives[p];
+				for (size_t axis = 0; axis < 3; axis++)
+				{
+					auto& bin = chunkBins[axis * binCount + GetBinIndex(primitive.Centroid(axis), centroidBounds.Min[axis], binScales[axis], builder.BinCount)];
+					bin.Bounds.Grow(primitive.Bounds);
+					bin.Count++;
+				}
+			}
+		};
+
+		bins.assign(3 * binCount, BuildBin{});
+		if (count < min_parallel_binning_count)
+		{
+			fillChunkBins(0, count, bins);
+			return;
+		}
+
+		const size_t chunkCount = Util::GetParallelChunkCount(count, min_parallel_binning_count / 2);
+		std::vector<std::vector<BuildBin>> chunkBins(chunkCount, bins);
+		Util::ParallelForChunks(count, chunkCount,
+			[&](const size_t chunkIndex, const size_t begin, const size_t end)
+			{
+				fillChunkBins(begin, end, chunkBins[chunkIndex]);
+			});
+
+		for (const auto& localBins : chunkBins)
+		{
+			for (size_t b = 0; b < bins.size(); b++)
+			{
+				bins[b].Bounds.Grow(localBins[b].Bounds);
+				bins[b].Count += localBins[b].Count;
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Builds the subtree of a node over primitives [first, first + count). Children of inner nodes are appended
+	*          to the node array as adjacent pairs.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void BuildNode(const BVHBuilder& builder, std::vector<BVHNode>& nodes, const size_t& nodeId, const size_t& first, const size_t& count, const unsigned int& depth)
+	{
+		if (builder.Tasks && count <= builder.TaskSize)
+		{
+			builder.Tasks->push_back({ nodeId, first, count, depth });
+			return;
+		}
+
+		BuildBounds bounds;
+		BuildBounds centroidBounds;
+		GetRangeBounds(builder.Primitives, first, count, bounds, centroidBounds);
+		for (size_t i = 0; i < 3; i++)
+		{
+			nodes[nodeId].Min[i] = RoundDownToFloat(bounds.Min[i]);
+			nodes[nodeId].Max[i] = RoundUpToFloat(bounds.Max[i]);
+		}
+
+		const auto makeLeaf = [&]()
+		{
+			nodes[nodeId].Offset = static_cast<uint32_t>(first);
+			nodes[nodeId].Count = static_cast<uint32_t>(count);
+		};
+		if (count == 1)
+		{
+			makeLeaf();
+			return;
+		}
+
+		// ------ SAH split candidates between bins -------------------------------------------------------------------
+		const unsigned int binCount = builder.BinCount;
+		double bestCost = DBL_MAX;
+		size_t bestAxis = 0;
+		size_t bestSplit = 0;
+		if (depth < max_sah_split_depth)
+		{
+			Point3 binScales{};
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				const double extent = centroidBounds.Max[axis] - centroidBounds.Min[axis];
+				binScales[axis] = extent > 0.0 ? static_cast<double>(binCount) / extent : 0.0;
+			}
+
+			std::vector<BuildBin> bins;
+			FillBins(builder, first, count, centroidBounds, binScales, bins);
+
+			const double nodeArea = bounds.HalfArea();
+			std::array<double, max_bvh_bin_count> rightCosts{};
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				if (binScales[axis] == 0.0)
+					continue;
+
+				// costs of the right side of splits before bins binCount - 1, ..., 1
+				BuildBounds rightBounds;
+				size_t rightCount = 0;
+				for (size_t b = binCount - 1; b > 0; b--)
+				{
+					rightBounds.Grow(bins[axis * binCount + b].Bounds);
+					rightCount += bins[axis * binCount + b].Count;
+					rightCosts[b] = rightCount > 0 ? rightBounds.HalfArea() * static_cast<double>(rightCount) : -1.0;
+				}
+
+				BuildBounds leftBounds;
+				size_t leftCount = 0;
+				for (size_t b = 1; b < binCount; b++)
+				{
+					leftBounds.Grow(bins[axis * binCount + b - 1].Bounds);
+					leftCount += bins[axis * binCount + b - 1].Count;
+					if (leftCount == 0 || rightCosts[b] < 0.0)
+						continue;
+
+					const double cost = builder.Settings.TraversalCost +
+						(nodeArea > 0.0 ? (leftBounds.HalfArea() * static_cast<double>(leftCount) + rightCosts[b]) / nodeArea : static_cast<double>(count));
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = b;
+					}
+				}
+			}
+		}
+
+		if (count <= builder.Settings.MaxLeafSize && bestCost >= static_cast<double>(count))
+		{
+			makeLeaf();
+			return;
+		}
+
+		// ------ partition, or split at the median along the longest centroid extent --------------------------------
+		const auto begin = builder.Primitives.begin() + static_cast<std::ptrdiff_t>(first);
+		const auto end = begin + static_cast<std::ptrdiff_t>(count);
+		size_t leftCount = 0;
+		if (bestCost < DBL_MAX)
+		{
+			const double binScale = static_cast<double>(binCount) / (centroidBounds.Max[bestAxis] - centroidBounds.Min[bestAxis]);
+			const auto middle = std::partition(begin, end,
+				[&](const BuildPrimitive& primitive)
+				{
+					return GetBinIndex(primitive.Centroid(bestAxis), centroidBounds.Min[bestAxis], binScale, binCount) < bestSplit;
+				});
+			leftCount = static_cast<size_t>(middle - begin);
+		}
+		else
+		{
+			size_t axis = 0;
+			for (size_t i = 1; i < 3; i++)
+			{
+				if (centroidBounds.Max[i] - centroidBounds.Min[i] > centroidBounds.Max[axis] - centroidBounds.Min[axis])
+					axis = i;
+			}
+
+			leftCount = count / 2;
+			std::nth_element(begin, begin + static_cast<std::ptrdiff_t>(leftCount), end,
+				[axis](const BuildPrimitive& p1, const BuildPrimitive& p2) { return p1.Centroid(axis) < p2.Centroid(axis); });
+		}
+
+		const size_t leftId = nodes.size();
+		nodes.resize(leftId + 2);
+		nodes[nodeId].Offset = static_cast<uint32_t>(leftId);
+		nodes[nodeId].Count = 0;
+		BuildNode(builder, nodes, leftId, first, leftCount, depth + 1);
+		BuildNode(builder, nodes, leftId + 1, first + leftCount, count - leftCount, depth + 1);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Builds a hierarchy over triangles [first, first + count) and reorders them (with their ids and vertex indices)
+	*          into leaf order.
+	*   \param[in] triangles         triangles.
+	*   \param[in] triangleIds       ids of the triangles, reordered with them.
+	*   \param[in] vertexIndices     vertex indices of the triangles (or empty), reordered with them.
+	*   \param[in] first             first triangle of the range.
+	*   \param[in] count             number of triangles of the range.
+	*   \param[in] depth             depth of the root of the hierarchy (e.g.: of a rebuilt subtree).
+	*   \param[in] settings          construction settings.
+	*   \param[in] isParallel        if true, subtrees are built in parallel.
+	*   \return nodes of the hierarchy with the root first (leaves reference triangles by their index in triangles).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<BVHNode> BuildTriangleRange(std::vector<TrianglePoints>& triangles, std::vector<uint32_t>& triangleIds, std::vector<TriangleVertexIndices>& vertexIndices,
+		const size_t& first, const size_t& count, const unsigned int& depth, const BVHSettings& settings, const bool& isParallel)
+	{
+		std::vector<BuildPrimitive> primitives(count);
+		for (size_t p = 0; p < count; p++)
+		{
+			const auto& [a, b, c] = triangles[first + p];
+			for (size_t i = 0; i < 3; i++)
+			{
+				primitives[p].Bounds.Min[i] = std::min({ a[i], b[i], c[i] });
+				primitives[p].Bounds.Max[i] = std::max({ a[i], b[i], c[i] });
+			}
+			primitives[p].TriangleId = static_cast<uint32_t>(p);
+		}
+
+		// ------ the top of the hierarchy, deferring subtrees to be built in parallel -------------------------------
+		const size_t threadCount = isParallel ? Util::GetParallelThreadCount() : 1;
+		std::vector<SubtreeTask> tasks;
+		const BVHBuilder topBuilder{ primitives, settings, settings.BinCount,
+			threadCount > 1 ? &tasks : nullptr, std::max(min_subtree_task_size, count / (4 * threadCount)) };
+		std::vector<BVHNode> nodes;
+		nodes.reserve(2 * count / settings.MaxLeafSize + 1);
+		nodes.resize(1);
+		BuildNode(topBuilder, nodes, 0, 0, count, depth);
+
+		// ------ subtrees, each built into its own node array with the subtree root first ---------------------------
+		std::vector<std::vector<BVHNode>> subtreeNodes(tasks.size());
+		Util::ParallelForChunks(tasks.size(), Util::GetParallelChunkCount(tasks.size(), 1),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				const BVHBuilder subtreeBuilder{ primitives, settings, settings.BinCount, nullptr, 0 };
+				for (size_t taskId = begin; taskId < end; taskId++)
+				{
+					const auto& task = tasks[taskId];
+					auto& localNodes = subtreeNodes[taskId];
+					localNodes.reserve(2 * task.Count / settings.MaxLeafSize + 1);
+					localNodes.resize(1);
+					BuildNode(subtreeBuilder, localNodes, 0, task.First, task.Count, task.Depth);
+				}
+			});
+
+		// subtree roots replace their placeholder nodes, and the remaining subtree nodes are appended
+		for (size_t taskId = 0; taskId < tasks.size(); taskId++)
+		{
+			auto& localNodes = subtreeNodes[taskId];
+			const auto base = static_cast<uint32_t>(nodes.size());
+			for (auto& node : localNodes)
+			{
+				if (node.Count == 0)
+					node.Offset = base + node.Offset - 1;
+			}
+			nodes[tasks[taskId].NodeId] = localNodes[0];
+			nodes.insert(nodes.end(), localNodes.begin() + 1, localNodes.end());
+			std::vector<BVHNode>().swap(localNodes);
+		}
+		nodes.shrink_to_fit();
+
+		// ------ triangles in leaf order -------------------------------------------------------------------------------
+		for (auto& node : nodes)
+		{
+			if (node.Count > 0)
+				node.Offset += static_cast<uint32_t>(first);
+		}
+
+		std::vector<TrianglePoints> rangeTriangles(triangles.begin() + static_cast<std::ptrdiff_t>(first), triangles.begin() + static_cast<std::ptrdiff_t>(first + count));
+		std::vector<uint32_t> rangeTriangleIds(triangleIds.begin() + static_cast<std::ptrdiff_t>(first), triangleIds.begin() + static_cast<std::ptrdiff_t>(first + count));
+		for (size_t p = 0; p < count; p++)
+		{
+			triangles[first + p] = rangeTriangles[primitives[p].TriangleId];
+			triangleIds[first + p] = rangeTriangleIds[primitives[p].TriangleId];
+		}
+
+		if (!vertexIndices.empty())
+		{
+			std::vector<TriangleVertexIndices> rangeVertexIndices(vertexIndices.begin() + static_cast<std::ptrdiff_t>(first), vertexIndices.begin() + static_cast<std::ptrdiff_t>(first + count));
+			for (size_t p = 0; p < count; p++)
+				vertexIndices[first + p] = rangeVertexIndices[primitives[p].TriangleId];
+		}
+
+		return nodes;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Half surface area of a node's box.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetNodeHalfArea(const BVHNode& node)
+	{
+		const double dx = static_cast<double>(node.Max[0]) - static_cast<double>(node.Min[0]);
+		const double dy = static_cast<double>(node.Max[1]) - static_cast<double>(node.Min[1]);
+		const double dz = static_cast<double>(node.Max[2]) - static_cast<double>(node.Min[2]);
+		return dx * dy + dy * dz + dz * dx;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief SAH cost of an inner node from the costs of its children: the traversal cost plus the costs of the children
+	*          weighted by the probability of hitting them (their surface area relative to the node's).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetInnerNodeCost(const std::vector<BVHNode>& nodes, const BVHNode& node, const double& leftCost, const double& rightCost, const double& traversalCost)
+	{
+		const double area = GetNodeHalfArea(node);
+		if (area <= 0.0)
+			return traversalCost + leftCost + rightCost;
+
+		return traversalCost + (GetNodeHalfArea(nodes[node.Offset]) * leftCost + GetNodeHalfArea(nodes[node.Offset + 1]) * rightCost) / area;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief SAH costs of all nodes of a hierarchy (children follow their parents in the node array).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<float> GetNodeCosts(const std::vector<BVHNode>& nodes, const double& traversalCost)
+	{
+		std::vector<float> costs(nodes.size());
+		for (size_t nodeId = nodes.size(); nodeId-- > 0;)
+		{
+			const auto& node = nodes[nodeId];
+			costs[nodeId] = node.Count > 0 ? static_cast<float>(node.Count) :
+				static_cast<float>(GetInnerNodeCost(nodes, node, costs[node.Offset], costs[node.Offset + 1], traversalCost));
+		}
+		return costs;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Construction settings within their valid ranges.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static BVHSettings GetValidSettings(const BVHSettings& settings)
+	{
+		BVHSettings result = settings;
+		result.BinCount = std::clamp(settings.BinCount, 2u, max_bvh_bin_count);
+		result.MaxLeafSize = std::max(settings.MaxLeafSize, 1u);
+		result.TraversalCost = std::max(settings.TraversalCost, 0.0);
+		return result;
+	}
+
+	TriangleBVH::TriangleBVH(std::vector<TrianglePoints> triangles, const BVHSettings& settings)
+		: m_Triangles(std::move(triangles)), m_Settings(GetValidSettings(settings))
+	{
+		Build();
+	}
+
+	TriangleBVH::TriangleBVH(const BufferMeshGeometryData& meshData, const BVHSettings& settings)
+		: m_Settings(GetValidSettings(settings))
+	{
+		if (!CollectMeshTriangles(meshData, m_Triangles, m_TriangleVertexIds))
+		{
+			m_Triangles.clear();
+			m_TriangleVertexIds.clear();
+		}
+		Build();
+	}
+
+	TriangleBVH::TriangleBVH(const ReferencedMeshGeometryData& meshData, const BVHSettings& settings)
+		: m_Settings(GetValidSettings(settings))
+	{
+		if (!CollectMeshTriangles(meshData, m_Triangles, m_TriangleVertexIds))
+		{
+			m_Triangles.clear();
+			m_TriangleVertexIds.clear();
+		}
+		Build();
+	}
+
+	void TriangleBVH::Build()
+	{
+		m_TriangleIds.resize(m_Triangles.size());
+		for (size_t t = 0; t < m_Triangles.size(); t++)
+			m_TriangleIds[t] = static_cast<uint32_t>(t);
+
+		if (m_Triangles.empty())
+		{
+			m_Nodes.clear();
+			m_ReferenceCosts.clear();
+			return;
+		}
+
+		m_Nodes = BuildTriangleRange(m_Triangles, m_TriangleIds, m_TriangleVertexIds, 0, m_Triangles.size(), 0, m_Settings, true);
+		m_ReferenceCosts = GetNodeCosts(m_Nodes, m_Settings.TraversalCost);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Closest point of a triangle to a point [Ericson, Real-Time Collision Detection, 5.1.5].
+	*   \param[in] p         query point.
+	*   \param[in] tri       triangle vertices.
+	*   \return closest point.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static Point3 ClosestPointOnTriangle(const Point3& p, const TrianglePoints& tri)
+	{
+		const auto& [a, b, c] = tri;
+		const auto dot = [](const Point3& x, const Point3& y) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; };
+		const auto sub = [](const Point3& x, const Point3& y) { return Point3{ x[0] - y[0], x[1] - y[1], x[2] - y[2] }; };
+		const auto along = [](const Point3& x, const Point3& dir, const double& t) { return Point3{ x[0] + t * dir[0], x[1] + t * dir[1], x[2] + t * dir[2] }; };
+
+		const Point3 ab = sub(b, a);
+		const Point3 ac = sub(c, a);
+		const Point3 ap = sub(p, a);
+		const double d1 = dot(ab, ap);
+		const double d2 = dot(ac, ap);
+		if (d1 <= 0.0 && d2 <= 0.0)
+			return a;
+
+		const Point3 bp = sub(p, b);
+		const double d3 = dot(ab, bp);
+		const double d4 = dot(ac, bp);
+		if (d3 >= 0.0 && d4 <= d3)
+			return b;
+
+		const double vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+			return along(a, ab, d1 / (d1 - d3));
+
+		const Point3 cp = sub(p, c);
+		const double d5 = dot(ab, cp);
+		const double d6 = dot(ac, cp);
+		if (d6 >= 0.0 && d5 <= d6)
+			return c;
+
+		const double vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+			return along(a, ac, d2 / (d2 - d6));
+
+		const double va = d3 * d6 - d5 * d4;
+		if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+			return along(b, sub(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		// triangles degenerated by a refit have no interior, so their closest point lies on an edge
+		if (!(va + vb + vc > 0.0))
+		{
+			const auto closestOnSegment = [&](const Point3& x, const Point3& y)
+			{
+				const Point3 xy = sub(y, x);
+				const double lengthSquared = dot(xy, xy);
+				return lengthSquared > 0.0 ? along(x, xy, std::clamp(dot(sub(p, x), xy) / lengthSquared, 0.0, 1.0)) : x;
+			};
+			const auto distanceSquared = [&](const Point3& q) { const Point3 pq = sub(q, p); return dot(pq, pq); };
+			const std::array<Point3, 3> edgePoints{ closestOnSegment(a, b), closestOnSegment(b, c), closestOnSegment(c, a) };
+			return *std::min_element(edgePoints.begin(), edgePoints.end(),
+				[&](const Point3& q1, const Point3& q2) { return distanceSquared(q1) < distanceSquared(q2); });
+		}
+
+		const double denom = 1.0 / (va + vb + vc);
+		return along(along(a, ab, vb * denom), ac, vc * denom);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Squared distance of a point from a node's box (0 inside).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double PointNodeDistanceSquared(const Point3& p, const BVHNode& node)
+	{
+		double result = 0.0;
+		for (size_t i = 0; i < 3; i++)
+		{
+			const double d = std::max({ static_cast<double>(node.Min[i]) - p[i], 0.0, p[i] - static_cast<double>(node.Max[i]) });
+			result += d * d;
+		}
+		return result;
+	}
+
+	bool TriangleBVH::FindClosestPoint(const Vector3& point, BVHClosestPoint& result, const double& maxDistance) const
+	{
+		if (m_Nodes.empty())
+			return false;
+
+		const Point3 p{ point.X(), point.Y(), point.Z() };
+		double bestDistanceSquared = maxDistance * maxDistance;
+		Point3 bestPoint{};
+		size_t bestTriangle = m_Triangles.size();
+
+		std::array<uint32_t, bvh_stack_size> stack{};
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const auto& node = m_Nodes[stack[--stackSize]];
+			if (PointNodeDistanceSquared(p, node) >= bestDistanceSquared)
+				continue;
+
+			if (node.Count > 0)
+			{
+				for (uint32_t t = node.Offset; t < node.Offset + node.Count; t++)
+				{
+					const Point3 q = ClosestPointOnTriangle(p, m_Triangles[t]);
+					const double distanceSquared = (p[0] - q[0]) * (p[0] - q[0]) + (p[1] - q[1]) * (p[1] - q[1]) + (p[2] - q[2]) * (p[2] - q[2]);
+					if (distanceSquared < bestDistanceSquared)
+					{
+						bestDistanceSquared = distanceSquared;
+						bestPoint = q;
+						bestTriangle = t;
+					}
+				}
+				continue;
+			}
+
+			// the closer child is visited first
+			const double leftDistance = PointNodeDistanceSquared(p, m_Nodes[node.Offset]);
+			const double rightDistance = PointNodeDistanceSquared(p, m_Nodes[node.Offset + 1]);
+			const bool isLeftCloser = leftDistance < rightDistance;
+			const double fartherDistance = isLeftCloser ? rightDistance : leftDistance;
+			if (fartherDistance < bestDistanceSquared)
+				stack[stackSize++] = isLeftCloser ? node.Offset + 1 : node.Offset;
+			if (std::min(leftDistance, rightDistance) < bestDistanceSquared)
+				stack[stackSize++] = isLeftCloser ? node.Offset : node.Offset + 1;
+		}
+
+		if (bestTriangle == m_Triangles.size())
+			return false;
+
+		result.Point = Vector3(bestPoint[0], bestPoint[1], bestPoint[2]);
+		result.DistanceSquared = bestDistanceSquared;
+		result.TriangleId = m_TriangleIds[bestTriangle];
+		return true;
+	}
+
+	//=============================================================================
+	/// \struct BVHRay
+	/// \brief A ray prepared for box tests.
+	//=============================================================================
+	struct BVHRay
+	{
+		Point3 Origin{};
+		Point3 Direction{};
+		Point3 InvDirection{};   //!< reciprocal direction components (unused for zero components)
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Prepares a ray for box tests.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static BVHRay GetRay(const Vector3& origin, const Vector3& direction)
+	{
+		BVHRay ray{ { origin.X(), origin.Y(), origin.Z() }, { direction.X(), direction.Y(), direction.Z() }, {} };
+		for (size_t i = 0; i < 3; i++)
+			ray.InvDirection[i] = ray.Direction[i] != 0.0 ? 1.0 / ray.Direction[i] : 0.0;
+		return ray;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Slab test of a ray segment 0 <= t <= maxDistance with a node's box.
+	*   \param[in] ray          ray.
+	*   \param[in] node         node.
+	*   \param[in] maxDistance  upper bound of the ray parameter.
+	*   \param[out] entry       ray parameter at which the ray enters the box.
+	*   \return true if the segment intersects the box.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool IntersectRayNode(const BVHRay& ray, const BVHNode& node, const double& maxDistance, double& entry)
+	{
+		double tMin = 0.0;
+		double tMax = maxDistance;
+		for (size_t i = 0; i < 3; i++)
+		{
+			const auto min = static_cast<double>(node.Min[i]);
+			const auto max = static_cast<double>(node.Max[i]);
+			// rays parallel to the slab are tested explicitly (0 * inf would be NaN)
+			if (ray.Direction[i] == 0.0)
+			{
+				if (ray.Origin[i] < min || ray.Origin[i] > max)
+					return false;
+				continue;
+			}
+
+			double t1 = (min - ray.Origin[i]) * ray.InvDirection[i];
+			double t2 = (max - ray.Origin[i]) * ray.InvDirection[i];
+			if (t1 > t2)
+				std::swap(t1, t2);
+			tMin = std::max(tMin, t1);
+			tMax = std::min(tMax, t2);
+			if (tMin > tMax)
+				return false;
+		}
+		entry = tMin;
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Ray-triangle intersection from both sides [Möller & Trumbore, 1997].
+	*   \param[in] ray          ray.
+	*   \param[in] tri          triangle vertices.
+	*   \param[in] maxDistance  exclusive upper bound of the ray parameter.
+	*   \param[out] hit         ray parameter and barycentric coordinates of the hit (Distance, U, V).
+	*   \return true if the ray hits the triangle at 0 <= t < maxDistance.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool IntersectRayTriangle(const BVHRay& ray, const TrianglePoints& tri, const double& maxDistance, BVHRayHit& hit)
+	{
+		const auto& [a, b, c] = tri;
+		const auto cross = [](const Point3& x, const Point3& y) { return Point3{ x[1] * y[2] - x[2] * y[1], x[2] * y[0] - x[0] * y[2], x[0] * y[1] - x[1] * y[0] }; };
+		const auto dot = [](const Point3& x, const Point3& y) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; };
+
+		const Point3 e1{ b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+		const Point3 e2{ c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+		const Point3 pVec = cross(ray.Direction, e2);
+		const double det = dot(e1, pVec);
+		if (det == 0.0)
+			return false;
+
+		const double invDet = 1.0 / det;
+		const Point3 tVec{ ray.Origin[0] - a[0], ray.Origin[1] - a[1], ray.Origin[2] - a[2] };
+		const double u = dot(tVec, pVec) * invDet;
+		if (u < 0.0 || u > 1.0)
+			return false;
+
+		const Point3 qVec = cross(tVec, e1);
+		const double v = dot(ray.Direction, qVec) * invDet;
+		if (v < 0.0 || u + v > 1.0)
+			return false;
+
+		const double t = dot(e2, qVec) * invDet;
+		if (t < 0.0 || t >= maxDistance)
+			return false;
+
+		hit.Distance = t;
+		hit.U = u;
+		hit.V = v;
+		return true;
+	}
+
+	bool TriangleBVH::IntersectRay(const Vector3& origin, const Vector3& direction, BVHRayHit& hit, const double& maxDistance) const
+	{
+		if (m_Nodes.empty())
+			return false;
+
+		const auto ray = GetRay(origin, direction);
+		BVHRayHit bestHit;
+		bestHit.Distance = maxDistance;
+		size_t bestTriangle = m_Triangles.size();
+
+		std::array<uint32_t, bvh_stack_size> stack{};
+		size_t stackSize = 0;
+		double entry = 0.0;
+		if (IntersectRayNode(ray, m_Nodes[0], maxDistance, entry))
+			stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const auto& node = m_Nodes[stack[--stackSize]];
+			if (node.Count > 0)
+			{
+				for (uint32_t t = node.Offset; t < node.Offset + node.Count; t++)
+				{
+					if (IntersectRayTriangle(ray, m_Triangles[t], bestHit.Distance, bestHit))
+						bestTriangle = t;
+				}
+				continue;
+			}
+
+			// children are tested against the closest hit so far, and the closer one is visited first
+			double leftEntry = 0.0;
+			double rightEntry = 0.0;
+			const bool isLeftHit = IntersectRayNode(ray, m_Nodes[node.Offset], bestHit.Distance, leftEntry);
+			const bool isRightHit = IntersectRayNode(ray, m_Nodes[node.Offset + 1], bestHit.Distance, rightEntry);
+			if (isLeftHit && isRightHit)
+			{
+				const bool isLeftCloser = leftEntry <= rightEntry;
+				stack[stackSize++] = isLeftCloser ? node.Offset + 1 : node.Offset;
+				stack[stackSize++] = isLeftCloser ? node.Offset : node.Offset + 1;
+			}
+			else if (isLeftHit || isRightHit)
+				stack[stackSize++] = isLeftHit ? node.Offset : node.Offset + 1;
+		}
+
+		if (bestTriangle == m_Triangles.size())
+			return false;
+
+		hit = bestHit;
+		hit.TriangleId = m_TriangleIds[bestTriangle];
+		return true;
+	}
+
+	bool TriangleBVH::IsRayOccluded(const Vector3& origin, const Vector3& direction, const double& maxDistance) const
+	{
+		if (m_Nodes.empty())
+			return false;
+
+		const auto ray = GetRay(origin, direction);
+		BVHRayHit hit;
+		std::array<uint32_t, bvh_stack_size> stack{};
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const auto& node = m_Nodes[stack[--stackSize]];
+			double entry = 0.0;
+			if (!IntersectRayNode(ray, node, maxDistance, entry))
+				continue;
+
+			if (node.Count > 0)
+			{
+				for (uint32_t t = node.Offset; t < node.Offset + node.Count; t++)
+				{
+					if (IntersectRayTriangle(ray, m_Triangles[t], maxDistance, hit))
+						return true;
+				}
+				continue;
+			}
+
+			stack[stackSize++] = node.Offset + 1;
+			stack[stackSize++] = node.Offset;
+		}
+		return false;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Exact triangle-box overlap test by separating axes [Akenine-Möller, 2001]: box face normals, the triangle
+	*          normal, and cross products of triangle edges with box axes.
+	*   \param[in] tri          triangle vertices.
+	*   \param[in] center       box center.
+	*   \param[in] halfSize     box half size.
+	*   \return true if the triangle and the box overlap (including boundary contact).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool TriangleOverlapsBox(const TrianglePoints& tri, const Point3& center, const Point3& halfSize)
+	{
+		const std::array<Point3, 3> v{ {
+			{ tri[0][0] - center[0], tri[0][1] - center[1], tri[0][2] - center[2] },
+			{ tri[1][0] - center[0], tri[1][1] - center[1], tri[1][2] - center[2] },
+			{ tri[2][0] - center[0], tri[2][1] - center[1], tri[2][2] - center[2] } } };
+
+		// box face normals
+		for (size_t i = 0; i < 3; i++)
+		{
+			if (std::min({ v[0][i], v[1][i], v[2][i] }) > halfSize[i] || std::max({ v[0][i], v[1][i], v[2][i] }) < -halfSize[i])
+				return false;
+		}
+
+		const auto separates = [&v, &halfSize](const Point3& axis)
+		{
+			const double p0 = axis[0] * v[0][0] + axis[1] * v[0][1] + axis[2] * v[0][2];
+			const double p1 = axis[0] * v[1][0] + axis[1] * v[1][1] + axis[2] * v[1][2];
+			const double p2 = axis[0] * v[2][0] + axis[1] * v[2][1] + axis[2] * v[2][2];
+			const double radius = halfSize[0] * std::fabs(axis[0]) + halfSize[1] * std::fabs(axis[1]) + halfSize[2] * std::fabs(axis[2]);
+			return std::min({ p0, p1, p2 }) > radius || std::max({ p0, p1, p2 }) < -radius;
+		};
+
+		// triangle normal
+		const std::array<Point3, 3> edges{ {
+			{ v[1][0] - v[0][0], v[1][1] - v[0][1], v[1][2] - v[0][2] },
+			{ v[2][0] - v[1][0], v[2][1] - v[1][1], v[2][2] - v[1][2] },
+			{ v[0][0] - v[2][0], v[0][1] - v[2][1], v[0][2] - v[2][2] } } };
+		const Point3 normal{
+			edges[0][1] * edges[1][2] - edges[0][2] * edges[1][1],
+			edges[0][2] * edges[1][0] - edges[0][0] * edges[1][2],
+			edges[0][0] * edges[1][1] - edges[0][1] * edges[1][0] };
+		if (separates(normal))
+			return false;
+
+		// cross products of triangle edges with box axes e_i x edge
+		for (const auto& edge : edges)
+		{
+			if (separates({ 0.0, -edge[2], edge[1] }) || separates({ edge[2], 0.0, -edge[0] }) || separates({ -edge[1], edge[0], 0.0 }))
+				return false;
+		}
+		return true;
+	}
+
+	void TriangleBVH::CollectTrianglesInBox(const Box3& box, std::vector<size_t>& triangleIds) const
+	{
+		triangleIds.clear();
+		const Point3 min{ box.Min().X(), box.Min().Y(), box.Min().Z() };
+		const Point3 max{ box.Max().X(), box.Max().Y(), box.Max().Z() };
+		if (m_Nodes.empty() || min[0] > max[0] || min[1] > max[1] || min[2] > max[2])
+			return;
+
+		const Point3 center{ 0.5 * (min[0] + max[0]), 0.5 * (min[1] + max[1]), 0.5 * (min[2] + max[2]) };
+		const Point3 halfSize{ 0.5 * (max[0] - min[0]), 0.5 * (max[1] - min[1]), 0.5 * (max[2] - min[2]) };
+
+		std::array<uint32_t, bvh_stack_size> stack{};
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const auto& node = m_Nodes[stack[--stackSize]];
+			if (max[0] < node.Min[0] || min[0] > node.Max[0] || max[1] < node.Min[1] || min[1] > node.Max[1] || max[2] < node.Min[2] || min[2] > node.Max[2])
+				continue;
+
+			if (node.Count > 0)
+			{
+				for (uint32_t t = node.Offset; t < node.Offset + node.Count; t++)
+				{
+					if (TriangleOverlapsBox(m_Triangles[t], center, halfSize))
+						triangleIds.push_back(m_TriangleIds[t]);
+				}
+				continue;
+			}
+
+			stack[stackSize++] = node.Offset + 1;
+			stack[stackSize++] = node.Offset;
+		}
+	}
+
+	Box3 TriangleBVH::GetBoundingBox() const
+	{
+		if (m_Nodes.empty())
+			return {};
+
+		const auto& root = m_Nodes[0];
+		return {
+			Vector3(static_cast<double>(root.Min[0]), static_cast<double>(root.Min[1]), static_cast<double>(root.Min[2])),
+			Vector3(static_cast<double>(root.Max[0]), static_cast<double>(root.Max[1]), static_cast<double>(root.Max[2])) };
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Updates triangles (in leaf order) from current positions of their mesh vertices, in parallel.
+	*   \param[in] triangles         triangles in leaf order.
+	*   \param[in] vertexIndices     mesh vertex indices of the triangles.
+	*   \param[in] vertexCount       number of mesh vertices.
+	*   \param[in] getPosition       position of a mesh vertex by its index.
+	*   \return false if a vertex index is out of range (triangles stay unchanged).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename GetPosition>
+	static bool UpdateTriangleVertices(std::vector<TrianglePoints>& triangles, const std::vector<TriangleVertexIndices>& vertexIndices, const size_t& vertexCount, const GetPosition& getPosition)
+	{
+		if (vertexIndices.size() != triangles.size() ||
+			!std::ranges::all_of(vertexIndices, [&vertexCount](const TriangleVertexIndices& ids) { return std::ranges::all_of(ids, [&vertexCount](const unsigned int& id) { return id < vertexCount; }); }))
+			return false;
+
+		Util::ParallelForChunks(triangles.size(), Util::GetParallelChunkCount(triangles.size(), min_refit_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				for (size_t t = begin; t < end; t++)
+				{
+					for (size_t j = 0; j < 3; j++)
+						triangles[t][j] = getPosition(vertexIndices[t][j]);
+				}
+			});
+		return true;
+	}
+
+	bool TriangleBVH::Refit(const std::vector<TrianglePoints>& triangles, BVHRefitStats* refitStats)
+	{
+		if (triangles.size() != m_Triangles.size())
+			return false;
+
+		Util::ParallelForChunks(m_Triangles.size(), Util::GetParallelChunkCount(m_Triangles.size(), min_refit_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				for (size_t t = begin; t < end; t++)
+					m_Triangles[t] = triangles[m_TriangleIds[t]];
+			});
+
+		RefitNodes(refitStats);
+		return true;
+	}
+
+	bool TriangleBVH::Refit(const BufferMeshGeometryData& meshData, BVHRefitStats* refitStats)
+	{
+		const auto& coords = meshData.VertexCoords;
+		if (!UpdateTriangleVertices(m_Triangles, m_TriangleVertexIds, coords.size() / 3,
+			[&coords](const unsigned int& vertexId) { return Point3{ coords[3 * vertexId], coords[3 * vertexId + 1], coords[3 * vertexId + 2] }; }))
+			return false;
+
+		RefitNodes(refitStats);
+		return true;
+	}
+
+	bool TriangleBVH::Refit(const ReferencedMeshGeometryData& meshData, BVHRefitStats* refitStats)
+	{
+		const auto& vertices = meshData.Vertices;
+		if (!UpdateTriangleVertices(m_Triangles, m_TriangleVertexIds, vertices.size(),
+			[&vertices](const unsigned int& vertexId)
+			{
+				const auto& position = vertices[vertexId].Position();
+				return Point3{ position.X(), position.Y(), position.Z() };
+			}))
+			return false;
+
+		RefitNodes(refitStats);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Updates the bounds and SAH cost of a node from its triangles (leaf) or its children (inner node).
+	*   \param[in] nodes             nodes of the hierarchy.
+	*   \param[in] triangles         triangles in leaf order.
+	*   \param[in] costs             SAH costs of nodes (the costs of children of an inner node are already updated).
+	*   \param[in] nodeId            node to update.
+	*   \param[in] traversalCost     SAH traversal cost.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void RefitNode(std::vector<BVHNode>& nodes, const std::vector<TrianglePoints>& triangles, std::vector<float>& costs, const size_t& nodeId, const double& traversalCost)
+	{
+		auto& node = nodes[nodeId];
+		if (node.Count > 0)
+		{
+			BuildBounds bounds;
+			for (uint32_t t = node.Offset; t < node.Offset + node.Count; t++)
+			{
+				for (const auto& vertex : triangles[t])
+					bounds.Grow(vertex, vertex);
+			}
+			for (size_t i = 0; i < 3; i++)
+			{
+				node.Min[i] = RoundDownToFloat(bounds.Min[i]);
+				node.Max[i] = RoundUpToFloat(bounds.Max[i]);
+			}
+			costs[nodeId] = static_cast<float>(node.Count);
+			return;
+		}
+
+		const auto& left = nodes[node.Offset];
+		const auto& right = nodes[node.Offset + 1];
+		for (size_t i = 0; i < 3; i++)
+		{
+			node.Min[i] = std::min(left.Min[i], right.Min[i]);
+			node.Max[i] = std::max(left.Max[i], right.Max[i]);
+		}
+		costs[nodeId] = static_cast<float>(GetInnerNodeCost(nodes, node, costs[node.Offset], costs[node.Offset + 1], traversalCost));
+	}
+
+	void TriangleBVH::RefitNodes(BVHRefitStats* refitStats)
+	{
+		if (refitStats)
+			*refitStats = {};
+		if (m_Nodes.empty())
+			return;
+
+		// ------ triangle ranges of subtrees (children follow their parents in the node array) -----------------------
+		const size_t nodeCount = m_Nodes.size();
+		std::vector<uint32_t> subtreeFirsts(nodeCount);
+		std::vector<uint32_t> subtreeCounts(nodeCount);
+		for (size_t nodeId = nodeCount; nodeId-- > 0;)
+		{
+			const auto& node = m_Nodes[nodeId];
+			subtreeFirsts[nodeId] = node.Count > 0 ? node.Offset : std::min(subtreeFirsts[node.Offset], subtreeFirsts[node.Offset + 1]);
+			subtreeCounts[nodeId] = node.Count > 0 ? node.Count : subtreeCounts[node.Offset] + subtreeCounts[node.Offset + 1];
+		}
+
+		// ------ subtrees refitted (and possibly rebuilt) in parallel, and the top nodes above them in preorder ------
+		const size_t maxSubtreeSize = std::max(min_subtree_task_size, m_Triangles.size() / refit_subtree_count);
+		std::vector<std::pair<uint32_t, unsigned int>> subtreeRoots;
+		std::vector<uint32_t> topNodeIds;
+		std::vector<std::pair<uint32_t, unsigned int>> stack{ { 0, 0 } };
+		while (!stack.empty())
+		{
+			const auto [nodeId, depth] = stack.back();
+			stack.pop_back();
+			const auto& node = m_Nodes[nodeId];
+			if (node.Count > 0 || subtreeCounts[nodeId] <= maxSubtreeSize)
+			{
+				subtreeRoots.emplace_back(nodeId, depth);
+				continue;
+			}
+
+			topNodeIds.push_back(nodeId);
+			stack.emplace_back(node.Offset + 1, depth + 1);
+			stack.emplace_back(node.Offset, depth + 1);
+		}
+
+		std::vector<float> costs(nodeCount);
+		Util::ParallelForChunks(subtreeRoots.size(), Util::GetParallelChunkCount(subtreeRoots.size(), 1),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				std::vector<uint32_t> subtreeNodeIds;
+				std::vector<uint32_t> subtreeStack;
+				for (size_t rootId = begin; rootId < end; rootId++)
+				{
+					// preorder visits parents before children, so its reverse updates nodes bottom-up
+					subtreeNodeIds.clear();
+					subtreeStack.assign(1, subtreeRoots[rootId].first);
+					while (!subtreeStack.empty())
+					{
+						const auto nodeId = subtreeStack.back();
+						subtreeStack.pop_back();
+						subtreeNodeIds.push_back(nodeId);
+						if (m_Nodes[nodeId].Count == 0)
+							subtreeStack.insert(subtreeStack.end(), { m_Nodes[nodeId].Offset + 1, m_Nodes[nodeId].Offset });
+					}
+					for (auto it = subtreeNodeIds.rbegin(); it != subtreeNodeIds.rend(); ++it)
+						RefitNode(m_Nodes, m_Triangles, costs, *it, m_Settings.TraversalCost);
+				}
+			});
+
+		const auto refitTopNodes = [&]()
+		{
+			for (auto it = topNodeIds.rbegin(); it != topNodeIds.rend(); ++it)
+				RefitNode(m_Nodes, m_Triangles, costs, *it, m_Settings.TraversalCost);
+		};
+		refitTopNodes();
+
+		const auto isDegraded = [&](const uint32_t& nodeId)
+		{
+			return m_Settings.RebuildCostRatio > 0.0 && m_Nodes[nodeId].Count == 0 &&
+				static_cast<double>(costs[nodeId]) > m_Settings.RebuildCostRatio * static_cast<double>(m_ReferenceCosts[nodeId]);
+		};
+
+		// ------ rebuild of subtrees whose SAH cost degraded (their triangle ranges are disjoint) ---------------------
+		std::vector<size_t> degradedRootIds;
+		for (size_t rootId = 0; rootId < subtreeRoots.size(); rootId++)
+		{
+			if (isDegraded(subtreeRoots[rootId].first))
+				degradedRootIds.push_back(rootId);
+		}
+
+		std::vector<std::vector<BVHNode>> rebuiltNodes(degradedRootIds.size());
+		std::vector<std::vector<float>> rebuiltCosts(degradedRootIds.size());
+		Util::ParallelForChunks(degradedRootIds.size(), Util::GetParallelChunkCount(degradedRootIds.size(), 1),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				for (size_t k = begin; k < end; k++)
+				{
+					const auto& [rootNodeId, depth] = subtreeRoots[degradedRootIds[k]];
+					rebuiltNodes[k] = BuildTriangleRange(m_Triangles, m_TriangleIds, m_TriangleVertexIds,
+						subtreeFirsts[rootNodeId], subtreeCounts[rootNodeId], depth, m_Settings, false);
+					rebuiltCosts[k] = GetNodeCosts(rebuiltNodes[k], m_Settings.TraversalCost);
+					// the rebuilt subtree spans the same triangles, so the bounds of its root do not change
+					costs[rootNodeId] = rebuiltCosts[k][0];
+				}
+			});
+
+		size_t rebuiltTriangleCount = 0;
+		for (const auto& rootId : degradedRootIds)
+			rebuiltTriangleCount += subtreeCounts[subtreeRoots[rootId].first];
+
+		if (!degradedRootIds.empty())
+			refitTopNodes();
+
+		// ------ a degraded top of the hierarchy is rebuilt entirely ------------------------------------------------
+		if (!topNodeIds.empty() && isDegraded(0))
+		{
+			m_Nodes = BuildTriangleRange(m_Triangles, m_TriangleIds, m_TriangleVertexIds, 0, m_Triangles.size(), 0, m_Settings, true);
+			m_ReferenceCosts = GetNodeCosts(m_Nodes, m_Settings.TraversalCost);
+			if (refitStats)
+			{
+				refitStats->SAHCost = static_cast<double>(m_ReferenceCosts[0]);
+				refitStats->RebuiltSubtreeCount = 1;
+				refitStats->RebuiltTriangleCount = m_Triangles.size();
+				refitStats->IsFullyRebuilt = true;
+			}
+			return;
+		}
+
+		if (refitStats)
+		{
+			refitStats->SAHCost = static_cast<double>(costs[0]);
+			refitStats->RebuiltSubtreeCount = degradedRootIds.size();
+			refitStats->RebuiltTriangleCount = rebuiltTriangleCount;
+		}
+		if (degradedRootIds.empty())
+			return;
+
+		// ------ flattening with rebuilt subtrees in place of the degraded ones -------------------------------------
+		std::vector<const std::vector<BVHNode>*> replacedNodes(nodeCount, nullptr);
+		std::vector<const std::vector<float>*> replacedCosts(nodeCount, nullptr);
+		for (size_t k = 0; k < degradedRootIds.size(); k++)
+		{
+			replacedNodes[subtreeRoots[degradedRootIds[k]].first] = &rebuiltNodes[k];
+			replacedCosts[subtreeRoots[degradedRootIds[k]].first] = &rebuiltCosts[k];
+		}
+
+		struct FlattenedNode
+		{
+			uint32_t                     NodeId{ 0 };
+			const std::vector<BVHNode>*  SourceNodes{ nullptr };
+			const std::vector<float>*    SourceCosts{ nullptr };
+			uint32_t                     SourceNodeId{ 0 };
+		};
+
+		std::vector<BVHNode> nodes(1);
+		std::vector<float> referenceCosts(1);
+		nodes.reserve(nodeCount);
+		referenceCosts.reserve(nodeCount);
+		std::vector<FlattenedNode> flattenStack{ { 0, &m_Nodes, &m_ReferenceCosts, 0 } };
+		while (!flattenStack.empty())
+		{
+			auto item = flattenStack.back();
+			flattenStack.pop_back();
+			if (item.SourceNodes == &m_Nodes && replacedNodes[item.SourceNodeId])
+			{
+				item.SourceCosts = replacedCosts[item.SourceNodeId];
+				item.SourceNodes = replacedNodes[item.SourceNodeId];
+				item.SourceNodeId = 0;
+			}
+
+			const auto& node = (*item.SourceNodes)[item.SourceNodeId];
+			nodes[item.NodeId] = node;
+			referenceCosts[item.NodeId] = (*item.SourceCosts)[item.SourceNodeId];
+			if (node.Count > 0)
+				continue;
+
+			const auto leftId = static_cast<uint32_t>(nodes.size());
+			nodes.resize(leftId + 2);
+			referenceCosts.resize(leftId + 2);
+			nodes[item.NodeId].Offset = leftId;
+			flattenStack.push_back({ leftId + 1, item.SourceNodes, item.SourceCosts, node.Offset + 1 });
+			flattenStack.push_back({ leftId, item.SourceNodes, item.SourceCosts, node.Offset });
+		}
+
+		m_Nodes = std::move(nodes);
+		m_ReferenceCosts = std::move(referenceCosts);
+	}
+
+	double TriangleBVH::GetSAHCost() const
+	{
+		return m_Nodes.empty() ? 0.0 : static_cast<double>(GetNodeCosts(m_Nodes, m_Settings.TraversalCost)[0]);
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
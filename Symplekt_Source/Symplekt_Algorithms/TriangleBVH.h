@@ -0,0 +1,335 @@
+/*!  \file TriangleBVH.h
+ *   \brief A bounding volume hierarchy over mesh triangles for closest point, ray and box queries.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/Box3.h"
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/Vector3.h"
+
+#include "MeshTriangleSoup.h"
+
+#include <array>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+namespace Symplektis::Algorithms
+{
+	//=============================================================================
+	/// \struct BVHSettings
+	/// \brief A data container for all major settings for TriangleBVH construction.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct BVHSettings
+	{
+		unsigned int BinCount{ 16 };       //>! number of bins along each axis for evaluating split candidates by the surface area heuristic (SAH), at most 64.
+		unsigned int MaxLeafSize{ 8 };     //>! nodes with more triangles are always split, smaller nodes become leaves if splitting does not lower their SAH cost.
+		double TraversalCost{ 1.0 };       //>! SAH cost of traversing an inner node relative to the cost of a triangle test.
+		double RebuildCostRatio{ 1.5 };    //>! TriangleBVH::Refit rebuilds subtrees whose SAH cost grew by more than this factor since they were built (0 disables rebuilds).
+	};
+
+	//=============================================================================
+	/// \struct BVHNode
+	/// \brief A node of TriangleBVH (32 bytes, so that two sibling nodes fit into a cache line). Bounds are stored in single
+	///        precision, rounded outwards, so they always contain the double precision triangles.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct alignas(32) BVHNode
+	{
+		std::array<float, 3> Min{};
+		std::array<float, 3> Max{};
+		uint32_t             Offset{ 0 };   //!< left child of an inner node (the right child directly follows it), or the first triangle of a leaf
+		uint32_t             Count{ 0 };    //!< number of triangles of a leaf (0 for inner nodes)
+	};
+
+	//=============================================================================
+	/// \struct BVHClosestPoint
+	/// \brief Result of a TriangleBVH closest point query.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct BVHClosestPoint
+	{
+		GeometryKernel::Vector3 Point{};          //!< closest point on the triangles
+		double                  DistanceSquared{ DBL_MAX };
+		size_t                  TriangleId{ 0 };  //!< index of the closest triangle in the input triangle soup
+	};
+
+	//=============================================================================
+	/// \struct BVHRayHit
+	/// \brief Result of a TriangleBVH ray query.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct BVHRayHit
+	{
+		double Distance{ DBL_MAX };   //!< ray parameter t of the hit point origin + t * direction (the distance for a unit direction)
+		double U{ 0.0 };              //!< barycentric coordinate of the hit point w.r.t. the second triangle vertex
+		double V{ 0.0 };              //!< barycentric coordinate of the hit point w.r.t. the third triangle vertex
+		size_t TriangleId{ 0 };       //!< index of the hit triangle in the input triangle soup
+	};
+
+	//=============================================================================
+	/// \struct BVHRefitStats
+	/// \brief Instrumentation data of a TriangleBVH refit.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct BVHRefitStats
+	{
+		double SAHCost{ 0.0 };                 //!< SAH cost of the hierarchy after the refit (see TriangleBVH::GetSAHCost)
+		size_t RebuiltSubtreeCount{ 0 };       //!< number of subtrees rebuilt because their SAH cost degraded
+		size_t RebuiltTriangleCount{ 0 };      //!< number of triangles of rebuilt subtrees
+		bool   IsFullyRebuilt{ false };        //!< true if the top of the hierarchy degraded, and the whole hierarchy was rebuilt
+	};
+
+	//=============================================================================
+	/// \class TriangleBVH
+	/// \brief A bounding volume hierarchy over a triangle soup (e.g.: from CollectMeshTriangles).
+	///
+	///        Nodes are split by the binned surface area heuristic [Wald, 2007]: triangle centroids are binned along each
+	///        axis, and the split plane between bins with the lowest expected cost of traversal and triangle tests is chosen.
+	///        The top of the hierarchy is built with binning on multiple threads, and its remaining subtrees are built
+	///        in parallel. All nodes are then flattened into a single array in which sibling nodes are adjacent,
+	///        and triangles are reordered so that each leaf references a contiguous range.
+	///
+	///        Queries are stack-based traversals (visiting the closer child first), are const, and can run from multiple
+	///        threads at once: closest point, first ray hit, any ray hit (occlusion), and triangles overlapping a box.
+	///        Triangles are tested from both sides by rays.
+	///
+	///        For deforming meshes with fixed connectivity, Refit updates triangles from current vertex positions and node
+	///        bounds bottom-up (in parallel over subtrees of at most max(4096, n / 64) triangles) without changing the
+	///        topology of the hierarchy. Refitted bounds loosen as triangles move, so the SAH cost of each subtree is
+	///        compared with its cost after it was built, and subtrees degraded past BVHSettings::RebuildCostRatio
+	///        are rebuilt in place (the whole hierarchy, if its top degraded).
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class TriangleBVH
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from a triangle soup.
+		*   \param[in] triangles         triangle soup.
+		*   \param[in] settings          construction settings.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit TriangleBVH(std::vector<TrianglePoints> triangles, const BVHSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from a buffer triangle mesh (VertexIndices read as triangle index triples, see CollectMeshTriangles).
+		*          Invalid mesh data results in a hierarchy without triangles.
+		*   \param[in] meshData          buffer mesh geometry data.
+		*   \param[in] settings          construction settings.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit TriangleBVH(const GeometryKernel::BufferMeshGeometryData& meshData, const BVHSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from a referenced mesh (polygonal faces are fan-triangulated, see CollectMeshTriangles). Invalid mesh
+		*          data results in a hierarchy without triangles.
+		*   \param[in] meshData          referenced mesh geometry data.
+		*   \param[in] settings          construction settings.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit TriangleBVH(const GeometryKernel::ReferencedMeshGeometryData& meshData, const BVHSettings& settings = {});
+
+		/// @{
+		/// \name Refit
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Refits the hierarchy to moved triangles of a triangle soup.
+		*   \param[in] triangles         triangle soup of the same size and order as the one the hierarchy was built from.
+		*   \param[out] refitStats       if not null, filled with instrumentation data of the refit.
+		*   \return false if the size of the triangle soup differs (the hierarchy stays unchanged).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool Refit(const std::vector<TrianglePoints>& triangles, BVHRefitStats* refitStats = nullptr);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Refits the hierarchy built from a buffer mesh to its current vertex coordinates. Triangles dropped as degenerate
+		*          during construction stay excluded.
+		*   \param[in] meshData          buffer mesh geometry data with the connectivity of the one the hierarchy was built from.
+		*   \param[out] refitStats       if not null, filled with instrumentation data of the refit.
+		*   \return false if the hierarchy was not built from a mesh or a vertex index is out of range (it stays unchanged).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool Refit(const GeometryKernel::BufferMeshGeometryData& meshData, BVHRefitStats* refitStats = nullptr);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Refits the hierarchy built from a referenced mesh to its current vertex positions. Triangles dropped as
+		*          degenerate during construction stay excluded.
+		*   \param[in] meshData          referenced mesh geometry data with the connectivity of the one the hierarchy was built from.
+		*   \param[out] refitStats       if not null, filled with instrumentation data of the refit.
+		*   \return false if the hierarchy was not built from a mesh or a vertex index is out of range (it stays unchanged).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool Refit(const GeometryKernel::ReferencedMeshGeometryData& meshData, BVHRefitStats* refitStats = nullptr);
+
+		/// @{
+		/// \name Queries
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Finds the closest point on the triangles to a point.
+		*   \param[in] point             query point.
+		*   \param[out] result           closest point (unchanged if none is found).
+		*   \param[in] maxDistance       only triangles closer than maxDistance are considered.
+		*   \return true if a triangle closer than maxDistance was found.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool FindClosestPoint(const GeometryKernel::Vector3& point, BVHClosestPoint& result, const double& maxDistance = DBL_MAX) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Finds the first hit of a ray origin + t * direction, 0 <= t < maxDistance.
+		*   \param[in] origin            ray origin.
+		*   \param[in] direction         ray direction (not necessarily normalized).
+		*   \param[out] hit              the hit with the smallest t (unchanged if there is none).
+		*   \param[in] maxDistance       upper bound of the ray parameter t.
+		*   \return true if the ray hits a triangle.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IntersectRay(const GeometryKernel::Vector3& origin, const GeometryKernel::Vector3& direction, BVHRayHit& hit, const double& maxDistance = DBL_MAX) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Tests whether a ray origin + t * direction, 0 <= t < maxDistance, hits any triangle (the traversal stops
+		*          at the first hit found).
+		*   \param[in] origin            ray origin.
+		*   \param[in] direction         ray direction (not necessarily normalized).
+		*   \param[in] maxDistance       upper bound of the ray parameter t.
+		*   \return true if the ray hits a triangle.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IsRayOccluded(const GeometryKernel::Vector3& origin, const GeometryKernel::Vector3& direction, const double& maxDistance = DBL_MAX) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Collects triangles overlapping a box (by an exact separating axis test, boundary contact counts as overlap).
+		*   \param[in] box               query box.
+		*   \param[out] triangleIds      indices of overlapping triangles in the input triangle soup (in no particular order).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void CollectTrianglesInBox(const GeometryKernel::Box3& box, std::vector<size_t>& triangleIds) const;
+
+		/// @{
+		/// \name Getters
+
+		[[nodiscard]] size_t TriangleCount() const
+		{
+			return m_Triangles.size();
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Bounding box of all triangles, i.e.: of the root node, rounded outwards to single precision (empty if there
+		*          are no triangles).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] GeometryKernel::Box3 GetBoundingBox() const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief SAH cost of the hierarchy, i.e.: the expected cost of a query reaching the root in units of triangle
+		*          tests (nested costs of children weighted by their surface area relative to their parent's).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double GetSAHCost() const;
+
+		[[nodiscard]] const std::vector<BVHNode>& Nodes() const
+		{
+			return m_Nodes;
+		}
+
+	private:
+		//-----------------------------------------------------------------------------
+		/*! \brief Builds the hierarchy over m_Triangles (in input order).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Build();
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Updates node bounds to the updated m_Triangles, and rebuilds subtrees whose SAH cost degraded.
+		*   \param[out] refitStats       if not null, filled with instrumentation data of the refit.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void RefitNodes(BVHRefitStats* refitStats);
+
+		//
+		// ==================================
+		//
+
+		std::vector<TrianglePoints>        m_Triangles{};          //!> triangles in leaf order
+		std::vector<uint32_t>              m_TriangleIds{};        //!> indices of triangles (in leaf order) in the input triangle soup
+		std::vector<TriangleVertexIndices> m_TriangleVertexIds{};  //!> mesh vertex indices of triangles in leaf order (empty if not built from a mesh)
+		std::vector<BVHNode>               m_Nodes{};              //!> flattened nodes, the root is the first one
+		std::vector<float>                 m_ReferenceCosts{};     //!> SAH costs of nodes after their subtree was (re)built
+		BVHSettings                        m_Settings{};           //!> construction settings
+	};
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
@@ -0,0 +1,248 @@
+/*! \file  DistanceField_Tests.cpp
+ *  \brief Unit tests for the signed distance field evaluation of meshes.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/OBJImporter.h"
+
+#include "Symplekt_Algorithms/DistanceFieldEvaluator.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	/// \brief Exact signed distance of a point to an axis-aligned box given by its center and half-size.
+	static double BoxSignedDistance(const double x, const double y, const double z, const Vector3& center, const double& halfSize)
+	{
+		const double qx = std::fabs(x - center.X()) - halfSize;
+		const double qy = std::fabs(y - center.Y()) - halfSize;
+		const double qz = std::fabs(z - center.Z()) - halfSize;
+		const double outX = std::max(qx, 0.0), outY = std::max(qy, 0.0), outZ = std::max(qz, 0.0);
+		return std::sqrt(outX * outX + outY * outY + outZ * outZ) + std::min(std::max(qx, std::max(qy, qz)), 0.0);
+	}
+
+	/// \brief A unit cube [0, 1]^3 with 12 outward oriented triangles.
+	static BufferMeshGeometryData GetUnitCubeBufferMesh()
+	{
+		BufferMeshGeometryData meshData{ L"UnitCube" };
+		meshData.VertexCoords = {
+			0.0, 0.0, 0.0,   1.0, 0.0, 0.0,   1.0, 1.0, 0.0,   0.0, 1.0, 0.0,
+			0.0, 0.0, 1.0,   1.0, 0.0, 1.0,   1.0, 1.0, 1.0,   0.0, 1.0, 1.0
+		};
+		meshData.VertexIndices = {
+			0, 2, 1,   0, 3, 2,   4, 5, 6,   4, 6, 7,
+			0, 1, 5,   0, 5, 4,   2, 3, 7,   2, 7, 6,
+			0, 4, 7,   0, 7, 3,   1, 2, 6,   1, 6, 5
+		};
+		return meshData;
+	}
+
+	TEST(DistanceField_Tests, EmptyBufferMesh_Evaluate_InvalidInput)
+	{
+		// Arrange
+		const BufferMeshGeometryData meshData{ L"EmptyMesh" };
+		auto gridData = InitializeScalarGridData({ L"Grid", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.5, 0.0 });
+
+		// Act
+		const auto resultState = DistanceFieldEvaluator::Evaluate(meshData, gridData);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::InvalidInput);
+	}
+
+	TEST(DistanceField_Tests, UnitCubeBufferMesh_Evaluate_BandExactAndSignsCorrect)
+	{
+		// Arrange
+		const auto meshData = GetUnitCubeBufferMesh();
+		auto gridData = InitializeScalarGridData({ L"UnitCubeSDF", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 2.0, 2.0, 2.0 } }, 0.1, 0.0 });
+		const Vector3 cubeCenter{ 0.5, 0.5, 0.5 };
+		const auto& gridMin = gridData.BoundingBox.Min();
+
+		// Act
+		const auto resultState = DistanceFieldEvaluator::Evaluate(meshData, gridData);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		size_t frozenCount = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++)
+				{
+					const size_t cellId = i + gridData.XCellCount * (j + gridData.YCellCount * k);
+					const double exactDistance = BoxSignedDistance(
+						gridMin.X() + (i + 0.5) * gridData.CellSize,
+						gridMin.Y() + (j + 0.5) * gridData.CellSize,
+						gridMin.Z() + (k + 0.5) * gridData.CellSize, cubeCenter, 0.5);
+					if (gridData.CellIsFrozen[cellId])
+					{
+						frozenCount++;
+						EXPECT_NEAR(gridData.CellData[cellId], exactDistance, 1e-9);
+						continue;
+					}
+					// fast sweeping is a first order approximation of the exact distance outside the band
+					EXPECT_NEAR(gridData.CellData[cellId], exactDistance, 0.5 * std::fabs(exactDistance) + gridData.CellSize);
+					EXPECT_EQ(gridData.CellData[cellId] < 0.0, exactDistance < 0.0);
+				}
+			}
+		}
+		EXPECT_GT(frozenCount, 0);
+		EXPECT_LT(frozenCount, gridData.CellData.size());
+	}
+
+	TEST(DistanceField_Tests, UnitCubeBufferMesh_EvaluateUnsignedWithoutFill_NonNegativeAndClamped)
+	{
+		// Arrange
+		const auto meshData = GetUnitCubeBufferMesh();
+		auto gridData = InitializeScalarGridData({ L"UnitCubeUDF", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 2.0, 2.0, 2.0 } }, 0.1, 0.0 });
+		DistanceFieldSettings settings;
+		settings.ComputeSign = false;
+		settings.FillOutsideBand = false;
+		settings.NarrowBandWidth = 2.0;
+
+		// Act
+		const auto resultState = DistanceFieldEvaluator::Evaluate(meshData, gridData, settings);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		const double bandRadius = settings.NarrowBandWidth * gridData.CellSize;
+		for (size_t cellId = 0; cellId < gridData.CellData.size(); cellId++)
+		{
+			EXPECT_GE(gridData.CellData[cellId], 0.0);
+			if (!gridData.CellIsFrozen[cellId])
+				EXPECT_DOUBLE_EQ(gridData.CellData[cellId], bandRadius);
+		}
+	}
+
+	TEST(DistanceField_Tests, CubeReferencedMesh_Evaluate_CenterAndCornerValues)
+	{
+		// Arrange
+		const auto importedFilePath = symplektRootPath / "Symplekt_ResourceData\\" / "Cube.obj";
+		ASSERT_EQ(IOService::OBJImporter::Import(importedFilePath), IOService::ImportStatus::Complete);
+		const auto meshData = IOService::ConvertIODataToReferencedMeshGeometryData(IOService::OBJImporter::Data());
+		auto gridData = InitializeScalarGridData({ L"CubeSDF", Box3{ Vector3{ -70.0, -70.0, -20.0 }, Vector3{ 70.0, 70.0, 120.0 } }, 5.0, 0.0 });
+		const Vector3 cubeCenter{ 0.0, 0.0, 50.0 };
+		const auto& gridMin = gridData.BoundingBox.Min();
+
+		// Act
+		const auto resultState = DistanceFieldEvaluator::Evaluate(meshData, gridData);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		const auto cellIdOfPoint = [&gridData, &gridMin](const double x, const double y, const double z)
+		{
+			const auto i = static_cast<size_t>((x - gridMin.X()) / gridData.CellSize);
+			const auto j = static_cast<size_t>((y - gridMin.Y()) / gridData.CellSize);
+			const auto k = static_cast<size_t>((z - gridMin.Z()) / gridData.CellSize);
+			return std::tuple{ i, j, k, i + gridData.XCellCount * (j + gridData.YCellCount * k) };
+		};
+		const auto [iCenter, jCenter, kCenter, centerCellId] = cellIdOfPoint(1.0, 1.0, 51.0);
+		EXPECT_NEAR(gridData.CellData[centerCellId], BoxSignedDistance(
+			gridMin.X() + (iCenter + 0.5) * gridData.CellSize,
+			gridMin.Y() + (jCenter + 0.5) * gridData.CellSize,
+			gridMin.Z() + (kCenter + 0.5) * gridData.CellSize, cubeCenter, 50.0), 0.5 * gridData.CellSize);
+		EXPECT_LT(gridData.CellData[centerCellId], -40.0);
+
+		const auto [iNear, jNear, kNear, nearCellId] = cellIdOfPoint(51.0, 1.0, 51.0);
+		EXPECT_TRUE(gridData.CellIsFrozen[nearCellId]);
+		EXPECT_NEAR(gridData.CellData[nearCellId], BoxSignedDistance(
+			gridMin.X() + (iNear + 0.5) * gridData.CellSize,
+			gridMin.Y() + (jNear + 0.5) * gridData.CellSize,
+			gridMin.Z() + (kNear + 0.5) * gridData.CellSize, cubeCenter, 50.0), 1e-9);
+
+		const auto [iCorner, jCorner, kCorner, cornerCellId] = cellIdOfPoint(-68.0, -68.0, -18.0);
+		EXPECT_GT(gridData.CellData[cornerCellId], 0.0);
+	}
+
+	TEST(DistanceField_Tests, OpenCubeBufferMesh_Evaluate_SignsCorrectAwayFromSurface)
+	{
+		// Arrange: the unit cube without its top face (z = 1), so scanline parity is unreliable and winding numbers decide
+		auto meshData = GetUnitCubeBufferMesh();
+		meshData.VertexIndices.erase(meshData.VertexIndices.begin() + 6, meshData.VertexIndices.begin() + 12);
+		auto gridData = InitializeScalarGridData({ L"OpenCubeSDF", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 2.0, 2.0, 2.0 } }, 0.1, 0.0 });
+		const Vector3 cubeCenter{ 0.5, 0.5, 0.5 };
+		const auto& gridMin = gridData.BoundingBox.Min();
+
+		// Act
+		const auto resultState = DistanceFieldEvaluator::Evaluate(meshData, gridData);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		size_t insideCount = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++)
+				{
+					const double exactDistance = BoxSignedDistance(
+						gridMin.X() + (i + 0.5) * gridData.CellSize,
+						gridMin.Y() + (j + 0.5) * gridData.CellSize,
+						gridMin.Z() + (k + 0.5) * gridData.CellSize, cubeCenter, 0.5);
+					// the generalized winding number degrades smoothly across the hole, so cells close to it are not checked
+					if (std::fabs(exactDistance) < 2.0 * gridData.CellSize)
+						continue;
+
+					const size_t cellId = i + gridData.XCellCount * (j + gridData.YCellCount * k);
+					ASSERT_EQ(gridData.CellData[cellId] < 0.0, exactDistance < 0.0);
+					if (exactDistance < 0.0)
+						insideCount++;
+				}
+			}
+		}
+		EXPECT_GT(insideCount, 0);
+	}
+
+	TEST(DistanceField_Tests, DISABLED_ResourceMeshes_EvaluateAt128To512_Timings)
+	{
+		for (const auto& fileName : { "bunnySimple.obj", "teapot.obj", "MetaPolyhedron.obj" })
+		{
+			// Arrange
+			ASSERT_EQ(IOService::OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / fileName), IOService::ImportStatus::Complete);
+			const auto meshData = IOService::ConvertIODataToBufferMeshGeometryData(IOService::OBJImporter::Data());
+			Box3 meshBox;
+			for (size_t i = 0; i + 2 < meshData.VertexCoords.size(); i += 3)
+				meshBox.ExpandByPoint(Vector3{ meshData.VertexCoords[i], meshData.VertexCoords[i + 1], meshData.VertexCoords[i + 2] });
+			const auto meshSize = meshBox.GetSize();
+			const double maxSize = std::max({ meshSize.X(), meshSize.Y(), meshSize.Z() });
+
+			for (const size_t resolution : { 128, 256, 512 })
+			{
+				// the longest axis of the grid box (padded by 5% of the mesh size on each side) has the given cell count
+				const double cellSize = 1.1 * maxSize / static_cast<double>(resolution);
+				Box3 gridBox{ meshBox.Min(), meshBox.Max() };
+				gridBox.ExpandByOffset(0.05 * maxSize);
+				auto gridData = InitializeScalarGridData({ L"SDF", gridBox, cellSize, 0.0 });
+
+				// Act
+				const auto start = std::chrono::steady_clock::now();
+				const auto resultState = DistanceFieldEvaluator::Evaluate(meshData, gridData);
+				const auto end = std::chrono::steady_clock::now();
+
+				// Assert
+				EXPECT_EQ(resultState, MeshProcessingStatus::Complete);
+				std::cout << fileName << " " << gridData.XCellCount << " x " << gridData.YCellCount << " x " << gridData.ZCellCount << ": "
+					<< std::chrono::duration<double>(end - start).count() << " s\n";
+			}
+		}
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
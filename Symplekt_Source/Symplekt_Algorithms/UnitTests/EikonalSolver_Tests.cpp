@@ -0,0 +1,182 @@
+/*! \file  EikonalSolver_Tests.cpp
+ *  \brief Unit tests for the fast marching and fast sweeping eikonal solvers.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+
+#include "Symplekt_Algorithms/EikonalSolver.h"
+
+#include <cmath>
+#include <limits>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	/// \brief A 41^3 grid with cell size 0.1 and a single seed cell with zero value at its center cell (20, 20, 20).
+	static ScalarGridData GetPointSeedGrid()
+	{
+		auto gridData = InitializeScalarGridData({ L"EikonalGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 4.1, 4.1, 4.1 } }, 0.1, 0.0 });
+		const size_t centerId = 20 + gridData.XCellCount * (20 + gridData.YCellCount * 20);
+		gridData.CellData[centerId] = 0.0;
+		gridData.CellIsFrozen[centerId] = true;
+		return gridData;
+	}
+
+	/// \brief Euclidean distance of cell (i, j, k) from the center cell (20, 20, 20) of a grid with cell size 0.1.
+	static double GetDistanceFromCenterCell(const size_t& i, const size_t& j, const size_t& k)
+	{
+		const double di = static_cast<double>(i) - 20.0;
+		const double dj = static_cast<double>(j) - 20.0;
+		const double dk = static_cast<double>(k) - 20.0;
+		return 0.1 * std::sqrt(di * di + dj * dj + dk * dk);
+	}
+
+	TEST(EikonalSolver_Tests, GridWithoutFrozenCells_Solve_InvalidInput)
+	{
+		// Arrange
+		auto gridData = InitializeScalarGridData({ L"EikonalGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.1, 0.0 });
+
+		// Act
+		const auto resultState = EikonalSolver::Solve(gridData);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::InvalidInput);
+	}
+
+	TEST(EikonalSolver_Tests, PointSeed_SolveFastMarching_FirstOrderDistanceApproximation)
+	{
+		// Arrange
+		auto gridData = GetPointSeedGrid();
+
+		// Act
+		const auto resultState = EikonalSolver::Solve(gridData);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+				{
+					const double distance = GetDistanceFromCenterCell(i, j, k);
+					// first order schemes overestimate diagonal distances, mostly near the point seed
+					ASSERT_GE(gridData.CellData[cellId], distance - 1e-9);
+					ASSERT_LE(gridData.CellData[cellId], 1.3 * distance + gridData.CellSize);
+				}
+			}
+		}
+		EXPECT_NEAR(gridData.CellData[35 + gridData.XCellCount * (20 + gridData.YCellCount * 20)], 1.5, 1e-9);
+	}
+
+	TEST(EikonalSolver_Tests, PointSeed_SolveFastSweeping_EqualToFastMarching)
+	{
+		// Arrange
+		auto marchedData = GetPointSeedGrid();
+		auto sweptData = GetPointSeedGrid();
+		EikonalSolverSettings sweepSettings;
+		sweepSettings.Method = EikonalSolverMethod::FastSweeping;
+
+		// Act
+		const auto marchState = EikonalSolver::Solve(marchedData);
+		const auto sweepState = EikonalSolver::Solve(sweptData, sweepSettings);
+
+		// Assert
+		ASSERT_EQ(marchState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(sweepState, MeshProcessingStatus::Complete);
+		for (size_t cellId = 0; cellId < marchedData.CellData.size(); cellId++)
+			ASSERT_NEAR(sweptData.CellData[cellId], marchedData.CellData[cellId], 1e-9);
+	}
+
+	TEST(EikonalSolver_Tests, PointSeed_SolveWithDistanceLimit_OnlyBandEvaluated)
+	{
+		// Arrange
+		auto limitedData = GetPointSeedGrid();
+		auto fullData = GetPointSeedGrid();
+		EikonalSolverSettings settings;
+		settings.DistanceLimit = 0.55;
+
+		// Act
+		const auto limitedState = EikonalSolver::Solve(limitedData, settings);
+		const auto fullState = EikonalSolver::Solve(fullData);
+
+		// Assert
+		ASSERT_EQ(limitedState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(fullState, MeshProcessingStatus::Complete);
+		size_t bandCellCount = 0;
+		for (size_t cellId = 0; cellId < limitedData.CellData.size(); cellId++)
+		{
+			if (fullData.CellData[cellId] <= settings.DistanceLimit)
+			{
+				bandCellCount++;
+				ASSERT_DOUBLE_EQ(limitedData.CellData[cellId], fullData.CellData[cellId]);
+			}
+			else
+				ASSERT_DOUBLE_EQ(limitedData.CellData[cellId], settings.DistanceLimit);
+		}
+		EXPECT_GT(bandCellCount, 100);
+		EXPECT_LT(bandCellCount, limitedData.CellData.size() / 50);
+	}
+
+	TEST(EikonalSolver_Tests, PointSeed_SolveFastSweepingWithDistanceLimit_EqualToFastMarching)
+	{
+		// Arrange
+		auto marchedData = GetPointSeedGrid();
+		auto sweptData = GetPointSeedGrid();
+		EikonalSolverSettings settings;
+		settings.DistanceLimit = 0.55;
+
+		// Act
+		const auto marchState = EikonalSolver::Solve(marchedData, settings);
+		settings.Method = EikonalSolverMethod::FastSweeping;
+		const auto sweepState = EikonalSolver::Solve(sweptData, settings);
+
+		// Assert
+		ASSERT_EQ(marchState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(sweepState, MeshProcessingStatus::Complete);
+		for (size_t cellId = 0; cellId < marchedData.CellData.size(); cellId++)
+			ASSERT_NEAR(sweptData.CellData[cellId], marchedData.CellData[cellId], 1e-9);
+	}
+
+	TEST(EikonalSolver_Tests, PointSeedWithWallObstacle_SolveWithSpeed_ArrivalTimesScaledAndDetoured)
+	{
+		// Arrange: speed 2 everywhere except for a wall at i = 25 with a gap at j > 35
+		auto marchedData = GetPointSeedGrid();
+		auto sweptData = GetPointSeedGrid();
+		EikonalSolverSettings settings;
+		settings.Speed = [](const size_t i, const size_t j, const size_t /*k*/) { return (i == 25 && j <= 35) ? 0.0 : 2.0; };
+		settings.NSweepIterations = 4;
+
+		// Act
+		const auto marchState = EikonalSolver::Solve(marchedData, settings);
+		settings.Method = EikonalSolverMethod::FastSweeping;
+		const auto sweepState = EikonalSolver::Solve(sweptData, settings);
+
+		// Assert
+		ASSERT_EQ(marchState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(sweepState, MeshProcessingStatus::Complete);
+		const size_t X = marchedData.XCellCount;
+		const size_t Y = marchedData.YCellCount;
+		const size_t frontCellId = 15 + X * (20 + Y * 20);
+		const size_t wallCellId = 25 + X * (20 + Y * 20);
+		const size_t behindWallCellId = 30 + X * (20 + Y * 20);
+		EXPECT_NEAR(marchedData.CellData[frontCellId], 0.25, 1e-9);
+		EXPECT_DOUBLE_EQ(marchedData.CellData[wallCellId], std::numeric_limits<double>::max());
+		// the shortest path around the wall through the gap is 2 * sqrt(0.5^2 + 1.55^2) long (instead of 1.0 through the wall)
+		const double detourLength = 2.0 * std::sqrt(0.5 * 0.5 + 1.55 * 1.55);
+		EXPECT_GT(marchedData.CellData[behindWallCellId], 0.5 * detourLength);
+		EXPECT_LT(marchedData.CellData[behindWallCellId], 0.5 * 1.3 * detourLength);
+		for (size_t cellId = 0; cellId < marchedData.CellData.size(); cellId++)
+			ASSERT_NEAR(sweptData.CellData[cellId], marchedData.CellData[cellId], 1e-9);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
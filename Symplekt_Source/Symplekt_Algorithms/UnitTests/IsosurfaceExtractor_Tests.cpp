@@ -0,0 +1,192 @@
+/*! \file  IsosurfaceExtractor_Tests.cpp
+ *  \brief Unit tests for the marching cubes isosurface extraction of scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+#include "Symplekt_GeometryKernel/Vector3Utils.h"
+
+#include "Symplekt_Algorithms/IsosurfaceExtractor.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <utility>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	/// \brief Fills grid cell values from a function of cell center coordinates.
+	static void FillGridValues(ScalarGridData& gridData, const std::function<double(double, double, double)>& valueFunction)
+	{
+		const Vector3 min = gridData.BoundingBox.Min();
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+					gridData.CellData[cellId] = valueFunction(
+						min.X() + (static_cast<double>(i) + 0.5) * gridData.CellSize,
+						min.Y() + (static_cast<double>(j) + 0.5) * gridData.CellSize,
+						min.Z() + (static_cast<double>(k) + 0.5) * gridData.CellSize);
+	}
+
+	/// \brief Counts directed triangle edges. In an oriented manifold every edge is used once in each direction.
+	static std::map<std::pair<unsigned int, unsigned int>, unsigned int> CountDirectedEdges(const BufferMeshGeometryData& meshData)
+	{
+		std::map<std::pair<unsigned int, unsigned int>, unsigned int> edgeCounts;
+		for (size_t t = 0; t + 2 < meshData.VertexIndices.size(); t += 3)
+		{
+			for (size_t e = 0; e < 3; e++)
+				edgeCounts[{ meshData.VertexIndices[t + e], meshData.VertexIndices[t + (e + 1) % 3] }]++;
+		}
+		return edgeCounts;
+	}
+
+	TEST(IsosurfaceExtractor_Tests, FlatGrid_Extract_InvalidInput)
+	{
+		// Arrange
+		auto gridData = InitializeScalarGridData({ L"FlatGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 1.0, 0.1 } }, 0.1, 0.0 });
+		BufferMeshGeometryData meshData{ L"Isosurface" };
+
+		// Act
+		const auto resultState = IsosurfaceExtractor::Extract(gridData, meshData);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::InvalidInput);
+	}
+
+	TEST(IsosurfaceExtractor_Tests, SphereDistanceField_Extract_ClosedOrientedSphereMesh)
+	{
+		// Arrange
+		const Vector3 center{ 0.03, -0.02, 0.01 };
+		constexpr double radius = 0.7;
+		auto gridData = InitializeScalarGridData({ L"SphereGrid", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.05, 0.0 });
+		FillGridValues(gridData, [&](const double x, const double y, const double z)
+			{ return std::sqrt((x - center.X()) * (x - center.X()) + (y - center.Y()) * (y - center.Y()) + (z - center.Z()) * (z - center.Z())) - radius; });
+		BufferMeshGeometryData meshData{ L"Isosurface" };
+
+		// Act
+		const auto resultState = IsosurfaceExtractor::Extract(gridData, meshData);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		EXPECT_EQ(meshData.Type, PolyMeshType::Triangular);
+		const size_t vertexCount = meshData.VertexCoords.size() / 3;
+		const size_t triangleCount = meshData.VertexIndices.size() / 3;
+		ASSERT_GT(triangleCount, 1000);
+		ASSERT_EQ(meshData.VertexNormalCoords.size(), meshData.VertexCoords.size());
+		ASSERT_EQ(meshData.TriangulationIndices.size(), triangleCount);
+		EXPECT_EQ(meshData.TriangulationIndices[triangleCount - 1], std::vector<unsigned int>{ static_cast<unsigned int>(triangleCount - 1) });
+
+		const auto edgeCounts = CountDirectedEdges(meshData);
+		for (const auto& [edge, count] : edgeCounts)
+		{
+			ASSERT_EQ(count, 1);
+			ASSERT_EQ(edgeCounts.count({ edge.second, edge.first }), 1);
+		}
+		// Euler characteristic of a sphere
+		EXPECT_EQ(static_cast<long long>(vertexCount) - static_cast<long long>(edgeCounts.size() / 2) + static_cast<long long>(triangleCount), 2);
+
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			const Vector3 position{ meshData.VertexCoords[3 * v], meshData.VertexCoords[3 * v + 1], meshData.VertexCoords[3 * v + 2] };
+			const Vector3 normal{ meshData.VertexNormalCoords[3 * v], meshData.VertexNormalCoords[3 * v + 1], meshData.VertexNormalCoords[3 * v + 2] };
+			const Vector3 radial = position - center;
+			ASSERT_NEAR(radial.GetLength(), radius, 0.01);
+			ASSERT_GT(normal.DotProduct(radial) / radial.GetLength(), 0.99);
+		}
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			Vector3 corners[3];
+			for (size_t c = 0; c < 3; c++)
+			{
+				const size_t v = meshData.VertexIndices[3 * t + c];
+				corners[c] = Vector3{ meshData.VertexCoords[3 * v], meshData.VertexCoords[3 * v + 1], meshData.VertexCoords[3 * v + 2] };
+			}
+			const Vector3 faceNormal = CrossProduct(corners[1] - corners[0], corners[2] - corners[0]);
+			ASSERT_GE(faceNormal.DotProduct(corners[0] - center), 0.0);
+		}
+	}
+
+	TEST(IsosurfaceExtractor_Tests, SaddleRichField_Extract_OrientedManifoldWithBoundaryOnlyOnGridBoundary)
+	{
+		// Arrange: a periodic field with many saddles, producing ambiguous cube faces
+		auto gridData = InitializeScalarGridData({ L"SaddleGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 3.0, 2.5, 4.0 } }, 0.1, 0.0 });
+		FillGridValues(gridData, [](const double x, const double y, const double z)
+			{ return std::sin(4.1 * x) * std::sin(3.7 * y) * std::sin(3.3 * z) + 0.3 * std::cos(5.3 * x + 2.9 * z); });
+		IsosurfaceSettings settings;
+		settings.IsoValue = 0.05;
+		settings.ComputeNormals = false;
+		BufferMeshGeometryData meshData{ L"Isosurface" };
+
+		// Act
+		const auto resultState = IsosurfaceExtractor::Extract(gridData, meshData, settings);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		EXPECT_TRUE(meshData.VertexNormalCoords.empty());
+		ASSERT_GT(meshData.VertexIndices.size(), 3000);
+
+		const Vector3 min = gridData.BoundingBox.Min();
+		const auto isOnGridBoundary = [&](const unsigned int& vertexId)
+		{
+			const size_t counts[3] = { gridData.XCellCount, gridData.YCellCount, gridData.ZCellCount };
+			const double minCoords[3] = { min.X(), min.Y(), min.Z() };
+			for (size_t c = 0; c < 3; c++)
+			{
+				const double index = (meshData.VertexCoords[3 * static_cast<size_t>(vertexId) + c] - minCoords[c]) / gridData.CellSize - 0.5;
+				if (std::fabs(index) < 1e-9 || std::fabs(index - static_cast<double>(counts[c] - 1)) < 1e-9)
+					return true;
+			}
+			return false;
+		};
+
+		size_t boundaryEdgeCount = 0;
+		const auto edgeCounts = CountDirectedEdges(meshData);
+		for (const auto& [edge, count] : edgeCounts)
+		{
+			ASSERT_EQ(count, 1);
+			if (edgeCounts.count({ edge.second, edge.first }) == 1)
+				continue;
+
+			ASSERT_TRUE(isOnGridBoundary(edge.first) && isOnGridBoundary(edge.second));
+			boundaryEdgeCount++;
+		}
+		EXPECT_GT(boundaryEdgeCount, 0);
+	}
+
+	TEST(IsosurfaceExtractor_Tests, DISABLED_SphereDistanceField512_Extract_Timing)
+	{
+		// Arrange
+		constexpr double radius = 0.8;
+		auto gridData = InitializeScalarGridData({ L"SphereGrid512", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 2.0 / 512.0, 0.0 });
+		FillGridValues(gridData, [&](const double x, const double y, const double z) { return std::sqrt(x * x + y * y + z * z) - radius; });
+		BufferMeshGeometryData meshData{ L"Isosurface" };
+
+		// Act
+		const auto extractStart = std::chrono::steady_clock::now();
+		const auto resultState = IsosurfaceExtractor::Extract(gridData, meshData);
+		const auto extractEnd = std::chrono::steady_clock::now();
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::Complete);
+		EXPECT_EQ(gridData.XCellCount * gridData.YCellCount * gridData.ZCellCount, 512 * 512 * 512);
+		std::cout << "grid: " << gridData.XCellCount << " x " << gridData.YCellCount << " x " << gridData.ZCellCount << "\n";
+		std::cout << "triangles: " << meshData.VertexIndices.size() / 3 << ", vertices: " << meshData.VertexCoords.size() / 3 << "\n";
+		std::cout << "extract: " << std::chrono::duration<double>(extractEnd - extractStart).count() << " s on "
+			<< Util::GetParallelThreadCount() << " thread(s)\n";
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,157 @@
+/*! \file  LevelSetEvolver_Tests.cpp
+ *  \brief Unit tests for narrow-band level set evolution.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+
+#include "Symplekt_Algorithms/LevelSetEvolver.h"
+
+#include <cmath>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	/// \brief A grid over [-halfExtent, halfExtent]^3 with cell size 0.05 filled with the signed distance of a sphere centered at the origin.
+	static ScalarGridData GetSphereDistanceGrid(const double& radius, const double& halfExtent = 1.0)
+	{
+		auto gridData = InitializeScalarGridData({ L"LevelSetGrid", Box3{ Vector3{ -halfExtent, -halfExtent, -halfExtent }, Vector3{ halfExtent, halfExtent, halfExtent } }, 0.05, 0.0 });
+		const Vector3 min = gridData.BoundingBox.Min();
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+				{
+					const double x = min.X() + (static_cast<double>(i) + 0.5) * gridData.CellSize;
+					const double y = min.Y() + (static_cast<double>(j) + 0.5) * gridData.CellSize;
+					const double z = min.Z() + (static_cast<double>(k) + 0.5) * gridData.CellSize;
+					gridData.CellData[cellId] = std::sqrt(x * x + y * y + z * z) - radius;
+				}
+			}
+		}
+		return gridData;
+	}
+
+	/// \brief Positive x-coordinate of the zero crossing of the level set along the row of cells closest to the x-axis.
+	static double GetZeroCrossingAlongXAxis(const ScalarGridData& gridData)
+	{
+		const size_t j = gridData.YCellCount / 2;
+		const size_t k = gridData.ZCellCount / 2;
+		const double min = gridData.BoundingBox.Min().X();
+		for (size_t i = gridData.XCellCount / 2; i + 1 < gridData.XCellCount; i++)
+		{
+			const double value = gridData.CellData[i + gridData.XCellCount * (j + gridData.YCellCount * k)];
+			const double nextValue = gridData.CellData[i + 1 + gridData.XCellCount * (j + gridData.YCellCount * k)];
+			if (value < 0.0 && nextValue >= 0.0)
+				return min + (static_cast<double>(i) + 0.5 + value / (value - nextValue)) * gridData.CellSize;
+		}
+		return 0.0;
+	}
+
+	TEST(LevelSetEvolver_Tests, MismatchedGrids_Evolve_InvalidInput)
+	{
+		// Arrange
+		auto levelSetData = GetSphereDistanceGrid(0.8);
+		const auto targetData = InitializeScalarGridData({ L"TargetGrid", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.1, 0.0 });
+
+		// Act
+		const auto resultState = LevelSetEvolver::Evolve(levelSetData, targetData);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::InvalidInput);
+	}
+
+	TEST(LevelSetEvolver_Tests, LargerSphere_Evolve_ShrinksOntoTargetSphere)
+	{
+		// Arrange
+		auto levelSetData = GetSphereDistanceGrid(0.8, 2.0);
+		const auto targetData = GetSphereDistanceGrid(0.5, 2.0);
+		LevelSetSettings settings;
+		settings.NIterations = 60;
+		std::vector<LevelSetIterationStats> stats;
+
+		// Act
+		const auto resultState = LevelSetEvolver::Evolve(levelSetData, targetData, settings, &stats);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::Complete);
+		EXPECT_NEAR(GetZeroCrossingAlongXAxis(levelSetData), 0.5, levelSetData.CellSize);
+		ASSERT_EQ(stats.size(), settings.NIterations);
+		const size_t tileCount = 10 * 10 * 10; // 80^3 cells in tiles of 8^3 cells
+		for (const auto& iterationStats : stats)
+		{
+			EXPECT_GT(iterationStats.BandCellCount, 0u);
+			EXPECT_GT(iterationStats.TimeStep, 0.0);
+		}
+		EXPECT_LT(stats.back().ActiveTileCount, tileCount);
+		EXPECT_TRUE(stats[settings.ReinitializationInterval - 1].IsReinitialized);
+		EXPECT_FALSE(stats[0].IsReinitialized);
+	}
+
+	TEST(LevelSetEvolver_Tests, DistantSphere_EvolveCoarseToFine_ShrinksOntoTargetSphere)
+	{
+		// Arrange
+		auto levelSetData = GetSphereDistanceGrid(1.5, 2.0);
+		const auto targetData = GetSphereDistanceGrid(0.5, 2.0);
+		LevelSetSettings settings;
+		settings.NIterations = 30;
+		settings.NCoarseLevels = 2;
+		settings.NRefinementIterations = 10;
+		std::vector<LevelSetIterationStats> stats;
+
+		// Act
+		const auto resultState = LevelSetEvolver::Evolve(levelSetData, targetData, settings, &stats);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::Complete);
+		EXPECT_NEAR(GetZeroCrossingAlongXAxis(levelSetData), 0.5, levelSetData.CellSize);
+		ASSERT_EQ(stats.size(), settings.NIterations + 2 * settings.NRefinementIterations);
+		EXPECT_EQ(stats.front().Level, 2u);
+		EXPECT_EQ(stats[settings.NIterations].Level, 1u);
+		EXPECT_EQ(stats.back().Level, 0u);
+		EXPECT_EQ(stats.back().Iteration, settings.NRefinementIterations - 1);
+		// the finest level is initialized only around the coarse surface
+		const size_t tileCount = 10 * 10 * 10; // 80^3 cells in tiles of 8^3 cells
+		EXPECT_LT(stats[settings.NIterations + settings.NRefinementIterations].ActiveTileCount, tileCount / 2);
+	}
+
+	TEST(LevelSetEvolver_Tests, DistortedSphere_EvolveWithReinitialization_UnitGradientNearFront)
+	{
+		// Arrange: the initial level set is a sphere of radius 0.5 scaled by 3 (|grad phi| = 3)
+		auto levelSetData = GetSphereDistanceGrid(0.5);
+		for (auto& value : levelSetData.CellData)
+			value *= 3.0;
+		const auto targetData = GetSphereDistanceGrid(0.5);
+		LevelSetSettings settings;
+		settings.NIterations = 10;
+		settings.ReinitializationInterval = 2;
+		settings.NReinitializationSteps = 8;
+
+		// Act
+		const auto resultState = LevelSetEvolver::Evolve(levelSetData, targetData, settings);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::Complete);
+		const size_t j = levelSetData.YCellCount / 2;
+		const size_t k = levelSetData.ZCellCount / 2;
+		for (size_t i = 28; i < 32; i++) // cells around x = 0.5 along the x-axis
+		{
+			const double value = levelSetData.CellData[i + levelSetData.XCellCount * (j + levelSetData.YCellCount * k)];
+			const double nextValue = levelSetData.CellData[i + 1 + levelSetData.XCellCount * (j + levelSetData.YCellCount * k)];
+			const double gradientX = (nextValue - value) / levelSetData.CellSize;
+			EXPECT_GT(gradientX, 0.8);
+			EXPECT_LT(gradientX, 1.2);
+		}
+		EXPECT_NEAR(GetZeroCrossingAlongXAxis(levelSetData), 0.5, levelSetData.CellSize);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
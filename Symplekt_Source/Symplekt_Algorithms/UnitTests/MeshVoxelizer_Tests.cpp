@@ -0,0 +1,134 @@
+/*! \file  MeshVoxelizer_Tests.cpp
+ *  \brief Unit tests for the solid voxelization of meshes.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/OBJImporter.h"
+
+#include "Symplekt_Algorithms/MeshVoxelizer.h"
+
+#include <cmath>
+#include <filesystem>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	/// \brief A unit cube [offset, offset + 1]^3 with 12 outward oriented triangles.
+	static BufferMeshGeometryData GetUnitCubeMesh(const double& offset)
+	{
+		BufferMeshGeometryData meshData{ L"UnitCube" };
+		meshData.VertexCoords = {
+			0.0, 0.0, 0.0,   1.0, 0.0, 0.0,   1.0, 1.0, 0.0,   0.0, 1.0, 0.0,
+			0.0, 0.0, 1.0,   1.0, 0.0, 1.0,   1.0, 1.0, 1.0,   0.0, 1.0, 1.0
+		};
+		for (auto& coord : meshData.VertexCoords)
+			coord += offset;
+		meshData.VertexIndices = {
+			0, 2, 1,   0, 3, 2,   4, 5, 6,   4, 6, 7,
+			0, 1, 5,   0, 5, 4,   2, 3, 7,   2, 7, 6,
+			0, 4, 7,   0, 7, 3,   1, 2, 6,   1, 6, 5
+		};
+		return meshData;
+	}
+
+	/// \brief Value of the cell containing point (x, y, z).
+	static double GetCellValueAt(const ScalarGridData& gridData, const double x, const double y, const double z)
+	{
+		const auto& min = gridData.BoundingBox.Min();
+		const auto i = static_cast<size_t>((x - min.X()) / gridData.CellSize);
+		const auto j = static_cast<size_t>((y - min.Y()) / gridData.CellSize);
+		const auto k = static_cast<size_t>((z - min.Z()) / gridData.CellSize);
+		return gridData.CellData[i + gridData.XCellCount * (j + gridData.YCellCount * k)];
+	}
+
+	TEST(MeshVoxelizer_Tests, EmptyMesh_Voxelize_InvalidInput)
+	{
+		// Arrange
+		const BufferMeshGeometryData meshData{ L"EmptyMesh" };
+		auto gridData = InitializeScalarGridData({ L"Grid", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.5, 0.0 });
+
+		// Act
+		const auto resultState = MeshVoxelizer::Voxelize(meshData, gridData);
+
+		// Assert
+		EXPECT_EQ(resultState, MeshProcessingStatus::InvalidInput);
+	}
+
+	TEST(MeshVoxelizer_Tests, UnitCube_VoxelizeOnGridThroughMeshEdges_CellsClassifiedByParity)
+	{
+		// Arrange: cell centers lie at 0.125 + 0.25 * n, so their lines pass exactly through the vertices, edges and face diagonals of the cube
+		const double offset = 0.125;
+		const auto meshData = GetUnitCubeMesh(offset);
+		auto gridData = InitializeScalarGridData({ L"CubeVoxels", Box3{ Vector3{ -0.75, -0.75, -0.75 }, Vector3{ 1.75, 1.75, 1.75 } }, 0.25, 0.0 });
+		VoxelizationSettings settings;
+		settings.UseWindingNumberFallback = false;
+
+		// Act
+		const auto resultState = MeshVoxelizer::Voxelize(meshData, gridData, settings);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		const auto& min = gridData.BoundingBox.Min();
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+				{
+					const double x = min.X() + (static_cast<double>(i) + 0.5) * gridData.CellSize;
+					const double y = min.Y() + (static_cast<double>(j) + 0.5) * gridData.CellSize;
+					const double z = min.Z() + (static_cast<double>(k) + 0.5) * gridData.CellSize;
+					const double boxDistance = std::max({ std::fabs(x - offset - 0.5), std::fabs(y - offset - 0.5), std::fabs(z - offset - 0.5) }) - 0.5;
+					if (boxDistance < 0.0)
+						EXPECT_EQ(gridData.CellData[cellId], settings.InsideValue) << "(" << x << ", " << y << ", " << z << ")";
+					else if (boxDistance > 0.0)
+						EXPECT_EQ(gridData.CellData[cellId], settings.OutsideValue) << "(" << x << ", " << y << ", " << z << ")";
+				}
+			}
+		}
+	}
+
+	TEST(MeshVoxelizer_Tests, CubeWithHoles_Voxelize_WindingNumberFallbackFillsInterior)
+	{
+		// Arrange: box [-50, 50] x [0, 100] x [-50, 50] with a 60 x 60 hole in each of its four side faces
+		const auto importedFilePath = symplektRootPath / "Symplekt_ResourceData\\" / "CubeWithHoles.obj";
+		ASSERT_EQ(IOService::OBJImporter::Import(importedFilePath), IOService::ImportStatus::Complete);
+		const auto meshData = IOService::ConvertIODataToReferencedMeshGeometryData(IOService::OBJImporter::Data());
+		auto gridData = InitializeScalarGridData({ L"CubeWithHolesVoxels", Box3{ Vector3{ -60.0, -10.0, -60.0 }, Vector3{ 60.0, 110.0, 60.0 } }, 5.0, 0.0 });
+		auto parityGridData = gridData;
+		VoxelizationSettings paritySettings;
+		paritySettings.UseWindingNumberFallback = false;
+
+		// Act
+		const auto resultState = MeshVoxelizer::Voxelize(meshData, gridData);
+		const auto parityResultState = MeshVoxelizer::Voxelize(meshData, parityGridData, paritySettings);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(parityResultState, MeshProcessingStatus::Complete);
+		// lines of cell centers along x through both x-holes cross no triangles, so parity alone misses the center
+		EXPECT_EQ(GetCellValueAt(parityGridData, 1.0, 51.0, 1.0), 1.0);
+		EXPECT_EQ(GetCellValueAt(gridData, 1.0, 51.0, 1.0), -1.0);
+		EXPECT_EQ(GetCellValueAt(gridData, -41.0, 11.0, -41.0), -1.0);
+		EXPECT_EQ(GetCellValueAt(gridData, 1.0, 91.0, 1.0), -1.0);
+		EXPECT_EQ(GetCellValueAt(gridData, -58.0, 51.0, 1.0), 1.0);
+		EXPECT_EQ(GetCellValueAt(gridData, 1.0, 105.0, 1.0), 1.0);
+		EXPECT_EQ(GetCellValueAt(gridData, -58.0, -8.0, -58.0), 1.0);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
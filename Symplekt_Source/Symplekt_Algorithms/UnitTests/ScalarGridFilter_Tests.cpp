@@ -0,0 +1,181 @@
+/*! \file  ScalarGridFilter_Tests.cpp
+ *  \brief Unit tests for separable smoothing filters of scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+
+#include "Symplekt_Algorithms/ScalarGridFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	/// \brief An 11 x 7 x 5 grid with pseudo-random values in [0, 1) (deterministic).
+	static ScalarGridData GetRandomGrid()
+	{
+		auto gridData = InitializeScalarGridData({ L"FilterGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.1, 0.7, 0.5 } }, 0.1, 0.0 });
+		unsigned int state = 1234;
+		for (auto& value : gridData.CellData)
+		{
+			state = state * 1664525u + 1013904223u;
+			value = static_cast<double>(state >> 8) / static_cast<double>(1u << 24);
+		}
+		return gridData;
+	}
+
+	/// \brief Direct 3D convolution by the product of 1D weights (cells beyond the boundary replaced by the nearest boundary cell).
+	static std::vector<double> GetBruteForceConvolution(const ScalarGridData& gridData, const std::vector<double>& weights)
+	{
+		const int nx = static_cast<int>(gridData.XCellCount);
+		const int ny = static_cast<int>(gridData.YCellCount);
+		const int nz = static_cast<int>(gridData.ZCellCount);
+		const int radius = static_cast<int>(weights.size()) / 2;
+		std::vector<double> result(gridData.CellData.size(), 0.0);
+		for (int k = 0; k < nz; k++)
+		{
+			for (int j = 0; j < ny; j++)
+			{
+				for (int i = 0; i < nx; i++)
+				{
+					double& value = result[i + nx * (j + ny * k)];
+					for (int c = -radius; c <= radius; c++)
+					{
+						for (int b = -radius; b <= radius; b++)
+						{
+							for (int a = -radius; a <= radius; a++)
+							{
+								const int ii = std::clamp(i + a, 0, nx - 1);
+								const int jj = std::clamp(j + b, 0, ny - 1);
+								const int kk = std::clamp(k + c, 0, nz - 1);
+								value += weights[a + radius] * weights[b + radius] * weights[c + radius] * gridData.CellData[ii + nx * (jj + ny * kk)];
+							}
+						}
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	TEST(ScalarGridFilter_Tests, InvalidSettings_Apply_InvalidInput)
+	{
+		// Arrange
+		auto gridData = GetRandomGrid();
+		GridFilterSettings zeroSigmaSettings;
+		zeroSigmaSettings.Sigma = 0.0;
+		auto maskedGridData = GetRandomGrid();
+		maskedGridData.CellIsFrozen.assign(maskedGridData.CellData.size() - 1, false);
+
+		// Act
+		const auto zeroSigmaState = ScalarGridFilter::Apply(gridData, zeroSigmaSettings);
+		const auto maskedState = ScalarGridFilter::Apply(maskedGridData);
+
+		// Assert
+		EXPECT_EQ(zeroSigmaState, MeshProcessingStatus::InvalidInput);
+		EXPECT_EQ(maskedState, MeshProcessingStatus::InvalidInput);
+		EXPECT_EQ(gridData.CellData, GetRandomGrid().CellData);
+	}
+
+	TEST(ScalarGridFilter_Tests, ConstantGrid_Apply_ValuesPreserved)
+	{
+		// Arrange
+		auto gridData = InitializeScalarGridData({ L"ConstantGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.1, 0.75 });
+		GridFilterSettings settings;
+		settings.Radius = 3;
+		settings.Sigma = 1.5;
+		settings.NIterations = 2;
+
+		// Act
+		const auto resultState = ScalarGridFilter::Apply(gridData, settings);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		for (const auto& value : gridData.CellData)
+			EXPECT_NEAR(value, 0.75, 1e-14);
+	}
+
+	TEST(ScalarGridFilter_Tests, RandomGrid_Apply_EqualsBruteForceConvolution)
+	{
+		// Arrange
+		const auto gridData = GetRandomGrid();
+		ASSERT_EQ(gridData.XCellCount, 11u);
+		ASSERT_EQ(gridData.YCellCount, 7u);
+		ASSERT_EQ(gridData.ZCellCount, 5u);
+		auto boxGridData = gridData;
+		GridFilterSettings boxSettings;
+		boxSettings.Type = GridFilterType::Box;
+		boxSettings.Radius = 1;
+		auto gaussianGridData = gridData;
+		GridFilterSettings gaussianSettings;
+		gaussianSettings.Radius = 3;
+		gaussianSettings.Sigma = 1.2;
+		std::vector<double> gaussianWeights;
+		double gaussianWeightSum = 0.0;
+		for (int n = -3; n <= 3; n++)
+		{
+			gaussianWeights.push_back(std::exp(-n * n / (2.0 * 1.2 * 1.2)));
+			gaussianWeightSum += gaussianWeights.back();
+		}
+		for (auto& weight : gaussianWeights)
+			weight /= gaussianWeightSum;
+
+		// Act
+		const auto boxState = ScalarGridFilter::Apply(boxGridData, boxSettings);
+		const auto gaussianState = ScalarGridFilter::Apply(gaussianGridData, gaussianSettings);
+
+		// Assert
+		ASSERT_EQ(boxState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(gaussianState, MeshProcessingStatus::Complete);
+		const auto expectedBoxValues = GetBruteForceConvolution(gridData, { 1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0 });
+		const auto expectedGaussianValues = GetBruteForceConvolution(gridData, gaussianWeights);
+		for (size_t cellId = 0; cellId < gridData.CellData.size(); cellId++)
+		{
+			EXPECT_NEAR(boxGridData.CellData[cellId], expectedBoxValues[cellId], 1e-12);
+			EXPECT_NEAR(gaussianGridData.CellData[cellId], expectedGaussianValues[cellId], 1e-12);
+		}
+	}
+
+	TEST(ScalarGridFilter_Tests, FrozenPlane_Apply_FrozenValuesKept)
+	{
+		// Arrange: freeze the plane j = 3
+		auto gridData = GetRandomGrid();
+		const auto initialValues = gridData.CellData;
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		gridData.CellIsFrozen.assign(gridData.CellData.size(), false);
+		for (size_t cellId = 0; cellId < gridData.CellData.size(); cellId++)
+			gridData.CellIsFrozen[cellId] = (cellId / nx) % ny == 3;
+		auto ignoredMaskGridData = gridData;
+		GridFilterSettings ignoredMaskSettings;
+		ignoredMaskSettings.RespectFrozenCells = false;
+
+		// Act
+		const auto resultState = ScalarGridFilter::Apply(gridData);
+		const auto ignoredMaskState = ScalarGridFilter::Apply(ignoredMaskGridData, ignoredMaskSettings);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		ASSERT_EQ(ignoredMaskState, MeshProcessingStatus::Complete);
+		for (size_t cellId = 0; cellId < gridData.CellData.size(); cellId++)
+		{
+			if (gridData.CellIsFrozen[cellId])
+			{
+				EXPECT_EQ(gridData.CellData[cellId], initialValues[cellId]);
+				EXPECT_NE(ignoredMaskGridData.CellData[cellId], initialValues[cellId]);
+				continue;
+			}
+			EXPECT_NE(gridData.CellData[cellId], initialValues[cellId]);
+		}
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
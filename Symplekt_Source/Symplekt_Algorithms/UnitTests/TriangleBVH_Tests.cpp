@@ -0,0 +1,379 @@
+/*! \file  TriangleBVH_Tests.cpp
+ *  \brief Unit tests for the bounding volume hierarchy over mesh triangles.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/OBJImporter.h"
+
+#include "Symplekt_Algorithms/TriangleBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	/// \brief A unit cube [0, 1]^3 with 12 outward oriented triangles.
+	static BufferMeshGeometryData GetUnitCubeMesh()
+	{
+		BufferMeshGeometryData meshData{ L"UnitCube" };
+		meshData.VertexCoords = {
+			0.0, 0.0, 0.0,   1.0, 0.0, 0.0,   1.0, 1.0, 0.0,   0.0, 1.0, 0.0,
+			0.0, 0.0, 1.0,   1.0, 0.0, 1.0,   1.0, 1.0, 1.0,   0.0, 1.0, 1.0
+		};
+		meshData.VertexIndices = {
+			0, 2, 1,   0, 3, 2,   4, 5, 6,   4, 6, 7,
+			0, 1, 5,   0, 5, 4,   2, 3, 7,   2, 7, 6,
+			0, 4, 7,   0, 7, 3,   1, 2, 6,   1, 6, 5
+		};
+		return meshData;
+	}
+
+	/// \brief Deterministic pseudo-random numbers in [0, 1).
+	class RandomSequence
+	{
+	public:
+		double Next()
+		{
+			m_State = m_State * 1664525u + 1013904223u;
+			return static_cast<double>(m_State >> 8) / static_cast<double>(1u << 24);
+		}
+
+	private:
+		unsigned int m_State{ 4321 };
+	};
+
+	/// \brief Brute-force squared distance of a point from a triangle soup, as the minimum over single-triangle hierarchies.
+	static double GetBruteForceDistanceSquared(const std::vector<TriangleBVH>& singleTriangleBVHs, const Vector3& point)
+	{
+		double result = DBL_MAX;
+		for (const auto& bvh : singleTriangleBVHs)
+		{
+			BVHClosestPoint closestPoint;
+			if (bvh.FindClosestPoint(point, closestPoint))
+				result = std::min(result, closestPoint.DistanceSquared);
+		}
+		return result;
+	}
+
+	TEST(TriangleBVH_Tests, UnitCube_Queries_ExactResults)
+	{
+		// Arrange
+		const auto meshData = GetUnitCubeMesh();
+
+		// Act
+		const TriangleBVH bvh(meshData);
+
+		// Assert
+		EXPECT_EQ(bvh.TriangleCount(), 12u);
+		const auto box = bvh.GetBoundingBox();
+		EXPECT_TRUE(box.EqualsWithTolerance(Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 1.0, 1.0 } }));
+
+		BVHClosestPoint closestPoint;
+		ASSERT_TRUE(bvh.FindClosestPoint(Vector3{ 0.25, 0.5, 3.0 }, closestPoint));
+		EXPECT_DOUBLE_EQ(closestPoint.DistanceSquared, 4.0);
+		EXPECT_TRUE(closestPoint.Point.EqualsWithTolerance(Vector3{ 0.25, 0.5, 1.0 }));
+		EXPECT_TRUE(closestPoint.TriangleId == 2 || closestPoint.TriangleId == 3);
+		EXPECT_FALSE(bvh.FindClosestPoint(Vector3{ 0.25, 0.5, 3.0 }, closestPoint, 1.5));
+
+		BVHRayHit hit;
+		ASSERT_TRUE(bvh.IntersectRay(Vector3{ -1.0, 0.3, 0.6 }, Vector3{ 2.0, 0.0, 0.0 }, hit));
+		EXPECT_DOUBLE_EQ(hit.Distance, 0.5);
+		EXPECT_TRUE(hit.TriangleId == 8 || hit.TriangleId == 9);
+		// a ray from the inside hits the back side of the opposite face
+		ASSERT_TRUE(bvh.IntersectRay(Vector3{ 0.5, 0.3, 0.6 }, Vector3{ 1.0, 0.0, 0.0 }, hit));
+		EXPECT_DOUBLE_EQ(hit.Distance, 0.5);
+		EXPECT_TRUE(hit.TriangleId == 10 || hit.TriangleId == 11);
+		EXPECT_FALSE(bvh.IntersectRay(Vector3{ -1.0, 0.3, 0.6 }, Vector3{ -1.0, 0.0, 0.0 }, hit));
+		EXPECT_FALSE(bvh.IntersectRay(Vector3{ -1.0, 1.3, 0.6 }, Vector3{ 1.0, 0.0, 0.0 }, hit));
+
+		EXPECT_TRUE(bvh.IsRayOccluded(Vector3{ 0.5, 0.5, -1.0 }, Vector3{ 0.0, 0.0, 1.0 }));
+		EXPECT_FALSE(bvh.IsRayOccluded(Vector3{ 0.5, 0.5, -1.0 }, Vector3{ 0.0, 0.0, 1.0 }, 0.5));
+
+		std::vector<size_t> triangleIds;
+		bvh.CollectTrianglesInBox(Box3{ Vector3{ 0.9, 0.4, 0.4 }, Vector3{ 1.1, 0.6, 0.6 } }, triangleIds);
+		std::sort(triangleIds.begin(), triangleIds.end());
+		EXPECT_EQ(triangleIds, (std::vector<size_t>{ 10, 11 }));
+		bvh.CollectTrianglesInBox(Box3{ Vector3{ 0.2, 0.2, 0.2 }, Vector3{ 0.8, 0.8, 0.8 } }, triangleIds);
+		EXPECT_TRUE(triangleIds.empty());
+	}
+
+	TEST(TriangleBVH_Tests, RandomTriangleSoup_Queries_EqualBruteForce)
+	{
+		// Arrange: small triangles scattered in [0, 10]^3
+		RandomSequence random;
+		std::vector<TrianglePoints> triangles(2000);
+		for (auto& tri : triangles)
+		{
+			const std::array<double, 3> corner{ 10.0 * random.Next(), 10.0 * random.Next(), 10.0 * random.Next() };
+			for (auto& vertex : tri)
+			{
+				for (size_t i = 0; i < 3; i++)
+					vertex[i] = corner[i] + 0.5 * random.Next();
+			}
+		}
+		BVHSettings settings;
+		settings.MaxLeafSize = 4;
+		std::vector<TriangleBVH> singleTriangleBVHs;
+		for (const auto& tri : triangles)
+			singleTriangleBVHs.emplace_back(std::vector<TrianglePoints>{ tri });
+
+		// Act
+		const TriangleBVH bvh(triangles, settings);
+
+		// Assert: leaves cover every triangle exactly once and are at most MaxLeafSize large
+		std::vector<size_t> leafTriangleCounts(triangles.size(), 0);
+		for (const auto& node : bvh.Nodes())
+		{
+			ASSERT_LE(node.Count, settings.MaxLeafSize);
+			for (uint32_t t = node.Offset; node.Count > 0 && t < node.Offset + node.Count; t++)
+				leafTriangleCounts[t]++;
+		}
+		EXPECT_TRUE(std::ranges::all_of(leafTriangleCounts, [](const size_t& count) { return count == 1; }));
+
+		std::vector<size_t> triangleIds;
+		for (size_t n = 0; n < 200; n++)
+		{
+			const Vector3 point{ -2.0 + 14.0 * random.Next(), -2.0 + 14.0 * random.Next(), -2.0 + 14.0 * random.Next() };
+			BVHClosestPoint closestPoint;
+			ASSERT_TRUE(bvh.FindClosestPoint(point, closestPoint));
+			EXPECT_DOUBLE_EQ(closestPoint.DistanceSquared, GetBruteForceDistanceSquared(singleTriangleBVHs, point));
+
+			const Vector3 direction{ random.Next() - 0.5, random.Next() - 0.5, random.Next() - 0.5 };
+			BVHRayHit hit;
+			double bruteForceDistance = DBL_MAX;
+			size_t bruteForceTriangleId = triangles.size();
+			for (size_t t = 0; t < triangles.size(); t++)
+			{
+				BVHRayHit triangleHit;
+				if (singleTriangleBVHs[t].IntersectRay(point, direction, triangleHit) && triangleHit.Distance < bruteForceDistance)
+				{
+					bruteForceDistance = triangleHit.Distance;
+					bruteForceTriangleId = t;
+				}
+			}
+			ASSERT_EQ(bvh.IntersectRay(point, direction, hit), bruteForceTriangleId < triangles.size());
+			EXPECT_EQ(bvh.IsRayOccluded(point, direction), bruteForceTriangleId < triangles.size());
+			if (bruteForceTriangleId < triangles.size())
+			{
+				EXPECT_DOUBLE_EQ(hit.Distance, bruteForceDistance);
+				EXPECT_EQ(hit.TriangleId, bruteForceTriangleId);
+			}
+
+			const Box3 box{ point, point + Vector3{ 1.0, 1.0, 1.0 } };
+			std::vector<size_t> bruteForceIds;
+			for (size_t t = 0; t < triangles.size(); t++)
+			{
+				singleTriangleBVHs[t].CollectTrianglesInBox(box, triangleIds);
+				if (!triangleIds.empty())
+					bruteForceIds.push_back(t);
+			}
+			bvh.CollectTrianglesInBox(box, triangleIds);
+			std::sort(triangleIds.begin(), triangleIds.end());
+			EXPECT_EQ(triangleIds, bruteForceIds);
+		}
+	}
+
+	TEST(TriangleBVH_Tests, ResourceMesh_FindClosestPoint_OnSurfaceAndEqualBruteForce)
+	{
+		// Arrange
+		const auto importedFilePath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple_no_holes.obj";
+		ASSERT_EQ(IOService::OBJImporter::Import(importedFilePath), IOService::ImportStatus::Complete);
+		const auto meshData = IOService::ConvertIODataToReferencedMeshGeometryData(IOService::OBJImporter::Data());
+		std::vector<TrianglePoints> triangles;
+		ASSERT_TRUE(CollectMeshTriangles(meshData, triangles));
+		std::vector<TriangleBVH> singleTriangleBVHs;
+		for (const auto& tri : triangles)
+			singleTriangleBVHs.emplace_back(std::vector<TrianglePoints>{ tri });
+
+		// Act
+		const TriangleBVH bvh(meshData);
+
+		// Assert
+		ASSERT_EQ(bvh.TriangleCount(), triangles.size());
+		RandomSequence random;
+		for (size_t n = 0; n < 100; n++)
+		{
+			// points in the bounding box [-60.8, 39.2] x [21.5, 120.5] x [-39.8, 37.8] of the mesh, enlarged by 10 units
+			const Vector3 point{ -71.0 + 121.0 * random.Next(), 11.0 + 120.0 * random.Next(), -50.0 + 98.0 * random.Next() };
+			BVHClosestPoint closestPoint;
+			ASSERT_TRUE(bvh.FindClosestPoint(point, closestPoint));
+			EXPECT_DOUBLE_EQ(closestPoint.DistanceSquared, GetBruteForceDistanceSquared(singleTriangleBVHs, point));
+			EXPECT_NEAR((closestPoint.Point - point).GetLength(), std::sqrt(closestPoint.DistanceSquared), 1e-9);
+
+			// the closest point lies on its triangle
+			BVHClosestPoint pointOnTriangle;
+			ASSERT_TRUE(singleTriangleBVHs[closestPoint.TriangleId].FindClosestPoint(closestPoint.Point, pointOnTriangle));
+			EXPECT_NEAR(pointOnTriangle.DistanceSquared, 0.0, 1e-16);
+		}
+	}
+
+	/// \brief Small triangles scattered in [0, 10]^3.
+	static std::vector<TrianglePoints> GetRandomTriangleSoup(const size_t& count, RandomSequence& random)
+	{
+		std::vector<TrianglePoints> triangles(count);
+		for (auto& tri : triangles)
+		{
+			const std::array<double, 3> corner{ 10.0 * random.Next(), 10.0 * random.Next(), 10.0 * random.Next() };
+			for (auto& vertex : tri)
+			{
+				for (size_t i = 0; i < 3; i++)
+					vertex[i] = corner[i] + 0.5 * random.Next();
+			}
+		}
+		return triangles;
+	}
+
+	TEST(TriangleBVH_Tests, RandomTriangleSoup_RefitAfterDeformations_RebuildsOnlyDegradedSubtrees)
+	{
+		// Arrange
+		RandomSequence random;
+		auto triangles = GetRandomTriangleSoup(20000, random);
+		TriangleBVH bvh(triangles);
+		const double initialCost = bvh.GetSAHCost();
+
+		// Act & Assert: a rigid translation keeps the SAH cost
+		for (auto& tri : triangles)
+		{
+			for (auto& vertex : tri)
+				vertex = { vertex[0] + 3.0, vertex[1] - 1.0, vertex[2] + 0.5 };
+		}
+		BVHRefitStats refitStats;
+		ASSERT_TRUE(bvh.Refit(triangles, &refitStats));
+		EXPECT_EQ(refitStats.RebuiltSubtreeCount, 0u);
+		EXPECT_NEAR(refitStats.SAHCost, initialCost, 1e-3 * initialCost);
+		EXPECT_DOUBLE_EQ(refitStats.SAHCost, bvh.GetSAHCost());
+
+		// Act & Assert: triangles of a corner block moved to random positions within the block degrade only some subtrees
+		for (auto& tri : triangles)
+		{
+			if (tri[0][0] >= 6.0 || tri[0][1] >= 4.0 || tri[0][2] >= 5.0)
+				continue;
+
+			const std::array<double, 3> offset{ 3.0 * random.Next() + 3.0 - tri[0][0], 5.0 * random.Next() - 1.0 - tri[0][1], 4.5 * random.Next() + 0.5 - tri[0][2] };
+			for (auto& vertex : tri)
+				vertex = { vertex[0] + offset[0], vertex[1] + offset[1], vertex[2] + offset[2] };
+		}
+		ASSERT_TRUE(bvh.Refit(triangles, &refitStats));
+		EXPECT_GT(refitStats.RebuiltSubtreeCount, 0u);
+		EXPECT_FALSE(refitStats.IsFullyRebuilt);
+		EXPECT_LT(refitStats.RebuiltTriangleCount, triangles.size());
+
+		// Act & Assert: the soup folded onto one octant of its box keeps subtrees compact, but degrades the top of the hierarchy
+		for (auto& tri : triangles)
+		{
+			for (auto& vertex : tri)
+			{
+				vertex = {
+					vertex[0] < 8.25 ? 16.5 - vertex[0] : vertex[0],
+					vertex[1] < 4.25 ? 8.5 - vertex[1] : vertex[1],
+					vertex[2] < 5.75 ? 11.5 - vertex[2] : vertex[2] };
+			}
+		}
+		BVHSettings noRebuildSettings;
+		noRebuildSettings.RebuildCostRatio = 0.0;
+		TriangleBVH refittedOnlyBvh(GetRandomTriangleSoup(20000, random), noRebuildSettings);
+		ASSERT_TRUE(refittedOnlyBvh.Refit(triangles));
+		ASSERT_TRUE(bvh.Refit(triangles, &refitStats));
+		EXPECT_TRUE(refitStats.IsFullyRebuilt);
+		const TriangleBVH rebuiltBvh(triangles);
+		EXPECT_NEAR(bvh.GetSAHCost(), rebuiltBvh.GetSAHCost(), 1e-3 * rebuiltBvh.GetSAHCost());
+
+		// queries of refitted (and rebuilt) hierarchies match brute force
+		std::vector<TriangleBVH> singleTriangleBVHs;
+		for (const auto& tri : triangles)
+			singleTriangleBVHs.emplace_back(std::vector<TrianglePoints>{ tri });
+		for (size_t n = 0; n < 100; n++)
+		{
+			const Vector3 point{ -5.0 + 25.0 * random.Next(), -10.0 + 25.0 * random.Next(), -5.0 + 25.0 * random.Next() };
+			const double bruteForceDistanceSquared = GetBruteForceDistanceSquared(singleTriangleBVHs, point);
+			BVHClosestPoint closestPoint;
+			ASSERT_TRUE(bvh.FindClosestPoint(point, closestPoint));
+			EXPECT_DOUBLE_EQ(closestPoint.DistanceSquared, bruteForceDistanceSquared);
+			ASSERT_TRUE(refittedOnlyBvh.FindClosestPoint(point, closestPoint));
+			EXPECT_DOUBLE_EQ(closestPoint.DistanceSquared, bruteForceDistanceSquared);
+		}
+	}
+
+	TEST(TriangleBVH_Tests, ResourceMesh_RefitToScaledVertices_QueriesEqualRebuiltHierarchy)
+	{
+		// Arrange
+		const auto importedFilePath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple_no_holes.obj";
+		ASSERT_EQ(IOService::OBJImporter::Import(importedFilePath), IOService::ImportStatus::Complete);
+		auto meshData = IOService::ConvertIODataToReferencedMeshGeometryData(IOService::OBJImporter::Data());
+		TriangleBVH bvh(meshData);
+		const double initialCost = bvh.GetSAHCost();
+		for (auto& vertex : meshData.Vertices)
+		{
+			const auto& position = vertex.Position();
+			vertex.Position() = Vector3{ 2.0 * position.X() + 10.0, 2.0 * position.Y(), 2.0 * position.Z() - 5.0 };
+		}
+
+		// Act
+		BVHRefitStats refitStats;
+		const bool isRefitted = bvh.Refit(meshData, &refitStats);
+
+		// Assert
+		ASSERT_TRUE(isRefitted);
+		EXPECT_EQ(refitStats.RebuiltSubtreeCount, 0u);
+		EXPECT_NEAR(refitStats.SAHCost, initialCost, 1e-3 * initialCost);
+		const TriangleBVH rebuiltBvh(meshData);
+		ASSERT_EQ(bvh.TriangleCount(), rebuiltBvh.TriangleCount());
+		EXPECT_TRUE(bvh.GetBoundingBox().EqualsWithTolerance(rebuiltBvh.GetBoundingBox()));
+		RandomSequence random;
+		for (size_t n = 0; n < 200; n++)
+		{
+			const Vector3 point{ -132.0 + 242.0 * random.Next(), 22.0 + 240.0 * random.Next(), -105.0 + 196.0 * random.Next() };
+			BVHClosestPoint closestPoint;
+			BVHClosestPoint rebuiltClosestPoint;
+			ASSERT_TRUE(bvh.FindClosestPoint(point, closestPoint));
+			ASSERT_TRUE(rebuiltBvh.FindClosestPoint(point, rebuiltClosestPoint));
+			EXPECT_DOUBLE_EQ(closestPoint.DistanceSquared, rebuiltClosestPoint.DistanceSquared);
+
+			const Vector3 direction{ random.Next() - 0.5, random.Next() - 0.5, random.Next() - 0.5 };
+			BVHRayHit hit;
+			BVHRayHit rebuiltHit;
+			ASSERT_EQ(bvh.IntersectRay(point, direction, hit), rebuiltBvh.IntersectRay(point, direction, rebuiltHit));
+			EXPECT_DOUBLE_EQ(hit.Distance, rebuiltHit.Distance);
+		}
+
+		// a hierarchy without mesh connectivity cannot be refitted to a mesh, nor to a triangle soup of another size
+		TriangleBVH soupBvh(std::vector<TrianglePoints>(3, TrianglePoints{ { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } }));
+		EXPECT_FALSE(soupBvh.Refit(meshData));
+		EXPECT_FALSE(soupBvh.Refit(std::vector<TrianglePoints>(2)));
+	}
+
+	TEST(TriangleBVH_Tests, InvalidMesh_Construct_NoTriangles)
+	{
+		// Arrange
+		auto meshData = GetUnitCubeMesh();
+		meshData.VertexIndices.push_back(0);
+
+		// Act
+		const TriangleBVH bvh(meshData);
+
+		// Assert
+		EXPECT_EQ(bvh.TriangleCount(), 0u);
+		EXPECT_TRUE(bvh.Nodes().empty());
+		BVHClosestPoint closestPoint;
+		EXPECT_FALSE(bvh.FindClosestPoint(Vector3{ 0.0, 0.0, 0.0 }, closestPoint));
+		BVHRayHit hit;
+		EXPECT_FALSE(bvh.IntersectRay(Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 0.0, 0.0 }, hit));
+		EXPECT_FALSE(bvh.IsRayOccluded(Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 0.0, 0.0 }));
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*! \file  WindingNumberEvaluator_Tests.cpp
+ *  \brief Unit tests for the hierarchical evaluation of generalized winding numbers.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/OBJImporter.h"
+
+#include "Symplekt_Algorithms/WindingNumberEvaluator.h"
+
+#include <cmath>
+#include <filesystem>
+#include <numbers>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+	using namespace Algorithms;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	/// \brief A unit cube [0, 1]^3 with 12 outward oriented triangles.
+	static BufferMeshGeometryData GetUnitCubeMesh()
+	{
+		BufferMeshGeometryData meshData{ L"UnitCube" };
+		meshData.VertexCoords = {
+			0.0, 0.0, 0.0,   1.0, 0.0, 0.0,   1.0, 1.0, 0.0,   0.0, 1.0, 0.0,
+			0.0, 0.0, 1.0,   1.0, 0.0, 1.0,   1.0, 1.0, 1.0,   0.0, 1.0, 1.0
+		};
+		meshData.VertexIndices = {
+			0, 2, 1,   0, 3, 2,   4, 5, 6,   4, 6, 7,
+			0, 1, 5,   0, 5, 4,   2, 3, 7,   2, 7, 6,
+			0, 4, 7,   0, 7, 3,   1, 2, 6,   1, 6, 5
+		};
+		return meshData;
+	}
+
+	/// \brief Pseudo-random query points in a box (deterministic).
+	static GridSamplePoints GetQueryPoints(const size_t& count, const Vector3& min, const Vector3& max)
+	{
+		GridSamplePoints points;
+		unsigned int state = 4321;
+		const auto random = [&state]() { state = state * 1664525u + 1013904223u; return static_cast<double>(state >> 8) / static_cast<double>(1u << 24); };
+		for (size_t n = 0; n < count; n++)
+		{
+			points.X.push_back(min.X() + random() * (max.X() - min.X()));
+			points.Y.push_back(min.Y() + random() * (max.Y() - min.Y()));
+			points.Z.push_back(min.Z() + random() * (max.Z() - min.Z()));
+		}
+		return points;
+	}
+
+	TEST(WindingNumberEvaluator_Tests, UnitCube_Evaluate_OneInsideZeroOutside)
+	{
+		// Arrange
+		const auto meshData = GetUnitCubeMesh();
+		WindingNumberSettings exactSettings;
+		exactSettings.UseFarFieldApproximation = false;
+
+		// Act
+		const WindingNumberEvaluator exactEvaluator(meshData, exactSettings);
+		const WindingNumberEvaluator evaluator(meshData);
+
+		// Assert
+		EXPECT_EQ(evaluator.TriangleCount(), 12u);
+		EXPECT_NEAR(exactEvaluator.Evaluate(Vector3{ 0.3, 0.6, 0.5 }), 1.0, 1e-12);
+		EXPECT_NEAR(exactEvaluator.Evaluate(Vector3{ 1.3, 0.6, 0.5 }), 0.0, 1e-12);
+		EXPECT_NEAR(evaluator.Evaluate(Vector3{ 0.3, 0.6, 0.5 }), 1.0, 1e-12);
+		EXPECT_NEAR(evaluator.Evaluate(Vector3{ 5.0, -4.0, 3.0 }), 0.0, 1e-3);
+	}
+
+	TEST(WindingNumberEvaluator_Tests, ClosedResourceMesh_EvaluateBatch_CloseToBruteForce)
+	{
+		// Arrange
+		const auto importedFilePath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple_no_holes.obj";
+		ASSERT_EQ(IOService::OBJImporter::Import(importedFilePath), IOService::ImportStatus::Complete);
+		const auto meshData = IOService::ConvertIODataToReferencedMeshGeometryData(IOService::OBJImporter::Data());
+		WindingNumberSettings exactSettings;
+		exactSettings.UseFarFieldApproximation = false;
+		const WindingNumberEvaluator exactEvaluator(meshData, exactSettings);
+		const WindingNumberEvaluator evaluator(meshData);
+		// points in the bounding box [-60.8, 39.2] x [21.5, 120.5] x [-39.8, 37.8] of the mesh, enlarged by 10 units
+		const auto points = GetQueryPoints(1000, Vector3{ -71.0, 11.0, -50.0 }, Vector3{ 50.0, 131.0, 48.0 });
+
+		// Act
+		std::vector<double> exactResults;
+		std::vector<double> results;
+		exactEvaluator.EvaluateBatch(points, exactResults);
+		evaluator.EvaluateBatch(points, results);
+
+		// Assert
+		ASSERT_EQ(results.size(), points.Size());
+		size_t insideCount = 0;
+		for (size_t n = 0; n < points.Size(); n++)
+		{
+			EXPECT_NEAR(results[n], exactResults[n], 5e-2);
+			EXPECT_EQ(std::fabs(results[n]) > 0.5, std::fabs(exactResults[n]) > 0.5);
+			// a closed mesh has integer winding numbers
+			EXPECT_NEAR(exactResults[n], std::round(exactResults[n]), 1e-8);
+			if (std::fabs(exactResults[n]) > 0.5)
+				insideCount++;
+		}
+		EXPECT_GT(insideCount, 0u);
+	}
+
+	TEST(WindingNumberEvaluator_Tests, CubeWithHoles_FillGrid_FractionalWindingNumberAtCenter)
+	{
+		// Arrange: box [-50, 50] x [0, 100] x [-50, 50] with a 60 x 60 hole in each of its four side faces
+		const auto importedFilePath = symplektRootPath / "Symplekt_ResourceData\\" / "CubeWithHoles.obj";
+		ASSERT_EQ(IOService::OBJImporter::Import(importedFilePath), IOService::ImportStatus::Complete);
+		const auto meshData = IOService::ConvertIODataToReferencedMeshGeometryData(IOService::OBJImporter::Data());
+		const WindingNumberEvaluator evaluator(meshData);
+		auto gridData = InitializeScalarGridData({ L"CubeWithHolesWinding", Box3{ Vector3{ -60.0, -10.0, -60.0 }, Vector3{ 60.0, 110.0, 60.0 } }, 10.0, 0.0 });
+
+		// Act
+		const auto resultState = evaluator.FillGrid(gridData);
+
+		// Assert
+		ASSERT_EQ(resultState, MeshProcessingStatus::Complete);
+		const auto& min = gridData.BoundingBox.Min();
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+				{
+					const Vector3 center{
+						min.X() + (static_cast<double>(i) + 0.5) * gridData.CellSize,
+						min.Y() + (static_cast<double>(j) + 0.5) * gridData.CellSize,
+						min.Z() + (static_cast<double>(k) + 0.5) * gridData.CellSize };
+					ASSERT_DOUBLE_EQ(gridData.CellData[cellId], evaluator.Evaluate(center));
+				}
+			}
+		}
+
+		// each hole subtends the solid angle 4 atan(30^2 / (50 sqrt(50^2 + 2 * 30^2))) from the center of the box
+		const double holeSolidAngle = 4.0 * std::atan(900.0 / (50.0 * std::sqrt(2500.0 + 1800.0)));
+		const double expectedCenterWindingNumber = 1.0 - 4.0 * holeSolidAngle / (4.0 * std::numbers::pi);
+		WindingNumberSettings exactSettings;
+		exactSettings.UseFarFieldApproximation = false;
+		const WindingNumberEvaluator exactEvaluator(meshData, exactSettings);
+		EXPECT_NEAR(exactEvaluator.Evaluate(Vector3{ 0.0, 50.0, 0.0 }), expectedCenterWindingNumber, 1e-12);
+		EXPECT_NEAR(evaluator.Evaluate(Vector3{ 0.0, 50.0, 0.0 }), expectedCenterWindingNumber, 1e-2);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,275 @@
+/*!  \file WindingNumberEvaluator.cpp
+ *   \brief Implementation of an object for fast evaluation of generalized winding numbers of triangle meshes.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#include "WindingNumberEvaluator.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+using namespace Symplektis::GeometryKernel;
+
+namespace Symplektis::Algorithms
+{
+	using Point3 = std::array<double, 3>;
+
+	//!> \brief maximum number of triangles in a leaf of the cluster hierarchy
+	constexpr unsigned int max_leaf_cluster_size = 8;
+
+	//!> \brief minimum number of query points per thread
+	constexpr size_t min_query_chunk_size = 256;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Signed solid angle of a triangle seen from a point [Van Oosterom & Strackee, 1983]. Positive for triangles
+	*          whose normal (by vertex order) points away from the point.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static double GetSolidAngle(const TrianglePoints& tri, const Point3& p)
+	{
+		const Point3 a{ tri[0][0] - p[0], tri[0][1] - p[1], tri[0][2] - p[2] };
+		const Point3 b{ tri[1][0] - p[0], tri[1][1] - p[1], tri[1][2] - p[2] };
+		const Point3 c{ tri[2][0] - p[0], tri[2][1] - p[1], tri[2][2] - p[2] };
+		const auto dot = [](const Point3& u, const Point3& v) { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; };
+		const double la = std::sqrt(dot(a, a));
+		const double lb = std::sqrt(dot(b, b));
+		const double lc = std::sqrt(dot(c, c));
+		const double det =
+			a[0] * (b[1] * c[2] - b[2] * c[1]) -
+			a[1] * (b[0] * c[2] - b[2] * c[0]) +
+			a[2] * (b[0] * c[1] - b[1] * c[0]);
+		const double denom = la * lb * lc + dot(a, b) * lc + dot(a, c) * lb + dot(b, c) * la;
+		return 2.0 * std::atan2(det, denom);
+	}
+
+	WindingNumberEvaluator::WindingNumberEvaluator(std::vector<TrianglePoints> triangles, const WindingNumberSettings& settings)
+		: m_Triangles(std::move(triangles)), m_Settings(settings)
+	{
+		if (m_Triangles.empty() || !m_Settings.UseFarFieldApproximation)
+			return;
+
+		m_Nodes.reserve(4 * m_Triangles.size() / max_leaf_cluster_size + 1);
+		BuildNode(0, static_cast<unsigned int>(m_Triangles.size()));
+	}
+
+	WindingNumberEvaluator::WindingNumberEvaluator(const BufferMeshGeometryData& meshData, const WindingNumberSettings& settings)
+		: WindingNumberEvaluator(
+			[&meshData]()
+			{
+				std::vector<TrianglePoints> triangles;
+				if (!CollectMeshTriangles(meshData, triangles))
+					triangles.clear();
+				return triangles;
+			}(), settings)
+	{
+	}
+
+	WindingNumberEvaluator::WindingNumberEvaluator(const ReferencedMeshGeometryData& meshData, const WindingNumberSettings& settings)
+		: WindingNumberEvaluator(
+			[&meshData]()
+			{
+				std::vector<TrianglePoints> triangles;
+				if (!CollectMeshTriangles(meshData, triangles))
+					triangles.clear();
+				return triangles;
+			}(), settings)
+	{
+	}
+
+	void WindingNumberEvaluator::BuildNode(const unsigned int& first, const unsigned int& count)
+	{
+		const auto nodeId = static_cast<unsigned int>(m_Nodes.size());
+		m_Nodes.emplace_back();
+
+		// ------ dipole moments of the cluster -------------------------------------------------
+		double areaSum = 0.0;
+		Point3 weightedCentroidSum{};
+		Point3 normalSum{};
+		std::array<double, 9> normalCentroidSum{};
+		Point3 centroidMin{ DBL_MAX, DBL_MAX, DBL_MAX };
+		Point3 centroidMax{ -DBL_MAX, -DBL_MAX, -DBL_MAX };
+		for (unsigned int t = first; t < first + count; t++)
+		{
+			const auto& [a, b, c] = m_Triangles[t];
+			const Point3 e1{ b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			const Point3 e2{ c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			// area-weighted normal
+			const Point3 n{
+				0.5 * (e1[1] * e2[2] - e1[2] * e2[1]),
+				0.5 * (e1[2] * e2[0] - e1[0] * e2[2]),
+				0.5 * (e1[0] * e2[1] - e1[1] * e2[0]) };
+			const double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			const Point3 centroid{ (a[0] + b[0] + c[0]) / 3.0, (a[1] + b[1] + c[1]) / 3.0, (a[2] + b[2] + c[2]) / 3.0 };
+
+			areaSum += area;
+			for (size_t i = 0; i < 3; i++)
+			{
+				weightedCentroidSum[i] += area * centroid[i];
+				normalSum[i] += n[i];
+				for (size_t j = 0; j < 3; j++)
+					normalCentroidSum[3 * i + j] += n[i] * centroid[j];
+				centroidMin[i] = std::min(centroidMin[i], centroid[i]);
+				centroidMax[i] = std::max(centroidMax[i], centroid[i]);
+			}
+		}
+
+		auto& node = m_Nodes[nodeId];
+		for (size_t i = 0; i < 3; i++)
+			node.Center[i] = areaSum > 0.0 ? weightedCentroidSum[i] / areaSum : 0.5 * (centroidMin[i] + centroidMax[i]);
+		node.NormalSum = normalSum;
+		for (size_t i = 0; i < 3; i++)
+		{
+			for (size_t j = 0; j < 3; j++)
+				node.NormalMoment[3 * i + j] = normalCentroidSum[3 * i + j] - normalSum[i] * node.Center[j];
+		}
+		for (unsigned int t = first; t < first + count; t++)
+		{
+			for (const auto& vertex : m_Triangles[t])
+			{
+				const double dx = vertex[0] - node.Center[0];
+				const double dy = vertex[1] - node.Center[1];
+				const double dz = vertex[2] - node.Center[2];
+				node.RadiusSquared = std::max(node.RadiusSquared, dx * dx + dy * dy + dz * dz);
+			}
+		}
+
+		if (count <= max_leaf_cluster_size)
+		{
+			node.First = first;
+			node.Count = count;
+			return;
+		}
+
+		// ------ median split along the longest axis of triangle centroids -------------------------------
+		size_t axis = 0;
+		for (size_t i = 1; i < 3; i++)
+		{
+			if (centroidMax[i] - centroidMin[i] > centroidMax[axis] - centroidMin[axis])
+				axis = i;
+		}
+
+		const unsigned int leftCount = count / 2;
+		std::nth_element(m_Triangles.begin() + first, m_Triangles.begin() + first + leftCount, m_Triangles.begin() + first + count,
+			[axis](const TrianglePoints& t1, const TrianglePoints& t2)
+			{
+				return t1[0][axis] + t1[1][axis] + t1[2][axis] < t2[0][axis] + t2[1][axis] + t2[2][axis];
+			});
+
+		BuildNode(first, leftCount);
+		const auto rightId = static_cast<unsigned int>(m_Nodes.size());
+		m_Nodes[nodeId].Right = rightId;
+		BuildNode(first + leftCount, count - leftCount);
+	}
+
+	double WindingNumberEvaluator::EvaluateAt(const Point3& point) const
+	{
+		double solidAngle = 0.0;
+		if (m_Nodes.empty())
+		{
+			// exact evaluation of all triangles
+			for (const auto& tri : m_Triangles)
+				solidAngle += GetSolidAngle(tri, point);
+			return 0.25 * std::numbers::inv_pi * solidAngle;
+		}
+
+		const double farFieldRatioSquared = m_Settings.FarFieldRatio * m_Settings.FarFieldRatio;
+		std::array<unsigned int, 64> stack{};
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const auto nodeId = stack[--stackSize];
+			const auto& node = m_Nodes[nodeId];
+			const Point3 r{ node.Center[0] - point[0], node.Center[1] - point[1], node.Center[2] - point[2] };
+			const double distanceSquared = r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+			if (distanceSquared > farFieldRatioSquared * node.RadiusSquared)
+			{
+				// far field: dipole of the cluster and its first order correction
+				//     N . r / |r|^3 + tr(M) / |r|^3 - 3 r . M r / |r|^5
+				const double invDistance3 = 1.0 / (distanceSquared * std::sqrt(distanceSquared));
+				const auto& m = node.NormalMoment;
+				const double rMr =
+					r[0] * (m[0] * r[0] + m[1] * r[1] + m[2] * r[2]) +
+					r[1] * (m[3] * r[0] + m[4] * r[1] + m[5] * r[2]) +
+					r[2] * (m[6] * r[0] + m[7] * r[1] + m[8] * r[2]);
+				const double dipole = node.NormalSum[0] * r[0] + node.NormalSum[1] * r[1] + node.NormalSum[2] * r[2];
+				solidAngle += (dipole + m[0] + m[4] + m[8] - 3.0 * rMr / distanceSquared) * invDistance3;
+				continue;
+			}
+
+			if (node.Count > 0)
+			{
+				for (unsigned int t = node.First; t < node.First + node.Count; t++)
+					solidAngle += GetSolidAngle(m_Triangles[t], point);
+				continue;
+			}
+
+			stack[stackSize++] = node.Right;
+			stack[stackSize++] = nodeId + 1;
+		}
+		return 0.25 * std::numbers::inv_pi * solidAngle;
+	}
+
+	double WindingNumberEvaluator::Evaluate(const Vector3& point) const
+	{
+		return EvaluateAt({ point.X(), point.Y(), point.Z() });
+	}
+
+	void WindingNumberEvaluator::EvaluateBatch(const GridSamplePoints& points, std::vector<double>& results) const
+	{
+		const size_t count = points.Size();
+		results.assign(count, 0.0);
+		if (count == 0 || points.Y.size() != count || points.Z.size() != count)
+			return;
+
+		Util::ParallelForChunks(count, Util::GetParallelChunkCount(count, min_query_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				for (size_t id = begin; id < end; id++)
+					results[id] = EvaluateAt({ points.X[id], points.Y[id], points.Z[id] });
+			});
+	}
+
+	MeshProcessingStatus WindingNumberEvaluator::FillGrid(ScalarGridData& gridData) const
+	{
+		const size_t nx = gridData.XCellCount;
+		const size_t ny = gridData.YCellCount;
+		const size_t nz = gridData.ZCellCount;
+		if (m_Triangles.empty() || nx * ny * nz == 0 || gridData.CellSize <= 0.0)
+			return MeshProcessingStatus::InvalidInput;
+
+		const Point3 origin{ gridData.BoundingBox.Min().X(), gridData.BoundingBox.Min().Y(), gridData.BoundingBox.Min().Z() };
+		const double h = gridData.CellSize;
+		gridData.CellData.resize(nx * ny * nz);
+		Util::ParallelForChunks(nz, Util::GetParallelChunkCount(nz, 1),
+			[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+			{
+				for (size_t k = kBegin; k < kEnd; k++)
+				{
+					for (size_t j = 0; j < ny; j++)
+					{
+						for (size_t i = 0; i < nx; i++)
+						{
+							gridData.CellData[i + nx * (j + ny * k)] = EvaluateAt({
+								origin[0] + (static_cast<double>(i) + 0.5) * h,
+								origin[1] + (static_cast<double>(j) + 0.5) * h,
+								origin[2] + (static_cast<double>(k) + 0.5) * h });
+						}
+					}
+				}
+			});
+
+		return MeshProcessingStatus::Complete;
+	}
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
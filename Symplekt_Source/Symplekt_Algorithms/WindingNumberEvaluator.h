@@ -0,0 +1,162 @@
+/*!  \file WindingNumberEvaluator.h
+ *   \brief An object for fast evaluation of generalized winding numbers of (not necessarily closed) triangle meshes.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+*/
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/ScalarGridSampler.h"
+#include "Symplekt_GeometryKernel/Vector3.h"
+
+#include "AlgorithmHelperTypes.h"
+#include "MeshTriangleSoup.h"
+
+#include <array>
+#include <vector>
+
+namespace Symplektis::Algorithms
+{
+	//=============================================================================
+	/// \struct WindingNumberSettings
+	/// \brief A data container for all major settings for WindingNumberEvaluator.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct WindingNumberSettings
+	{
+		bool UseFarFieldApproximation{ true };   //>! if false, all triangles are evaluated exactly (brute force reference).
+		double FarFieldRatio{ 2.0 };             //>! a cluster is approximated if its distance from the query point exceeds FarFieldRatio times its radius.
+	};
+
+	//=============================================================================
+	/// \class WindingNumberEvaluator
+	/// \brief Evaluates the generalized winding number w(q) = 1/(4 pi) * sum of signed solid angles of mesh triangles seen
+	///        from q [Jacobson et al., 2013]. For outward oriented meshes, w is 1 inside and 0 outside of closed meshes and
+	///        degrades smoothly across holes, so |w| > 1/2 is a robust inside test for meshes which are not watertight.
+	///
+	///        Triangles are clustered in a bounding volume hierarchy. Clusters far from the query point (relative to their
+	///        radius) are evaluated by a second order expansion of their dipole field about their area-weighted centroid,
+	///        while triangles of near clusters are evaluated exactly [Barill et al., 2018]. Batch queries and grid fills
+	///        are processed on multiple threads.
+	///
+	/// \ingroup ALGORITHM
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class WindingNumberEvaluator
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from a triangle soup.
+		*   \param[in] triangles         triangles (vertex order determines orientation).
+		*   \param[in] settings          winding number settings.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit WindingNumberEvaluator(std::vector<TrianglePoints> triangles, const WindingNumberSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from a buffer triangle mesh (VertexIndices read as triangle index triples). Invalid mesh data results
+		*          in an evaluator without triangles.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit WindingNumberEvaluator(const GeometryKernel::BufferMeshGeometryData& meshData, const WindingNumberSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from a referenced mesh (polygonal faces are fan-triangulated). Invalid mesh data results in an
+		*          evaluator without triangles.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit WindingNumberEvaluator(const GeometryKernel::ReferencedMeshGeometryData& meshData, const WindingNumberSettings& settings = {});
+
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Winding number at a point.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double Evaluate(const GeometryKernel::Vector3& point) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Winding numbers at a batch of points.
+		*   \param[in] points            query points.
+		*   \param[in] results           results resized to the number of points.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void EvaluateBatch(const GeometryKernel::GridSamplePoints& points, std::vector<double>& results) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Fills ScalarGridData::CellData with winding numbers at cell centers.
+		*   \param[in] gridData          initialized scalar grid data (e.g.: from InitializeScalarGridData).
+		*   \return Processing status (InvalidInput for an empty mesh or grid)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] MeshProcessingStatus FillGrid(GeometryKernel::ScalarGridData& gridData) const;
+
+		/// @{
+		/// \name Getters
+
+		[[nodiscard]] size_t TriangleCount() const
+		{
+			return m_Triangles.size();
+		}
+
+	private:
+		//=============================================================================
+		/// \struct ClusterNode
+		/// \brief A node of the triangle cluster hierarchy. The left child of an inner node directly follows it in the node array.
+		//=============================================================================
+		struct ClusterNode
+		{
+			std::array<double, 3> Center{};        //!< area-weighted centroid of the cluster's triangles
+			std::array<double, 3> NormalSum{};     //!< sum of area-weighted triangle normals (dipole moment)
+			std::array<double, 9> NormalMoment{};  //!< sum of area * normal_i * (centroid - Center)_j (second order moment)
+			double                RadiusSquared{ 0.0 };
+			unsigned int          First{ 0 };      //!< first triangle of a leaf
+			unsigned int          Count{ 0 };      //!< number of triangles of a leaf (0 for inner nodes)
+			unsigned int          Right{ 0 };      //!< right child of an inner node
+		};
+
+		void BuildNode(const unsigned int& first, const unsigned int& count);
+
+		[[nodiscard]] double EvaluateAt(const std::array<double, 3>& point) const;
+
+		//
+		// ==================================
+		//
+
+		std::vector<TrianglePoints>  m_Triangles;
+		std::vector<ClusterNode>     m_Nodes;
+		WindingNumberSettings        m_Settings;
+	};
+
+} // namespace Symplektis::Algorithms
\ No newline at end of file
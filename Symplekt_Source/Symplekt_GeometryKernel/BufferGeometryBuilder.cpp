@@ -22,6 +22,12 @@ namespace Symplektis::GeometryKernel
 		m_ResultData = std::make_unique<BufferMeshGeometryData>(inputData.Name);
 	}
 
+	BufferMeshGeometryBuilder::BufferMeshGeometryBuilder(BasePolygonalGeometryData&& inputData)
+	{
+		m_ResultData = std::make_unique<BufferMeshGeometryData>(inputData.Name);
+		m_BaseData = std::make_unique<BasePolygonalGeometryData>(std::move(inputData));
+	}
+
 	void BufferMeshGeometryBuilder::PreallocateMeshGeometryContainers()
 	{
 		if (m_BaseData->Vertices.empty() || m_BaseData->PolyVertexIndices.empty())
@@ -40,6 +40,16 @@ namespace Symplektis::GeometryKernel
 		//-----------------------------------------------------------------------------
 		explicit BufferMeshGeometryBuilder(BasePolygonalGeometryData& inputData);
 
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor taking over the buffers of input data (e.g.: freshly imported), without copying them.
+		*   \param[in] inputData        BasePolygonalGeometryData to construct a buffer geometry data from
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit BufferMeshGeometryBuilder(BasePolygonalGeometryData&& inputData);
+
         /// @{
 		/// \name Functionality
 
@@ -94,7 +104,7 @@ namespace Symplektis::GeometryKernel
 		//-----------------------------------------------------------------------------
 		void SetBaseData(BasePolygonalGeometryData&& data)
 		{
-			m_BaseData = std::make_unique<BasePolygonalGeometryData>(data);
+			m_BaseData = std::make_unique<BasePolygonalGeometryData>(std::move(data));
 		}
 
 		//-----------------------------------------------------------------------------
@@ -0,0 +1,94 @@
+/*! \file  GridCellMask.cpp
+ *  \brief Implementation of a bit-packed per-cell flag container for scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "GridCellMask.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace Symplektis::GeometryKernel
+{
+	//!> \brief a word with all flags set
+	constexpr uint64_t full_mask_word = ~static_cast<uint64_t>(0);
+
+	GridCellMask::GridCellMask(const size_t& cellCount, const bool& value)
+		: m_Words((cellCount + 63) >> 6, 0), m_Size(cellCount)
+	{
+		if (value)
+			Fill(true);
+	}
+
+	GridCellMask::GridCellMask(const std::vector<bool>& flags)
+		: m_Words((flags.size() + 63) >> 6, 0), m_Size(flags.size())
+	{
+		for (size_t cellId = 0; cellId < m_Size; cellId++)
+		{
+			if (flags[cellId])
+				m_Words[cellId >> 6] |= static_cast<uint64_t>(1) << (cellId & 63);
+		}
+	}
+
+	void GridCellMask::Fill(const bool& value)
+	{
+		std::fill(m_Words.begin(), m_Words.end(), value ? full_mask_word : 0);
+		if (value && (m_Size & 63) != 0)
+			m_Words.back() = full_mask_word >> (64 - (m_Size & 63));
+	}
+
+	size_t GridCellMask::Count() const
+	{
+		size_t count = 0;
+		for (const auto& word : m_Words)
+			count += static_cast<size_t>(std::popcount(word));
+		return count;
+	}
+
+	size_t GridCellMask::FindNextSet(const size_t& cellId) const
+	{
+		if (cellId >= m_Size)
+			return m_Size;
+
+		size_t wordId = cellId >> 6;
+		// flags before cellId are cleared from its word
+		uint64_t word = m_Words[wordId] & (full_mask_word << (cellId & 63));
+		while (word == 0)
+		{
+			if (++wordId == m_Words.size())
+				return m_Size;
+			word = m_Words[wordId];
+		}
+		return (wordId << 6) + static_cast<size_t>(std::countr_zero(word));
+	}
+
+	size_t GridCellMask::FindNextUnset(const size_t& cellId) const
+	{
+		if (cellId >= m_Size)
+			return m_Size;
+
+		size_t wordId = cellId >> 6;
+		// inverted flags, with flags before cellId cleared from its word
+		uint64_t word = ~m_Words[wordId] & (full_mask_word << (cellId & 63));
+		while (word == 0)
+		{
+			if (++wordId == m_Words.size())
+				return m_Size;
+			word = ~m_Words[wordId];
+		}
+		// unset bits beyond Size() in the last word are not cells
+		const size_t result = (wordId << 6) + static_cast<size_t>(std::countr_zero(word));
+		return result < m_Size ? result : m_Size;
+	}
+
+	void GridCellMask::CopyTo(std::vector<bool>& flags) const
+	{
+		flags.assign(m_Size, false);
+		for (size_t cellId = FindNextSet(0); cellId < m_Size; cellId = FindNextSet(cellId + 1))
+			flags[cellId] = true;
+	}
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
@@ -0,0 +1,198 @@
+/*! \file  GridCellMask.h
+ *  \brief A bit-packed per-cell flag container for scalar grids (e.g.: frozen cells) with atomic updates.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace Symplektis::GeometryKernel
+{
+	//=============================================================================
+	/// \class GridCellMask
+	/// \brief Per-cell flags of a scalar grid (indexed by cellId = i + XCellCount * (j + YCellCount * k), like
+	///        ScalarGridData::CellIsFrozen) packed into 64-bit words.
+	///
+	///        Unlike std::vector<bool>, single flags can be set, reset and tested from multiple threads at once: these
+	///        operations are atomic on the word containing the flag (with relaxed memory order, so results written by
+	///        parallel loops are visible after they join). Counting uses word popcounts, and scanning for the next set
+	///        (or unset) flag skips whole words of unset (or set) flags. Bits beyond Size() are always unset.
+	///
+	/// \ingroup GEOMETRY_REPS
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class GridCellMask
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Default constructor (empty mask)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		GridCellMask() = default;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		*   \param[in] cellCount       number of cells.
+		*   \param[in] value           initial value of all flags.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit GridCellMask(const size_t& cellCount, const bool& value = false);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from per-cell flags (e.g.: ScalarGridData::CellIsFrozen).
+		*   \param[in] flags           per-cell flags.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit GridCellMask(const std::vector<bool>& flags);
+
+		/// @{
+		/// \name Cell access (thread-safe)
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the flag of a cell.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool Test(const size_t& cellId) const
+		{
+			return (GetAtomicWord(cellId >> 6).load(std::memory_order_relaxed) >> (cellId & 63)) & 1;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Sets the flag of a cell.
+		*   \return true if the flag was not set before (i.e.: exactly one of concurrent callers gets true).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		bool Set(const size_t& cellId)
+		{
+			const uint64_t bit = static_cast<uint64_t>(1) << (cellId & 63);
+			return (GetAtomicWord(cellId >> 6).fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Resets the flag of a cell.
+		*   \return true if the flag was set before.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		bool Reset(const size_t& cellId)
+		{
+			const uint64_t bit = static_cast<uint64_t>(1) << (cellId & 63);
+			return (GetAtomicWord(cellId >> 6).fetch_and(~bit, std::memory_order_relaxed) & bit) != 0;
+		}
+
+		/// @{
+		/// \name Bulk operations (not thread-safe)
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Sets all flags to a value.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Fill(const bool& value);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the number of set flags.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t Count() const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the first cell with a set flag at or after a cell (Size() if there is none).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t FindNextSet(const size_t& cellId) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the first cell with an unset flag at or after a cell (Size() if there is none).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t FindNextUnset(const size_t& cellId) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Copies the flags into per-cell flags (e.g.: ScalarGridData::CellIsFrozen), resized to Size().
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void CopyTo(std::vector<bool>& flags) const;
+
+		/// @{
+		/// \name Getters
+
+		[[nodiscard]] size_t Size() const
+		{
+			return m_Size;
+		}
+
+		[[nodiscard]] bool Empty() const
+		{
+			return m_Size == 0;
+		}
+
+		[[nodiscard]] const std::vector<uint64_t>& Words() const
+		{
+			return m_Words;
+		}
+
+	private:
+		//-----------------------------------------------------------------------------
+		/*! \brief Atomic view of a word of the mask.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::atomic_ref<uint64_t> GetAtomicWord(const size_t& wordId) const
+		{
+			return std::atomic_ref<uint64_t>(const_cast<uint64_t&>(m_Words[wordId]));
+		}
+
+		//
+		// ==================================
+		//
+
+		std::vector<uint64_t> m_Words{};   //>! flags of cells 64 n, ..., 64 n + 63 in bits 0, ..., 63 of word n
+		size_t                m_Size{ 0 }; //>! number of cells
+	};
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
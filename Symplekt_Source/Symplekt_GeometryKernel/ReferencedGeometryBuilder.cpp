@@ -27,6 +27,12 @@ namespace Symplektis::GeometryKernel
 		m_ResultData = std::make_unique<ReferencedMeshGeometryData>(inputData.Name);
 	}
 
+	ReferencedMeshGeometryBuilder::ReferencedMeshGeometryBuilder(BasePolygonalGeometryData&& inputData)
+	{
+		m_ResultData = std::make_unique<ReferencedMeshGeometryData>(inputData.Name);
+		m_BaseData = std::make_unique<BasePolygonalGeometryData>(std::move(inputData));
+	}
+
 	//-----------------------------------------------------------------------------
 	/*! \brief Check for isolated vertices given a half-edge container
 	*   \param[in] vert      vertex to be checked
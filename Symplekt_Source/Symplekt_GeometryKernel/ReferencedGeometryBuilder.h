@@ -47,6 +47,16 @@ namespace Symplektis::GeometryKernel
 		//-----------------------------------------------------------------------------
 		explicit ReferencedMeshGeometryBuilder(BasePolygonalGeometryData& inputData);
 
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor taking over the buffers of input data (e.g.: freshly imported), without copying them.
+		*   \param[in] inputData        BasePolygonalGeometryData to construct a referenced geometry data from
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit ReferencedMeshGeometryBuilder(BasePolygonalGeometryData&& inputData);
+
 		/// @{
 		/// \name Functionality
 
@@ -102,7 +112,7 @@ namespace Symplektis::GeometryKernel
 		//-----------------------------------------------------------------------------
 		void SetBaseData(BasePolygonalGeometryData&& data)
 		{
-			m_BaseData = std::make_unique<BasePolygonalGeometryData>(data);
+			m_BaseData = std::make_unique<BasePolygonalGeometryData>(std::move(data));
 		}
 
 		//-----------------------------------------------------------------------------
@@ -0,0 +1,326 @@
+/*! \file  ScalarGridPyramid.cpp
+ *  \brief Implementation of restriction and prolongation operators between levels of a multi-resolution pyramid of ScalarGridData.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "ScalarGridPyramid.h"
+
+#include "GridCellMask.h"
+#include "ScalarGridInit.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace Symplektis::GeometryKernel
+{
+	//!> \brief relative tolerance of the alignment of pyramid levels
+	constexpr double pyramid_alignment_tolerance = 1e-6;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Offsets of the fine grid minimum from the coarse grid minimum along x, y and z (in fine cells).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::array<double, 3> GetFineGridOffsets(const ScalarGridData& coarseData, const ScalarGridData& fineData)
+	{
+		const auto& coarseMin = coarseData.BoundingBox.Min();
+		const auto& fineMin = fineData.BoundingBox.Min();
+		return {
+			(fineMin.X() - coarseMin.X()) / fineData.CellSize,
+			(fineMin.Y() - coarseMin.Y()) / fineData.CellSize,
+			(fineMin.Z() - coarseMin.Z()) / fineData.CellSize };
+	}
+
+	ScalarGridData RestrictScalarGridData(const ScalarGridData& fineData)
+	{
+		auto coarseData = InitializeScalarGridData({ fineData.Name,
+			Box3{ fineData.BoundingBox.Min(), fineData.BoundingBox.Max() }, 2.0 * fineData.CellSize, 0.0 });
+
+		const std::array<size_t, 3> fineCounts{ fineData.XCellCount, fineData.YCellCount, fineData.ZCellCount };
+		const std::array<size_t, 3> coarseCounts{ coarseData.XCellCount, coarseData.YCellCount, coarseData.ZCellCount };
+		if (fineCounts[0] * fineCounts[1] * fineCounts[2] == 0 || fineData.CellData.size() != fineCounts[0] * fineCounts[1] * fineCounts[2])
+			return coarseData;
+
+		// ------ fine indices of the two children of each coarse index along each axis ----------------------------
+		const auto offsets = GetFineGridOffsets(coarseData, fineData);
+		std::array<std::vector<size_t>, 3> childIndices;
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			const auto offset = static_cast<long long>(std::lround(offsets[axis]));
+			const auto maxIndex = static_cast<long long>(fineCounts[axis]) - 1;
+			childIndices[axis].resize(2 * coarseCounts[axis]);
+			for (size_t n = 0; n < childIndices[axis].size(); n++)
+				childIndices[axis][n] = static_cast<size_t>(std::clamp(static_cast<long long>(n) - offset, 0LL, maxIndex));
+		}
+
+		// frozen flags of coarse cells of neighboring slabs may share a mask word, so they are set atomically
+		const bool hasFrozenCells = fineData.CellIsFrozen.size() == fineData.CellData.size() &&
+			std::find(fineData.CellIsFrozen.begin(), fineData.CellIsFrozen.end(), true) != fineData.CellIsFrozen.end();
+		const GridCellMask isFineFrozen = hasFrozenCells ? GridCellMask(fineData.CellIsFrozen) : GridCellMask{};
+		GridCellMask isCoarseFrozen(hasFrozenCells ? coarseData.CellData.size() : 0);
+
+		const size_t nx = fineCounts[0];
+		const size_t nxy = fineCounts[0] * fineCounts[1];
+		Util::ParallelForChunks(coarseCounts[2], Util::GetParallelChunkCount(coarseCounts[2], 1),
+			[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+			{
+				for (size_t k = kBegin; k < kEnd; k++)
+				{
+					for (size_t j = 0; j < coarseCounts[1]; j++)
+					{
+						for (size_t i = 0; i < coarseCounts[0]; i++)
+						{
+							const size_t coarseCellId = i + coarseCounts[0] * (j + coarseCounts[1] * k);
+							double sum = 0.0;
+							for (size_t c = 0; c < 8; c++)
+							{
+								const size_t childId =
+									childIndices[0][2 * i + (c & 1)] +
+									nx * childIndices[1][2 * j + ((c >> 1) & 1)] +
+									nxy * childIndices[2][2 * k + (c >> 2)];
+								sum += fineData.CellData[childId];
+								if (hasFrozenCells && isFineFrozen.Test(childId))
+									isCoarseFrozen.Set(coarseCellId);
+							}
+							coarseData.CellData[coarseCellId] = 0.125 * sum;
+						}
+					}
+				}
+			});
+
+		if (hasFrozenCells)
+			isCoarseFrozen.CopyTo(coarseData.CellIsFrozen);
+
+		return coarseData;
+	}
+
+	//=============================================================================
+	/// \struct ProlongationStencils
+	/// \brief Coarse cell indices and weights of the trilinear interpolation at fine cell centers along each axis.
+	//=============================================================================
+	struct ProlongationStencils
+	{
+		std::array<size_t, 3>               FineCounts{};
+		std::array<size_t, 3>               CoarseCounts{};
+		std::array<size_t, 3>               Offsets{};          //!< offsets of the fine grid minimum from the coarse grid minimum (0 or 1 fine cell)
+		std::array<std::vector<size_t>, 3>  LowerIndices{};
+		std::array<std::vector<size_t>, 3>  UpperIndices{};
+		std::array<std::vector<double>, 3>  UpperWeights{};
+		std::array<std::vector<size_t>, 3>  ParentIndices{};    //!< indices of the coarse cells containing fine cell centers
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates prolongation stencils of fine cells along each axis.
+	*   \return false if coarseData is not the coarser pyramid level of fineData
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool GetProlongationStencils(const ScalarGridData& coarseData, const ScalarGridData& fineData, ProlongationStencils& stencils)
+	{
+		stencils.FineCounts = { fineData.XCellCount, fineData.YCellCount, fineData.ZCellCount };
+		stencils.CoarseCounts = { coarseData.XCellCount, coarseData.YCellCount, coarseData.ZCellCount };
+		const size_t fineCellCount = stencils.FineCounts[0] * stencils.FineCounts[1] * stencils.FineCounts[2];
+		const size_t coarseCellCount = stencils.CoarseCounts[0] * stencils.CoarseCounts[1] * stencils.CoarseCounts[2];
+		if (fineCellCount == 0 || coarseCellCount == 0 || fineData.CellSize <= 0.0 || coarseData.CellData.size() != coarseCellCount ||
+			std::fabs(coarseData.CellSize - 2.0 * fineData.CellSize) > pyramid_alignment_tolerance * fineData.CellSize)
+			return false;
+
+		// the center of fine cell n lies at the coarse cell coordinate (n + offset) / 2 - 1/4
+		const auto offsets = GetFineGridOffsets(coarseData, fineData);
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			const double offset = std::round(offsets[axis]);
+			if ((offset != 0.0 && offset != 1.0) || std::fabs(offsets[axis] - offset) > pyramid_alignment_tolerance)
+				return false;
+
+			const auto maxIndex = static_cast<long long>(stencils.CoarseCounts[axis]) - 1;
+			const size_t fineCount = stencils.FineCounts[axis];
+			stencils.Offsets[axis] = static_cast<size_t>(offset);
+			stencils.LowerIndices[axis].resize(fineCount);
+			stencils.UpperIndices[axis].resize(fineCount);
+			stencils.UpperWeights[axis].resize(fineCount);
+			stencils.ParentIndices[axis].resize(fineCount);
+			for (size_t n = 0; n < fineCount; n++)
+			{
+				const double coordinate = 0.5 * (static_cast<double>(n) + offset) - 0.25;
+				const double lower = std::floor(coordinate);
+				const auto lowerIndex = static_cast<long long>(lower);
+				stencils.LowerIndices[axis][n] = static_cast<size_t>(std::clamp(lowerIndex, 0LL, maxIndex));
+				stencils.UpperIndices[axis][n] = static_cast<size_t>(std::clamp(lowerIndex + 1, 0LL, maxIndex));
+				stencils.UpperWeights[axis][n] = coordinate - lower;
+				stencils.ParentIndices[axis][n] = std::min((n + stencils.Offsets[axis]) / 2, static_cast<size_t>(maxIndex));
+			}
+		}
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Interpolates coarse cell values at the centers of fine cells [iBegin, iEnd) of row (j, k).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void ProlongateRowCells(const ProlongationStencils& stencils, const std::vector<double>& values,
+		const size_t& j, const size_t& k, const size_t& iBegin, const size_t& iEnd, double* fineRow)
+	{
+		const size_t cx = stencils.CoarseCounts[0];
+		const size_t cxy = stencils.CoarseCounts[0] * stencils.CoarseCounts[1];
+		const size_t k0 = cxy * stencils.LowerIndices[2][k];
+		const size_t k1 = cxy * stencils.UpperIndices[2][k];
+		const double wz = stencils.UpperWeights[2][k];
+		const size_t j0 = cx * stencils.LowerIndices[1][j];
+		const size_t j1 = cx * stencils.UpperIndices[1][j];
+		const double wy = stencils.UpperWeights[1][j];
+		for (size_t i = iBegin; i < iEnd; i++)
+		{
+			const size_t i0 = stencils.LowerIndices[0][i];
+			const size_t i1 = stencils.UpperIndices[0][i];
+			const double wx = stencils.UpperWeights[0][i];
+			const double v00 = values[i0 + j0 + k0] + wx * (values[i1 + j0 + k0] - values[i0 + j0 + k0]);
+			const double v10 = values[i0 + j1 + k0] + wx * (values[i1 + j1 + k0] - values[i0 + j1 + k0]);
+			const double v01 = values[i0 + j0 + k1] + wx * (values[i1 + j0 + k1] - values[i0 + j0 + k1]);
+			const double v11 = values[i0 + j1 + k1] + wx * (values[i1 + j1 + k1] - values[i0 + j1 + k1]);
+			const double v0 = v00 + wy * (v10 - v00);
+			const double v1 = v01 + wy * (v11 - v01);
+			fineRow[i] = v0 + wz * (v1 - v0);
+		}
+	}
+
+	bool ProlongateScalarGridData(const ScalarGridData& coarseData, ScalarGridData& fineData)
+	{
+		ProlongationStencils stencils;
+		if (!GetProlongationStencils(coarseData, fineData, stencils))
+			return false;
+
+		const auto& fineCounts = stencils.FineCounts;
+		fineData.CellData.resize(fineCounts[0] * fineCounts[1] * fineCounts[2]);
+		Util::ParallelForChunks(fineCounts[2], Util::GetParallelChunkCount(fineCounts[2], 1),
+			[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+			{
+				for (size_t k = kBegin; k < kEnd; k++)
+				{
+					for (size_t j = 0; j < fineCounts[1]; j++)
+						ProlongateRowCells(stencils, coarseData.CellData, j, k, 0, fineCounts[0], fineData.CellData.data() + fineCounts[0] * (j + fineCounts[1] * k));
+				}
+			});
+
+		return true;
+	}
+
+	bool ProlongateScalarGridData(const ScalarGridData& coarseData, ScalarGridData& fineData, const size_t& blockLog2,
+		const std::vector<size_t>& coarseBlockIds, const double& outsideValue, std::vector<size_t>& fineBlockIds)
+	{
+		ProlongationStencils stencils;
+		if (!GetProlongationStencils(coarseData, fineData, stencils))
+			return false;
+
+		// ------ fine blocks containing children of cells of the coarse blocks ----------------------------------
+		const size_t blockSize = static_cast<size_t>(1) << blockLog2;
+		const auto& fineCounts = stencils.FineCounts;
+		std::array<size_t, 3> coarseBlockCounts{};
+		std::array<size_t, 3> fineBlockCounts{};
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			coarseBlockCounts[axis] = (stencils.CoarseCounts[axis] + blockSize - 1) >> blockLog2;
+			fineBlockCounts[axis] = (fineCounts[axis] + blockSize - 1) >> blockLog2;
+		}
+
+		std::vector<uint8_t> isFineBlockProlongated(fineBlockCounts[0] * fineBlockCounts[1] * fineBlockCounts[2], 0);
+		for (const size_t coarseBlockId : coarseBlockIds)
+		{
+			if (coarseBlockId >= coarseBlockCounts[0] * coarseBlockCounts[1] * coarseBlockCounts[2])
+				return false;
+
+			const std::array<size_t, 3> coarseBlock{
+				coarseBlockId % coarseBlockCounts[0],
+				(coarseBlockId / coarseBlockCounts[0]) % coarseBlockCounts[1],
+				coarseBlockId / (coarseBlockCounts[0] * coarseBlockCounts[1]) };
+			std::array<size_t, 3> fineBlockBegin{};
+			std::array<size_t, 3> fineBlockEnd{};
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				// children of coarse cells [c0, c1) are the fine cells [2 c0 - offset, 2 c1 - offset)
+				const size_t childBegin = std::max(2 * (coarseBlock[axis] << blockLog2), stencils.Offsets[axis]) - stencils.Offsets[axis];
+				const size_t childEnd = std::min(2 * ((coarseBlock[axis] + 1) << blockLog2) - stencils.Offsets[axis], fineCounts[axis]);
+				fineBlockBegin[axis] = childBegin >> blockLog2;
+				fineBlockEnd[axis] = childBegin < childEnd ? ((childEnd - 1) >> blockLog2) + 1 : fineBlockBegin[axis];
+			}
+
+			for (size_t bk = fineBlockBegin[2]; bk < fineBlockEnd[2]; bk++)
+				for (size_t bj = fineBlockBegin[1]; bj < fineBlockEnd[1]; bj++)
+					for (size_t bi = fineBlockBegin[0]; bi < fineBlockEnd[0]; bi++)
+						isFineBlockProlongated[bi + fineBlockCounts[0] * (bj + fineBlockCounts[1] * bk)] = 1;
+		}
+
+		fineBlockIds.clear();
+		for (size_t blockId = 0; blockId < isFineBlockProlongated.size(); blockId++)
+		{
+			if (isFineBlockProlongated[blockId])
+				fineBlockIds.push_back(blockId);
+		}
+
+		// ------ interpolation within the fine blocks, the sign of the parent coarse cell elsewhere ------------
+		fineData.CellData.resize(fineCounts[0] * fineCounts[1] * fineCounts[2]);
+		const size_t cx = stencils.CoarseCounts[0];
+		const size_t cxy = stencils.CoarseCounts[0] * stencils.CoarseCounts[1];
+		const auto& values = coarseData.CellData;
+		Util::ParallelForChunks(fineCounts[2], Util::GetParallelChunkCount(fineCounts[2], 1),
+			[&](const size_t /*chunkIndex*/, const size_t kBegin, const size_t kEnd)
+			{
+				for (size_t k = kBegin; k < kEnd; k++)
+				{
+					const size_t parentK = cxy * stencils.ParentIndices[2][k];
+					for (size_t j = 0; j < fineCounts[1]; j++)
+					{
+						const size_t parentJK = cx * stencils.ParentIndices[1][j] + parentK;
+						const size_t blockRowId = fineBlockCounts[0] * ((j >> blockLog2) + fineBlockCounts[1] * (k >> blockLog2));
+						double* fineRow = fineData.CellData.data() + fineCounts[0] * (j + fineCounts[1] * k);
+						for (size_t bi = 0; bi < fineBlockCounts[0]; bi++)
+						{
+							const size_t iBegin = bi << blockLog2;
+							const size_t iEnd = std::min(iBegin + blockSize, fineCounts[0]);
+							if (isFineBlockProlongated[blockRowId + bi])
+							{
+								ProlongateRowCells(stencils, values, j, k, iBegin, iEnd, fineRow);
+								continue;
+							}
+
+							for (size_t i = iBegin; i < iEnd; i++)
+								fineRow[i] = values[stencils.ParentIndices[0][i] + parentJK] < 0.0 ? -outsideValue : outsideValue;
+						}
+					}
+				}
+			});
+
+		return true;
+	}
+
+	std::vector<ScalarGridData> BuildScalarGridPyramid(const ScalarGridData& finestData, const unsigned int& coarseLevelCount)
+	{
+		std::vector<ScalarGridData> levels;
+		levels.reserve(coarseLevelCount);
+		const ScalarGridData* finerLevel = &finestData;
+		for (unsigned int level = 0; level < coarseLevelCount; level++)
+		{
+			if (finerLevel->XCellCount <= 1 && finerLevel->YCellCount <= 1 && finerLevel->ZCellCount <= 1)
+				break;
+
+			levels.push_back(RestrictScalarGridData(*finerLevel));
+			finerLevel = &levels.back();
+		}
+		return levels;
+	}
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*! \file  ScalarGridPyramid.h
+ *  \brief Restriction and prolongation operators between levels of a multi-resolution pyramid of ScalarGridData.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+
+#include <vector>
+
+namespace Symplektis::GeometryKernel
+{
+	//-----------------------------------------------------------------------------
+	/*! \brief Restricts a scalar grid to the next coarser pyramid level, i.e.: a grid with twice the cell size whose
+	 *         RectilinearGridBox3 (aligned with the global grid of the coarse cell size) contains the fine box.
+	 *         Each coarse cell holds the average of its 2^3 child cells (children outside of the fine grid are replaced
+	 *         by the nearest fine cell), and it is frozen if any of its children is frozen.
+	 *
+	 *	\param[in] fineData           fine scalar grid data.
+	 *  \return coarse scalar grid data
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	[[nodiscard]] ScalarGridData RestrictScalarGridData(const ScalarGridData& fineData);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Prolongates a coarse pyramid level to the next finer one by trilinear interpolation of coarse cell values
+	 *         at fine cell centers (with weights 1/4 and 3/4 along each axis, and constant extrapolation beyond the outer
+	 *         coarse cell centers). CellIsFrozen of the fine grid stays unchanged.
+	 *
+	 *	\param[in] coarseData         coarse scalar grid data (e.g.: from RestrictScalarGridData(fineData)).
+	 *	\param[in] fineData           fine scalar grid data whose CellData is overwritten.
+	 *  \return false if coarseData is not the coarser pyramid level of fineData
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	[[nodiscard]] bool ProlongateScalarGridData(const ScalarGridData& coarseData, ScalarGridData& fineData);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Prolongates a coarse pyramid level to the next finer one only within the fine cells whose parent coarse
+	 *         cells belong to the given blocks, e.g.: the narrow band of a level set. Both grids are split into blocks
+	 *         of 2^blockLog2 cells along each axis, indexed as cells (x fastest). Fine cells of the fine blocks containing
+	 *         children of the coarse blocks are interpolated as by ProlongateScalarGridData above. All other fine cells
+	 *         are set to -outsideValue if the value of their parent coarse cell is negative, and to outsideValue otherwise.
+	 *
+	 *	\param[in] coarseData         coarse scalar grid data (e.g.: from RestrictScalarGridData(fineData)).
+	 *	\param[in] fineData           fine scalar grid data whose CellData is overwritten.
+	 *	\param[in] blockLog2          log2 of the edge length of a block (in cells).
+	 *	\param[in] coarseBlockIds     ids of the prolongated coarse blocks.
+	 *	\param[in] outsideValue       magnitude of fine cell values outside of the prolongated blocks.
+	 *	\param[in] fineBlockIds       sorted ids of the prolongated fine blocks.
+	 *  \return false if coarseData is not the coarser pyramid level of fineData, or a coarse block id is out of range
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	[[nodiscard]] bool ProlongateScalarGridData(const ScalarGridData& coarseData, ScalarGridData& fineData, const size_t& blockLog2,
+		const std::vector<size_t>& coarseBlockIds, const double& outsideValue, std::vector<size_t>& fineBlockIds);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Builds the coarser levels of a multi-resolution pyramid by repeated restriction.
+	 *
+	 *	\param[in] finestData         finest pyramid level (not copied into the result).
+	 *	\param[in] coarseLevelCount   number of coarser levels. Restriction stops early once a level has a single cell.
+	 *  \return coarser levels ordered from fine to coarse (level n has the cell size 2^(n + 1) times finestData.CellSize)
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	[[nodiscard]] std::vector<ScalarGridData> BuildScalarGridPyramid(const ScalarGridData& finestData, const unsigned int& coarseLevelCount);
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
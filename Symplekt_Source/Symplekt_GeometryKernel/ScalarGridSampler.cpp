@@ -0,0 +1,257 @@
+/*! \file  ScalarGridSampler.cpp
+ *  \brief Implementation of an object for interpolating values and gradients of ScalarGridData at arbitrary points.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "ScalarGridSampler.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Symplektis::GeometryKernel
+{
+	//!> \brief number of points processed together in the vectorizable loops of SampleBatch
+	constexpr size_t sample_lane_count = 8;
+
+	//!> \brief minimum number of points per sampling thread
+	constexpr size_t min_sample_chunk_size = 16384;
+
+	//=============================================================================
+	/// \struct AxisStencil
+	/// \brief Position of a point within the cell centers along an axis.
+	//=============================================================================
+	struct AxisStencil
+	{
+		size_t Index{ 0 };               //!< index of the last cell center not after the point (clamped to [0, count - 2])
+		double T{ 0.0 };                 //!< relative position between cell centers Index and Index + 1, in [0, 1]
+		double DerivativeScale{ 0.0 };   //!< 1 / CellSize, or 0 if the point was clamped along the axis
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates the stencil position of a coordinate along an axis.
+	*   \param[in] coord          point coordinate.
+	*   \param[in] origin         coordinate of the center of the first cell.
+	*   \param[in] invCellSize    1 / CellSize.
+	*   \param[in] count          number of cells along the axis.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static inline AxisStencil GetAxisStencil(const double& coord, const double& origin, const double& invCellSize, const size_t& count)
+	{
+		const double maxU = static_cast<double>(count - 1);
+		const double rawU = (coord - origin) * invCellSize;
+		const double u = rawU >= 0.0 ? std::min(rawU, maxU) : 0.0; // NaN coordinates are clamped to 0 as well
+		const double maxIndex = count > 1 ? maxU - 1.0 : 0.0;
+		const double index = std::min(std::floor(u), maxIndex);
+
+		AxisStencil result;
+		result.Index = static_cast<size_t>(index);
+		result.T = u - index;
+		result.DerivativeScale = (rawU == u) ? invCellSize : 0.0;
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Catmull-Rom spline weights (and their derivatives) of the four cell centers Index - 1, ..., Index + 2 at relative position t.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static inline void GetCubicWeights(const double& t, std::array<double, 4>& weights, std::array<double, 4>& derivativeWeights)
+	{
+		const double t2 = t * t;
+		const double t3 = t2 * t;
+		weights = {
+			0.5 * (-t3 + 2.0 * t2 - t),
+			0.5 * (3.0 * t3 - 5.0 * t2 + 2.0),
+			0.5 * (-3.0 * t3 + 4.0 * t2 + t),
+			0.5 * (t3 - t2) };
+		derivativeWeights = {
+			0.5 * (-3.0 * t2 + 4.0 * t - 1.0),
+			0.5 * (9.0 * t2 - 10.0 * t),
+			0.5 * (-9.0 * t2 + 8.0 * t + 1.0),
+			0.5 * (3.0 * t2 - 2.0 * t) };
+	}
+
+	ScalarGridSampler::ScalarGridSampler(const ScalarGridData& gridData, const GridInterpolationType& type)
+		: m_Values(gridData.CellData), m_Type(type)
+	{
+		m_Origin = {
+			gridData.BoundingBox.Min().X() + 0.5 * gridData.CellSize,
+			gridData.BoundingBox.Min().Y() + 0.5 * gridData.CellSize,
+			gridData.BoundingBox.Min().Z() + 0.5 * gridData.CellSize };
+		m_Counts = { gridData.XCellCount, gridData.YCellCount, gridData.ZCellCount };
+		m_InvCellSize = gridData.CellSize > 0.0 ? 1.0 / gridData.CellSize : 0.0;
+	}
+
+	double ScalarGridSampler::Sample(const Vector3& point) const
+	{
+		const double x = point.X(), y = point.Y(), z = point.Z();
+		double value = 0.0;
+		SampleRange(&x, &y, &z, 0, 1, &value, nullptr, nullptr, nullptr);
+		return value;
+	}
+
+	Vector3 ScalarGridSampler::SampleGradient(const Vector3& point) const
+	{
+		const double x = point.X(), y = point.Y(), z = point.Z();
+		double value = 0.0;
+		double gradX = 0.0, gradY = 0.0, gradZ = 0.0;
+		SampleRange(&x, &y, &z, 0, 1, &value, &gradX, &gradY, &gradZ);
+		return Vector3{ gradX, gradY, gradZ };
+	}
+
+	void ScalarGridSampler::SampleBatch(const GridSamplePoints& points, GridSampleResults& results, const bool& computeGradients) const
+	{
+		const size_t count = points.Size();
+		results.Values.resize(count);
+		results.GradientX.resize(computeGradients ? count : 0);
+		results.GradientY.resize(computeGradients ? count : 0);
+		results.GradientZ.resize(computeGradients ? count : 0);
+		if (count == 0 || points.Y.size() != count || points.Z.size() != count)
+			return;
+
+		Util::ParallelForChunks(count, Util::GetParallelChunkCount(count, min_sample_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				SampleRange(points.X.data(), points.Y.data(), points.Z.data(), begin, end, results.Values.data(),
+					computeGradients ? results.GradientX.data() : nullptr,
+					computeGradients ? results.GradientY.data() : nullptr,
+					computeGradients ? results.GradientZ.data() : nullptr);
+			});
+	}
+
+	void ScalarGridSampler::SampleRange(const double* x, const double* y, const double* z, const size_t& begin, const size_t& end,
+		double* values, double* gradX, double* gradY, double* gradZ) const
+	{
+		const size_t nx = m_Counts[0];
+		const size_t nxy = m_Counts[0] * m_Counts[1];
+		const size_t stepX = nx > 1 ? 1 : 0;
+		const size_t stepY = m_Counts[1] > 1 ? nx : 0;
+		const size_t stepZ = m_Counts[2] > 1 ? nxy : 0;
+		const double* cellValues = m_Values.data();
+		if (m_Values.empty() || m_Values.size() != nxy * m_Counts[2] || m_InvCellSize == 0.0)
+		{
+			// inconsistent grid data: nothing to interpolate
+			for (size_t id = begin; id < end; id++)
+			{
+				values[id] = 0.0;
+				if (gradX)
+					gradX[id] = gradY[id] = gradZ[id] = 0.0;
+			}
+			return;
+		}
+
+		for (size_t first = begin; first < end; first += sample_lane_count)
+		{
+			const size_t laneCount = std::min(sample_lane_count, end - first);
+
+			// ------ stencil positions along each axis ----------------------------------------
+			std::array<AxisStencil, sample_lane_count> sx{}, sy{}, sz{};
+			for (size_t lane = 0; lane < laneCount; lane++)
+			{
+				sx[lane] = GetAxisStencil(x[first + lane], m_Origin[0], m_InvCellSize, m_Counts[0]);
+				sy[lane] = GetAxisStencil(y[first + lane], m_Origin[1], m_InvCellSize, m_Counts[1]);
+				sz[lane] = GetAxisStencil(z[first + lane], m_Origin[2], m_InvCellSize, m_Counts[2]);
+			}
+
+			if (m_Type == GridInterpolationType::Trilinear)
+			{
+				// ------ gather the 2^3 stencil values -----------------------------------------
+				std::array<std::array<double, sample_lane_count>, 8> c{};
+				for (size_t lane = 0; lane < laneCount; lane++)
+				{
+					const double* base = cellValues + sx[lane].Index + nx * sy[lane].Index + nxy * sz[lane].Index;
+					c[0][lane] = base[0];
+					c[1][lane] = base[stepX];
+					c[2][lane] = base[stepY];
+					c[3][lane] = base[stepX + stepY];
+					c[4][lane] = base[stepZ];
+					c[5][lane] = base[stepX + stepZ];
+					c[6][lane] = base[stepY + stepZ];
+					c[7][lane] = base[stepX + stepY + stepZ];
+				}
+
+				// ------ blend -----------------------------------------------------------------
+				for (size_t lane = 0; lane < laneCount; lane++)
+				{
+					const double tx = sx[lane].T, ty = sy[lane].T, tz = sz[lane].T;
+					const double a00 = c[0][lane] + tx * (c[1][lane] - c[0][lane]);
+					const double a10 = c[2][lane] + tx * (c[3][lane] - c[2][lane]);
+					const double a01 = c[4][lane] + tx * (c[5][lane] - c[4][lane]);
+					const double a11 = c[6][lane] + tx * (c[7][lane] - c[6][lane]);
+					const double b0 = a00 + ty * (a10 - a00);
+					const double b1 = a01 + ty * (a11 - a01);
+					values[first + lane] = b0 + tz * (b1 - b0);
+					if (!gradX)
+						continue;
+
+					const double e0 = (c[1][lane] - c[0][lane]) + ty * ((c[3][lane] - c[2][lane]) - (c[1][lane] - c[0][lane]));
+					const double e1 = (c[5][lane] - c[4][lane]) + ty * ((c[7][lane] - c[6][lane]) - (c[5][lane] - c[4][lane]));
+					gradX[first + lane] = (e0 + tz * (e1 - e0)) * sx[lane].DerivativeScale;
+					gradY[first + lane] = ((a10 - a00) + tz * ((a11 - a01) - (a10 - a00))) * sy[lane].DerivativeScale;
+					gradZ[first + lane] = (b1 - b0) * sz[lane].DerivativeScale;
+				}
+				continue;
+			}
+
+			// ------ tricubic: separable Catmull-Rom weights of the 4^3 stencil ---------------------
+			for (size_t lane = 0; lane < laneCount; lane++)
+			{
+				std::array<double, 4> wx{}, wy{}, wz{}, dwx{}, dwy{}, dwz{};
+				GetCubicWeights(sx[lane].T, wx, dwx);
+				GetCubicWeights(sy[lane].T, wy, dwy);
+				GetCubicWeights(sz[lane].T, wz, dwz);
+
+				std::array<size_t, 4> ox{}, oy{}, oz{};
+				for (size_t s = 0; s < 4; s++)
+				{
+					// stencil cells beyond the grid are clamped to the boundary cells
+					ox[s] = std::min(static_cast<size_t>(std::max(static_cast<long long>(sx[lane].Index) + static_cast<long long>(s) - 1, 0LL)), m_Counts[0] - 1);
+					oy[s] = nx * std::min(static_cast<size_t>(std::max(static_cast<long long>(sy[lane].Index) + static_cast<long long>(s) - 1, 0LL)), m_Counts[1] - 1);
+					oz[s] = nxy * std::min(static_cast<size_t>(std::max(static_cast<long long>(sz[lane].Index) + static_cast<long long>(s) - 1, 0LL)), m_Counts[2] - 1);
+				}
+
+				double value = 0.0, dx = 0.0, dy = 0.0, dz = 0.0;
+				for (size_t k = 0; k < 4; k++)
+				{
+					double planeValue = 0.0, planeDx = 0.0, planeDy = 0.0;
+					for (size_t j = 0; j < 4; j++)
+					{
+						const double* row = cellValues + oy[j] + oz[k];
+						double rowValue = 0.0, rowDx = 0.0;
+						for (size_t i = 0; i < 4; i++)
+						{
+							rowValue += wx[i] * row[ox[i]];
+							rowDx += dwx[i] * row[ox[i]];
+						}
+						planeValue += wy[j] * rowValue;
+						planeDx += wy[j] * rowDx;
+						planeDy += dwy[j] * rowValue;
+					}
+					value += wz[k] * planeValue;
+					dx += wz[k] * planeDx;
+					dy += wz[k] * planeDy;
+					dz += dwz[k] * planeValue;
+				}
+
+				values[first + lane] = value;
+				if (!gradX)
+					continue;
+
+				gradX[first + lane] = dx * sx[lane].DerivativeScale;
+				gradY[first + lane] = dy * sy[lane].DerivativeScale;
+				gradZ[first + lane] = dz * sz[lane].DerivativeScale;
+			}
+		}
+	}
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
@@ -0,0 +1,331 @@
+/*! \file  SparseScalarGridData.cpp
+ *  \brief Implementation of a sparse, blocked counterpart of ScalarGridData.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "SparseScalarGridData.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Symplektis::GeometryKernel
+{
+	//!> \brief mask of cell index bits within a brick
+	constexpr size_t brick_cell_mask = SPARSE_GRID_BRICK_SIZE - 1;
+
+	//!> \brief number of bits per packed brick coordinate
+	constexpr uint64_t brick_key_bits = 21;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Packs brick coordinates into a brick map key.
+	*/
+	//-----------------------------------------------------------------------------
+	static uint64_t GetBrickKey(const size_t& brickX, const size_t& brickY, const size_t& brickZ)
+	{
+		return static_cast<uint64_t>(brickX) | (static_cast<uint64_t>(brickY) << brick_key_bits) | (static_cast<uint64_t>(brickZ) << (2 * brick_key_bits));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Index of a cell within its brick.
+	*/
+	//-----------------------------------------------------------------------------
+	static size_t GetBrickCellId(const size_t& i, const size_t& j, const size_t& k)
+	{
+		return (i & brick_cell_mask) | ((j & brick_cell_mask) << SPARSE_GRID_BRICK_LOG2) | ((k & brick_cell_mask) << (2 * SPARSE_GRID_BRICK_LOG2));
+	}
+
+	SparseScalarGridData::SparseScalarGridData(const BaseScalarGridInputData& inputData)
+		: Name(inputData.Name)
+		, BoundingBox(inputData.CellSize, inputData.BoundingBox)
+		, CellSize(inputData.CellSize)
+		, m_BackgroundValue(inputData.InitValue)
+	{
+		const auto boxSize = BoundingBox.GetSize();
+
+		XCellCount = static_cast<size_t>(boxSize.X() / inputData.CellSize);
+		YCellCount = static_cast<size_t>(boxSize.Y() / inputData.CellSize);
+		ZCellCount = static_cast<size_t>(boxSize.Z() / inputData.CellSize);
+	}
+
+	const SparseGridBrick* SparseScalarGridData::FindBrick(const size_t& i, const size_t& j, const size_t& k) const
+	{
+		const auto brickIt = m_BrickIds.find(GetBrickKey(i >> SPARSE_GRID_BRICK_LOG2, j >> SPARSE_GRID_BRICK_LOG2, k >> SPARSE_GRID_BRICK_LOG2));
+		return brickIt == m_BrickIds.end() ? nullptr : &m_Bricks[brickIt->second];
+	}
+
+	SparseGridBrick& SparseScalarGridData::FindOrAllocateBrick(const size_t& i, const size_t& j, const size_t& k)
+	{
+		const size_t brickX = i >> SPARSE_GRID_BRICK_LOG2;
+		const size_t brickY = j >> SPARSE_GRID_BRICK_LOG2;
+		const size_t brickZ = k >> SPARSE_GRID_BRICK_LOG2;
+		const auto [brickIt, isNew] = m_BrickIds.try_emplace(GetBrickKey(brickX, brickY, brickZ), m_Bricks.size());
+		if (!isNew)
+			return m_Bricks[brickIt->second];
+
+		auto& brick = m_Bricks.emplace_back();
+		brick.BrickX = brickX;
+		brick.BrickY = brickY;
+		brick.BrickZ = brickZ;
+		brick.CellData.fill(m_BackgroundValue);
+		return brick;
+	}
+
+	double SparseScalarGridData::GetValue(const size_t& i, const size_t& j, const size_t& k) const
+	{
+		const auto* brick = FindBrick(i, j, k);
+		return brick ? brick->CellData[GetBrickCellId(i, j, k)] : m_BackgroundValue;
+	}
+
+	double SparseScalarGridData::GetValue(const size_t& cellId) const
+	{
+		const size_t i = cellId % XCellCount;
+		const size_t j = (cellId / XCellCount) % YCellCount;
+		const size_t k = cellId / (XCellCount * YCellCount);
+		return GetValue(i, j, k);
+	}
+
+	void SparseScalarGridData::SetValue(const size_t& i, const size_t& j, const size_t& k, const double& value)
+	{
+		auto& brick = FindOrAllocateBrick(i, j, k);
+		const size_t brickCellId = GetBrickCellId(i, j, k);
+		brick.CellData[brickCellId] = value;
+		brick.ActiveMask.set(brickCellId);
+	}
+
+	void SparseScalarGridData::SetValue(const size_t& cellId, const double& value)
+	{
+		const size_t i = cellId % XCellCount;
+		const size_t j = (cellId / XCellCount) % YCellCount;
+		const size_t k = cellId / (XCellCount * YCellCount);
+		SetValue(i, j, k, value);
+	}
+
+	bool SparseScalarGridData::IsActive(const size_t& i, const size_t& j, const size_t& k) const
+	{
+		const auto* brick = FindBrick(i, j, k);
+		return brick && brick->ActiveMask.test(GetBrickCellId(i, j, k));
+	}
+
+	bool SparseScalarGridData::IsFrozen(const size_t& i, const size_t& j, const size_t& k) const
+	{
+		const auto* brick = FindBrick(i, j, k);
+		return brick && brick->FrozenMask.test(GetBrickCellId(i, j, k));
+	}
+
+	bool SparseScalarGridData::IsFrozen(const size_t& cellId) const
+	{
+		const size_t i = cellId % XCellCount;
+		const size_t j = (cellId / XCellCount) % YCellCount;
+		const size_t k = cellId / (XCellCount * YCellCount);
+		return IsFrozen(i, j, k);
+	}
+
+	void SparseScalarGridData::SetFrozen(const size_t& i, const size_t& j, const size_t& k, const bool& isFrozen)
+	{
+		if (!isFrozen)
+		{
+			const auto brickIt = m_BrickIds.find(GetBrickKey(i >> SPARSE_GRID_BRICK_LOG2, j >> SPARSE_GRID_BRICK_LOG2, k >> SPARSE_GRID_BRICK_LOG2));
+			if (brickIt != m_BrickIds.end())
+				m_Bricks[brickIt->second].FrozenMask.reset(GetBrickCellId(i, j, k));
+			return;
+		}
+
+		FindOrAllocateBrick(i, j, k).FrozenMask.set(GetBrickCellId(i, j, k));
+	}
+
+	void SparseScalarGridData::Deactivate(const size_t& i, const size_t& j, const size_t& k)
+	{
+		const auto brickIt = m_BrickIds.find(GetBrickKey(i >> SPARSE_GRID_BRICK_LOG2, j >> SPARSE_GRID_BRICK_LOG2, k >> SPARSE_GRID_BRICK_LOG2));
+		if (brickIt == m_BrickIds.end())
+			return;
+
+		auto& brick = m_Bricks[brickIt->second];
+		const size_t brickCellId = GetBrickCellId(i, j, k);
+		brick.CellData[brickCellId] = m_BackgroundValue;
+		brick.ActiveMask.reset(brickCellId);
+		brick.FrozenMask.reset(brickCellId);
+	}
+
+	void SparseScalarGridData::ReadLinearRange(const size_t& firstCellId, const size_t& count, double* values, uint8_t* frozenFlags) const
+	{
+		if (count == 0 || XCellCount == 0 || YCellCount == 0)
+			return;
+
+		size_t i = firstCellId % XCellCount;
+		size_t j = (firstCellId / XCellCount) % YCellCount;
+		size_t k = firstCellId / (XCellCount * YCellCount);
+
+		for (size_t readCount = 0; readCount < count; )
+		{
+			// a run of cells along x which stays within one brick and one grid row
+			const size_t runLength = std::min({
+				SPARSE_GRID_BRICK_SIZE - (i & brick_cell_mask), XCellCount - i, count - readCount });
+
+			const auto* brick = FindBrick(i, j, k);
+			if (brick)
+			{
+				const size_t brickCellId = GetBrickCellId(i, j, k);
+				for (size_t r = 0; r < runLength; r++)
+				{
+					if (values)
+						values[readCount + r] = brick->CellData[brickCellId + r];
+					if (frozenFlags)
+						frozenFlags[readCount + r] = brick->FrozenMask.test(brickCellId + r) ? 1 : 0;
+				}
+			}
+			else
+			{
+				if (values)
+					std::fill_n(values + readCount, runLength, m_BackgroundValue);
+				if (frozenFlags)
+					std::fill_n(frozenFlags + readCount, runLength, static_cast<uint8_t>(0));
+			}
+
+			readCount += runLength;
+			i += runLength;
+			if (i == XCellCount)
+			{
+				i = 0;
+				if (++j == YCellCount)
+				{
+					j = 0;
+					k++;
+				}
+			}
+		}
+	}
+
+	size_t SparseScalarGridData::Prune(const double& tolerance)
+	{
+		std::vector<SparseGridBrick> keptBricks;
+		keptBricks.reserve(m_Bricks.size());
+		for (auto& brick : m_Bricks)
+		{
+			for (size_t brickCellId = 0; brickCellId < SPARSE_GRID_BRICK_CELL_COUNT; brickCellId++)
+			{
+				if (!brick.ActiveMask.test(brickCellId) || brick.FrozenMask.test(brickCellId))
+					continue;
+				if (std::fabs(brick.CellData[brickCellId] - m_BackgroundValue) > tolerance)
+					continue;
+
+				brick.CellData[brickCellId] = m_BackgroundValue;
+				brick.ActiveMask.reset(brickCellId);
+			}
+
+			if (brick.ActiveMask.any() || brick.FrozenMask.any())
+				keptBricks.push_back(std::move(brick));
+		}
+
+		const size_t removedCount = m_Bricks.size() - keptBricks.size();
+		m_Bricks = std::move(keptBricks);
+		m_BrickIds.clear();
+		for (size_t brickId = 0; brickId < m_Bricks.size(); brickId++)
+			m_BrickIds[GetBrickKey(m_Bricks[brickId].BrickX, m_Bricks[brickId].BrickY, m_Bricks[brickId].BrickZ)] = brickId;
+
+		return removedCount;
+	}
+
+	void SparseScalarGridData::Clear()
+	{
+		m_Bricks.clear();
+		m_BrickIds.clear();
+	}
+
+	size_t SparseScalarGridData::ActiveCellCount() const
+	{
+		size_t activeCount = 0;
+		for (const auto& brick : m_Bricks)
+			activeCount += brick.ActiveMask.count();
+
+		return activeCount;
+	}
+
+	size_t SparseScalarGridData::Size() const
+	{
+		// bucket array + one node per brick (key, value and a next pointer)
+		return m_Bricks.capacity() * sizeof(SparseGridBrick) +
+			m_BrickIds.bucket_count() * sizeof(void*) +
+			m_BrickIds.size() * (sizeof(std::pair<const uint64_t, size_t>) + sizeof(void*));
+	}
+
+	SparseScalarGridData ConvertScalarGridDataToSparse(const ScalarGridData& gridData, const double& backgroundValue, const double& tolerance)
+	{
+		SparseScalarGridData result(BaseScalarGridInputData{ gridData.Name, Box3{ gridData.BoundingBox.Min(), gridData.BoundingBox.Max() }, gridData.CellSize, backgroundValue });
+		// keep the exact bounds and cell counts of the input (re-snapping to the global grid might shift them by a rounding error)
+		result.BoundingBox.Min() = gridData.BoundingBox.Min();
+		result.BoundingBox.Max() = gridData.BoundingBox.Max();
+		result.XCellCount = gridData.XCellCount;
+		result.YCellCount = gridData.YCellCount;
+		result.ZCellCount = gridData.ZCellCount;
+
+		const bool hasFrozenFlags = gridData.CellIsFrozen.size() == gridData.CellData.size();
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+				{
+					const bool isFrozen = hasFrozenFlags && gridData.CellIsFrozen[cellId];
+					if (!isFrozen && std::fabs(gridData.CellData[cellId] - backgroundValue) <= tolerance)
+						continue;
+
+					result.SetValue(i, j, k, gridData.CellData[cellId]);
+					if (isFrozen)
+						result.SetFrozen(i, j, k, true);
+				}
+			}
+		}
+
+		return result;
+	}
+
+	ScalarGridData ConvertSparseToScalarGridData(const SparseScalarGridData& sparseGridData)
+	{
+		ScalarGridData result;
+		result.Name = sparseGridData.Name;
+		result.CellSize = sparseGridData.CellSize;
+		result.BoundingBox = RectilinearGridBox3{ sparseGridData.CellSize, sparseGridData.BoundingBox.Min(), sparseGridData.BoundingBox.Max() };
+		result.BoundingBox.Min() = sparseGridData.BoundingBox.Min();
+		result.BoundingBox.Max() = sparseGridData.BoundingBox.Max();
+		result.XCellCount = sparseGridData.XCellCount;
+		result.YCellCount = sparseGridData.YCellCount;
+		result.ZCellCount = sparseGridData.ZCellCount;
+
+		const size_t cellCount = sparseGridData.CellCount();
+		result.CellData = std::vector<double>(cellCount, sparseGridData.BackgroundValue());
+		result.CellIsFrozen = std::vector<bool>(cellCount, false);
+
+		const size_t X = sparseGridData.XCellCount;
+		const size_t Y = sparseGridData.YCellCount;
+		for (const auto& brick : sparseGridData.Bricks())
+		{
+			const size_t iMin = brick.BrickX * SPARSE_GRID_BRICK_SIZE;
+			const size_t jMin = brick.BrickY * SPARSE_GRID_BRICK_SIZE;
+			const size_t kMin = brick.BrickZ * SPARSE_GRID_BRICK_SIZE;
+			const size_t iMax = std::min(iMin + SPARSE_GRID_BRICK_SIZE, X);
+			const size_t jMax = std::min(jMin + SPARSE_GRID_BRICK_SIZE, Y);
+			const size_t kMax = std::min(kMin + SPARSE_GRID_BRICK_SIZE, sparseGridData.ZCellCount);
+
+			for (size_t k = kMin; k < kMax; k++)
+			{
+				for (size_t j = jMin; j < jMax; j++)
+				{
+					for (size_t i = iMin; i < iMax; i++)
+					{
+						const size_t brickCellId = GetBrickCellId(i, j, k);
+						const size_t cellId = i + X * (j + Y * k);
+						result.CellData[cellId] = brick.CellData[brickCellId];
+						result.CellIsFrozen[cellId] = brick.FrozenMask.test(brickCellId);
+					}
+				}
+			}
+		}
+
+		return result;
+	}
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
@@ -0,0 +1,343 @@
+/*! \file  SparseScalarGridData.h
+ *  \brief A sparse, blocked counterpart of ScalarGridData storing only 8x8x8 cell bricks near non-background values.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/RectilinearGridBox3.h"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Symplektis::GeometryKernel
+{
+	//!> \brief log2 of the number of cells along one edge of a SparseGridBrick.
+	constexpr size_t SPARSE_GRID_BRICK_LOG2 = 3;
+	//!> \brief number of cells along one edge of a SparseGridBrick.
+	constexpr size_t SPARSE_GRID_BRICK_SIZE = 1 << SPARSE_GRID_BRICK_LOG2;
+	//!> \brief number of cells of a SparseGridBrick.
+	constexpr size_t SPARSE_GRID_BRICK_CELL_COUNT = SPARSE_GRID_BRICK_SIZE * SPARSE_GRID_BRICK_SIZE * SPARSE_GRID_BRICK_SIZE;
+
+	//=============================================================================
+	/// \struct SparseGridBrick
+	/// \brief A leaf block of SparseScalarGridData with 8^3 cells stored in x-fastest order. Cells which are not active
+	///        hold the background value of the grid.
+	///
+	/// \ingroup GEOMETRY_REPS
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SparseGridBrick
+	{
+		size_t                                           BrickX{ 0 };   //>! brick coordinates (first cell index divided by SPARSE_GRID_BRICK_SIZE)
+		size_t                                           BrickY{ 0 };
+		size_t                                           BrickZ{ 0 };
+
+		std::array<double, SPARSE_GRID_BRICK_CELL_COUNT> CellData{};
+		std::bitset<SPARSE_GRID_BRICK_CELL_COUNT>        ActiveMask{};  //>! cells with a value set explicitly
+		std::bitset<SPARSE_GRID_BRICK_CELL_COUNT>        FrozenMask{};  //>! equivalent of ScalarGridData::CellIsFrozen
+	};
+
+	//=============================================================================
+	/// \class SparseScalarGridData
+	/// \brief A sparse scalar grid with the same geometry (BoundingBox, cell counts, CellSize) and cell indexing as ScalarGridData.
+	///        Cells are grouped into 8^3 bricks which are only allocated once a cell inside them is set, so the memory
+	///        scales with the number of bricks around the active cells (e.g.: a narrow band around a surface) instead of the
+	///        volume of the grid. Brick lookup goes through a hash map of brick coordinates.
+	///
+	/// \ingroup GEOMETRY_REPS
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class SparseScalarGridData
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Default constructor
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		SparseScalarGridData() = default;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from the same input data as InitializeScalarGridData. InitValue is used as the background value.
+		*   \param[in] inputData       input data struct {name, boundingBox, cellSize, initValue}
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit SparseScalarGridData(const BaseScalarGridInputData& inputData);
+
+		/// @{
+		/// \name Cell access (cellId = i + XCellCount * (j + YCellCount * k), like in ScalarGridData)
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Gets the value of a cell (background value for inactive cells).
+		*   \param[in] i, j, k      cell indices.
+		*   \return cell value
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double GetValue(const size_t& i, const size_t& j, const size_t& k) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Gets the value of a cell with a linear cell index (background value for inactive cells).
+		*   \param[in] cellId       linear cell index.
+		*   \return cell value
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double GetValue(const size_t& cellId) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Sets the value of a cell and activates it (allocating its brick if needed).
+		*   \param[in] i, j, k      cell indices.
+		*   \param[in] value        cell value.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void SetValue(const size_t& i, const size_t& j, const size_t& k, const double& value);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Sets the value of a cell with a linear cell index and activates it (allocating its brick if needed).
+		*   \param[in] cellId       linear cell index.
+		*   \param[in] value        cell value.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void SetValue(const size_t& cellId, const double& value);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns true if the value of a cell was set explicitly.
+		*   \param[in] i, j, k      cell indices.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IsActive(const size_t& i, const size_t& j, const size_t& k) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the frozen flag of a cell (false for cells of unallocated bricks).
+		*   \param[in] i, j, k      cell indices.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IsFrozen(const size_t& i, const size_t& j, const size_t& k) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the frozen flag of a cell with a linear cell index.
+		*   \param[in] cellId       linear cell index.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IsFrozen(const size_t& cellId) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Sets the frozen flag of a cell. Freezing a cell allocates its brick, unfreezing a cell of an unallocated brick does nothing.
+		*   \param[in] i, j, k      cell indices.
+		*   \param[in] isFrozen     frozen flag.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void SetFrozen(const size_t& i, const size_t& j, const size_t& k, const bool& isFrozen);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Resets a cell to the background value, removes its active and frozen flags (the brick stays allocated).
+		*   \param[in] i, j, k      cell indices.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Deactivate(const size_t& i, const size_t& j, const size_t& k);
+
+		/// @{
+		/// \name Bulk operations
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Reads a range of cells in linear (x-fastest) order, e.g.: for streaming the grid into dense formats without
+		*          allocating the whole dense array. Brick lookups are done once per run of cells along x within a brick.
+		*   \param[in] firstCellId  linear index of the first cell.
+		*   \param[in] count        number of read cells.
+		*   \param[in] values       output array of at least count values (may be nullptr).
+		*   \param[in] frozenFlags  output array of at least count frozen flags (may be nullptr).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void ReadLinearRange(const size_t& firstCellId, const size_t& count, double* values, uint8_t* frozenFlags) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Deactivates non-frozen cells with values within tolerance from the background value and removes bricks
+		*          with no active or frozen cells left.
+		*   \param[in] tolerance    value tolerance.
+		*   \return number of removed bricks
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		size_t Prune(const double& tolerance = 0.0);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Removes all bricks.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Clear();
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Background value getter.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const double& BackgroundValue() const
+		{
+			return m_BackgroundValue;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Allocated bricks getter (in the order of allocation).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const std::vector<SparseGridBrick>& Bricks() const
+		{
+			return m_Bricks;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the total number of cells of the grid (XCellCount * YCellCount * ZCellCount).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t CellCount() const
+		{
+			return XCellCount * YCellCount * ZCellCount;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the number of active cells.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t ActiveCellCount() const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns an estimate of the heap memory used by bricks and the brick lookup in bytes.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t Size() const;
+
+		//
+		// =============== Grid geometry (same as in ScalarGridData) ==============================
+		//
+
+		std::wstring                          Name;
+		GeometryKernel::RectilinearGridBox3   BoundingBox;
+
+		size_t                                XCellCount{ 0 };
+		size_t                                YCellCount{ 0 };
+		size_t                                ZCellCount{ 0 };
+
+		double                                CellSize{ 0.0 };
+
+	private:
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Finds the brick containing a given cell.
+		*   \return pointer to brick, or nullptr if the brick is not allocated.
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const SparseGridBrick* FindBrick(const size_t& i, const size_t& j, const size_t& k) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Finds the brick containing a given cell or allocates it (filled with the background value).
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] SparseGridBrick& FindOrAllocateBrick(const size_t& i, const size_t& j, const size_t& k);
+
+		//
+		// ==================================
+		//
+
+		double                                m_BackgroundValue{ 0.0 };  //>! value of inactive cells
+		std::vector<SparseGridBrick>          m_Bricks;                  //>! allocated bricks
+		std::unordered_map<uint64_t, size_t>  m_BrickIds;                //>! packed brick coordinates -> id in m_Bricks
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts dense scalar grid data to a sparse grid. Cells which are frozen or whose value differs from the
+	 *         background value by more than tolerance become active.
+	 *  \param[in] gridData          dense scalar grid data.
+	 *  \param[in] backgroundValue   background value of the sparse grid.
+	 *  \param[in] tolerance         value tolerance.
+	 *  \return sparse scalar grid data
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	SparseScalarGridData ConvertScalarGridDataToSparse(const ScalarGridData& gridData, const double& backgroundValue, const double& tolerance = 0.0);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts a sparse grid to dense scalar grid data (allocating all cells).
+	 *  \param[in] sparseGridData    sparse scalar grid data.
+	 *  \return dense scalar grid data
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	ScalarGridData ConvertSparseToScalarGridData(const SparseScalarGridData& sparseGridData);
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*! \file  TiledScalarGridData.cpp
+ *  \brief Implementation of a dense scalar grid with cells stored in contiguous cubic bricks.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "TiledScalarGridData.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <cmath>
+
+namespace Symplektis::GeometryKernel
+{
+	//!> \brief minimum number of points per sampling thread
+	constexpr size_t min_tiled_sample_chunk_size = 16384;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates the lower stencil cell index and the relative position of a coordinate along an axis (clamped
+	*          to the outer cell centers the same way as in ScalarGridSampler).
+	*   \param[in] coord          point coordinate.
+	*   \param[in] origin         coordinate of the center of the first cell.
+	*   \param[in] invCellSize    1 / CellSize.
+	*   \param[in] count          number of cells along the axis.
+	*   \param[out] index         index of the last cell center not after the point (clamped to [0, count - 2]).
+	*   \param[out] t             relative position between cell centers index and index + 1, in [0, 1].
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static inline void GetTrilinearAxisStencil(const double& coord, const double& origin, const double& invCellSize, const size_t& count,
+		size_t& index, double& t)
+	{
+		const double maxU = static_cast<double>(count - 1);
+		const double rawU = (coord - origin) * invCellSize;
+		const double u = rawU >= 0.0 ? std::min(rawU, maxU) : 0.0; // NaN coordinates are clamped to 0 as well
+		const double lower = std::min(std::floor(u), count > 1 ? maxU - 1.0 : 0.0);
+		index = static_cast<size_t>(lower);
+		t = u - lower;
+	}
+
+	TiledScalarGridData::TiledScalarGridData(const BaseScalarGridInputData& inputData, const GridBrickSize& brickSize)
+		: Name(inputData.Name)
+		, BoundingBox(inputData.CellSize, inputData.BoundingBox)
+		, CellSize(inputData.CellSize)
+	{
+		const auto boxSize = BoundingBox.GetSize();
+
+		XCellCount = static_cast<size_t>(boxSize.X() / inputData.CellSize);
+		YCellCount = static_cast<size_t>(boxSize.Y() / inputData.CellSize);
+		ZCellCount = static_cast<size_t>(boxSize.Z() / inputData.CellSize);
+
+		AllocateBricks(brickSize, inputData.InitValue);
+	}
+
+	void TiledScalarGridData::AllocateBricks(const GridBrickSize& brickSize, const double& initValue)
+	{
+		m_BrickLog2 = static_cast<size_t>(brickSize);
+		m_BrickMask = (size_t{ 1 } << m_BrickLog2) - 1;
+		m_XBrickCount = (XCellCount + m_BrickMask) >> m_BrickLog2;
+		m_YBrickCount = (YCellCount + m_BrickMask) >> m_BrickLog2;
+		m_ZBrickCount = (ZCellCount + m_BrickMask) >> m_BrickLog2;
+
+		const size_t paddedCellCount = (m_XBrickCount * m_YBrickCount * m_ZBrickCount) << (3 * m_BrickLog2);
+		CellData = std::vector<double>(paddedCellCount, initValue);
+		CellIsFrozen = std::vector<bool>(paddedCellCount, false);
+	}
+
+	TiledScalarGridData ConvertScalarGridDataToTiled(const ScalarGridData& gridData, const GridBrickSize& brickSize)
+	{
+		TiledScalarGridData result;
+		result.Name = gridData.Name;
+		result.CellSize = gridData.CellSize;
+		result.BoundingBox = RectilinearGridBox3{ gridData.CellSize, gridData.BoundingBox.Min(), gridData.BoundingBox.Max() };
+		// keep the exact bounds of the input (re-snapping to the global grid might shift them by a rounding error)
+		result.BoundingBox.Min() = gridData.BoundingBox.Min();
+		result.BoundingBox.Max() = gridData.BoundingBox.Max();
+		result.XCellCount = gridData.XCellCount;
+		result.YCellCount = gridData.YCellCount;
+		result.ZCellCount = gridData.ZCellCount;
+		result.AllocateBricks(brickSize, 0.0);
+
+		const bool hasFrozenFlags = gridData.CellIsFrozen.size() == gridData.CellData.size();
+		size_t linearCellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				// consecutive cells of a row stay in one brick row, so the tiled index only needs evaluating per brick
+				size_t tiledCellId = 0;
+				for (size_t i = 0; i < gridData.XCellCount; i++, linearCellId++, tiledCellId++)
+				{
+					if ((i & result.m_BrickMask) == 0)
+						tiledCellId = result.GetCellId(i, j, k);
+
+					result.CellData[tiledCellId] = gridData.CellData[linearCellId];
+					if (hasFrozenFlags)
+						result.CellIsFrozen[tiledCellId] = gridData.CellIsFrozen[linearCellId];
+				}
+			}
+		}
+
+		return result;
+	}
+
+	ScalarGridData ConvertTiledToScalarGridData(const TiledScalarGridData& tiledGridData)
+	{
+		ScalarGridData result;
+		result.Name = tiledGridData.Name;
+		result.CellSize = tiledGridData.CellSize;
+		result.BoundingBox = RectilinearGridBox3{ tiledGridData.CellSize, tiledGridData.BoundingBox.Min(), tiledGridData.BoundingBox.Max() };
+		result.BoundingBox.Min() = tiledGridData.BoundingBox.Min();
+		result.BoundingBox.Max() = tiledGridData.BoundingBox.Max();
+		result.XCellCount = tiledGridData.XCellCount;
+		result.YCellCount = tiledGridData.YCellCount;
+		result.ZCellCount = tiledGridData.ZCellCount;
+
+		const size_t cellCount = result.XCellCount * result.YCellCount * result.ZCellCount;
+		result.CellData = std::vector<double>(cellCount);
+		result.CellIsFrozen = std::vector<bool>(cellCount, false);
+
+		const size_t X = result.XCellCount;
+		const size_t Y = result.YCellCount;
+		tiledGridData.ForEachCell([&](const size_t i, const size_t j, const size_t k, const size_t tiledCellId)
+		{
+			const size_t linearCellId = i + X * (j + Y * k);
+			result.CellData[linearCellId] = tiledGridData.CellData[tiledCellId];
+			result.CellIsFrozen[linearCellId] = tiledGridData.CellIsFrozen[tiledCellId];
+		});
+
+		return result;
+	}
+
+	double TiledScalarGridData::Sample(const Vector3& point) const
+	{
+		const double x = point.X(), y = point.Y(), z = point.Z();
+		double value = 0.0;
+		SampleRange(&x, &y, &z, 0, 1, &value);
+		return value;
+	}
+
+	void TiledScalarGridData::SampleBatch(const GridSamplePoints& points, std::vector<double>& values) const
+	{
+		const size_t count = points.Size();
+		values.resize(count);
+		if (count == 0 || points.Y.size() != count || points.Z.size() != count)
+			return;
+
+		Util::ParallelForChunks(count, Util::GetParallelChunkCount(count, min_tiled_sample_chunk_size),
+			[&](const size_t /*chunkIndex*/, const size_t begin, const size_t end)
+			{
+				SampleRange(points.X.data(), points.Y.data(), points.Z.data(), begin, end, values.data());
+			});
+	}
+
+	void TiledScalarGridData::SampleRange(const double* x, const double* y, const double* z, const size_t& begin, const size_t& end, double* values) const
+	{
+		const std::array<size_t, 3> counts{ XCellCount, YCellCount, ZCellCount };
+		if (CellSize <= 0.0 || counts[0] * counts[1] * counts[2] == 0 || CellData.empty())
+		{
+			std::fill(values + begin, values + end, 0.0);
+			return;
+		}
+
+		const std::array<double, 3> origin{
+			BoundingBox.Min().X() + 0.5 * CellSize,
+			BoundingBox.Min().Y() + 0.5 * CellSize,
+			BoundingBox.Min().Z() + 0.5 * CellSize };
+		const double invCellSize = 1.0 / CellSize;
+		const std::array<const double*, 3> coords{ x, y, z };
+		const double* cellValues = CellData.data();
+		for (size_t id = begin; id < end; id++)
+		{
+			// tiled cell indices are sums of per-axis offsets, so each of the 8 stencil cells costs two additions
+			std::array<size_t, 3> lowerOffsets{}, upperOffsets{};
+			std::array<double, 3> t{};
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				size_t index = 0;
+				GetTrilinearAxisStencil(coords[axis][id], origin[axis], invCellSize, counts[axis], index, t[axis]);
+				lowerOffsets[axis] = GetAxisCellIdOffset(axis, index);
+				upperOffsets[axis] = GetAxisCellIdOffset(axis, std::min(index + 1, counts[axis] - 1));
+			}
+
+			const double c0 = cellValues[lowerOffsets[0] + lowerOffsets[1] + lowerOffsets[2]];
+			const double c1 = cellValues[upperOffsets[0] + lowerOffsets[1] + lowerOffsets[2]];
+			const double c2 = cellValues[lowerOffsets[0] + upperOffsets[1] + lowerOffsets[2]];
+			const double c3 = cellValues[upperOffsets[0] + upperOffsets[1] + lowerOffsets[2]];
+			const double c4 = cellValues[lowerOffsets[0] + lowerOffsets[1] + upperOffsets[2]];
+			const double c5 = cellValues[upperOffsets[0] + lowerOffsets[1] + upperOffsets[2]];
+			const double c6 = cellValues[lowerOffsets[0] + upperOffsets[1] + upperOffsets[2]];
+			const double c7 = cellValues[upperOffsets[0] + upperOffsets[1] + upperOffsets[2]];
+			const double a00 = c0 + t[0] * (c1 - c0);
+			const double a10 = c2 + t[0] * (c3 - c2);
+			const double a01 = c4 + t[0] * (c5 - c4);
+			const double a11 = c6 + t[0] * (c7 - c6);
+			const double b0 = a00 + t[1] * (a10 - a00);
+			const double b1 = a01 + t[1] * (a11 - a01);
+			values[id] = b0 + t[2] * (b1 - b0);
+		}
+	}
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
@@ -0,0 +1,416 @@
+/*! \file  TiledScalarGridData.h
+ *  \brief A dense scalar grid with cells stored in contiguous cubic bricks (cache-blocked layout).
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/RectilinearGridBox3.h"
+#include "Symplekt_GeometryKernel/ScalarGridSampler.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace Symplektis::GeometryKernel
+{
+	//=============================================================================
+	/// \enum GridBrickSize
+	/// \brief Edge length of a brick of TiledScalarGridData (as log2 of the number of cells).
+	///
+	/// \ingroup GEOMETRY_REPS
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class GridBrickSize
+	{
+		Brick4 = 2,   //!< 4^3 cells (256 B of doubles, fits L1 together with its neighbors)
+		Brick8 = 3    //!< 8^3 cells (4 KiB of doubles, one page)
+	};
+
+	//=============================================================================
+	/// \class TiledScalarGridData
+	/// \brief Dense scalar grid data with the same geometry as ScalarGridData, whose CellData and CellIsFrozen are stored
+	///        brick by brick: cells of a brick are contiguous (x-fastest within the brick) and bricks follow in x-fastest order.
+	///        Neighbors in y and z are then mostly within the same few cache lines, unlike the linear layout where they are
+	///        XCellCount or XCellCount * YCellCount cells apart. Cell counts are padded to whole bricks; padding cells are
+	///        never visited by ForEachCell, ForEachCellStencil and ForEachNeighbor. Sample and SampleBatch interpolate
+	///        trilinearly with the same results as ScalarGridSampler on the linear layout.
+	///
+	///        The layout is optional: whole-grid stencils should use ForEachCellStencil, which steps through bricks by
+	///        index offsets (ForEachNeighbor is meant for access to a few cells). Measured at 256^3 on a single thread, a
+	///        7-point Laplacian runs as fast as in the linear layout (the x-fastest linear sweep is prefetch-friendly and a
+	///        few xy-planes stay cached), sampling along z-rays is up to ~20% faster with 8^3 bricks, and sampling at random
+	///        points is slower than the lane-vectorized ScalarGridSampler. Run the DISABLED_ timing test in
+	///        TiledScalarGrid_Tests.cpp to reproduce this on the target machine.
+	///
+	/// \ingroup GEOMETRY_REPS
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class TiledScalarGridData
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Default constructor
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		TiledScalarGridData() = default;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor from the same input data as InitializeScalarGridData.
+		*   \param[in] inputData       input data struct {name, boundingBox, cellSize, initValue}
+		*   \param[in] brickSize       brick edge length.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit TiledScalarGridData(const BaseScalarGridInputData& inputData, const GridBrickSize& brickSize = GridBrickSize::Brick8);
+
+		/// @{
+		/// \name Index helpers
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Index into CellData and CellIsFrozen of a cell.
+		*   \param[in] i, j, k      cell indices.
+		*   \return tiled cell index
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t GetCellId(const size_t& i, const size_t& j, const size_t& k) const
+		{
+			const size_t brickId = (i >> m_BrickLog2) + m_XBrickCount * ((j >> m_BrickLog2) + m_YBrickCount * (k >> m_BrickLog2));
+			return (brickId << (3 * m_BrickLog2)) | (i & m_BrickMask) | ((j & m_BrickMask) << m_BrickLog2) | ((k & m_BrickMask) << (2 * m_BrickLog2));
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Cell indices of a tiled cell index (inverse of GetCellId).
+		*   \param[in] cellId       tiled cell index.
+		*   \return {i, j, k}
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::array<size_t, 3> GetCellIndices(const size_t& cellId) const
+		{
+			const size_t brickId = cellId >> (3 * m_BrickLog2);
+			const size_t brickX = brickId % m_XBrickCount;
+			const size_t brickY = (brickId / m_XBrickCount) % m_YBrickCount;
+			const size_t brickZ = brickId / (m_XBrickCount * m_YBrickCount);
+			return {
+				(brickX << m_BrickLog2) | (cellId & m_BrickMask),
+				(brickY << m_BrickLog2) | ((cellId >> m_BrickLog2) & m_BrickMask),
+				(brickZ << m_BrickLog2) | ((cellId >> (2 * m_BrickLog2)) & m_BrickMask) };
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Value of a cell.
+		*   \param[in] i, j, k      cell indices.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const double& GetValue(const size_t& i, const size_t& j, const size_t& k) const
+		{
+			return CellData[GetCellId(i, j, k)];
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Value of a cell (modifiable).
+		*   \param[in] i, j, k      cell indices.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double& GetValue(const size_t& i, const size_t& j, const size_t& k)
+		{
+			return CellData[GetCellId(i, j, k)];
+		}
+
+		/// @{
+		/// \name Iteration
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Visits all (non-padding) cells in storage order.
+		*   \param[in] visitor      callable with arguments (i, j, k, cellId).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename CellVisitor>
+		void ForEachCell(CellVisitor&& visitor) const
+		{
+			const size_t brickSize = size_t{ 1 } << m_BrickLog2;
+			size_t brickCellIdStart = 0;
+			for (size_t brickZ = 0; brickZ < m_ZBrickCount; brickZ++)
+			{
+				for (size_t brickY = 0; brickY < m_YBrickCount; brickY++)
+				{
+					for (size_t brickX = 0; brickX < m_XBrickCount; brickX++, brickCellIdStart += (brickSize * brickSize * brickSize))
+					{
+						const size_t iMin = brickX * brickSize, jMin = brickY * brickSize, kMin = brickZ * brickSize;
+						const size_t iCount = std::min(brickSize, XCellCount - iMin);
+						const size_t jCount = std::min(brickSize, YCellCount - jMin);
+						const size_t kCount = std::min(brickSize, ZCellCount - kMin);
+						for (size_t lk = 0; lk < kCount; lk++)
+						{
+							for (size_t lj = 0; lj < jCount; lj++)
+							{
+								const size_t rowCellIdStart = brickCellIdStart + ((lj + (lk << m_BrickLog2)) << m_BrickLog2);
+								for (size_t li = 0; li < iCount; li++)
+									visitor(iMin + li, jMin + lj, kMin + lk, rowCellIdStart + li);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Visits the (up to 6) face neighbors of a cell within the grid. Neighbors within the same brick are found
+		*          by offsetting the tiled index, only neighbors across a brick face need a full index evaluation.
+		*   \param[in] i, j, k      cell indices.
+		*   \param[in] visitor      callable with arguments (neighborCellId, axis, direction), with axis in {0, 1, 2} and direction in {-1, 1}.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename NeighborVisitor>
+		void ForEachNeighbor(const size_t& i, const size_t& j, const size_t& k, NeighborVisitor&& visitor) const
+		{
+			const size_t cellId = GetCellId(i, j, k);
+			const std::array<size_t, 3> indices{ i, j, k };
+			const std::array<size_t, 3> cellCounts{ XCellCount, YCellCount, ZCellCount };
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				const size_t localIndex = indices[axis] & m_BrickMask;
+				const size_t step = size_t{ 1 } << (axis * m_BrickLog2);
+				if (indices[axis] > 0)
+				{
+					if (localIndex > 0)
+						visitor(cellId - step, axis, -1);
+					else
+						visitor(GetCellId(axis == 0 ? i - 1 : i, axis == 1 ? j - 1 : j, axis == 2 ? k - 1 : k), axis, -1);
+				}
+				if (indices[axis] + 1 < cellCounts[axis])
+				{
+					if (localIndex < m_BrickMask)
+						visitor(cellId + step, axis, 1);
+					else
+						visitor(GetCellId(axis == 0 ? i + 1 : i, axis == 1 ? j + 1 : j, axis == 2 ? k + 1 : k), axis, 1);
+				}
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Visits all (non-padding) cells in storage order together with the tiled indices of their 6 face neighbors
+		*          in the order -x, +x, -y, +y, -z, +z. A neighbor outside the grid is replaced by the cell itself, so that
+		*          one-sided differences at the grid boundary vanish without branching in the visitor.
+		*   \param[in] visitor      callable with arguments (i, j, k, cellId, const std::array<size_t, 6>& neighborCellIds).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename StencilVisitor>
+		void ForEachCellStencil(StencilVisitor&& visitor) const
+		{
+			const size_t brickSize = size_t{ 1 } << m_BrickLog2;
+			const size_t brickCellCount = brickSize * brickSize * brickSize;
+			// a step into the neighboring brick lands on its opposite face, i.e.: a brick stride back across the brick
+			const size_t xBrickStep = brickCellCount - m_BrickMask;
+			const size_t yBrickStep = m_XBrickCount * brickCellCount - m_BrickMask * brickSize;
+			const size_t zBrickStep = m_XBrickCount * m_YBrickCount * brickCellCount - m_BrickMask * brickSize * brickSize;
+			size_t brickCellIdStart = 0;
+			for (size_t brickZ = 0; brickZ < m_ZBrickCount; brickZ++)
+			{
+				for (size_t brickY = 0; brickY < m_YBrickCount; brickY++)
+				{
+					for (size_t brickX = 0; brickX < m_XBrickCount; brickX++, brickCellIdStart += brickCellCount)
+					{
+						const size_t iMin = brickX * brickSize, jMin = brickY * brickSize, kMin = brickZ * brickSize;
+						const size_t iCount = std::min(brickSize, XCellCount - iMin);
+						const size_t jCount = std::min(brickSize, YCellCount - jMin);
+						const size_t kCount = std::min(brickSize, ZCellCount - kMin);
+						for (size_t lk = 0; lk < kCount; lk++)
+						{
+							// distances to the lower and upper neighbors along y and z are shared by whole rows
+							const size_t k = kMin + lk;
+							const size_t zLower = k == 0 ? 0 : (lk > 0 ? brickSize * brickSize : zBrickStep);
+							const size_t zUpper = k + 1 == ZCellCount ? 0 : (lk < m_BrickMask ? brickSize * brickSize : zBrickStep);
+							for (size_t lj = 0; lj < jCount; lj++)
+							{
+								const size_t j = jMin + lj;
+								const size_t yLower = j == 0 ? 0 : (lj > 0 ? brickSize : yBrickStep);
+								const size_t yUpper = j + 1 == YCellCount ? 0 : (lj < m_BrickMask ? brickSize : yBrickStep);
+								const size_t rowCellIdStart = brickCellIdStart + ((lj + (lk << m_BrickLog2)) << m_BrickLog2);
+								for (size_t li = 0; li < iCount; li++)
+								{
+									const size_t i = iMin + li;
+									const size_t cellId = rowCellIdStart + li;
+									const size_t xLower = i == 0 ? 0 : (li > 0 ? 1 : xBrickStep);
+									const size_t xUpper = i + 1 == XCellCount ? 0 : (li < m_BrickMask ? 1 : xBrickStep);
+									const std::array<size_t, 6> neighborCellIds{
+										cellId - xLower, cellId + xUpper, cellId - yLower, cellId + yUpper, cellId - zLower, cellId + zUpper };
+									visitor(i, j, k, cellId, neighborCellIds);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// @{
+		/// \name Sampling
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Trilinearly interpolated value at a point (values located at cell centers, points clamped to the box of
+		*          outer cell centers as in ScalarGridSampler).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double Sample(const Vector3& point) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Trilinearly interpolates values at a batch of points (on multiple threads for large batches).
+		*   \param[in] points          query points.
+		*   \param[out] values         interpolated values, resized to the number of points.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void SampleBatch(const GridSamplePoints& points, std::vector<double>& values) const;
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Brick size getter.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] GridBrickSize BrickSize() const
+		{
+			return static_cast<GridBrickSize>(m_BrickLog2);
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns the number of bricks along x, y and z.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::array<size_t, 3> BrickCounts() const
+		{
+			return { m_XBrickCount, m_YBrickCount, m_ZBrickCount };
+		}
+
+		//
+		// =============== Grid geometry (same as in ScalarGridData) ==============================
+		//
+
+		std::wstring                          Name;
+		GeometryKernel::RectilinearGridBox3   BoundingBox;
+
+		size_t                                XCellCount{ 0 };
+		size_t                                YCellCount{ 0 };
+		size_t                                ZCellCount{ 0 };
+
+		double                                CellSize{ 0.0 };
+
+		// ----------- data fields (tiled order, padded to whole bricks) ----------------------------
+		std::vector<double>                   CellData;
+		std::vector<bool>                     CellIsFrozen;
+
+	private:
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Evaluates brick counts and allocates padded data fields for the current cell counts.
+		*   \param[in] brickSize       brick edge length.
+		*   \param[in] initValue       initial cell value.
+		*/
+		//-----------------------------------------------------------------------------
+		void AllocateBricks(const GridBrickSize& brickSize, const double& initValue);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Contribution of a cell index along an axis to the tiled cell index, i.e.: GetCellId(i, j, k) equals
+		*          GetAxisCellIdOffset(0, i) + GetAxisCellIdOffset(1, j) + GetAxisCellIdOffset(2, k).
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t GetAxisCellIdOffset(const size_t& axis, const size_t& index) const
+		{
+			const size_t brickStride = axis == 0 ? 1 : (axis == 1 ? m_XBrickCount : m_XBrickCount * m_YBrickCount);
+			return (((index >> m_BrickLog2) * brickStride) << (3 * m_BrickLog2)) + ((index & m_BrickMask) << (axis * m_BrickLog2));
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Samples points [begin, end) of a batch.
+		*/
+		//-----------------------------------------------------------------------------
+		void SampleRange(const double* x, const double* y, const double* z, const size_t& begin, const size_t& end, double* values) const;
+
+		friend TiledScalarGridData ConvertScalarGridDataToTiled(const ScalarGridData& gridData, const GridBrickSize& brickSize);
+
+		//
+		// ==================================
+		//
+
+		size_t m_BrickLog2{ 3 };         //>! log2 of brick edge length
+		size_t m_BrickMask{ 7 };         //>! brick edge length - 1
+		size_t m_XBrickCount{ 0 };
+		size_t m_YBrickCount{ 0 };
+		size_t m_ZBrickCount{ 0 };
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts dense scalar grid data in linear (x-fastest) order into the tiled layout.
+	 *  \param[in] gridData          dense scalar grid data.
+	 *  \param[in] brickSize         brick edge length.
+	 *  \return tiled scalar grid data
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	TiledScalarGridData ConvertScalarGridDataToTiled(const ScalarGridData& gridData, const GridBrickSize& brickSize = GridBrickSize::Brick8);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts tiled scalar grid data back into linear (x-fastest) order.
+	 *  \param[in] tiledGridData     tiled scalar grid data.
+	 *  \return dense scalar grid data
+	 *
+	 *  \author M. Cavarga (MCInversion)
+	 *  \date   18.10.2026
+	 */
+	 //-----------------------------------------------------------------------------
+	ScalarGridData ConvertTiledToScalarGridData(const TiledScalarGridData& tiledGridData);
+
+} // Symplektis::GeometryKernel
\ No newline at end of file
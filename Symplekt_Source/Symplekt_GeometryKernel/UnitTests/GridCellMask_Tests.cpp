@@ -0,0 +1,110 @@
+/*! \file  GridCellMask_Tests.cpp
+ *  \brief Unit tests for bit-packed per-cell flags of scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/GridCellMask.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+
+	TEST(GridCellMask_Tests, SetFlags_Scan_SkipsWordsAndStopsAtSize)
+	{
+		// Arrange: 130 cells span three words, the last one partially
+		GridCellMask mask(130);
+
+		// Act
+		const bool isFirstSet = mask.Set(3);
+		const bool isSecondSet = mask.Set(3);
+		mask.Set(64);
+		mask.Set(129);
+		const bool isReset = mask.Reset(64);
+		const bool isSecondReset = mask.Reset(64);
+		mask.Set(100);
+
+		// Assert
+		EXPECT_TRUE(isFirstSet);
+		EXPECT_FALSE(isSecondSet);
+		EXPECT_TRUE(isReset);
+		EXPECT_FALSE(isSecondReset);
+		EXPECT_EQ(mask.Size(), 130u);
+		EXPECT_EQ(mask.Words().size(), 3u);
+		EXPECT_EQ(mask.Count(), 3u);
+		EXPECT_TRUE(mask.Test(3));
+		EXPECT_FALSE(mask.Test(64));
+		EXPECT_EQ(mask.FindNextSet(0), 3u);
+		EXPECT_EQ(mask.FindNextSet(4), 100u);
+		EXPECT_EQ(mask.FindNextSet(101), 129u);
+		EXPECT_EQ(mask.FindNextSet(130), 130u);
+		EXPECT_EQ(mask.FindNextUnset(3), 4u);
+
+		mask.Fill(true);
+		EXPECT_EQ(mask.Count(), 130u);
+		EXPECT_EQ(mask.FindNextUnset(0), 130u);
+		mask.Reset(128);
+		EXPECT_EQ(mask.FindNextUnset(0), 128u);
+		EXPECT_EQ(mask.FindNextUnset(129), 130u);
+	}
+
+	TEST(GridCellMask_Tests, BoolFlags_ConvertAndCopyBack_SameFlags)
+	{
+		// Arrange
+		std::vector<bool> flags(200, false);
+		for (size_t cellId = 0; cellId < flags.size(); cellId += 7)
+			flags[cellId] = true;
+
+		// Act
+		const GridCellMask mask(flags);
+		std::vector<bool> copiedFlags;
+		mask.CopyTo(copiedFlags);
+
+		// Assert
+		EXPECT_EQ(mask.Count(), 29u);
+		EXPECT_EQ(copiedFlags, flags);
+		for (size_t cellId = 0; cellId < flags.size(); cellId++)
+			EXPECT_EQ(mask.Test(cellId), flags[cellId]);
+	}
+
+	TEST(GridCellMask_Tests, ConcurrentSet_AllCellsMarkedExactlyOnce)
+	{
+		// Arrange
+		constexpr size_t cellCount = 100000;
+		constexpr size_t threadCount = 4;
+		GridCellMask mask(cellCount);
+		std::atomic<size_t> firstSetCount{ 0 };
+
+		// Act: all threads set all cells of interleaved ranges (neighboring cells share words)
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < threadCount; t++)
+		{
+			threads.emplace_back([&mask, &firstSetCount, t]()
+				{
+					size_t count = 0;
+					for (size_t n = 0; n < cellCount; n++)
+					{
+						if (mask.Set((n + t * 17) % cellCount))
+							count++;
+					}
+					firstSetCount += count;
+				});
+		}
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert
+		EXPECT_EQ(firstSetCount.load(), cellCount);
+		EXPECT_EQ(mask.Count(), cellCount);
+		EXPECT_EQ(mask.FindNextUnset(0), cellCount);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*! \file  ScalarGridPyramid_Tests.cpp
+ *  \brief Unit tests for restriction and prolongation between levels of scalar grid pyramids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+#include "Symplekt_GeometryKernel/ScalarGridPyramid.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+
+	/// \brief A linear function of cell center coordinates.
+	static double GetLinearValue(const double& x, const double& y, const double& z)
+	{
+		return x + 2.0 * y - 3.0 * z;
+	}
+
+	/// \brief Value of GetLinearValue at the center of cell (i, j, k).
+	static double GetLinearCellValue(const ScalarGridData& gridData, const size_t& i, const size_t& j, const size_t& k)
+	{
+		const Vector3 min = gridData.BoundingBox.Min();
+		return GetLinearValue(
+			min.X() + (static_cast<double>(i) + 0.5) * gridData.CellSize,
+			min.Y() + (static_cast<double>(j) + 0.5) * gridData.CellSize,
+			min.Z() + (static_cast<double>(k) + 0.5) * gridData.CellSize);
+	}
+
+	/// \brief A grid with cell size 0.125 over a box filled with GetLinearValue.
+	static ScalarGridData GetLinearGrid(const Vector3& min, const Vector3& max)
+	{
+		auto gridData = InitializeScalarGridData({ L"PyramidGrid", Box3{ min, max }, 0.125, 0.0 });
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+					gridData.CellData[cellId] = GetLinearCellValue(gridData, i, j, k);
+		return gridData;
+	}
+
+	TEST(ScalarGridPyramid_Tests, AlignedGrid_Restrict_AveragesChildren)
+	{
+		// Arrange
+		auto fineData = GetLinearGrid(Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 2.0, 2.0, 1.0 });
+		fineData.CellIsFrozen[5 + 16 * (5 + 16 * 5)] = true;
+
+		// Act
+		const auto coarseData = RestrictScalarGridData(fineData);
+
+		// Assert
+		EXPECT_DOUBLE_EQ(coarseData.CellSize, 0.25);
+		ASSERT_EQ(coarseData.XCellCount, 8u);
+		ASSERT_EQ(coarseData.YCellCount, 8u);
+		ASSERT_EQ(coarseData.ZCellCount, 4u);
+		size_t cellId = 0;
+		for (size_t k = 0; k < coarseData.ZCellCount; k++)
+			for (size_t j = 0; j < coarseData.YCellCount; j++)
+				for (size_t i = 0; i < coarseData.XCellCount; i++, cellId++)
+				{
+					// a linear function equals the average of its values at the centers of child cells
+					EXPECT_NEAR(coarseData.CellData[cellId], GetLinearCellValue(coarseData, i, j, k), 1e-12);
+					EXPECT_EQ(coarseData.CellIsFrozen[cellId], i == 2 && j == 2 && k == 2);
+				}
+	}
+
+	TEST(ScalarGridPyramid_Tests, OffsetGrid_Restrict_CoarseBoxContainsFineBox)
+	{
+		// Arrange: the fine box starts one fine cell above the global coarse grid
+		const auto fineData = GetLinearGrid(Vector3{ 0.125, 0.125, 0.125 }, Vector3{ 1.875, 1.875, 1.875 });
+		ASSERT_EQ(fineData.XCellCount, 14u);
+
+		// Act
+		const auto coarseData = RestrictScalarGridData(fineData);
+
+		// Assert
+		ASSERT_EQ(coarseData.XCellCount, 8u);
+		EXPECT_DOUBLE_EQ(coarseData.BoundingBox.Min().X(), 0.0);
+		EXPECT_DOUBLE_EQ(coarseData.BoundingBox.Max().X(), 2.0);
+		// interior coarse cells have all children within the fine grid
+		for (size_t k = 1; k < 7; k++)
+			for (size_t j = 1; j < 7; j++)
+				for (size_t i = 1; i < 7; i++)
+					EXPECT_NEAR(coarseData.CellData[i + 8 * (j + 8 * k)], GetLinearCellValue(coarseData, i, j, k), 1e-12);
+		// boundary coarse cells replace missing children by the nearest fine cell
+		EXPECT_NEAR(coarseData.CellData[0], GetLinearValue(0.1875, 0.1875, 0.1875), 1e-12);
+	}
+
+	TEST(ScalarGridPyramid_Tests, LinearCoarseField_Prolongate_ReproducedBetweenCoarseCenters)
+	{
+		// Arrange
+		auto fineData = GetLinearGrid(Vector3{ 0.125, 0.125, 0.125 }, Vector3{ 1.875, 1.875, 1.875 });
+		auto coarseData = RestrictScalarGridData(fineData);
+		size_t coarseCellId = 0;
+		for (size_t k = 0; k < coarseData.ZCellCount; k++)
+			for (size_t j = 0; j < coarseData.YCellCount; j++)
+				for (size_t i = 0; i < coarseData.XCellCount; i++, coarseCellId++)
+					coarseData.CellData[coarseCellId] = GetLinearCellValue(coarseData, i, j, k);
+		std::fill(fineData.CellData.begin(), fineData.CellData.end(), 0.0);
+
+		// Act
+		const bool isProlongated = ProlongateScalarGridData(coarseData, fineData);
+		const bool isMismatchProlongated = ProlongateScalarGridData(fineData, coarseData);
+
+		// Assert
+		ASSERT_TRUE(isProlongated);
+		EXPECT_FALSE(isMismatchProlongated);
+		// fine cell centers 0.1875 + 0.125 n lie between the outer coarse cell centers 0.125 and 1.875
+		size_t cellId = 0;
+		for (size_t k = 0; k < fineData.ZCellCount; k++)
+			for (size_t j = 0; j < fineData.YCellCount; j++)
+				for (size_t i = 0; i < fineData.XCellCount; i++, cellId++)
+					EXPECT_NEAR(fineData.CellData[cellId], GetLinearCellValue(fineData, i, j, k), 1e-12);
+	}
+
+	TEST(ScalarGridPyramid_Tests, LinearCoarseField_ProlongateBlocks_InterpolatedOnlyWithinChildBlocks)
+	{
+		// Arrange: coarse grid of 2^3 blocks of 4^3 cells, fine grid of 4^3 blocks (14 cells along each axis, offset by one fine cell)
+		auto fineData = GetLinearGrid(Vector3{ 0.125, 0.125, 0.125 }, Vector3{ 1.875, 1.875, 1.875 });
+		auto coarseData = RestrictScalarGridData(fineData);
+		size_t coarseCellId = 0;
+		for (size_t k = 0; k < coarseData.ZCellCount; k++)
+			for (size_t j = 0; j < coarseData.YCellCount; j++)
+				for (size_t i = 0; i < coarseData.XCellCount; i++, coarseCellId++)
+					coarseData.CellData[coarseCellId] = GetLinearCellValue(coarseData, i, j, k);
+		constexpr size_t blockLog2 = 2;
+		constexpr double outsideValue = 0.5;
+		std::vector<size_t> fineBlockIds;
+		std::vector<size_t> invalidFineBlockIds;
+		auto invalidFineData = fineData;
+
+		// Act
+		const bool isProlongated = ProlongateScalarGridData(coarseData, fineData, blockLog2, { 0 }, outsideValue, fineBlockIds);
+		const bool isInvalidBlockProlongated = ProlongateScalarGridData(coarseData, invalidFineData, blockLog2, { 8 }, outsideValue, invalidFineBlockIds);
+
+		// Assert
+		ASSERT_TRUE(isProlongated);
+		EXPECT_FALSE(isInvalidBlockProlongated);
+		// children of coarse cells [0, 4) are fine cells [0, 7), i.e.: fine blocks 0 and 1 along each axis
+		EXPECT_EQ(fineBlockIds, (std::vector<size_t>{ 0, 1, 4, 5, 16, 17, 20, 21 }));
+		size_t cellId = 0;
+		for (size_t k = 0; k < fineData.ZCellCount; k++)
+			for (size_t j = 0; j < fineData.YCellCount; j++)
+				for (size_t i = 0; i < fineData.XCellCount; i++, cellId++)
+				{
+					if ((i >> blockLog2) < 2 && (j >> blockLog2) < 2 && (k >> blockLog2) < 2)
+					{
+						EXPECT_NEAR(fineData.CellData[cellId], GetLinearCellValue(fineData, i, j, k), 1e-12);
+						continue;
+					}
+					// other cells take the sign of the coarse cell containing their center
+					const double parentValue = GetLinearCellValue(coarseData, (i + 1) / 2, (j + 1) / 2, (k + 1) / 2);
+					EXPECT_EQ(fineData.CellData[cellId], parentValue < 0.0 ? -outsideValue : outsideValue);
+				}
+	}
+
+	TEST(ScalarGridPyramid_Tests, Grid_BuildPyramid_StopsAtSingleCell)
+	{
+		// Arrange
+		const auto finestData = GetLinearGrid(Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 2.0, 2.0, 2.0 });
+
+		// Act
+		const auto levels = BuildScalarGridPyramid(finestData, 6);
+
+		// Assert
+		ASSERT_EQ(levels.size(), 4u);
+		const double meanValue = GetLinearValue(1.0, 1.0, 1.0);
+		for (size_t level = 0; level < levels.size(); level++)
+		{
+			EXPECT_DOUBLE_EQ(levels[level].CellSize, 0.25 * static_cast<double>(1 << level));
+			EXPECT_EQ(levels[level].XCellCount, 8u >> level);
+		}
+		EXPECT_NEAR(levels.back().CellData[0], meanValue, 1e-12);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,150 @@
+/*! \file  ScalarGridSampler_Tests.cpp
+ *  \brief Unit tests for trilinear and tricubic sampling of scalar grids.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+#include "Symplekt_GeometryKernel/ScalarGridSampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+
+	/// \brief A grid over [0, 2.1] x [0, 1.3] x [0, 1.7] with cell size 0.1, filled from a function of cell center coordinates.
+	static ScalarGridData GetSampledTestGrid(const std::function<double(double, double, double)>& valueFunction)
+	{
+		auto gridData = InitializeScalarGridData({ L"SampledGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 2.1, 1.3, 1.7 } }, 0.1, 0.0 });
+		const Vector3 min = gridData.BoundingBox.Min();
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+					gridData.CellData[cellId] = valueFunction(
+						min.X() + (static_cast<double>(i) + 0.5) * gridData.CellSize,
+						min.Y() + (static_cast<double>(j) + 0.5) * gridData.CellSize,
+						min.Z() + (static_cast<double>(k) + 0.5) * gridData.CellSize);
+		return gridData;
+	}
+
+	/// \brief Pseudo-random query points in a box (deterministic).
+	static GridSamplePoints GetQueryPoints(const size_t& count, const Vector3& min, const Vector3& max)
+	{
+		GridSamplePoints points;
+		unsigned int state = 12345;
+		const auto random = [&state]() { state = state * 1664525u + 1013904223u; return static_cast<double>(state >> 8) / static_cast<double>(1u << 24); };
+		for (size_t n = 0; n < count; n++)
+		{
+			points.X.push_back(min.X() + random() * (max.X() - min.X()));
+			points.Y.push_back(min.Y() + random() * (max.Y() - min.Y()));
+			points.Z.push_back(min.Z() + random() * (max.Z() - min.Z()));
+		}
+		return points;
+	}
+
+	TEST(ScalarGridSampler_TestSuite, LinearField_SampleBatch_ExactValuesAndGradientsForBothInterpolations)
+	{
+		// Arrange
+		const auto gridData = GetSampledTestGrid([](const double x, const double y, const double z) { return 2.0 * x - 3.0 * y + 0.5 * z + 1.0; });
+		// points at least 1.5 cells from outer cell centers, so that tricubic stencils are not clamped
+		const auto points = GetQueryPoints(1000, Vector3{ 0.25, 0.25, 0.25 }, Vector3{ 1.85, 1.05, 1.45 });
+
+		for (const auto type : { GridInterpolationType::Trilinear, GridInterpolationType::Tricubic })
+		{
+			// Act
+			const ScalarGridSampler sampler(gridData, type);
+			GridSampleResults results;
+			sampler.SampleBatch(points, results);
+
+			// Assert
+			ASSERT_EQ(results.Values.size(), points.Size());
+			ASSERT_EQ(results.GradientZ.size(), points.Size());
+			for (size_t n = 0; n < points.Size(); n++)
+			{
+				ASSERT_NEAR(results.Values[n], 2.0 * points.X[n] - 3.0 * points.Y[n] + 0.5 * points.Z[n] + 1.0, 1e-10);
+				ASSERT_NEAR(results.GradientX[n], 2.0, 1e-9);
+				ASSERT_NEAR(results.GradientY[n], -3.0, 1e-9);
+				ASSERT_NEAR(results.GradientZ[n], 0.5, 1e-9);
+			}
+		}
+	}
+
+	TEST(ScalarGridSampler_TestSuite, SmoothField_SampleBatch_EqualToSinglePointSamplesAndCellValues)
+	{
+		// Arrange: points also outside the grid
+		const auto gridData = GetSampledTestGrid([](const double x, const double y, const double z) { return std::sin(3.0 * x) * std::cos(2.0 * y) + z * z; });
+		const auto points = GetQueryPoints(777, Vector3{ -0.3, -0.2, -0.4 }, Vector3{ 2.4, 1.5, 2.0 });
+
+		for (const auto type : { GridInterpolationType::Trilinear, GridInterpolationType::Tricubic })
+		{
+			// Act
+			const ScalarGridSampler sampler(gridData, type);
+			GridSampleResults results;
+			sampler.SampleBatch(points, results);
+			GridSampleResults valueResults;
+			sampler.SampleBatch(points, valueResults, false);
+
+			// Assert
+			EXPECT_TRUE(valueResults.GradientX.empty());
+			for (size_t n = 0; n < points.Size(); n++)
+			{
+				const Vector3 point{ points.X[n], points.Y[n], points.Z[n] };
+				const Vector3 gradient = sampler.SampleGradient(point);
+				ASSERT_DOUBLE_EQ(results.Values[n], sampler.Sample(point));
+				ASSERT_DOUBLE_EQ(valueResults.Values[n], results.Values[n]);
+				ASSERT_DOUBLE_EQ(results.GradientX[n], gradient.X());
+				ASSERT_DOUBLE_EQ(results.GradientY[n], gradient.Y());
+				ASSERT_DOUBLE_EQ(results.GradientZ[n], gradient.Z());
+				// gradients vanish along axes where the point is clamped to the grid
+				if (points.X[n] < 0.05 || points.X[n] > 2.05)
+					ASSERT_EQ(results.GradientX[n], 0.0);
+			}
+			// cell values are interpolated exactly
+			const size_t cellId = 7 + gridData.XCellCount * (4 + gridData.YCellCount * 9);
+			EXPECT_NEAR(sampler.Sample(Vector3{ 0.75, 0.45, 0.95 }), gridData.CellData[cellId], 1e-12);
+		}
+	}
+
+	TEST(ScalarGridSampler_TestSuite, SmoothField_SampleTricubic_MoreAccurateThanTrilinear)
+	{
+		// Arrange
+		const auto field = [](const double x, const double y, const double z) { return std::sin(3.0 * x) * std::cos(2.0 * y) + z * z; };
+		const auto gridData = GetSampledTestGrid(field);
+		const auto points = GetQueryPoints(500, Vector3{ 0.25, 0.25, 0.25 }, Vector3{ 1.85, 1.05, 1.45 });
+		const ScalarGridSampler trilinearSampler(gridData, GridInterpolationType::Trilinear);
+		const ScalarGridSampler tricubicSampler(gridData, GridInterpolationType::Tricubic);
+
+		// Act
+		GridSampleResults trilinearResults;
+		GridSampleResults tricubicResults;
+		trilinearSampler.SampleBatch(points, trilinearResults);
+		tricubicSampler.SampleBatch(points, tricubicResults);
+
+		// Assert
+		double trilinearError = 0.0;
+		double tricubicError = 0.0;
+		double trilinearGradientError = 0.0;
+		double tricubicGradientError = 0.0;
+		for (size_t n = 0; n < points.Size(); n++)
+		{
+			const double x = points.X[n], y = points.Y[n], z = points.Z[n];
+			trilinearError = std::max(trilinearError, std::fabs(trilinearResults.Values[n] - field(x, y, z)));
+			tricubicError = std::max(tricubicError, std::fabs(tricubicResults.Values[n] - field(x, y, z)));
+			const double gradientX = 3.0 * std::cos(3.0 * x) * std::cos(2.0 * y);
+			trilinearGradientError = std::max(trilinearGradientError, std::fabs(trilinearResults.GradientX[n] - gradientX));
+			tricubicGradientError = std::max(tricubicGradientError, std::fabs(tricubicResults.GradientX[n] - gradientX));
+		}
+		EXPECT_LT(tricubicError, 0.25 * trilinearError);
+		EXPECT_LT(tricubicError, 1e-3);
+		EXPECT_LT(tricubicGradientError, 0.25 * trilinearGradientError);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
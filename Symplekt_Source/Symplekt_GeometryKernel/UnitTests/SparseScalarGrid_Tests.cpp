@@ -0,0 +1,160 @@
+/*! \file  SparseScalarGrid_Tests.cpp
+ *  \brief Unit tests for the sparse, blocked scalar grid data.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+#include "Symplekt_GeometryKernel/SparseScalarGridData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+
+	TEST(SparseScalarGrid_TestSuite, EmptySparseGrid_GetValue_BackgroundValueWithoutBricks)
+	{
+		// Arrange
+		const SparseScalarGridData gridData(BaseScalarGridInputData{ L"SparseGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 10.0, 5.0, 2.5 } }, 0.5, 3.0 });
+
+		// Act
+		const auto value = gridData.GetValue(7, 3, 2);
+
+		// Assert
+		EXPECT_EQ(gridData.XCellCount, 20);
+		EXPECT_EQ(gridData.YCellCount, 10);
+		EXPECT_EQ(gridData.ZCellCount, 5);
+		EXPECT_DOUBLE_EQ(value, 3.0);
+		EXPECT_FALSE(gridData.IsActive(7, 3, 2));
+		EXPECT_FALSE(gridData.IsFrozen(7, 3, 2));
+		EXPECT_TRUE(gridData.Bricks().empty());
+		EXPECT_EQ(gridData.ActiveCellCount(), 0);
+	}
+
+	TEST(SparseScalarGrid_TestSuite, SparseGrid_SetValuesAndFrozenFlags_BricksAllocatedPerBlock)
+	{
+		// Arrange
+		SparseScalarGridData gridData(BaseScalarGridInputData{ L"SparseGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 20.0, 20.0, 20.0 } }, 1.0, 1.0 });
+
+		// Act
+		gridData.SetValue(0, 0, 0, -1.0);
+		gridData.SetValue(7, 7, 7, -2.0);
+		gridData.SetValue(8, 0, 0, -3.0);
+		gridData.SetValue(19 + 20 * (19 + 20 * 19), -4.0);
+		gridData.SetFrozen(1, 1, 1, true);
+		gridData.SetFrozen(15, 15, 15, false);
+
+		// Assert
+		EXPECT_EQ(gridData.Bricks().size(), 3);
+		EXPECT_EQ(gridData.ActiveCellCount(), 4);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(0, 0, 0), -1.0);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(7, 7, 7), -2.0);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(8 + 20 * 0), -3.0);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(19, 19, 19), -4.0);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(1, 1, 1), 1.0);
+		EXPECT_TRUE(gridData.IsFrozen(1, 1, 1));
+		EXPECT_FALSE(gridData.IsActive(1, 1, 1));
+		EXPECT_FALSE(gridData.IsFrozen(15, 15, 15));
+	}
+
+	TEST(SparseScalarGrid_TestSuite, ThinShellDenseGrid_ConvertToSparseAndBack_IdenticalData)
+	{
+		// Arrange
+		auto denseData = InitializeScalarGridData({ L"ShellGrid", Box3{ Vector3{ -1.0, -1.0, -1.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 0.05, 0.0 });
+		const double bandValue = 0.15;
+		size_t cellId = 0;
+		for (size_t k = 0; k < denseData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < denseData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < denseData.XCellCount; i++, cellId++)
+				{
+					const double x = denseData.BoundingBox.Min().X() + (i + 0.5) * denseData.CellSize;
+					const double y = denseData.BoundingBox.Min().Y() + (j + 0.5) * denseData.CellSize;
+					const double z = denseData.BoundingBox.Min().Z() + (k + 0.5) * denseData.CellSize;
+					const double distance = std::sqrt(x * x + y * y + z * z) - 0.7;
+					denseData.CellData[cellId] = std::clamp(distance, -bandValue, bandValue);
+					denseData.CellIsFrozen[cellId] = std::fabs(distance) < denseData.CellSize;
+				}
+			}
+		}
+
+		// Act
+		auto sparseData = ConvertScalarGridDataToSparse(denseData, bandValue);
+		const size_t prunedBrickCount = sparseData.Prune();
+		const auto convertedData = ConvertSparseToScalarGridData(sparseData);
+
+		// Assert
+		EXPECT_EQ(prunedBrickCount, 0);
+		EXPECT_LT(sparseData.Bricks().size() * SPARSE_GRID_BRICK_CELL_COUNT, denseData.CellData.size());
+		EXPECT_EQ(convertedData.XCellCount, denseData.XCellCount);
+		EXPECT_EQ(convertedData.YCellCount, denseData.YCellCount);
+		EXPECT_EQ(convertedData.ZCellCount, denseData.ZCellCount);
+		EXPECT_EQ(convertedData.BoundingBox.Min(), denseData.BoundingBox.Min());
+		EXPECT_EQ(convertedData.CellData, denseData.CellData);
+		EXPECT_EQ(convertedData.CellIsFrozen, denseData.CellIsFrozen);
+	}
+
+	TEST(SparseScalarGrid_TestSuite, SparseGrid_ReadLinearRangeAcrossRowsAndBricks_MatchesCellAccess)
+	{
+		// Arrange
+		SparseScalarGridData gridData(BaseScalarGridInputData{ L"SparseGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 13.0, 11.0, 9.0 } }, 1.0, -5.0 });
+		for (size_t k = 0; k < gridData.ZCellCount; k += 3)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j += 2)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i += 5)
+				{
+					gridData.SetValue(i, j, k, static_cast<double>(i + 100 * j + 10000 * k));
+					gridData.SetFrozen(i, j, k, (i + j) % 2 == 0);
+				}
+			}
+		}
+		const size_t firstCellId = 17;
+		const size_t count = gridData.CellCount() - 2 * firstCellId;
+		std::vector<double> values(count);
+		std::vector<uint8_t> frozenFlags(count);
+
+		// Act
+		gridData.ReadLinearRange(firstCellId, count, values.data(), frozenFlags.data());
+
+		// Assert
+		for (size_t r = 0; r < count; r++)
+		{
+			ASSERT_DOUBLE_EQ(values[r], gridData.GetValue(firstCellId + r));
+			ASSERT_EQ(frozenFlags[r] == 1, gridData.IsFrozen(firstCellId + r));
+		}
+	}
+
+	TEST(SparseScalarGrid_TestSuite, SparseGridWithBackgroundCells_Prune_EmptyBricksRemoved)
+	{
+		// Arrange
+		SparseScalarGridData gridData(BaseScalarGridInputData{ L"SparseGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 32.0, 8.0, 8.0 } }, 1.0, 2.0 });
+		gridData.SetValue(1, 1, 1, 2.0 + 1e-9);
+		gridData.SetValue(9, 1, 1, 0.0);
+		gridData.SetValue(17, 1, 1, 2.0);
+		gridData.SetFrozen(17, 1, 1, true);
+		gridData.SetValue(25, 1, 1, 1.0);
+		gridData.Deactivate(25, 1, 1);
+
+		// Act
+		const size_t prunedBrickCount = gridData.Prune(1e-6);
+
+		// Assert
+		EXPECT_EQ(prunedBrickCount, 2);
+		EXPECT_EQ(gridData.Bricks().size(), 2);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(1, 1, 1), 2.0);
+		EXPECT_DOUBLE_EQ(gridData.GetValue(9, 1, 1), 0.0);
+		EXPECT_TRUE(gridData.IsFrozen(17, 1, 1));
+		EXPECT_DOUBLE_EQ(gridData.GetValue(25, 1, 1), 2.0);
+		EXPECT_GT(gridData.Size(), 2 * sizeof(SparseGridBrick));
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
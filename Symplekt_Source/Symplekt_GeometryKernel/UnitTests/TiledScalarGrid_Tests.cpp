@@ -0,0 +1,321 @@
+/*! \file  TiledScalarGrid_Tests.cpp
+ *  \brief Unit tests for the brick-tiled dense scalar grid data.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+#include "Symplekt_GeometryKernel/TiledScalarGridData.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Symplektis::UnitTests
+{
+	using namespace GeometryKernel;
+
+	/// \brief A dense grid with cell counts which are not multiples of brick sizes, filled with a smooth field and some frozen cells.
+	static ScalarGridData GetLinearTestGrid()
+	{
+		auto gridData = InitializeScalarGridData({ L"TestGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 2.1, 1.3, 1.7 } }, 0.1, 0.0 });
+		size_t cellId = 0;
+		for (size_t k = 0; k < gridData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < gridData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < gridData.XCellCount; i++, cellId++)
+				{
+					gridData.CellData[cellId] = std::sin(0.3 * i) + std::cos(0.2 * j) * k;
+					gridData.CellIsFrozen[cellId] = (i + 2 * j + 3 * k) % 5 == 0;
+				}
+			}
+		}
+		return gridData;
+	}
+
+	/// \brief 7-point Laplacian (with one-sided differences vanishing at the grid boundary) in the linear layout.
+	static void GetLinearLaplacian(const ScalarGridData& gridData, std::vector<double>& laplacian)
+	{
+		const size_t X = gridData.XCellCount;
+		const size_t Y = gridData.YCellCount;
+		const size_t Z = gridData.ZCellCount;
+		const auto& values = gridData.CellData;
+		size_t cellId = 0;
+		for (size_t k = 0; k < Z; k++)
+		{
+			for (size_t j = 0; j < Y; j++)
+			{
+				for (size_t i = 0; i < X; i++, cellId++)
+				{
+					const double value = values[cellId];
+					laplacian[cellId] =
+						values[i > 0 ? cellId - 1 : cellId] + values[i + 1 < X ? cellId + 1 : cellId] +
+						values[j > 0 ? cellId - X : cellId] + values[j + 1 < Y ? cellId + X : cellId] +
+						values[k > 0 ? cellId - X * Y : cellId] + values[k + 1 < Z ? cellId + X * Y : cellId] - 6.0 * value;
+				}
+			}
+		}
+	}
+
+	/// \brief 7-point Laplacian in the tiled layout (stored at tiled cell indices).
+	static void GetTiledLaplacian(const TiledScalarGridData& tiledData, std::vector<double>& laplacian)
+	{
+		const auto& values = tiledData.CellData;
+		tiledData.ForEachCellStencil([&](const size_t /*i*/, const size_t /*j*/, const size_t /*k*/, const size_t cellId, const std::array<size_t, 6>& neighborCellIds)
+		{
+			laplacian[cellId] =
+				values[neighborCellIds[0]] + values[neighborCellIds[1]] + values[neighborCellIds[2]] +
+				values[neighborCellIds[3]] + values[neighborCellIds[4]] + values[neighborCellIds[5]] - 6.0 * values[cellId];
+		});
+	}
+
+	TEST(TiledScalarGrid_TestSuite, LinearGrid_ConvertToTiledAndBack_IdenticalDataForBothBrickSizes)
+	{
+		// Arrange
+		const auto linearData = GetLinearTestGrid();
+
+		for (const auto brickSize : { GridBrickSize::Brick4, GridBrickSize::Brick8 })
+		{
+			// Act
+			const auto tiledData = ConvertScalarGridDataToTiled(linearData, brickSize);
+			const auto convertedData = ConvertTiledToScalarGridData(tiledData);
+
+			// Assert
+			const size_t brickEdge = size_t{ 1 } << static_cast<size_t>(brickSize);
+			EXPECT_EQ(tiledData.BrickSize(), brickSize);
+			EXPECT_EQ(tiledData.BrickCounts()[0], (linearData.XCellCount + brickEdge - 1) / brickEdge);
+			EXPECT_EQ(tiledData.CellData.size() % (brickEdge * brickEdge * brickEdge), 0);
+			EXPECT_EQ(convertedData.XCellCount, linearData.XCellCount);
+			EXPECT_EQ(convertedData.YCellCount, linearData.YCellCount);
+			EXPECT_EQ(convertedData.ZCellCount, linearData.ZCellCount);
+			EXPECT_EQ(convertedData.BoundingBox.Min(), linearData.BoundingBox.Min());
+			EXPECT_EQ(convertedData.CellData, linearData.CellData);
+			EXPECT_EQ(convertedData.CellIsFrozen, linearData.CellIsFrozen);
+		}
+	}
+
+	TEST(TiledScalarGrid_TestSuite, TiledGrid_ForEachCell_EachCellVisitedOnceWithConsistentIndices)
+	{
+		// Arrange
+		const TiledScalarGridData tiledData(BaseScalarGridInputData{ L"TiledGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 9.0, 5.0, 13.0 } }, 1.0, 0.0 }, GridBrickSize::Brick4);
+		std::vector<size_t> visitCounts(tiledData.CellData.size(), 0);
+		size_t visitedCount = 0;
+		bool indicesConsistent = true;
+
+		// Act
+		tiledData.ForEachCell([&](const size_t i, const size_t j, const size_t k, const size_t cellId)
+		{
+			visitCounts[cellId]++;
+			visitedCount++;
+			const auto [iBack, jBack, kBack] = tiledData.GetCellIndices(cellId);
+			indicesConsistent = indicesConsistent && cellId == tiledData.GetCellId(i, j, k) && iBack == i && jBack == j && kBack == k;
+		});
+
+		// Assert
+		EXPECT_EQ(visitedCount, 9 * 5 * 13);
+		EXPECT_TRUE(indicesConsistent);
+		for (const auto& count : visitCounts)
+			ASSERT_LE(count, 1);
+	}
+
+	TEST(TiledScalarGrid_TestSuite, TiledGrid_SevenPointLaplacianWithNeighborIterator_EqualToLinearLayout)
+	{
+		// Arrange
+		const auto linearData = GetLinearTestGrid();
+		const auto tiledData = ConvertScalarGridDataToTiled(linearData, GridBrickSize::Brick4);
+		const size_t X = linearData.XCellCount;
+		const size_t Y = linearData.YCellCount;
+		const size_t Z = linearData.ZCellCount;
+
+		// Act
+		std::vector<double> tiledLaplacian(tiledData.CellData.size(), 0.0);
+		std::vector<size_t> tiledNeighborCounts(tiledData.CellData.size(), 0);
+		tiledData.ForEachCell([&](const size_t i, const size_t j, const size_t k, const size_t cellId)
+		{
+			tiledData.ForEachNeighbor(i, j, k, [&](const size_t neighborCellId, const size_t /*axis*/, const int /*direction*/)
+			{
+				tiledLaplacian[cellId] += tiledData.CellData[neighborCellId] - tiledData.CellData[cellId];
+				tiledNeighborCounts[cellId]++;
+			});
+		});
+
+		// Assert
+		for (size_t k = 0; k < Z; k++)
+		{
+			for (size_t j = 0; j < Y; j++)
+			{
+				for (size_t i = 0; i < X; i++)
+				{
+					const size_t cellId = i + X * (j + Y * k);
+					const double value = linearData.CellData[cellId];
+					double laplacian = 0.0;
+					size_t neighborCount = 0;
+					if (i > 0) { laplacian += linearData.CellData[cellId - 1] - value; neighborCount++; }
+					if (i + 1 < X) { laplacian += linearData.CellData[cellId + 1] - value; neighborCount++; }
+					if (j > 0) { laplacian += linearData.CellData[cellId - X] - value; neighborCount++; }
+					if (j + 1 < Y) { laplacian += linearData.CellData[cellId + X] - value; neighborCount++; }
+					if (k > 0) { laplacian += linearData.CellData[cellId - X * Y] - value; neighborCount++; }
+					if (k + 1 < Z) { laplacian += linearData.CellData[cellId + X * Y] - value; neighborCount++; }
+
+					const size_t tiledCellId = tiledData.GetCellId(i, j, k);
+					ASSERT_EQ(tiledNeighborCounts[tiledCellId], neighborCount);
+					ASSERT_NEAR(tiledLaplacian[tiledCellId], laplacian, 1e-12);
+				}
+			}
+		}
+	}
+
+	TEST(TiledScalarGrid_TestSuite, TiledGrid_SevenPointLaplacianWithStencilIterator_EqualToLinearLayoutForBothBrickSizes)
+	{
+		// Arrange
+		const auto linearData = GetLinearTestGrid();
+		std::vector<double> linearLaplacian(linearData.CellData.size());
+		GetLinearLaplacian(linearData, linearLaplacian);
+
+		for (const auto brickSize : { GridBrickSize::Brick4, GridBrickSize::Brick8 })
+		{
+			const auto tiledData = ConvertScalarGridDataToTiled(linearData, brickSize);
+			std::vector<double> tiledLaplacian(tiledData.CellData.size(), 0.0);
+			size_t visitedCount = 0;
+			bool indicesConsistent = true;
+
+			// Act
+			GetTiledLaplacian(tiledData, tiledLaplacian);
+			tiledData.ForEachCellStencil([&](const size_t i, const size_t j, const size_t k, const size_t cellId, const std::array<size_t, 6>& /*neighborCellIds*/)
+			{
+				visitedCount++;
+				indicesConsistent = indicesConsistent && cellId == tiledData.GetCellId(i, j, k);
+			});
+
+			// Assert
+			EXPECT_EQ(visitedCount, linearLaplacian.size());
+			EXPECT_TRUE(indicesConsistent);
+			size_t linearCellId = 0;
+			for (size_t k = 0; k < linearData.ZCellCount; k++)
+			{
+				for (size_t j = 0; j < linearData.YCellCount; j++)
+				{
+					for (size_t i = 0; i < linearData.XCellCount; i++, linearCellId++)
+						ASSERT_NEAR(tiledLaplacian[tiledData.GetCellId(i, j, k)], linearLaplacian[linearCellId], 1e-12);
+				}
+			}
+		}
+	}
+
+	TEST(TiledScalarGrid_TestSuite, TiledGrid_SampleBatch_EqualToLinearGridSampler)
+	{
+		// Arrange
+		const auto linearData = GetLinearTestGrid();
+		const ScalarGridSampler sampler(linearData);
+		GridSamplePoints points;
+		std::mt19937 generator(7);
+		std::uniform_real_distribution<double> distribution(-0.2, 2.3); // includes points outside the grid box
+		for (size_t pointId = 0; pointId < 1000; pointId++)
+		{
+			points.X.push_back(distribution(generator));
+			points.Y.push_back(distribution(generator));
+			points.Z.push_back(distribution(generator));
+		}
+		GridSampleResults expectedResults;
+		sampler.SampleBatch(points, expectedResults, false);
+
+		for (const auto brickSize : { GridBrickSize::Brick4, GridBrickSize::Brick8 })
+		{
+			const auto tiledData = ConvertScalarGridDataToTiled(linearData, brickSize);
+
+			// Act
+			std::vector<double> values;
+			tiledData.SampleBatch(points, values);
+
+			// Assert
+			ASSERT_EQ(values.size(), points.Size());
+			for (size_t pointId = 0; pointId < points.Size(); pointId++)
+				ASSERT_NEAR(values[pointId], expectedResults.Values[pointId], 1e-12);
+			const Vector3 point{ points.X[0], points.Y[0], points.Z[0] };
+			EXPECT_NEAR(tiledData.Sample(point), sampler.Sample(point), 1e-12);
+		}
+	}
+
+	TEST(TiledScalarGrid_TestSuite, DISABLED_Grid256_StencilAndSampling_Timing)
+	{
+		// Arrange
+		constexpr size_t cellCount = 256;
+		constexpr size_t pointCount = 1 << 22;
+		auto linearData = InitializeScalarGridData({ L"TimingGrid", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 1.0, 1.0, 1.0 } }, 1.0 / cellCount, 0.0 });
+		size_t cellId = 0;
+		for (size_t k = 0; k < linearData.ZCellCount; k++)
+		{
+			for (size_t j = 0; j < linearData.YCellCount; j++)
+			{
+				for (size_t i = 0; i < linearData.XCellCount; i++, cellId++)
+					linearData.CellData[cellId] = std::sin(0.05 * i) + std::cos(0.03 * j) * std::sin(0.02 * k);
+			}
+		}
+
+		// random points and points along z-rays (ray marching reads one column of cells after another)
+		GridSamplePoints randomPoints, rayPoints;
+		std::mt19937 generator(11);
+		std::uniform_real_distribution<double> distribution(0.0, 1.0);
+		for (size_t pointId = 0; pointId < pointCount; pointId++)
+		{
+			randomPoints.X.push_back(distribution(generator));
+			randomPoints.Y.push_back(distribution(generator));
+			randomPoints.Z.push_back(distribution(generator));
+		}
+		constexpr size_t raySampleCount = 512;
+		for (size_t rayId = 0; rayId < pointCount / raySampleCount; rayId++)
+		{
+			const double x = distribution(generator);
+			const double y = distribution(generator);
+			for (size_t sampleId = 0; sampleId < raySampleCount; sampleId++)
+			{
+				rayPoints.X.push_back(x);
+				rayPoints.Y.push_back(y);
+				rayPoints.Z.push_back((sampleId + 0.5) / raySampleCount);
+			}
+		}
+
+		const auto measure = [](const auto& job)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			job();
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		};
+
+		// outputs are preallocated, so that first-touch page faults are not timed
+		std::vector<double> laplacian(linearData.CellData.size());
+		GridSampleResults sampleResults;
+		sampleResults.Values.resize(pointCount);
+		std::vector<double> values(pointCount);
+
+		// Act & Assert
+		const ScalarGridSampler sampler(linearData);
+		const double linearLaplacianTime = measure([&] { GetLinearLaplacian(linearData, laplacian); });
+		const double linearRandomTime = measure([&] { sampler.SampleBatch(randomPoints, sampleResults, false); });
+		const double linearRayTime = measure([&] { sampler.SampleBatch(rayPoints, sampleResults, false); });
+		std::cout << "linear:   Laplacian " << linearLaplacianTime << " s, random samples " << linearRandomTime
+			<< " s, ray samples " << linearRayTime << " s\n";
+
+		for (const auto brickSize : { GridBrickSize::Brick4, GridBrickSize::Brick8 })
+		{
+			const auto tiledData = ConvertScalarGridDataToTiled(linearData, brickSize);
+			std::vector<double> tiledLaplacian(tiledData.CellData.size());
+			const double tiledLaplacianTime = measure([&] { GetTiledLaplacian(tiledData, tiledLaplacian); });
+			const double tiledRandomTime = measure([&] { tiledData.SampleBatch(randomPoints, values); });
+			const double tiledRayTime = measure([&] { tiledData.SampleBatch(rayPoints, values); });
+			EXPECT_NEAR(values[pointCount / 2], sampleResults.Values[pointCount / 2], 1e-12); // the sampler was last run on the ray points
+
+			const size_t brickEdge = size_t{ 1 } << static_cast<size_t>(brickSize);
+			std::cout << "tiled " << brickEdge << "^3: Laplacian " << tiledLaplacianTime << " s, random samples " << tiledRandomTime
+				<< " s, ray samples " << tiledRayTime << " s\n";
+		}
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*! \file  Base64Utils.cpp
+ *  \brief Implementation of base64 encoding & decoding utils
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "Base64Utils.h"
+
+#include <array>
+
+namespace Symplektis::IOService
+{
+	//!> \brief base64 alphabet
+	constexpr char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	//!> \brief marks characters which are not a part of the base64 alphabet in the decoding table
+	constexpr unsigned char base64_invalid = 0xFF;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Builds an inverse lookup table for base64_alphabet.
+	 *  \return table of 6-bit values for each char (base64_invalid for non-alphabet chars)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static constexpr std::array<unsigned char, 256> BuildBase64DecodingTable()
+	{
+		std::array<unsigned char, 256> table{};
+		for (auto& value : table)
+			value = base64_invalid;
+		for (unsigned char i = 0; i < 64; i++)
+			table[static_cast<unsigned char>(base64_alphabet[i])] = i;
+
+		return table;
+	}
+
+	//!> \brief inverse lookup table for base64_alphabet
+	constexpr std::array<unsigned char, 256> base64_decoding_table = BuildBase64DecodingTable();
+
+	std::string EncodeBase64(const void* data, const size_t byteCount)
+	{
+		const auto* bytes = static_cast<const unsigned char*>(data);
+		std::string result(GetBase64EncodedLength(byteCount), '=');
+
+		size_t iOut = 0;
+		size_t i = 0;
+		for (; i + 2 < byteCount; i += 3)
+		{
+			const unsigned int triple = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+			result[iOut++] = base64_alphabet[(triple >> 18) & 0x3F];
+			result[iOut++] = base64_alphabet[(triple >> 12) & 0x3F];
+			result[iOut++] = base64_alphabet[(triple >> 6) & 0x3F];
+			result[iOut++] = base64_alphabet[triple & 0x3F];
+		}
+
+		const size_t remainder = byteCount - i;
+		if (remainder == 0)
+			return result;
+
+		const unsigned int triple = (bytes[i] << 16) | (remainder == 2 ? bytes[i + 1] << 8 : 0);
+		result[iOut++] = base64_alphabet[(triple >> 18) & 0x3F];
+		result[iOut++] = base64_alphabet[(triple >> 12) & 0x3F];
+		if (remainder == 2)
+			result[iOut] = base64_alphabet[(triple >> 6) & 0x3F];
+
+		return result;
+	}
+
+	bool DecodeBase64(const std::string_view encoded, std::vector<unsigned char>& decoded)
+	{
+		decoded.reserve(decoded.size() + 3 * (encoded.size() / 4));
+
+		unsigned int quad = 0;
+		unsigned int quadCharCount = 0;
+		unsigned int paddingCount = 0;
+		for (const char c : encoded)
+		{
+			if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+				continue;
+
+			if (c == '=')
+			{
+				if (quadCharCount < 2)
+					return false;
+				paddingCount++;
+				quad <<= 6;
+			}
+			else
+			{
+				const unsigned char value = base64_decoding_table[static_cast<unsigned char>(c)];
+				if (value == base64_invalid || paddingCount > 0)
+					return false;
+				quad = (quad << 6) | value;
+			}
+
+			if (++quadCharCount < 4)
+				continue;
+
+			decoded.push_back(static_cast<unsigned char>((quad >> 16) & 0xFF));
+			if (paddingCount < 2)
+				decoded.push_back(static_cast<unsigned char>((quad >> 8) & 0xFF));
+			if (paddingCount < 1)
+				decoded.push_back(static_cast<unsigned char>(quad & 0xFF));
+
+			quad = 0;
+			quadCharCount = 0;
+			paddingCount = 0;
+		}
+
+		return quadCharCount == 0;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
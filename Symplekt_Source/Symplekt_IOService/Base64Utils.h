@@ -0,0 +1,56 @@
+/*! \file  Base64Utils.h
+ *  \brief Base64 encoding & decoding utils for inline binary data in XML-based file formats
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	//-----------------------------------------------------------------------------
+	/*! \brief Evaluates the length of a padded base64 encoding of a given number of bytes.
+	 *  \param[in] byteCount       number of encoded bytes
+	 *  \return number of base64 characters
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] constexpr size_t GetBase64EncodedLength(const size_t byteCount)
+	{
+		return 4 * ((byteCount + 2) / 3);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Encodes a byte buffer to a padded base64 string.
+	 *  \param[in] data            pointer to the first encoded byte
+	 *  \param[in] byteCount       number of encoded bytes
+	 *  \return base64 string
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] std::string EncodeBase64(const void* data, size_t byteCount);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Decodes a base64 string, ignoring whitespace. Padded blocks may be concatenated.
+	 *  \param[in] encoded         base64 encoded characters
+	 *  \param[out] decoded        decoded bytes (appended)
+	 *  \return true if the input was a valid base64 sequence
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] bool DecodeBase64(std::string_view encoded, std::vector<unsigned char>& decoded);
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*! \file  BaseGeometryExportHandle.cpp
+ *  \brief Implementation of conversion utilities from mesh geometry data to GeometryIOData to be exported
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "BaseGeometryExportHandle.h"
+
+#include "Symplekt_GeometryKernel/Face.h"
+#include "Symplekt_GeometryKernel/HalfEdge.h"
+#include "Symplekt_GeometryKernel/Vertex.h"
+#include "Symplekt_GeometryKernel/VertexNormal.h"
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	GeometryIOData ConvertReferencedMeshGeometryDataToIOData(const ReferencedMeshGeometryData& meshData)
+	{
+		GeometryIOData result;
+		result.Name = meshData.Name;
+
+		result.Vertices.reserve(meshData.Vertices.size());
+		for (const auto& vertex : meshData.Vertices)
+			result.Vertices.emplace_back(vertex.Position());
+
+		if (!meshData.VertexNormals.empty())
+		{
+			result.VertexNormals.reserve(meshData.Vertices.size());
+			for (const auto& vertex : meshData.Vertices)
+				result.VertexNormals.emplace_back(meshData.VertexNormals[vertex.Normal().get()].Get());
+		}
+
+		result.VertexIndices.resize(meshData.Faces.size());
+		for (size_t faceId = 0; faceId < meshData.Faces.size(); faceId++)
+		{
+			const auto& face = meshData.Faces[faceId];
+			auto& polyIndices = result.VertexIndices[faceId];
+			polyIndices.reserve(face.GetTriangulation().size() + 2);
+
+			const auto& baseHeId = face.HalfEdge();
+			auto heId = baseHeId;
+			do
+			{
+				polyIndices.emplace_back(static_cast<unsigned int>(meshData.HalfEdges[heId.get()].TailVertex().get()));
+				heId = meshData.HalfEdges[heId.get()].NextHalfEdge();
+			}
+			while (heId != baseHeId);
+		}
+
+		return result;
+	}
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,31 @@
+/*! \file  BaseGeometryExportHandle.h
+ *  \brief Conversion utilities from mesh geometry data to GeometryIOData to be exported
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+namespace Symplektis::IOService
+{
+	
+    //-----------------------------------------------------------------------------
+    /*! \brief Collects vertices, polygon vertex indices (traversed along face half-edge cycles) and vertex normals
+     *         of ReferencedMeshGeometryData into GeometryIOData to be exported.
+     *  \param[in] meshData          referenced mesh geometry data.
+     *  \return result GeometryIOData
+     *
+     *   \author M. Cavarga (MCInversion)
+     *   \date   18.10.2026
+     *
+     */
+     //-----------------------------------------------------------------------------
+	GeometryIOData ConvertReferencedMeshGeometryDataToIOData(const GeometryKernel::ReferencedMeshGeometryData& meshData);
+
+} // Symplektis::IOService
\ No newline at end of file
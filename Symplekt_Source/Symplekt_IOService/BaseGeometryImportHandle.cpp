@@ -8,7 +8,9 @@
 
 #include "BaseGeometryImportHandle.h"
 
+#include "Symplekt_GeometryKernel/BufferGeometryBuilder.h"
 #include "Symplekt_GeometryKernel/BufferMeshGeometry.h"
+#include "Symplekt_GeometryKernel/ReferencedGeometryBuilder.h"
 #include "Symplekt_GeometryKernel/ReferencedMeshGeometry.h"
 
 namespace Symplektis::IOService
@@ -35,6 +37,29 @@ namespace Symplektis::IOService
 		};
 	}
 
+	//-----------------------------------------------------------------------------
+	/*! \brief Moves buffers from imported GeometryIOData to BasePolygonalGeometryData object used for geometry construction.
+	 *  \param[in] importedData          imported GeometryIOData (emptied).
+	 *  \return result BasePolygonalGeometryData
+	 *
+	 *   \author M. Cavarga (MCInversion)
+	 *   \date   18.10.2026
+	 *
+	 */
+	 //-----------------------------------------------------------------------------
+	static BasePolygonalGeometryData ConvertIODataToBasePolygonalGeometryData(GeometryIOData&& importedData)
+	{
+		BasePolygonalGeometryData result{
+			std::move(importedData.Name),
+			std::move(importedData.Vertices),
+			std::move(importedData.VertexIndices),
+			std::move(importedData.VertexNormals)
+		};
+		importedData.Clear();
+
+		return result;
+	}
+
 	//
 	// =============================================================
 	//
@@ -58,4 +83,20 @@ namespace Symplektis::IOService
 
 		return buffGeom.GetMeshData();
 	}
+
+	ReferencedMeshGeometryData ConvertIODataToReferencedMeshGeometryData(GeometryIOData&& importedData)
+	{
+		ReferencedMeshGeometryBuilder builder{ ConvertIODataToBasePolygonalGeometryData(std::move(importedData)) };
+		builder.BuildGeometry();
+
+		return std::move(builder.Data());
+	}
+
+	BufferMeshGeometryData ConvertIODataToBufferMeshGeometryData(GeometryIOData&& importedData)
+	{
+		BufferMeshGeometryBuilder builder{ ConvertIODataToBasePolygonalGeometryData(std::move(importedData)) };
+		builder.BuildGeometry();
+
+		return std::move(builder.Data());
+	}
 } // Symplektis::IOService
\ No newline at end of file
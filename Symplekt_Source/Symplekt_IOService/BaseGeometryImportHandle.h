@@ -39,4 +39,30 @@ namespace Symplektis::IOService
      //-----------------------------------------------------------------------------
 	GeometryKernel::BufferMeshGeometryData ConvertIODataToBufferMeshGeometryData(const GeometryIOData& importedData);
 
+    //-----------------------------------------------------------------------------
+    /*! \brief Builds ReferencedMeshGeometryData from imported GeometryIOData whose buffers are moved into the builder
+     *         (no intermediate copies). importedData is left empty.
+     *  \param[in] importedData          imported GeometryIOData.
+     *  \return result ReferencedMeshGeometryData
+     *
+     *   \author M. Cavarga (MCInversion)
+     *   \date   18.10.2026
+     *
+     */
+     //-----------------------------------------------------------------------------
+	GeometryKernel::ReferencedMeshGeometryData ConvertIODataToReferencedMeshGeometryData(GeometryIOData&& importedData);
+
+    //-----------------------------------------------------------------------------
+    /*! \brief Builds BufferMeshGeometryData from imported GeometryIOData whose buffers are moved into the builder
+     *         (no intermediate copies). importedData is left empty.
+     *  \param[in] importedData          imported GeometryIOData.
+     *  \return result BufferMeshGeometryData
+     *
+     *   \author M. Cavarga (MCInversion)
+     *   \date   18.10.2026
+     *
+     */
+     //-----------------------------------------------------------------------------
+	GeometryKernel::BufferMeshGeometryData ConvertIODataToBufferMeshGeometryData(GeometryIOData&& importedData);
+
 } // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,167 @@
+/*! \file  BatchMeshImporter.cpp
+ *  \brief Implementation of an object for importing batches of mesh files on multiple threads
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "BatchMeshImporter.h"
+#include "BaseGeometryImportHandle.h"
+#include "OBJImporter.h"
+#include "PLYImporter.h"
+#include "VTKImporter.h"
+
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class ImportMemoryBudget
+	/// \brief Byte counter shared by import workers. Acquire() blocks while the reserved bytes would exceed the budget,
+	///        unless nothing is reserved (so that a file larger than the budget can still be imported alone).
+	//=============================================================================
+	class ImportMemoryBudget
+	{
+	public:
+		explicit ImportMemoryBudget(const size_t& budget)
+			: m_Budget(budget)
+		{ }
+
+		void Acquire(const size_t& byteCount)
+		{
+			std::unique_lock lock(m_Mutex);
+			m_Released.wait(lock, [this, &byteCount]() { return m_Reserved == 0 || m_Reserved + byteCount <= m_Budget; });
+			m_Reserved += byteCount;
+		}
+
+		void Release(const size_t& byteCount)
+		{
+			{
+				std::lock_guard lock(m_Mutex);
+				m_Reserved -= byteCount;
+			}
+			m_Released.notify_all();
+		}
+
+	private:
+		std::mutex              m_Mutex;
+		std::condition_variable m_Released;
+		size_t                  m_Budget{ 0 };
+		size_t                  m_Reserved{ 0 };
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Imports a file with a supported extension into caller-owned data.
+	 *  \param[in] filePath          input file path.
+	 *  \param[in] data              imported data.
+	 *  \param[in] stlSettings       vertex welding settings for *.stl files.
+	 *  \return Import status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static ImportStatus ImportFileByExtension(const std::filesystem::path& filePath, GeometryIOData& data, const STLImportSettings& stlSettings)
+	{
+		const auto extension = filePath.extension();
+		if (extension == ".obj")
+			return OBJImporter::Import(filePath, data);
+		if (extension == ".vtk")
+			return VTKImporter::Import(filePath, data);
+		if (extension == ".ply")
+			return PLYImporter::Import(filePath, data);
+		if (extension == ".stl" || extension == ".STL")
+			return STLImporter::Import(filePath, data, stlSettings);
+
+		return ImportStatus::InvalidExtension;
+	}
+
+	BatchMeshImporter::BatchMeshImporter(const BatchImportSettings& settings)
+		: m_Settings(settings)
+	{
+		if (m_Settings.ThreadCount == 0)
+			m_Settings.ThreadCount = Util::GetParallelThreadCount();
+	}
+
+	std::vector<BatchImportResult> BatchMeshImporter::Import(const std::vector<std::filesystem::path>& importedFilePaths) const
+	{
+		std::vector<BatchImportResult> results(importedFilePaths.size());
+		if (importedFilePaths.empty())
+			return results;
+
+		ImportMemoryBudget memoryBudget(m_Settings.MemoryBudget);
+		std::atomic<size_t> nextFileId{ 0 };
+
+		// each result is only accessed by the worker importing its file
+		const auto workerLoop = [&]()
+		{
+			for (size_t fileId = nextFileId++; fileId < importedFilePaths.size(); fileId = nextFileId++)
+			{
+				auto& result = results[fileId];
+				result.FilePath = importedFilePaths[fileId];
+
+				std::error_code errorCode;
+				const auto fileSize = std::filesystem::file_size(result.FilePath, errorCode);
+				const size_t reservedBytes = errorCode ? 0 : std::min(static_cast<size_t>(fileSize), m_Settings.MemoryBudget);
+
+				memoryBudget.Acquire(reservedBytes);
+				try
+				{
+					result.Status = ImportFileByExtension(result.FilePath, result.IOData, m_Settings.STLSettings);
+					if (result.Status == ImportStatus::Complete && m_Settings.BuildMeshes)
+						result.MeshData = ConvertIODataToReferencedMeshGeometryData(std::move(result.IOData));
+				}
+				catch (const std::exception& ex)
+				{
+					result.Status = ImportStatus::InternalError;
+					result.ErrorMessage = ex.what();
+				}
+				catch (...)
+				{
+					result.Status = ImportStatus::InternalError;
+					result.ErrorMessage = "BatchMeshImporter: unknown exception!";
+				}
+				memoryBudget.Release(reservedBytes);
+			}
+		};
+
+		const size_t threadCount = std::min(m_Settings.ThreadCount, importedFilePaths.size());
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+		for (size_t i = 0; i < threadCount; i++)
+			threads.emplace_back(workerLoop);
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return results;
+	}
+
+	std::vector<BatchImportResult> BatchMeshImporter::ImportDirectory(const std::filesystem::path& directoryPath) const
+	{
+		std::error_code errorCode;
+		if (!std::filesystem::is_directory(directoryPath, errorCode))
+			return {};
+
+		std::vector<std::filesystem::path> importedFilePaths;
+		for (const auto& entry : std::filesystem::directory_iterator(directoryPath, errorCode))
+		{
+			const auto extension = entry.path().extension();
+			if (entry.is_regular_file() &&
+				(extension == ".obj" || extension == ".vtk" || extension == ".ply" || extension == ".stl" || extension == ".STL"))
+				importedFilePaths.push_back(entry.path());
+		}
+
+		std::sort(importedFilePaths.begin(), importedFilePaths.end());
+		return Import(importedFilePaths);
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,134 @@
+/*! \file  BatchMeshImporter.h
+ *  \brief Object for importing batches of mesh files on multiple threads
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+#include "IOHelperTypes.h"
+#include "STLImporter.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \struct BatchImportSettings
+	/// \brief Settings for BatchMeshImporter.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct BatchImportSettings
+	{
+		size_t             ThreadCount{ 0 };                  //!< number of import threads (0 is replaced by Util::GetParallelThreadCount())
+		size_t             MemoryBudget{ 512 * 1024 * 1024 }; //!< maximum total byte size of files being imported at once (a larger file is imported alone)
+		bool               BuildMeshes{ false };              //!< if true, imported data are moved into ReferencedMeshGeometryData
+		STLImportSettings  STLSettings{};                     //!< vertex welding settings for *.stl files
+	};
+
+	//=============================================================================
+	/// \struct BatchImportResult
+	/// \brief Result of importing a single file of a batch.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct BatchImportResult
+	{
+		std::filesystem::path                       FilePath{};
+		ImportStatus                                Status{ ImportStatus::InternalError };
+		GeometryIOData                              IOData{};       //!< imported data (empty if BuildMeshes is set)
+		GeometryKernel::ReferencedMeshGeometryData  MeshData{};     //!< built mesh (only if BuildMeshes is set)
+		std::string                                 ErrorMessage{}; //!< message of an exception thrown while importing the file
+	};
+
+	//=============================================================================
+	/// \class BatchMeshImporter
+	/// \brief Imports a batch of *.obj, *.vtk, *.ply and *.stl files on a pool of worker threads. The importer is chosen
+	///        by file extension, and every file is imported into data owned by its worker (see the Import(path, data)
+	///        overloads of the importers), so the importer singletons' m_Data is never shared. Workers wait before
+	///        starting a file while the total size of files being imported would exceed the memory budget.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class BatchMeshImporter
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		 *  \param[in] settings          batch import settings.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit BatchMeshImporter(const BatchImportSettings& settings = {});
+
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports all given files and waits until they are finished.
+		 *  \param[in] importedFilePaths     paths to imported files.
+		 *  \return import results (in the order of importedFilePaths)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::vector<BatchImportResult> Import(const std::vector<std::filesystem::path>& importedFilePaths) const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports all files with a supported extension from a directory (non-recursively).
+		 *  \param[in] directoryPath         path to a directory.
+		 *  \return import results (in the order of sorted file paths, empty if the directory does not exist)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::vector<BatchImportResult> ImportDirectory(const std::filesystem::path& directoryPath) const;
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Settings getter (with the thread count already resolved)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const BatchImportSettings& Settings() const
+		{
+			return m_Settings;
+		}
+
+	private:
+		//
+		// ==================================
+		//
+
+		BatchImportSettings m_Settings; //!> batch import settings
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*! \file  ChecksumUtils.cpp
+ *  \brief Implementation of checksum utils for validating binary files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "ChecksumUtils.h"
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace Symplektis::IOService
+{
+	//!> \brief reflected CRC-32 polynomial
+	constexpr uint32_t crc32_polynomial = 0xEDB88320u;
+
+	//!> \brief number of lookup tables (bytes processed per iteration of the slicing-by-8 loop)
+	constexpr size_t crc32_slice_count = 8;
+
+	using CRC32Tables = std::array<std::array<uint32_t, 256>, crc32_slice_count>;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Builds lookup tables for the slicing-by-8 CRC-32 algorithm.
+	 *  \return tables, where tables[k][b] is the CRC of byte b followed by k zero bytes
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static constexpr CRC32Tables BuildCRC32Tables()
+	{
+		CRC32Tables tables{};
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			uint32_t crc = i;
+			for (unsigned int bit = 0; bit < 8; bit++)
+				crc = (crc & 1) ? (crc >> 1) ^ crc32_polynomial : (crc >> 1);
+			tables[0][i] = crc;
+		}
+
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			for (size_t k = 1; k < crc32_slice_count; k++)
+				tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+		}
+
+		return tables;
+	}
+
+	//!> \brief CRC-32 lookup tables
+	constexpr CRC32Tables crc32_tables = BuildCRC32Tables();
+
+	uint32_t UpdateCRC32(uint32_t crc, const void* data, size_t byteCount)
+	{
+		const auto* bytes = static_cast<const unsigned char*>(data);
+		crc = ~crc;
+
+		// slicing-by-8 assumes little endian byte order of the loaded words
+		while (byteCount >= crc32_slice_count)
+		{
+			uint32_t low, high;
+			std::memcpy(&low, bytes, sizeof(uint32_t));
+			std::memcpy(&high, bytes + sizeof(uint32_t), sizeof(uint32_t));
+			if constexpr (std::endian::native == std::endian::big)
+			{
+				low = ((low & 0xFF) << 24) | ((low & 0xFF00) << 8) | ((low >> 8) & 0xFF00) | (low >> 24);
+				high = ((high & 0xFF) << 24) | ((high & 0xFF00) << 8) | ((high >> 8) & 0xFF00) | (high >> 24);
+			}
+			low ^= crc;
+
+			crc =
+				crc32_tables[7][low & 0xFF] ^ crc32_tables[6][(low >> 8) & 0xFF] ^
+				crc32_tables[5][(low >> 16) & 0xFF] ^ crc32_tables[4][low >> 24] ^
+				crc32_tables[3][high & 0xFF] ^ crc32_tables[2][(high >> 8) & 0xFF] ^
+				crc32_tables[1][(high >> 16) & 0xFF] ^ crc32_tables[0][high >> 24];
+
+			bytes += crc32_slice_count;
+			byteCount -= crc32_slice_count;
+		}
+
+		while (byteCount-- > 0)
+			crc = (crc >> 8) ^ crc32_tables[0][(crc ^ *bytes++) & 0xFF];
+
+		return ~crc;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
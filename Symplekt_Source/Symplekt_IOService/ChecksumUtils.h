@@ -0,0 +1,48 @@
+/*! \file  ChecksumUtils.h
+ *  \brief Checksum utils for validating binary files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Symplektis::IOService
+{
+	//!> \brief initial value of a running CRC-32 checksum
+	constexpr uint32_t CRC32_INITIAL_VALUE = 0;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Updates a running CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) checksum with a block of bytes.
+	 *         Consecutive calls are equivalent to a single call over the concatenated blocks.
+	 *  \param[in] crc             checksum of the previous blocks (CRC32_INITIAL_VALUE for the first block)
+	 *  \param[in] data            pointer to the first byte of the block
+	 *  \param[in] byteCount       number of bytes in the block
+	 *  \return updated checksum
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] uint32_t UpdateCRC32(uint32_t crc, const void* data, size_t byteCount);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Computes a CRC-32 checksum of a block of bytes.
+	 *  \param[in] data            pointer to the first byte of the block
+	 *  \param[in] byteCount       number of bytes in the block
+	 *  \return checksum
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	[[nodiscard]] inline uint32_t ComputeCRC32(const void* data, const size_t byteCount)
+	{
+		return UpdateCRC32(CRC32_INITIAL_VALUE, data, byteCount);
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,302 @@
+/*! \file  GLBExporter.cpp
+ *  \brief Implementation of an object for exporting 3D triangle mesh data to binary glTF 2.0 (*.glb) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "GLBExporter.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace Symplektis::IOService
+{
+	//!> \brief GLB header magic ("glTF")
+	constexpr uint32_t glb_magic = 0x46546C67;
+
+	//!> \brief GLB container version
+	constexpr uint32_t glb_version = 2;
+
+	//!> \brief JSON chunk type ("JSON")
+	constexpr uint32_t glb_json_chunk_type = 0x4E4F534A;
+
+	//!> \brief binary chunk type ("BIN\0")
+	constexpr uint32_t glb_bin_chunk_type = 0x004E4942;
+
+	//!> \brief glTF accessor component types
+	constexpr unsigned int gltf_float_component = 5126;
+	constexpr unsigned int gltf_uint16_component = 5123;
+	constexpr unsigned int gltf_uint32_component = 5125;
+
+	//!> \brief glTF buffer view targets
+	constexpr unsigned int gltf_array_buffer_target = 34962;
+	constexpr unsigned int gltf_element_array_buffer_target = 34963;
+
+	//!> \brief glTF triangles primitive mode
+	constexpr unsigned int gltf_triangles_mode = 4;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Stores a value in little endian byte order.
+	 *  \param[in] dst             first destination byte.
+	 *  \param[in] value           stored value.
+	 *  \return pointer past the stored value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename T>
+	static char* StoreLittleEndian(char* dst, const T value)
+	{
+		auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+		if constexpr (std::endian::native == std::endian::big)
+			std::reverse(bytes.begin(), bytes.end());
+
+		std::memcpy(dst, bytes.data(), sizeof(T));
+		return dst + sizeof(T);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Rounds a byte count up to the 4-byte alignment required for GLB chunks and accessors.
+	 *  \param[in] byteCount       byte count.
+	 *  \return aligned byte count
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static size_t AlignTo4(const size_t byteCount)
+	{
+		return (byteCount + 3) & ~static_cast<size_t>(3);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts coordinates to little endian floats, also computing their per-axis bounds.
+	 *  \param[in] coords          source coordinates (xyz triples).
+	 *  \param[in] dst             first destination byte.
+	 *  \param[out] min            minimum float coordinates.
+	 *  \param[out] max            maximum float coordinates.
+	 *  \return false if a coordinate is not finite after conversion to float (its bounds would not be valid JSON numbers).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool StoreFloatCoords(const std::vector<double>& coords, char* dst, std::array<float, 3>& min, std::array<float, 3>& max)
+	{
+		min.fill(std::numeric_limits<float>::max());
+		max.fill(std::numeric_limits<float>::lowest());
+		for (size_t i = 0; i < coords.size(); i++)
+		{
+			const auto value = static_cast<float>(coords[i]);
+			if (!std::isfinite(value))
+				return false;
+
+			min[i % 3] = std::min(min[i % 3], value);
+			max[i % 3] = std::max(max[i % 3], value);
+			dst = StoreLittleEndian(dst, value);
+		}
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Stores triangle indices narrowed to a given unsigned integer type.
+	 *  \param[in] indices         source indices.
+	 *  \param[in] dst             first destination byte.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename T>
+	static void StoreIndices(const std::vector<unsigned int>& indices, char* dst)
+	{
+		if constexpr (std::is_same_v<T, unsigned int> && std::endian::native == std::endian::little)
+		{
+			std::memcpy(dst, indices.data(), indices.size() * sizeof(T));
+			return;
+		}
+
+		for (const auto& index : indices)
+			dst = StoreLittleEndian(dst, static_cast<T>(index));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Escapes a string for use as a JSON string value.
+	 *  \param[in] value           escaped string.
+	 *  \return escaped string
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::string EscapeJSONString(const std::string& value)
+	{
+		std::string result;
+		for (const char& c : value)
+		{
+			if (c == '"' || c == '\\')
+				result += '\\';
+
+			if (static_cast<unsigned char>(c) < 0x20)
+				continue;
+
+			result += c;
+		}
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes the json of a float VEC3 accessor with bounds.
+	 *  \param[in] jsonStream      output json stream.
+	 *  \param[in] bufferView      buffer view id.
+	 *  \param[in] count           number of vectors.
+	 *  \param[in] min             minimum coordinates.
+	 *  \param[in] max             maximum coordinates.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteVec3AccessorJSON(std::ostringstream& jsonStream, const size_t bufferView, const size_t count,
+		const std::array<float, 3>& min, const std::array<float, 3>& max)
+	{
+		jsonStream << "{\"bufferView\":" << bufferView << ",\"componentType\":" << gltf_float_component << ",\"count\":" << count << ",\"type\":\"VEC3\"";
+		jsonStream << ",\"min\":[" << min[0] << "," << min[1] << "," << min[2] << "]";
+		jsonStream << ",\"max\":[" << max[0] << "," << max[1] << "," << max[2] << "]}";
+	}
+
+	ExportStatus GLBExporter::Export(const GeometryKernel::BufferMeshGeometryData& data, const std::filesystem::path& exportedFileName)
+	{
+		std::filesystem::path resultPath = exportedFileName;
+
+		if (exportedFileName.extension().empty())
+			resultPath += ".glb";
+
+		else if (exportedFileName.extension() != ".glb")
+			return ExportStatus::InvalidExtension;
+
+		const size_t vertexCount = data.VertexCoords.size() / 3;
+		if (vertexCount == 0 || data.VertexCoords.size() % 3 != 0 || data.VertexIndices.empty() || data.VertexIndices.size() % 3 != 0)
+		{
+			MSG_CHECK(false, "GLBExporter::Export: Exporting data without valid vertex and triangle index buffers!\n");
+			return ExportStatus::InternalError;
+		}
+
+		if (vertexCount > std::numeric_limits<uint32_t>::max() ||
+			std::any_of(data.VertexIndices.begin(), data.VertexIndices.end(), [vertexCount](const unsigned int& index) { return index >= vertexCount; }))
+		{
+			MSG_CHECK(false, "GLBExporter::Export: Vertex index out of vertex buffer range!\n");
+			return ExportStatus::InternalError;
+		}
+
+		const bool hasNormals = data.VertexNormalCoords.size() == data.VertexCoords.size();
+		// indices must not reach the maximum value of their component type (primitive restart)
+		const bool useShortIndices = vertexCount <= std::numeric_limits<uint16_t>::max();
+
+		const size_t positionsByteCount = data.VertexCoords.size() * sizeof(float);
+		const size_t normalsByteCount = hasNormals ? data.VertexNormalCoords.size() * sizeof(float) : 0;
+		const size_t indicesByteCount = data.VertexIndices.size() * (useShortIndices ? sizeof(uint16_t) : sizeof(uint32_t));
+		const size_t normalsOffset = positionsByteCount;
+		const size_t indicesOffset = normalsOffset + normalsByteCount;
+		const size_t binByteCount = AlignTo4(indicesOffset + indicesByteCount);
+
+		// ------ binary chunk: all buffers are converted directly into a single zero-padded allocation ---------
+		std::vector<char> binChunk(binByteCount, 0);
+		std::array<float, 3> positionMin{};
+		std::array<float, 3> positionMax{};
+		std::array<float, 3> normalMin{};
+		std::array<float, 3> normalMax{};
+		if (!StoreFloatCoords(data.VertexCoords, binChunk.data(), positionMin, positionMax) ||
+			(hasNormals && !StoreFloatCoords(data.VertexNormalCoords, binChunk.data() + normalsOffset, normalMin, normalMax)))
+		{
+			MSG_CHECK(false, "GLBExporter::Export: Exporting non-finite (or float-overflowing) vertex or normal coordinates!\n");
+			return ExportStatus::InternalError;
+		}
+
+		if (useShortIndices)
+			StoreIndices<uint16_t>(data.VertexIndices, binChunk.data() + indicesOffset);
+		else
+			StoreIndices<unsigned int>(data.VertexIndices, binChunk.data() + indicesOffset);
+
+		// ------ JSON chunk ---------
+		// the mesh name is converted to UTF-8 through std::filesystem::path, falling back to the file name
+		const auto utf8Name = data.Name.empty() ? resultPath.stem().u8string() : std::filesystem::path(data.Name).u8string();
+		const std::string meshName = EscapeJSONString(std::string(utf8Name.begin(), utf8Name.end()));
+		const size_t indicesBufferView = hasNormals ? 2 : 1;
+		std::ostringstream jsonStream;
+		jsonStream.precision(std::numeric_limits<float>::max_digits10);
+		jsonStream << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"Symplektis\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],";
+		jsonStream << "\"nodes\":[{\"mesh\":0,\"name\":\"" << meshName << "\"}],";
+		jsonStream << "\"meshes\":[{\"name\":\"" << meshName << "\",\"primitives\":[{\"attributes\":{\"POSITION\":0";
+		if (hasNormals)
+			jsonStream << ",\"NORMAL\":1";
+		jsonStream << "},\"indices\":" << indicesBufferView << ",\"mode\":" << gltf_triangles_mode << "}]}],";
+		jsonStream << "\"buffers\":[{\"byteLength\":" << binByteCount << "}],";
+
+		jsonStream << "\"bufferViews\":[";
+		jsonStream << "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":" << positionsByteCount << ",\"target\":" << gltf_array_buffer_target << "},";
+		if (hasNormals)
+			jsonStream << "{\"buffer\":0,\"byteOffset\":" << normalsOffset << ",\"byteLength\":" << normalsByteCount << ",\"target\":" << gltf_array_buffer_target << "},";
+		jsonStream << "{\"buffer\":0,\"byteOffset\":" << indicesOffset << ",\"byteLength\":" << indicesByteCount << ",\"target\":" << gltf_element_array_buffer_target << "}],";
+
+		jsonStream << "\"accessors\":[";
+		WriteVec3AccessorJSON(jsonStream, 0, vertexCount, positionMin, positionMax);
+		jsonStream << ",";
+		if (hasNormals)
+		{
+			WriteVec3AccessorJSON(jsonStream, 1, vertexCount, normalMin, normalMax);
+			jsonStream << ",";
+		}
+		jsonStream << "{\"bufferView\":" << indicesBufferView << ",\"componentType\":" << (useShortIndices ? gltf_uint16_component : gltf_uint32_component);
+		jsonStream << ",\"count\":" << data.VertexIndices.size() << ",\"type\":\"SCALAR\"}]}";
+
+		std::string jsonChunk = jsonStream.str();
+		jsonChunk.resize(AlignTo4(jsonChunk.size()), ' ');
+
+		const size_t totalByteCount = 12 + 8 + jsonChunk.size() + 8 + binChunk.size();
+		if (totalByteCount > std::numeric_limits<uint32_t>::max())
+		{
+			MSG_CHECK(false, "GLBExporter::Export: Exported data exceed the maximum GLB file size!\n");
+			return ExportStatus::InternalError;
+		}
+
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+			return ExportStatus::FileNotCreated;
+
+		std::array<char, 20> header{};
+		char* headerDst = StoreLittleEndian(header.data(), glb_magic);
+		headerDst = StoreLittleEndian(headerDst, glb_version);
+		headerDst = StoreLittleEndian(headerDst, static_cast<uint32_t>(totalByteCount));
+		headerDst = StoreLittleEndian(headerDst, static_cast<uint32_t>(jsonChunk.size()));
+		StoreLittleEndian(headerDst, glb_json_chunk_type);
+		fileOStream.write(header.data(), static_cast<std::streamsize>(header.size()));
+		fileOStream.write(jsonChunk.data(), static_cast<std::streamsize>(jsonChunk.size()));
+
+		std::array<char, 8> binHeader{};
+		StoreLittleEndian(StoreLittleEndian(binHeader.data(), static_cast<uint32_t>(binChunk.size())), glb_bin_chunk_type);
+		fileOStream.write(binHeader.data(), static_cast<std::streamsize>(binHeader.size()));
+		fileOStream.write(binChunk.data(), static_cast<std::streamsize>(binChunk.size()));
+
+		if (!fileOStream.good())
+			return ExportStatus::InternalError;
+
+		fileOStream.close();
+		return ExportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
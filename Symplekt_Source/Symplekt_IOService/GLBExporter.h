@@ -0,0 +1,49 @@
+/*! \file  GLBExporter.h
+ *  \brief Object for exporting 3D triangle mesh data to binary glTF 2.0 (*.glb) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "IOHelperTypes.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class GLBExporter
+	/// \brief An exporter singleton object for exporting triangulated buffer mesh geometry data to a binary glTF 2.0 (*.glb) file.
+	///        The file contains a JSON chunk describing a single mesh node and a single binary chunk with float positions,
+	///        float vertex normals (if there is one per vertex) and UInt16 (if the vertex count allows it) or UInt32 triangle indices.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class GLBExporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports a binary *.glb file to a given path. The glTF mesh is named after data.Name (or the file name if empty).
+		 *  \param[in] data                      exported BufferMeshGeometryData (VertexIndices are read as triangle index triples)
+		 *  \param[in] exportedFileName          *.glb file name.
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(const GeometryKernel::BufferMeshGeometryData& data, const std::filesystem::path& exportedFileName);
+	};
+
+} // Symplektis::IOService
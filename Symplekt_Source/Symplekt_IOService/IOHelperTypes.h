@@ -21,11 +21,12 @@ namespace Symplektis::IOService
 	//=============================================================================
 	enum class [[nodiscard]] ImportStatus
 	{
-		Complete         = 0,      //!< file import is complete without errors.
-		FileNotFound     = 1,      //!< file to be imported (given a path) was not found
-		FileNotOpened    = 2,      //!< file to be imported (given a path) was not opened
-		InvalidExtension = 3,      //!< file to be imported (given a path) has incorrect suffix
-		InternalError    = 4,      //!< internal error, outside of external file I/O operations was thrown
+		Complete          = 0,      //!< file import is complete without errors.
+		FileNotFound      = 1,      //!< file to be imported (given a path) was not found
+		FileNotOpened     = 2,      //!< file to be imported (given a path) was not opened
+		InvalidExtension  = 3,      //!< file to be imported (given a path) has incorrect suffix
+		InternalError     = 4,      //!< internal error, outside of external file I/O operations was thrown
+		InvalidFileFormat = 5,      //!< file to be imported (given a path) has unsupported or corrupted contents
 	};
 
 	//=============================================================================
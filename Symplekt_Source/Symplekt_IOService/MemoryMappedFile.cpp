@@ -0,0 +1,140 @@
+/*! \file  MemoryMappedFile.cpp
+ *  \brief Implementation of a read-only memory-mapped view of a file
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "MemoryMappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+namespace Symplektis::IOService
+{
+	MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& filePath)
+	{
+#ifdef _WIN32
+		const HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+			return;
+
+		m_FileHandle = fileHandle;
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			Close();
+			return;
+		}
+
+		m_Size = static_cast<size_t>(fileSize.QuadPart);
+		m_IsOpen = true;
+		if (m_Size == 0)
+			return; // cannot map an empty file
+
+		m_MapHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_MapHandle == nullptr)
+		{
+			Close();
+			return;
+		}
+
+		m_Data = static_cast<const char*>(MapViewOfFile(m_MapHandle, FILE_MAP_READ, 0, 0, 0));
+		if (m_Data == nullptr)
+			Close();
+#else
+		m_FileDescriptor = open(filePath.c_str(), O_RDONLY);
+		if (m_FileDescriptor < 0)
+			return;
+
+		struct stat fileStat{};
+		if (fstat(m_FileDescriptor, &fileStat) != 0)
+		{
+			Close();
+			return;
+		}
+
+		m_Size = static_cast<size_t>(fileStat.st_size);
+		m_IsOpen = true;
+		if (m_Size == 0)
+			return; // cannot map an empty file
+
+		void* mapped = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_FileDescriptor, 0);
+		if (mapped == MAP_FAILED)
+		{
+			Close();
+			return;
+		}
+
+		madvise(mapped, m_Size, MADV_SEQUENTIAL);
+		m_Data = static_cast<const char*>(mapped);
+#endif
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Close();
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+		: m_Data(std::exchange(other.m_Data, nullptr)),
+		  m_Size(std::exchange(other.m_Size, 0)),
+		  m_IsOpen(std::exchange(other.m_IsOpen, false)),
+		  m_FileHandle(std::exchange(other.m_FileHandle, nullptr)),
+		  m_MapHandle(std::exchange(other.m_MapHandle, nullptr)),
+		  m_FileDescriptor(std::exchange(other.m_FileDescriptor, -1))
+	{
+	}
+
+	MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		Close();
+		m_Data = std::exchange(other.m_Data, nullptr);
+		m_Size = std::exchange(other.m_Size, 0);
+		m_IsOpen = std::exchange(other.m_IsOpen, false);
+		m_FileHandle = std::exchange(other.m_FileHandle, nullptr);
+		m_MapHandle = std::exchange(other.m_MapHandle, nullptr);
+		m_FileDescriptor = std::exchange(other.m_FileDescriptor, -1);
+		return *this;
+	}
+
+	void MemoryMappedFile::Close()
+	{
+#ifdef _WIN32
+		if (m_Data != nullptr)
+			UnmapViewOfFile(m_Data);
+		if (m_MapHandle != nullptr)
+			CloseHandle(m_MapHandle);
+		if (m_FileHandle != nullptr)
+			CloseHandle(m_FileHandle);
+#else
+		if (m_Data != nullptr)
+			munmap(const_cast<char*>(m_Data), m_Size);
+		if (m_FileDescriptor >= 0)
+			close(m_FileDescriptor);
+#endif
+		m_Data = nullptr;
+		m_Size = 0;
+		m_IsOpen = false;
+		m_FileHandle = nullptr;
+		m_MapHandle = nullptr;
+		m_FileDescriptor = -1;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*! \file  MemoryMappedFile.h
+ *  \brief Read-only memory-mapped view of a file for importers of large binary data.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class MemoryMappedFile
+	/// \brief A move-only RAII handle mapping a whole file into the address space (read-only).
+	///        The mapped bytes are valid as long as the MemoryMappedFile object is alive.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class MemoryMappedFile
+	{
+	public:
+		/// @{
+		/// \name Constructors & Destructor
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor. Opens and maps the file. Use IsOpen() to verify success.
+		 *  \param[in] filePath     path to a mapped file.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit MemoryMappedFile(const std::filesystem::path& filePath);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Destructor. Unmaps the file view and closes the file handles.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		~MemoryMappedFile();
+
+		MemoryMappedFile(const MemoryMappedFile& other) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Move constructor.
+		 *  \param[in] other     moved MemoryMappedFile.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Move assignment.
+		 *  \param[in] other     moved MemoryMappedFile.
+		 *  \return reference to this MemoryMappedFile
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+		/// @{
+		/// \name Getters
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns true if the file was successfully mapped. Empty files are open, but have no data.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IsOpen() const
+		{
+			return m_IsOpen;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Pointer to the first mapped byte (nullptr for an empty or unopened file).
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const char* Data() const
+		{
+			return m_Data;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Size of the mapped file in bytes.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] size_t Size() const
+		{
+			return m_Size;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Mapped contents as a character view.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::string_view View() const
+		{
+			return { m_Data, m_Size };
+		}
+
+	private:
+		//-----------------------------------------------------------------------------
+		/*! \brief Releases the mapping and platform handles, resets to an unopened state.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Close();
+
+		//
+		// ==================================
+		//
+
+		const char* m_Data{ nullptr };        //!> first mapped byte
+		size_t      m_Size{ 0 };              //!> mapped size in bytes
+		bool        m_IsOpen{ false };        //!> true if file was opened and mapped
+		void*       m_FileHandle{ nullptr };  //!> platform file handle (HANDLE on Windows)
+		void*       m_MapHandle{ nullptr };   //!> platform mapping handle (Windows only)
+		int         m_FileDescriptor{ -1 };   //!> POSIX file descriptor
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,255 @@
+/*! \file  MeshProcessingPipeline.cpp
+ *  \brief Implementation of an object for batch processing of mesh files in a pipeline of concurrent stages
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "MeshProcessingPipeline.h"
+#include "BaseGeometryExportHandle.h"
+#include "BaseGeometryImportHandle.h"
+#include "OBJExporter.h"
+#include "OBJImporter.h"
+#include "PLYExporter.h"
+#include "VTKExporter.h"
+#include "VTKImporter.h"
+
+#include "Symplekt_UtilityGeneral/BoundedQueue.h"
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//=============================================================================
+	/// \struct MeshPipelineItem
+	/// \brief A mesh in flight between two pipeline stages.
+	//=============================================================================
+	struct MeshPipelineItem
+	{
+		size_t                      JobId{ 0 };
+		GeometryIOData              IOData{};
+		ReferencedMeshGeometryData  MeshData{};
+	};
+
+	using MeshPipelineQueue = Util::BoundedQueue<MeshPipelineItem>;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Imports a file with a supported extension into caller-owned data.
+	 *  \param[in] filePath          input file path.
+	 *  \param[in] data              imported data.
+	 *  \return Import status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static ImportStatus ImportFileByExtension(const std::filesystem::path& filePath, GeometryIOData& data)
+	{
+		if (filePath.extension() == ".obj")
+			return OBJImporter::Import(filePath, data);
+		if (filePath.extension() == ".vtk")
+			return VTKImporter::Import(filePath, data);
+
+		return ImportStatus::InvalidExtension;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Exports data into a file with a supported extension.
+	 *  \param[in] data              exported data.
+	 *  \param[in] filePath          output file path.
+	 *  \return Export status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static ExportStatus ExportFileByExtension(const GeometryIOData& data, const std::filesystem::path& filePath)
+	{
+		if (filePath.extension() == ".vtk")
+			return VTKExporter::Export(data, filePath);
+		if (filePath.extension() == ".obj")
+			return OBJExporter::Export(data, filePath);
+		if (filePath.extension() == ".ply")
+			return PLYExporter::Export(data, filePath);
+
+		return ExportStatus::InvalidExtension;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Returns a worker count, replacing 0 with the number of available threads.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static size_t ResolveWorkerCount(const size_t& workerCount)
+	{
+		return workerCount > 0 ? workerCount : Util::GetParallelThreadCount();
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Starts worker threads of a single stage. The worker that finishes last closes the output queue
+	 *         of the stage, so that the workers of the next stage finish after draining it.
+	 *  \param[in] threads           container of pipeline threads.
+	 *  \param[in] workerCount       number of workers of this stage.
+	 *  \param[in] workerLoop        worker loop (must not throw).
+	 *  \param[in] outputQueue       output queue of this stage (nullptr for the last stage).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void StartStageWorkers(
+		std::vector<std::thread>&     threads,
+		const size_t&                 workerCount,
+		const std::function<void()>&  workerLoop,
+		MeshPipelineQueue*            outputQueue)
+	{
+		const auto runningWorkers = std::make_shared<std::atomic<size_t>>(workerCount);
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			threads.emplace_back([workerLoop, runningWorkers, outputQueue]()
+			{
+				workerLoop();
+				if (runningWorkers->fetch_sub(1) == 1 && outputQueue)
+					outputQueue->Close();
+			});
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Pops items from an input queue until it is closed and drained, processes them and pushes them into an output queue.
+	 *         Exceptions thrown while processing an item are stored in its job result, and the item is dropped.
+	 *  \param[in] inputQueue        input queue of this stage.
+	 *  \param[in] outputQueue       output queue of this stage (nullptr for the last stage).
+	 *  \param[in] results           job results.
+	 *  \param[in] processItem       item job, returns false if the item should not proceed to the next stage.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void RunQueueWorkerLoop(
+		MeshPipelineQueue&                                inputQueue,
+		MeshPipelineQueue*                                outputQueue,
+		std::vector<MeshPipelineJobResult>&               results,
+		const std::function<bool(MeshPipelineItem&)>&     processItem)
+	{
+		while (auto item = inputQueue.Pop())
+		{
+			try
+			{
+				if (processItem(*item) && outputQueue)
+					outputQueue->Push(std::move(*item));
+			}
+			catch (const std::exception& ex)
+			{
+				results[item->JobId].ErrorMessage = ex.what();
+			}
+			catch (...)
+			{
+				results[item->JobId].ErrorMessage = "MeshProcessingPipeline: unknown exception!";
+			}
+		}
+	}
+
+	MeshProcessingPipeline::MeshProcessingPipeline(const MeshPipelineSettings& settings)
+		: m_Settings(settings)
+	{
+		m_Settings.ReadWorkerCount = ResolveWorkerCount(settings.ReadWorkerCount);
+		m_Settings.BuildWorkerCount = ResolveWorkerCount(settings.BuildWorkerCount);
+		m_Settings.ProcessWorkerCount = ResolveWorkerCount(settings.ProcessWorkerCount);
+		m_Settings.WriteWorkerCount = ResolveWorkerCount(settings.WriteWorkerCount);
+	}
+
+	std::vector<MeshPipelineJobResult> MeshProcessingPipeline::Run(const std::vector<MeshPipelineJob>& jobs, const MeshProcessingCallback& processingCallback) const
+	{
+		std::vector<MeshPipelineJobResult> results(jobs.size());
+		if (jobs.empty())
+			return results;
+
+		MeshPipelineQueue buildQueue(m_Settings.QueueCapacity);
+		MeshPipelineQueue processQueue(m_Settings.QueueCapacity);
+		MeshPipelineQueue writeQueue(m_Settings.QueueCapacity);
+		std::atomic<size_t> nextJobId{ 0 };
+
+		// each job result is only accessed by the worker currently holding the job
+		const auto readLoop = [&]()
+		{
+			for (size_t jobId = nextJobId++; jobId < jobs.size(); jobId = nextJobId++)
+			{
+				MeshPipelineItem item{ jobId };
+				try
+				{
+					results[jobId].ReadStatus = ImportFileByExtension(jobs[jobId].InputFilePath, item.IOData);
+				}
+				catch (const std::exception& ex)
+				{
+					results[jobId].ReadStatus = ImportStatus::InternalError;
+					results[jobId].ErrorMessage = ex.what();
+				}
+				catch (...)
+				{
+					results[jobId].ReadStatus = ImportStatus::InternalError;
+					results[jobId].ErrorMessage = "MeshProcessingPipeline: unknown exception!";
+				}
+
+				if (results[jobId].ReadStatus == ImportStatus::Complete)
+					buildQueue.Push(std::move(item));
+			}
+		};
+
+		const auto buildLoop = [&]()
+		{
+			RunQueueWorkerLoop(buildQueue, &processQueue, results, [](MeshPipelineItem& item)
+			{
+				item.MeshData = ConvertIODataToReferencedMeshGeometryData(std::move(item.IOData));
+				return true;
+			});
+		};
+
+		const auto processLoop = [&]()
+		{
+			RunQueueWorkerLoop(processQueue, &writeQueue, results, [&processingCallback](MeshPipelineItem& item)
+			{
+				if (processingCallback)
+					processingCallback(item.MeshData);
+				return true;
+			});
+		};
+
+		const auto writeLoop = [&]()
+		{
+			RunQueueWorkerLoop(writeQueue, nullptr, results, [&jobs, &results](MeshPipelineItem& item)
+			{
+				const auto exportedData = ConvertReferencedMeshGeometryDataToIOData(item.MeshData);
+
+				auto& result = results[item.JobId];
+				result.WriteStatus = ExportFileByExtension(exportedData, jobs[item.JobId].OutputFilePath);
+				result.Completed = (result.WriteStatus == ExportStatus::Complete);
+				return true;
+			});
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(m_Settings.ReadWorkerCount + m_Settings.BuildWorkerCount + m_Settings.ProcessWorkerCount + m_Settings.WriteWorkerCount);
+		StartStageWorkers(threads, m_Settings.WriteWorkerCount, writeLoop, nullptr);
+		StartStageWorkers(threads, m_Settings.ProcessWorkerCount, processLoop, &writeQueue);
+		StartStageWorkers(threads, m_Settings.BuildWorkerCount, buildLoop, &processQueue);
+		StartStageWorkers(threads, m_Settings.ReadWorkerCount, readLoop, &buildQueue);
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return results;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*! \file  MeshProcessingPipeline.h
+ *  \brief Object for batch processing of mesh files in a pipeline of concurrent import, build, processing and export stages
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "IOHelperTypes.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \struct MeshPipelineSettings
+	/// \brief Settings for MeshProcessingPipeline. Worker counts equal to 0 are replaced by Util::GetParallelThreadCount().
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct MeshPipelineSettings
+	{
+		size_t ReadWorkerCount{ 1 };       //!< number of threads reading and parsing input files
+		size_t BuildWorkerCount{ 0 };      //!< number of threads building ReferencedMeshGeometryData
+		size_t ProcessWorkerCount{ 0 };    //!< number of threads running the processing callback
+		size_t WriteWorkerCount{ 1 };      //!< number of threads serializing and writing output files
+		size_t QueueCapacity{ 4 };         //!< maximum number of meshes waiting between two consecutive stages
+	};
+
+	//=============================================================================
+	/// \struct MeshPipelineJob
+	/// \brief A single pipeline job: an input file (*.obj, *.vtk) and an output file (*.vtk, *.obj, *.ply).
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct MeshPipelineJob
+	{
+		std::filesystem::path InputFilePath;
+		std::filesystem::path OutputFilePath;
+	};
+
+	//=============================================================================
+	/// \struct MeshPipelineJobResult
+	/// \brief Result of a single pipeline job. A job failing in one of the stages does not proceed to the next stages.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct MeshPipelineJobResult
+	{
+		ImportStatus ReadStatus{ ImportStatus::InternalError };     //!< status of input file import
+		ExportStatus WriteStatus{ ExportStatus::InternalError };    //!< status of output file export
+		bool         Completed{ false };                            //!< true if the output file was written
+		std::string  ErrorMessage{};                                //!< message of an exception thrown while processing the job
+	};
+
+	/// \brief Processing callback called on each built mesh (concurrently from ProcessWorkerCount threads)
+	using MeshProcessingCallback = std::function<void(GeometryKernel::ReferencedMeshGeometryData&)>;
+
+	//=============================================================================
+	/// \class MeshProcessingPipeline
+	/// \brief Processes a batch of mesh files in four stages: read/parse, build, user-supplied processing, and serialize/write.
+	///        Each stage runs on its own pool of worker threads, and consecutive stages are connected by bounded queues,
+	///        so that many meshes are in flight at once (e.g.: files are parsed while other meshes are being built)
+	///        while the number of meshes held in memory stays limited. The throughput of the batch is then limited
+	///        by the slowest stage rather than by the sum of all stages.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class MeshProcessingPipeline
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		 *  \param[in] settings          pipeline settings.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		explicit MeshProcessingPipeline(const MeshPipelineSettings& settings = {});
+
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Runs all jobs through the pipeline and waits until they are finished.
+		 *  \param[in] jobs                  input and output file paths.
+		 *  \param[in] processingCallback    callback processing each built mesh (may be empty).
+		 *  \return job results (in the order of jobs)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::vector<MeshPipelineJobResult> Run(const std::vector<MeshPipelineJob>& jobs, const MeshProcessingCallback& processingCallback = {}) const;
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Settings getter (with worker counts already resolved)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] const MeshPipelineSettings& Settings() const
+		{
+			return m_Settings;
+		}
+
+	private:
+		//
+		// ==================================
+		//
+
+		MeshPipelineSettings m_Settings; //!> pipeline settings
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -90,7 +90,7 @@ namespace Symplektis::IOService
 			if (iNormal > -1) normalIndices.push_back(iNormal);
 		}
 
-		polyIndexBuffer.emplace_back(polyIndices);
+		polyIndexBuffer.emplace_back(std::move(polyIndices));
 		if (!textureIndices.empty()) polyIndexBuffer.emplace_back(textureIndices);
 		if (!normalIndices.empty()) polyIndexBuffer.emplace_back(normalIndices);
 	}
@@ -110,6 +110,11 @@ namespace Symplektis::IOService
 	}
 	
 	ImportStatus OBJImporter::Import(const std::filesystem::path& importedFilePath)
+	{
+		return Import(importedFilePath, m_Data);
+	}
+
+	ImportStatus OBJImporter::Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData)
 	{
 		if (importedFilePath.empty() || !exists(importedFilePath))
 			return ImportStatus::FileNotFound;
@@ -121,8 +126,8 @@ namespace Symplektis::IOService
 		if (!fileInStream.is_open())
 			return ImportStatus::FileNotOpened;
 
-		ClearIOData();
-		m_Data.Name = GetGeometryNameFromFilePath(importedFilePath);
+		importedData.Clear();
+		importedData.Name = GetGeometryNameFromFilePath(importedFilePath);
 
 		std::vector<std::vector<unsigned int>> textureIndices{};
 		std::vector<std::vector<unsigned int>> normalIndices{};
@@ -139,7 +144,7 @@ namespace Symplektis::IOService
 
 			if (token == "v")
 			{
-				ReadVector3Line(sStream, m_Data.Vertices);
+				ReadVector3Line(sStream, importedData.Vertices);
 				lineNumber++;
 				continue;
 			}
@@ -157,7 +162,7 @@ namespace Symplektis::IOService
 			}
 			if (token == "f")
 			{
-				ReadVertexIndices(sStream, m_Data.VertexIndices, textureIndices, normalIndices);
+				ReadVertexIndices(sStream, importedData.VertexIndices, textureIndices, normalIndices);
 				lineNumber++;
 				continue;
 			}
@@ -202,7 +207,7 @@ namespace Symplektis::IOService
 			return ImportStatus::InternalError;
 		}
 
-		PostProcessVertexNormalsFromIndices(normalIndices, nonIndexedVertexNormals);
+		PostProcessVertexNormalsFromIndices(normalIndices, nonIndexedVertexNormals, importedData);
 
 		// TODO: Do something with textureIndices
 
@@ -254,22 +259,23 @@ namespace Symplektis::IOService
 
 	void OBJImporter::PostProcessVertexNormalsFromIndices(
 		const std::vector<std::vector<unsigned int>>&  collectedNormalIndices,
-		const std::vector<Vector3>&                    nonIndexedVertexNormals)
+		const std::vector<Vector3>&                    nonIndexedVertexNormals,
+		GeometryIOData&                                data)
 	{
 		if (nonIndexedVertexNormals.empty())
 			return; // do nothing. There are no normals indexed or non-indexed.
 
 		if (collectedNormalIndices.empty())
 		{
-			if (nonIndexedVertexNormals.size() == m_Data.Vertices.size())
+			if (nonIndexedVertexNormals.size() == data.Vertices.size())
 			{
 				// assuming that there is already a one-to-one correspondence between vertices and vertex normals.
-				m_Data.VertexNormals = nonIndexedVertexNormals;
+				data.VertexNormals = nonIndexedVertexNormals;
 				return;
 			}
 			
 			size_t totalVertexIndexCount = 0;
-			for (const auto & indexTuple : m_Data.VertexIndices) totalVertexIndexCount += indexTuple.size();
+			for (const auto & indexTuple : data.VertexIndices) totalVertexIndexCount += indexTuple.size();
 
 			if (nonIndexedVertexNormals.size() != totalVertexIndexCount)
 			{
@@ -286,13 +292,13 @@ namespace Symplektis::IOService
 			// ===== computing vertex normals according to vertex index tuples =================================================
 			//
 
-			const size_t verticesCount = m_Data.Vertices.size();
+			const size_t verticesCount = data.Vertices.size();
 
 			// pre-define the same number of normals as vertices
 			std::vector<Vector3> resultNormals(verticesCount);
 			std::map<unsigned int, bool> vertexHasNormal = GetVerticesWithoutNormals(verticesCount);
 
-			for (unsigned int normalIndex = 0; auto& indexTuple : m_Data.VertexIndices)
+			for (unsigned int normalIndex = 0; auto& indexTuple : data.VertexIndices)
 			{
 				for (auto & index : indexTuple)
 				{
@@ -315,7 +321,7 @@ namespace Symplektis::IOService
 
 			if (VerticesWithoutNormalsExist(vertexHasNormal)) return;
 
-			m_Data.VertexNormals = resultNormals;
+			data.VertexNormals = resultNormals;
 			return;
 		}
 
@@ -324,7 +330,7 @@ namespace Symplektis::IOService
 		// ===== computing vertex normals according to normal index tuples =================================================
 		//        >>>>>>  TODO: Test on actual data. No data of this kind was tested yet <<<<<< 
 
-		const size_t verticesCount = m_Data.Vertices.size();
+		const size_t verticesCount = data.Vertices.size();
 		
 		// pre-define the same number of normals as vertices
 		std::vector<Vector3> resultNormals(verticesCount); 
@@ -352,7 +358,7 @@ namespace Symplektis::IOService
 					return;
 				}
 
-				const unsigned int vertexIndex = m_Data.VertexIndices[faceIndex][tupleIndex];
+				const unsigned int vertexIndex = data.VertexIndices[faceIndex][tupleIndex];
 				resultNormals[vertexIndex] = nonIndexedVertexNormals[index];
 				vertexHasNormal[vertexIndex] = true;
 
@@ -364,7 +370,7 @@ namespace Symplektis::IOService
 
 		if (VerticesWithoutNormalsExist(vertexHasNormal)) return;
 
-		m_Data.VertexNormals = resultNormals;
+		data.VertexNormals = resultNormals;
 	}
 
 	
@@ -41,6 +41,18 @@ namespace Symplektis::IOService
 		//-----------------------------------------------------------------------------
 		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath);
 
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.obj file from a given path into caller-owned data, e.g.: to be moved into a geometry builder afterwards.
+		 *  \param[in] importedFilePath          path to an *.obj file.
+		 *  \param[in] importedData              imported data (cleared first).
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData);
+
 		/// @{
 		/// \name Getters
 
@@ -75,6 +87,7 @@ namespace Symplektis::IOService
 		/*! \brief Re-defines vertex normal array if normal indices were found.
 		 *  \param[in] collectedNormalIndices       normal indices [n] collected from "p/[t]/[n]" tokens.
 		 *  \param[in] nonIndexedVertexNormals      raw normal buffer not indexed yet (may be of different size than vertices buffer).
+		 *  \param[in] data                         imported data.
 		*
 		*   \author M. Cavarga (MCInversion)
 		*   \date   13.10.2021
@@ -82,7 +95,8 @@ namespace Symplektis::IOService
 		//-----------------------------------------------------------------------------
 		static void PostProcessVertexNormalsFromIndices(
 			const std::vector<std::vector<unsigned int>>&  collectedNormalIndices,
-			const std::vector<GeometryKernel::Vector3>&      nonIndexedVertexNormals);
+			const std::vector<GeometryKernel::Vector3>&      nonIndexedVertexNormals,
+			GeometryIOData&                                  data);
 
 		//
 		// ==================================
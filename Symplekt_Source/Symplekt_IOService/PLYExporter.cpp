@@ -0,0 +1,209 @@
+/*! \file  PLYExporter.cpp
+ *  \brief Implementation of an object for exporting 3D geometry data to Stanford PLY (*.ply) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "PLYExporter.h"
+#include "PLYFormatUtils.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+
+namespace Symplektis::IOService
+{
+	//!> \brief precision for double values written into an ASCII .ply file
+	constexpr unsigned int stream_precision = 17;
+
+	//!> \brief precision for float values written into an ASCII .ply file
+	constexpr unsigned int stream_precision_float = 9;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes the *.ply header.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] data           exported GeometryIOData.
+	 *  \param[in] settings       export settings.
+	 *  \param[in] hasNormals     if true, nx, ny, nz vertex properties are declared.
+	 *  \param[in] countType      face list count type name.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteHeader(std::ofstream& fileOStream, const GeometryIOData& data, const PLYExportSettings& settings,
+		const bool hasNormals, const std::string& countType)
+	{
+		fileOStream << "ply\n";
+		if (settings.Format == PLYDataFormat::ASCII)
+			fileOStream << "format ascii 1.0\n";
+		else if (settings.Format == PLYDataFormat::BinaryLittleEndian)
+			fileOStream << "format binary_little_endian 1.0\n";
+		else
+			fileOStream << "format binary_big_endian 1.0\n";
+
+		fileOStream << "comment Symplektis export\n";
+
+		const std::string scalarType = (settings.ScalarType == PLYScalarType::Float32 ? "float" : "double");
+		fileOStream << "element vertex " << data.Vertices.size() << "\n";
+		fileOStream << "property " << scalarType << " x\n" << "property " << scalarType << " y\n" << "property " << scalarType << " z\n";
+		if (hasNormals)
+			fileOStream << "property " << scalarType << " nx\n" << "property " << scalarType << " ny\n" << "property " << scalarType << " nz\n";
+
+		if (!data.VertexIndices.empty())
+		{
+			fileOStream << "element face " << data.VertexIndices.size() << "\n";
+			fileOStream << "property list " << countType << " int vertex_indices\n";
+		}
+
+		fileOStream << "end_header\n";
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a binary *.ply body.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] data           exported GeometryIOData.
+	 *  \param[in] settings       export settings.
+	 *  \param[in] hasNormals     if true, vertex normals are written.
+	 *  \param[in] maxPolygonSize maximum number of polygon vertices (determines the face list count type).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteBinaryBody(std::ofstream& fileOStream, const GeometryIOData& data, const PLYExportSettings& settings,
+		const bool hasNormals, const size_t maxPolygonSize)
+	{
+		const auto fileByteOrder = (settings.Format == PLYDataFormat::BinaryLittleEndian ? std::endian::little : std::endian::big);
+		PLYBinaryWriter writer(fileOStream, fileByteOrder != std::endian::native);
+
+		const auto writeScalar = [&writer, &settings](const double value)
+		{
+			if (settings.ScalarType == PLYScalarType::Float32)
+				writer.Write(static_cast<float>(value));
+			else
+				writer.Write(value);
+		};
+
+		for (size_t i = 0; i < data.Vertices.size(); i++)
+		{
+			writeScalar(data.Vertices[i].X());
+			writeScalar(data.Vertices[i].Y());
+			writeScalar(data.Vertices[i].Z());
+			if (!hasNormals)
+				continue;
+
+			writeScalar(data.VertexNormals[i].X());
+			writeScalar(data.VertexNormals[i].Y());
+			writeScalar(data.VertexNormals[i].Z());
+		}
+
+		for (const auto& polygon : data.VertexIndices)
+		{
+			if (maxPolygonSize <= std::numeric_limits<uint8_t>::max())
+				writer.Write(static_cast<uint8_t>(polygon.size()));
+			else if (maxPolygonSize <= std::numeric_limits<uint16_t>::max())
+				writer.Write(static_cast<uint16_t>(polygon.size()));
+			else
+				writer.Write(static_cast<uint32_t>(polygon.size()));
+
+			for (const auto& index : polygon)
+				writer.Write(static_cast<int32_t>(index));
+		}
+
+		writer.Flush();
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes an ASCII *.ply body.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] data           exported GeometryIOData.
+	 *  \param[in] settings       export settings.
+	 *  \param[in] hasNormals     if true, vertex normals are written.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteASCIIBody(std::ofstream& fileOStream, const GeometryIOData& data, const PLYExportSettings& settings, const bool hasNormals)
+	{
+		const bool isFloat = (settings.ScalarType == PLYScalarType::Float32);
+		fileOStream.precision(isFloat ? stream_precision_float : stream_precision);
+
+		const auto writeVector = [&fileOStream, isFloat](const GeometryKernel::Vector3& vec)
+		{
+			if (isFloat)
+				fileOStream << static_cast<float>(vec.X()) << " " << static_cast<float>(vec.Y()) << " " << static_cast<float>(vec.Z());
+			else
+				fileOStream << vec.X() << " " << vec.Y() << " " << vec.Z();
+		};
+
+		for (size_t i = 0; i < data.Vertices.size(); i++)
+		{
+			writeVector(data.Vertices[i]);
+			if (hasNormals)
+			{
+				fileOStream << " ";
+				writeVector(data.VertexNormals[i]);
+			}
+			fileOStream << "\n";
+		}
+
+		for (const auto& polygon : data.VertexIndices)
+		{
+			fileOStream << polygon.size();
+			for (const auto& index : polygon)
+				fileOStream << " " << index;
+			fileOStream << "\n";
+		}
+	}
+
+	ExportStatus PLYExporter::Export(const GeometryIOData& data, const std::filesystem::path& exportedFileName, const PLYExportSettings& settings)
+	{
+		std::filesystem::path resultPath = exportedFileName;
+
+		if (exportedFileName.extension().empty())
+			resultPath += ".ply";
+
+		else if (exportedFileName.extension() != ".ply")
+			return ExportStatus::InvalidExtension;
+
+		// PLY without vertices is invalid, and face indices are written as "int" properties
+		if (data.Vertices.empty() || data.Vertices.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+		{
+			MSG_CHECK(false, "PLYExporter::Export: Exporting data with no vertices or too many vertices!\n");
+			return ExportStatus::InternalError;
+		}
+
+		const bool hasNormals = (data.VertexNormals.size() == data.Vertices.size());
+		if (!hasNormals && !data.VertexNormals.empty())
+			MSG_CHECK(false, "PLYExporter::Export: Vertex normals buffer is of different size than vertex buffer. Vertex normals will not be exported!\n");
+
+		size_t maxPolygonSize = 0;
+		for (const auto& polygon : data.VertexIndices)
+			maxPolygonSize = std::max(maxPolygonSize, polygon.size());
+
+		const std::string countType =
+			(maxPolygonSize <= std::numeric_limits<uint8_t>::max() ? "uchar" : (maxPolygonSize <= std::numeric_limits<uint16_t>::max() ? "ushort" : "uint"));
+
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+			return ExportStatus::FileNotCreated;
+
+		WriteHeader(fileOStream, data, settings, hasNormals, countType);
+		if (settings.Format == PLYDataFormat::ASCII)
+			WriteASCIIBody(fileOStream, data, settings, hasNormals);
+		else
+			WriteBinaryBody(fileOStream, data, settings, hasNormals, maxPolygonSize);
+
+		fileOStream.close();
+		return ExportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
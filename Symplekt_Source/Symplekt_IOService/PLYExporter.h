@@ -0,0 +1,94 @@
+/*! \file  PLYExporter.h
+ *  \brief Object for exporting 3D geometry data to Stanford PLY (*.ply) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \enum PLYDataFormat
+	/// \brief Storage format of the *.ply file body
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class PLYDataFormat
+	{
+		ASCII              = 0,    //!< human-readable values ("format ascii 1.0"), slow and large.
+		BinaryLittleEndian = 1,    //!< raw binary values ("format binary_little_endian 1.0").
+		BinaryBigEndian    = 2,    //!< raw binary values ("format binary_big_endian 1.0").
+	};
+
+	//=============================================================================
+	/// \enum PLYScalarType
+	/// \brief Floating point type of the exported vertex coordinates and normals
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class PLYScalarType
+	{
+		Float32 = 0,    //!< "float" properties (half the size, lossy).
+		Float64 = 1,    //!< "double" properties (lossless).
+	};
+
+	//=============================================================================
+	/// \struct PLYExportSettings
+	/// \brief Settings for PLYExporter
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct PLYExportSettings
+	{
+		PLYDataFormat Format{ PLYDataFormat::BinaryLittleEndian };
+		PLYScalarType ScalarType{ PLYScalarType::Float64 };
+	};
+
+	//=============================================================================
+	/// \class PLYExporter
+	/// \brief An exporter singleton object for exporting geometry data to a Stanford *.ply file.
+	///        Vertex normals are written as nx, ny, nz vertex properties if there is one normal per vertex.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class PLYExporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports a Stanford *.ply file to a given path.
+		 *  \param[in] data                      exported GeometryIOData
+		 *  \param[in] exportedFileName          *.ply file name.
+		 *  \param[in] settings                  data format settings (binary little endian Float64 by default).
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(const GeometryIOData& data, const std::filesystem::path& exportedFileName, const PLYExportSettings& settings = {});
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
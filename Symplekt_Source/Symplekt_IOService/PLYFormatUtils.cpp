@@ -0,0 +1,197 @@
+/*! \file  PLYFormatUtils.cpp
+ *  \brief Implementation of types and utilities shared by Stanford PLY (*.ply) readers and writers
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "PLYFormatUtils.h"
+
+#include <bit>
+#include <cctype>
+#include <charconv>
+
+namespace Symplektis::IOService
+{
+	//-----------------------------------------------------------------------------
+	/*! \brief Parses a PLY property type name.
+	 *  \param[in] name           type name (e.g.: "uchar" or "uint8").
+	 *  \return PLYPropertyType if valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::optional<PLYPropertyType> ParsePropertyType(const std::string_view& name)
+	{
+		if (name == "char" || name == "int8") return PLYPropertyType::Int8;
+		if (name == "uchar" || name == "uint8") return PLYPropertyType::UInt8;
+		if (name == "short" || name == "int16") return PLYPropertyType::Int16;
+		if (name == "ushort" || name == "uint16") return PLYPropertyType::UInt16;
+		if (name == "int" || name == "int32") return PLYPropertyType::Int32;
+		if (name == "uint" || name == "uint32") return PLYPropertyType::UInt32;
+		if (name == "float" || name == "float32") return PLYPropertyType::Float32;
+		if (name == "double" || name == "float64") return PLYPropertyType::Float64;
+		return std::nullopt;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Splits a header line into whitespace-separated tokens.
+	 *  \param[in] line           header line.
+	 *  \return tokens
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<std::string_view> SplitHeaderLine(const std::string_view& line)
+	{
+		std::vector<std::string_view> tokens;
+		size_t pos = 0;
+		while (pos < line.size())
+		{
+			while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos])))
+				pos++;
+
+			const size_t tokenStart = pos;
+			while (pos < line.size() && !std::isspace(static_cast<unsigned char>(line[pos])))
+				pos++;
+
+			if (pos > tokenStart)
+				tokens.push_back(line.substr(tokenStart, pos - tokenStart));
+		}
+		return tokens;
+	}
+
+	size_t GetPropertyTypeSize(const PLYPropertyType& type)
+	{
+		switch (type)
+		{
+		case PLYPropertyType::Int8:
+		case PLYPropertyType::UInt8: return 1;
+		case PLYPropertyType::Int16:
+		case PLYPropertyType::UInt16: return 2;
+		case PLYPropertyType::Int32:
+		case PLYPropertyType::UInt32:
+		case PLYPropertyType::Float32: return 4;
+		case PLYPropertyType::Float64: return 8;
+		}
+		return 0;
+	}
+
+	std::optional<PLYHeader> ParseHeader(const std::string_view& contents)
+	{
+		PLYHeader header;
+		bool formatFound = false;
+		size_t pos = 0;
+		for (bool isFirstLine = true; pos < contents.size(); isFirstLine = false)
+		{
+			size_t lineEnd = contents.find('\n', pos);
+			if (lineEnd == std::string_view::npos)
+				return std::nullopt;
+
+			std::string_view line = contents.substr(pos, lineEnd - pos);
+			if (!line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+			pos = lineEnd + 1;
+
+			if (isFirstLine)
+			{
+				if (line != "ply")
+					return std::nullopt;
+				continue;
+			}
+
+			const auto tokens = SplitHeaderLine(line);
+			if (tokens.empty() || tokens[0] == "comment" || tokens[0] == "obj_info")
+				continue;
+
+			if (tokens[0] == "end_header")
+			{
+				if (!formatFound)
+					return std::nullopt;
+
+				header.BodyOffset = pos;
+				return header;
+			}
+
+			if (tokens[0] == "format" && tokens.size() >= 2)
+			{
+				if (tokens[1] != "ascii" && tokens[1] != "binary_little_endian" && tokens[1] != "binary_big_endian")
+					return std::nullopt;
+
+				header.IsBinary = (tokens[1] != "ascii");
+				if (tokens[1] == "binary_little_endian")
+					header.SwapBytes = (std::endian::native != std::endian::little);
+				if (tokens[1] == "binary_big_endian")
+					header.SwapBytes = (std::endian::native != std::endian::big);
+
+				formatFound = true;
+				continue;
+			}
+
+			if (tokens[0] == "element" && tokens.size() == 3)
+			{
+				PLYElement element;
+				element.Name = tokens[1];
+				const auto [ptr, errCode] = std::from_chars(tokens[2].data(), tokens[2].data() + tokens[2].size(), element.Count);
+				if (errCode != std::errc())
+					return std::nullopt;
+
+				header.Elements.emplace_back(std::move(element));
+				continue;
+			}
+
+			if (tokens[0] == "property" && !header.Elements.empty())
+			{
+				PLYProperty property;
+				if (tokens.size() == 5 && tokens[1] == "list")
+				{
+					const auto countType = ParsePropertyType(tokens[2]);
+					const auto itemType = ParsePropertyType(tokens[3]);
+					if (!countType || !itemType || *countType == PLYPropertyType::Float32 || *countType == PLYPropertyType::Float64)
+						return std::nullopt;
+
+					property.IsList = true;
+					property.CountType = *countType;
+					property.Type = *itemType;
+					property.Name = tokens[4];
+				}
+				else if (tokens.size() == 3)
+				{
+					const auto type = ParsePropertyType(tokens[1]);
+					if (!type)
+						return std::nullopt;
+
+					property.Type = *type;
+					property.Name = tokens[2];
+				}
+				else
+					return std::nullopt;
+
+				header.Elements.back().Properties.push_back(property);
+				continue;
+			}
+
+			return std::nullopt;
+		}
+
+		return std::nullopt;
+	}
+
+	size_t GetVertexSlot(const PLYProperty& property)
+	{
+		if (property.IsList)
+			return vertex_slot_count;
+
+		return static_cast<size_t>(std::find(vertex_slot_names.begin(), vertex_slot_names.end(), property.Name) - vertex_slot_names.begin());
+	}
+
+	bool IsFaceIndexList(const PLYProperty& property)
+	{
+		return property.IsList && (property.Name == "vertex_indices" || property.Name == "vertex_index") &&
+			property.Type != PLYPropertyType::Float32 && property.Type != PLYPropertyType::Float64;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
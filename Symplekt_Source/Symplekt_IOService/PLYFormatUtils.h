@@ -0,0 +1,292 @@
+/*! \file  PLYFormatUtils.h
+ *  \brief Types and utilities shared by Stanford PLY (*.ply) readers and writers
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	//!> \brief number of imported vertex property slots: x, y, z, nx, ny, nz
+	inline constexpr size_t vertex_slot_count = 6;
+
+	//!> \brief names of imported vertex properties, in slot order
+	inline constexpr std::array<std::string_view, vertex_slot_count> vertex_slot_names{ "x", "y", "z", "nx", "ny", "nz" };
+
+	//=============================================================================
+	/// \enum PLYPropertyType
+	/// \brief Scalar types of PLY properties.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class PLYPropertyType
+	{
+		Int8    = 0,
+		UInt8   = 1,
+		Int16   = 2,
+		UInt16  = 3,
+		Int32   = 4,
+		UInt32  = 5,
+		Float32 = 6,
+		Float64 = 7
+	};
+
+	//=============================================================================
+	/// \struct PLYProperty
+	/// \brief A property declared in the *.ply header. List properties store a count followed by count items.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct PLYProperty
+	{
+		std::string_view Name;
+		PLYPropertyType  Type{ PLYPropertyType::Float32 };       //!> scalar type (item type for lists)
+		bool             IsList{ false };
+		PLYPropertyType  CountType{ PLYPropertyType::UInt8 };    //!> list count type (lists only)
+	};
+
+	//=============================================================================
+	/// \struct PLYElement
+	/// \brief An element declared in the *.ply header.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct PLYElement
+	{
+		std::string_view         Name;
+		size_t                   Count{ 0 };
+		std::vector<PLYProperty> Properties;
+	};
+
+	//=============================================================================
+	/// \struct PLYHeader
+	/// \brief Parsed *.ply header.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct PLYHeader
+	{
+		bool                    IsBinary{ false };
+		bool                    SwapBytes{ false };    //!> true if file byte order differs from native byte order
+		std::vector<PLYElement> Elements;
+		size_t                  BodyOffset{ 0 };       //!> position of the first byte after "end_header"
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Byte size of a PLY property type.
+	 *  \param[in] type           property type.
+	 *  \return number of bytes
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	size_t GetPropertyTypeSize(const PLYPropertyType& type);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parses the *.ply header.
+	 *  \param[in] contents       file contents.
+	 *  \return parsed PLYHeader, or std::nullopt if the header is invalid.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	std::optional<PLYHeader> ParseHeader(const std::string_view& contents);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Returns the vertex slot (index into vertex_slot_names) of a vertex property, or vertex_slot_count if the property is not imported.
+	 *  \param[in] property       vertex element property.
+	 *  \return slot index
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	size_t GetVertexSlot(const PLYProperty& property);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Returns true if a face element property holds the polygon vertex indices.
+	 *  \param[in] property       face element property.
+	 *  \return true if the property is an integer list of vertex indices.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	bool IsFaceIndexList(const PLYProperty& property);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Loads an unaligned binary value.
+	 *  \param[in] src            first byte of the value.
+	 *  \return loaded value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename T, bool SwapBytes>
+	T LoadValue(const char* src)
+	{
+		std::array<char, sizeof(T)> bytes;
+		std::memcpy(bytes.data(), src, sizeof(T));
+		if constexpr (SwapBytes)
+			std::reverse(bytes.begin(), bytes.end());
+
+		T value;
+		std::memcpy(&value, bytes.data(), sizeof(T));
+		return value;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts a strided sequence of binary values of a given type in one pass.
+	 *  \param[in] src            first byte of the first value.
+	 *  \param[in] srcStride      byte distance between consecutive source values.
+	 *  \param[in] count          number of converted values.
+	 *  \param[in] swapBytes      if true, the byte order of source values is reversed.
+	 *  \param[in] dst            first output value.
+	 *  \param[in] dstStride      distance between consecutive output values.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TIn, typename TOut>
+	void ConvertValues(const char* src, const size_t srcStride, const size_t count, const bool swapBytes, TOut* dst, const size_t dstStride)
+	{
+		if (swapBytes)
+		{
+			for (size_t i = 0; i < count; i++)
+				dst[i * dstStride] = static_cast<TOut>(LoadValue<TIn, true>(src + i * srcStride));
+			return;
+		}
+
+		for (size_t i = 0; i < count; i++)
+			dst[i * dstStride] = static_cast<TOut>(LoadValue<TIn, false>(src + i * srcStride));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts a strided sequence of binary values of a given PLY property type in one pass.
+	 *  \param[in] type           source property type.
+	 *  \param[in] src            first byte of the first value.
+	 *  \param[in] srcStride      byte distance between consecutive source values.
+	 *  \param[in] count          number of converted values.
+	 *  \param[in] swapBytes      if true, the byte order of source values is reversed.
+	 *  \param[in] dst            first output value.
+	 *  \param[in] dstStride      distance between consecutive output values.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TOut>
+	void ConvertValues(const PLYPropertyType& type, const char* src, const size_t srcStride, const size_t count, const bool swapBytes, TOut* dst, const size_t dstStride)
+	{
+		switch (type)
+		{
+		case PLYPropertyType::Int8: ConvertValues<int8_t>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::UInt8: ConvertValues<uint8_t>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::Int16: ConvertValues<int16_t>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::UInt16: ConvertValues<uint16_t>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::Int32: ConvertValues<int32_t>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::UInt32: ConvertValues<uint32_t>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::Float32: ConvertValues<float>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		case PLYPropertyType::Float64: ConvertValues<double>(src, srcStride, count, swapBytes, dst, dstStride); return;
+		}
+	}
+
+	//!> \brief size of the buffer collecting binary values before they are written to the file
+	inline constexpr size_t write_buffer_size = 1 << 20;
+
+	//=============================================================================
+	/// \class PLYBinaryWriter
+	/// \brief Collects binary values in a buffer (swapping bytes if needed) and writes it to a file stream in large blocks.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class PLYBinaryWriter
+	{
+	public:
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		 *  \param[in] fileOStream    output file stream.
+		 *  \param[in] swapBytes      if true, the byte order of written values is reversed.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		PLYBinaryWriter(std::ofstream& fileOStream, const bool swapBytes)
+			: m_FileOStream(fileOStream), m_SwapBytes(swapBytes)
+		{
+			m_Buffer.reserve(write_buffer_size);
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Appends a value to the buffer, and writes the buffer if it is full.
+		 *  \param[in] value          written value.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		template <typename T>
+		void Write(const T value)
+		{
+			std::array<char, sizeof(T)> bytes;
+			std::memcpy(bytes.data(), &value, sizeof(T));
+			if (m_SwapBytes)
+				std::reverse(bytes.begin(), bytes.end());
+
+			m_Buffer.insert(m_Buffer.end(), bytes.begin(), bytes.end());
+			if (m_Buffer.size() >= write_buffer_size)
+				Flush();
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Writes the buffer contents to the file stream.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Flush()
+		{
+			m_FileOStream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+
+	private:
+		std::ofstream&    m_FileOStream;
+		bool              m_SwapBytes{ false };
+		std::vector<char> m_Buffer;
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,368 @@
+/*! \file  PLYImporter.cpp
+ *  \brief Implementation of an object for importing 3D geometry data from Stanford PLY (*.ply) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "PLYImporter.h"
+
+#include "MemoryMappedFile.h"
+#include "PLYFormatUtils.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parse mesh file name from the imported file path.
+	 *  \param[in] importedFilePath     path to the imported file.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::wstring GetGeometryNameFromFilePath(const std::filesystem::path& importedFilePath)
+	{
+		const auto stem = importedFilePath.stem();
+		return stem.wstring();
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads a binary element in which all properties have a fixed size. Vertex properties are converted column by column.
+	 *  \param[in] header         parsed PLYHeader.
+	 *  \param[in] element        read element.
+	 *  \param[in] body           remaining file body.
+	 *  \param[in] vertexValues   output vertex values (vertex_slot_count per vertex), filled if element is "vertex".
+	 *  \return number of read bytes, or std::nullopt if the body is truncated.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::optional<size_t> ReadBinaryFixedSizeElement(const PLYHeader& header, const PLYElement& element, const std::string_view& body, std::vector<double>& vertexValues)
+	{
+		size_t stride = 0;
+		for (const auto& property : element.Properties)
+			stride += GetPropertyTypeSize(property.Type);
+
+		if (stride == 0)
+			return 0;
+
+		if (element.Count > body.size() / stride)
+			return std::nullopt;
+
+		if (element.Name != "vertex")
+			return element.Count * stride;
+
+		vertexValues.resize(element.Count * vertex_slot_count);
+		size_t propertyOffset = 0;
+		for (const auto& property : element.Properties)
+		{
+			if (const size_t slot = GetVertexSlot(property); slot < vertex_slot_count)
+				ConvertValues(property.Type, body.data() + propertyOffset, stride, element.Count, header.SwapBytes, vertexValues.data() + slot, vertex_slot_count);
+
+			propertyOffset += GetPropertyTypeSize(property.Type);
+		}
+
+		return element.Count * stride;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads a binary element with list properties record by record. Each list is converted in one pass.
+	 *  \param[in] header         parsed PLYHeader.
+	 *  \param[in] element        read element.
+	 *  \param[in] body           remaining file body.
+	 *  \param[in] vertexValues   output vertex values (vertex_slot_count per vertex), filled if element is "vertex".
+	 *  \param[in] vertexIndices  output polygon vertex indices, filled if element is "face".
+	 *  \return number of read bytes, or std::nullopt if the body is truncated.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::optional<size_t> ReadBinaryListElement(const PLYHeader& header, const PLYElement& element, const std::string_view& body,
+		std::vector<double>& vertexValues, std::vector<std::vector<unsigned int>>& vertexIndices)
+	{
+		// every record takes at least one byte, so that a corrupted count cannot trigger a huge allocation
+		if (element.Count > body.size())
+			return std::nullopt;
+
+		const bool isVertex = (element.Name == "vertex");
+		const bool isFace = (element.Name == "face");
+		if (isVertex)
+			vertexValues.resize(element.Count * vertex_slot_count);
+		if (isFace)
+			vertexIndices.reserve(element.Count);
+
+		size_t offset = 0;
+		for (size_t i = 0; i < element.Count; i++)
+		{
+			for (const auto& property : element.Properties)
+			{
+				if (!property.IsList)
+				{
+					const size_t size = GetPropertyTypeSize(property.Type);
+					if (size > body.size() - offset)
+						return std::nullopt;
+
+					if (const size_t slot = GetVertexSlot(property); isVertex && slot < vertex_slot_count)
+						ConvertValues(property.Type, body.data() + offset, size, 1, header.SwapBytes, &vertexValues[i * vertex_slot_count + slot], 1);
+
+					offset += size;
+					continue;
+				}
+
+				const size_t countSize = GetPropertyTypeSize(property.CountType);
+				if (countSize > body.size() - offset)
+					return std::nullopt;
+
+				int64_t count = 0;
+				ConvertValues(property.CountType, body.data() + offset, countSize, 1, header.SwapBytes, &count, 1);
+				offset += countSize;
+
+				const size_t itemSize = GetPropertyTypeSize(property.Type);
+				if (count < 0 || static_cast<size_t>(count) > (body.size() - offset) / itemSize)
+					return std::nullopt;
+
+				if (isFace && IsFaceIndexList(property))
+				{
+					std::vector<unsigned int> polygon(static_cast<size_t>(count));
+					ConvertValues(property.Type, body.data() + offset, itemSize, polygon.size(), header.SwapBytes, polygon.data(), 1);
+					vertexIndices.emplace_back(std::move(polygon));
+				}
+
+				offset += static_cast<size_t>(count) * itemSize;
+			}
+		}
+
+		return offset;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads a binary *.ply body.
+	 *  \param[in] header         parsed PLYHeader.
+	 *  \param[in] body           file body.
+	 *  \param[in] vertexValues   output vertex values (vertex_slot_count per vertex).
+	 *  \param[in] vertexIndices  output polygon vertex indices.
+	 *  \return true if the body was read
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadBinaryBody(const PLYHeader& header, const std::string_view& body,
+		std::vector<double>& vertexValues, std::vector<std::vector<unsigned int>>& vertexIndices)
+	{
+		size_t offset = 0;
+		for (const auto& element : header.Elements)
+		{
+			const bool hasLists = std::any_of(element.Properties.begin(), element.Properties.end(),
+				[](const PLYProperty& property) { return property.IsList; });
+
+			const auto readBytes = hasLists ?
+				ReadBinaryListElement(header, element, body.substr(offset), vertexValues, vertexIndices) :
+				ReadBinaryFixedSizeElement(header, element, body.substr(offset), vertexValues);
+			if (!readBytes)
+				return false;
+
+			offset += *readBytes;
+		}
+
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads the next whitespace-separated number from an ASCII *.ply body.
+	 *  \param[in] current        current position (advanced past the number).
+	 *  \param[in] end            end of the body.
+	 *  \param[in] value          output value.
+	 *  \return true if a number was read
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadASCIINumber(const char*& current, const char* end, double& value)
+	{
+		while (current < end && std::isspace(static_cast<unsigned char>(*current)))
+			current++;
+
+		const auto [ptr, errCode] = std::from_chars(current, end, value);
+		if (errCode != std::errc())
+			return false;
+
+		current = ptr;
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads an ASCII *.ply body.
+	 *  \param[in] header         parsed PLYHeader.
+	 *  \param[in] body           file body.
+	 *  \param[in] vertexValues   output vertex values (vertex_slot_count per vertex).
+	 *  \param[in] vertexIndices  output polygon vertex indices.
+	 *  \return true if the body was read
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadASCIIBody(const PLYHeader& header, const std::string_view& body,
+		std::vector<double>& vertexValues, std::vector<std::vector<unsigned int>>& vertexIndices)
+	{
+		const char* current = body.data();
+		const char* end = body.data() + body.size();
+		for (const auto& element : header.Elements)
+		{
+			// every record takes at least one character, so that a corrupted count cannot trigger a huge allocation
+			if (!element.Properties.empty() && element.Count > body.size())
+				return false;
+
+			const bool isVertex = (element.Name == "vertex");
+			const bool isFace = (element.Name == "face");
+			if (isVertex)
+				vertexValues.resize(element.Count * vertex_slot_count);
+			if (isFace)
+				vertexIndices.reserve(element.Count);
+
+			for (size_t i = 0; i < element.Count; i++)
+			{
+				for (const auto& property : element.Properties)
+				{
+					double value = 0.0;
+					if (!ReadASCIINumber(current, end, value))
+						return false;
+
+					if (!property.IsList)
+					{
+						if (const size_t slot = GetVertexSlot(property); isVertex && slot < vertex_slot_count)
+							vertexValues[i * vertex_slot_count + slot] = value;
+						continue;
+					}
+
+					if (value < 0.0 || value != std::floor(value) || value > static_cast<double>(body.size()))
+						return false;
+
+					const bool isIndexList = isFace && IsFaceIndexList(property);
+					std::vector<unsigned int> polygon(isIndexList ? static_cast<size_t>(value) : 0);
+					for (size_t j = 0; j < static_cast<size_t>(value); j++)
+					{
+						double item = 0.0;
+						if (!ReadASCIINumber(current, end, item))
+							return false;
+
+						if (isIndexList)
+							polygon[j] = (item >= 0.0 ? static_cast<unsigned int>(item) : std::numeric_limits<unsigned int>::max());
+					}
+
+					if (isIndexList)
+						vertexIndices.emplace_back(std::move(polygon));
+				}
+			}
+		}
+
+		return true;
+	}
+
+	ImportStatus PLYImporter::Import(const std::filesystem::path& importedFilePath)
+	{
+		return Import(importedFilePath, m_Data);
+	}
+
+	ImportStatus PLYImporter::Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData)
+	{
+		if (importedFilePath.empty() || !exists(importedFilePath))
+			return ImportStatus::FileNotFound;
+
+		if (!importedFilePath.has_extension() || importedFilePath.extension() != ".ply")
+			return ImportStatus::InvalidExtension;
+
+		const MemoryMappedFile file(importedFilePath);
+		if (!file.IsOpen())
+			return ImportStatus::FileNotOpened;
+
+		importedData.Clear();
+
+		const auto header = ParseHeader(file.View());
+		if (!header)
+		{
+			MSG_CHECK(false, "PLYImporter::Import: invalid *.ply header!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const auto vertexElement = std::find_if(header->Elements.begin(), header->Elements.end(),
+			[](const PLYElement& element) { return element.Name == "vertex"; });
+		if (vertexElement == header->Elements.end())
+		{
+			MSG_CHECK(false, "PLYImporter::Import: *.ply file has no vertex element!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		std::array<bool, vertex_slot_count> hasSlot{};
+		for (const auto& property : vertexElement->Properties)
+		{
+			if (const size_t slot = GetVertexSlot(property); slot < vertex_slot_count)
+				hasSlot[slot] = true;
+		}
+
+		if (!hasSlot[0] || !hasSlot[1] || !hasSlot[2])
+		{
+			MSG_CHECK(false, "PLYImporter::Import: *.ply vertex element has no x, y, z properties!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		std::vector<double> vertexValues;
+		const std::string_view body = file.View().substr(header->BodyOffset);
+		const bool bodyIsValid = header->IsBinary ?
+			ReadBinaryBody(*header, body, vertexValues, importedData.VertexIndices) :
+			ReadASCIIBody(*header, body, vertexValues, importedData.VertexIndices);
+		if (!bodyIsValid)
+		{
+			MSG_CHECK(false, "PLYImporter::Import: truncated or invalid *.ply body!\n");
+			importedData.Clear();
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const size_t vertexCount = vertexElement->Count;
+		for (const auto& polygon : importedData.VertexIndices)
+		{
+			if (std::any_of(polygon.begin(), polygon.end(), [vertexCount](const unsigned int& index) { return index >= vertexCount; }))
+			{
+				MSG_CHECK(false, "PLYImporter::Import: *.ply face vertex index out of range!\n");
+				importedData.Clear();
+				return ImportStatus::InvalidFileFormat;
+			}
+		}
+
+		const bool hasNormals = hasSlot[3] && hasSlot[4] && hasSlot[5];
+		importedData.Vertices.reserve(vertexCount);
+		if (hasNormals)
+			importedData.VertexNormals.reserve(vertexCount);
+
+		for (size_t i = 0; i < vertexCount; i++)
+		{
+			const double* values = &vertexValues[i * vertex_slot_count];
+			importedData.Vertices.emplace_back(Vector3(values[0], values[1], values[2]));
+			if (hasNormals)
+				importedData.VertexNormals.emplace_back(Vector3(values[3], values[4], values[5]));
+		}
+
+		importedData.Name = GetGeometryNameFromFilePath(importedFilePath);
+		return ImportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
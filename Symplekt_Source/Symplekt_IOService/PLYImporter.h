@@ -0,0 +1,84 @@
+/*! \file  PLYImporter.h
+ *  \brief Object for importing 3D geometry data from Stanford PLY (*.ply) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class PLYImporter
+	/// \brief An importer singleton object for importing geometry data from a Stanford *.ply file and storing it as GeometryIOData.
+	///        Supports ASCII, binary little endian and binary big endian bodies with any PLY property types. Vertex positions (x, y, z),
+	///        vertex normals (nx, ny, nz) and variable-length face lists (vertex_indices or vertex_index) are imported,
+	///        other elements and properties are skipped. Binary bodies are read from a memory-mapped file and converted
+	///        property-by-property in bulk.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class PLYImporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.ply file from a given path.
+		 *  \param[in] importedFilePath          path to a *.ply file.
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.ply file from a given path into caller-owned data, e.g.: to be imported concurrently with other files.
+		 *  \param[in] importedFilePath          path to a *.ply file.
+		 *  \param[in] importedData              imported data (cleared first).
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData);
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imported data getter
+		 *  \return reference to m_Data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static GeometryIOData& Data()
+		{
+			return m_Data;
+		}
+
+	private:
+		//
+		// ==================================
+		//
+
+		inline static GeometryIOData m_Data{}; //!> imported geometry data
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
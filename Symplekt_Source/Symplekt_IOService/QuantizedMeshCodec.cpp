@@ -0,0 +1,548 @@
+/*! \file  QuantizedMeshCodec.cpp
+ *  \brief Implementation of a compact binary codec for 3D geometry data with quantized positions, octahedral normals and delta-coded connectivity
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "QuantizedMeshCodec.h"
+
+#include "Symplekt_GeometryKernel/Box3.h"
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	static constexpr char QUANTIZED_MESH_MAGIC[4] = { 'S', 'Q', 'M', 'C' };
+	static constexpr uint8_t QUANTIZED_MESH_VERSION = 1;
+	static constexpr uint8_t QUANTIZED_MESH_HAS_NORMALS = 0x01;
+	static constexpr size_t QUANTIZED_MESH_PREFIX_SIZE = 8; // magic, version, flags, position bits, normal bits
+
+	static constexpr unsigned int MIN_POSITION_BITS = 1;
+	static constexpr unsigned int MAX_POSITION_BITS = 30;
+	static constexpr unsigned int MIN_NORMAL_BITS = 2;
+	static constexpr unsigned int MAX_NORMAL_BITS = 16;
+
+	static constexpr size_t MAX_VARINT32_SIZE = 5;      // varint size of values below 2^35
+	static constexpr size_t MAX_NORMAL_VARINT_SIZE = 3; // varint size of zigzag deltas of 16-bit values
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes an unsigned LEB128 varint.
+	 *  \param[in] out           output position (with enough space for the encoded value).
+	 *  \param[in] value         written value.
+	 *  \return position after the written value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint8_t* WriteVarint(uint8_t* out, uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			*out++ = static_cast<uint8_t>(value | 0x80);
+			value >>= 7;
+		}
+		*out++ = static_cast<uint8_t>(value);
+		return out;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads an unsigned LEB128 varint.
+	 *  \param[in,out] in        input position (moved past the value).
+	 *  \param[in] end           end of input.
+	 *  \param[out] value        read value.
+	 *  \return true if a complete value was read
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadVarint(const uint8_t*& in, const uint8_t* end, uint64_t& value)
+	{
+		value = 0;
+		for (unsigned int shift = 0; shift < 64 && in != end; shift += 7)
+		{
+			const uint8_t byte = *in++;
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+				return true;
+		}
+		return false;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Maps a signed value to an unsigned value with small magnitudes mapped to small values (0, -1, 1, -2, ...).
+	 *  \param[in] value         signed value.
+	 *  \return zigzag-coded value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint64_t EncodeZigZag(const int64_t value)
+	{
+		return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Inverse of EncodeZigZag.
+	 *  \param[in] value         zigzag-coded value.
+	 *  \return signed value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static int64_t DecodeZigZag(const uint64_t value)
+	{
+		return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a double as 8 little-endian bytes.
+	 *  \param[in] out           output position.
+	 *  \param[in] value         written value.
+	 *  \return position after the written value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint8_t* WriteDouble(uint8_t* out, const double value)
+	{
+		const auto bits = std::bit_cast<uint64_t>(value);
+		for (unsigned int i = 0; i < sizeof(uint64_t); i++)
+			*out++ = static_cast<uint8_t>(bits >> (8 * i));
+
+		return out;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads a double from 8 little-endian bytes.
+	 *  \param[in,out] in        input position (moved past the value).
+	 *  \param[in] end           end of input.
+	 *  \param[out] value        read value.
+	 *  \return true if the value was read
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadDouble(const uint8_t*& in, const uint8_t* end, double& value)
+	{
+		if (end - in < static_cast<ptrdiff_t>(sizeof(uint64_t)))
+			return false;
+
+		uint64_t bits = 0;
+		for (unsigned int i = 0; i < sizeof(uint64_t); i++)
+			bits |= static_cast<uint64_t>(*in++) << (8 * i);
+
+		value = std::bit_cast<double>(bits);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Octahedral projection of a normal to the [-1, 1]^2 square quantized to [0, steps]^2.
+	 *         Zero normals are mapped to the center, i.e.: they decode as (0, 0, 1).
+	 *  \param[in] normal        encoded normal.
+	 *  \param[in] steps         number of quantization steps (even, so that the center is exact).
+	 *  \param[out] u            first quantized coordinate.
+	 *  \param[out] v            second quantized coordinate.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void EncodeOctahedral(const Vector3& normal, const double steps, int64_t& u, int64_t& v)
+	{
+		double px = 0.0;
+		double py = 0.0;
+		const double l1Norm = std::fabs(normal.X()) + std::fabs(normal.Y()) + std::fabs(normal.Z());
+		if (l1Norm > 0.0)
+		{
+			px = normal.X() / l1Norm;
+			py = normal.Y() / l1Norm;
+			if (normal.Z() < 0.0)
+			{
+				const double ox = px;
+				px = (1.0 - std::fabs(py)) * (ox >= 0.0 ? 1.0 : -1.0);
+				py = (1.0 - std::fabs(ox)) * (py >= 0.0 ? 1.0 : -1.0);
+			}
+		}
+		u = std::llround((px * 0.5 + 0.5) * steps);
+		v = std::llround((py * 0.5 + 0.5) * steps);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Inverse of EncodeOctahedral.
+	 *  \param[in] u             first quantized coordinate.
+	 *  \param[in] v             second quantized coordinate.
+	 *  \param[in] steps         number of quantization steps.
+	 *  \return unit normal
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static Vector3 DecodeOctahedral(const int64_t u, const int64_t v, const double steps)
+	{
+		double px = static_cast<double>(u) / steps * 2.0 - 1.0;
+		double py = static_cast<double>(v) / steps * 2.0 - 1.0;
+		const double pz = 1.0 - std::fabs(px) - std::fabs(py);
+		if (pz < 0.0)
+		{
+			const double ox = px;
+			px = (1.0 - std::fabs(py)) * (ox >= 0.0 ? 1.0 : -1.0);
+			py = (1.0 - std::fabs(ox)) * (py >= 0.0 ? 1.0 : -1.0);
+		}
+		const double length = std::sqrt(px * px + py * py + pz * pz);
+		return { px / length, py / length, pz / length };
+	}
+
+	QuantizedMeshEncoding QuantizedMeshCodec::Encode(const GeometryIOData& data, const QuantizedMeshSettings& settings)
+	{
+		const unsigned int positionBits = std::clamp(settings.PositionBits, MIN_POSITION_BITS, MAX_POSITION_BITS);
+		const unsigned int normalBits = std::clamp(settings.NormalBits, MIN_NORMAL_BITS, MAX_NORMAL_BITS);
+		const size_t vertexCount = data.Vertices.size();
+		const bool hasNormals = vertexCount > 0 && data.VertexNormals.size() == vertexCount;
+
+		if (vertexCount > std::numeric_limits<uint32_t>::max())
+		{
+			MSG_CHECK(false, "QuantizedMeshCodec::Encode: too many vertices!\n");
+			return {};
+		}
+
+		size_t cornerCount = 0;
+		size_t uniformPolygonSize = data.VertexIndices.empty() ? 0 : data.VertexIndices.front().size();
+		for (const auto& polygon : data.VertexIndices)
+		{
+			cornerCount += polygon.size();
+			if (polygon.size() != uniformPolygonSize)
+				uniformPolygonSize = 0; // mixed polygon sizes are stored per polygon
+		}
+
+		QuantizedMeshEncoding result;
+		result.UncompressedByteSize = (data.Vertices.size() + data.VertexNormals.size()) * 3 * sizeof(double) +
+			(data.VertexIndices.size() + cornerCount) * sizeof(uint32_t);
+
+		// ------ upper bound of the encoded size --------------------------------
+		const size_t maxEncodedSize = QUANTIZED_MESH_PREFIX_SIZE + (data.Name.size() + 4) * MAX_VARINT32_SIZE + 6 * sizeof(double) +
+			(uniformPolygonSize == 0 ? data.VertexIndices.size() * MAX_VARINT32_SIZE : 0) + cornerCount * MAX_VARINT32_SIZE +
+			vertexCount * 3 * MAX_VARINT32_SIZE + (hasNormals ? vertexCount * 2 * MAX_NORMAL_VARINT_SIZE : 0);
+		result.Bytes.resize(maxEncodedSize);
+		uint8_t* out = result.Bytes.data();
+
+		// ------ header ----------------------------------------------------------
+		std::memcpy(out, QUANTIZED_MESH_MAGIC, sizeof(QUANTIZED_MESH_MAGIC));
+		out += sizeof(QUANTIZED_MESH_MAGIC);
+		*out++ = QUANTIZED_MESH_VERSION;
+		*out++ = hasNormals ? QUANTIZED_MESH_HAS_NORMALS : 0;
+		*out++ = static_cast<uint8_t>(positionBits);
+		*out++ = static_cast<uint8_t>(normalBits);
+
+		out = WriteVarint(out, data.Name.size());
+		for (const auto codeUnit : data.Name)
+			out = WriteVarint(out, static_cast<uint32_t>(codeUnit));
+
+		out = WriteVarint(out, vertexCount);
+		out = WriteVarint(out, data.VertexIndices.size());
+		out = WriteVarint(out, uniformPolygonSize);
+
+		Box3 bounds;
+		bounds.ExpandByPoints(data.Vertices);
+		const Vector3 boxMin = bounds.IsEmpty() ? Vector3() : bounds.Min();
+		const Vector3 boxMax = bounds.IsEmpty() ? Vector3() : bounds.Max();
+		for (const double coord : { boxMin.X(), boxMin.Y(), boxMin.Z(), boxMax.X(), boxMax.Y(), boxMax.Z() })
+			out = WriteDouble(out, coord);
+
+		// ------ connectivity ----------------------------------------------------
+		if (uniformPolygonSize == 0)
+		{
+			for (const auto& polygon : data.VertexIndices)
+				out = WriteVarint(out, polygon.size());
+		}
+
+		constexpr auto unvisited = std::numeric_limits<uint32_t>::max();
+		std::vector<uint32_t> traversalIndex(vertexCount, unvisited);
+		std::vector<uint32_t> traversalOrder;
+		traversalOrder.reserve(vertexCount);
+
+		int64_t previousIndex = 0;
+		for (const auto& polygon : data.VertexIndices)
+		{
+			for (const auto vertexId : polygon)
+			{
+				if (vertexId >= vertexCount)
+				{
+					MSG_CHECK(false, "QuantizedMeshCodec::Encode: vertex index out of range!\n");
+					result.Bytes.clear();
+					return result;
+				}
+
+				uint32_t& newIndex = traversalIndex[vertexId];
+				if (newIndex == unvisited)
+				{
+					newIndex = static_cast<uint32_t>(traversalOrder.size());
+					traversalOrder.push_back(vertexId);
+					out = WriteVarint(out, 0); // next new vertex
+				}
+				else
+					out = WriteVarint(out, EncodeZigZag(previousIndex - static_cast<int64_t>(newIndex)) + 1);
+
+				previousIndex = newIndex;
+			}
+		}
+
+		// unreferenced vertices follow the traversed ones
+		for (uint32_t vertexId = 0; vertexId < vertexCount; vertexId++)
+		{
+			if (traversalIndex[vertexId] == unvisited)
+				traversalOrder.push_back(vertexId);
+		}
+
+		// ------ positions -------------------------------------------------------
+		const double positionSteps = static_cast<double>((1u << positionBits) - 1);
+		const Vector3 extent = boxMax - boxMin;
+		const double scale[3] = {
+			extent.X() > 0.0 ? positionSteps / extent.X() : 0.0,
+			extent.Y() > 0.0 ? positionSteps / extent.Y() : 0.0,
+			extent.Z() > 0.0 ? positionSteps / extent.Z() : 0.0 };
+
+		int64_t previousPosition[3] = { 0, 0, 0 };
+		for (const auto vertexId : traversalOrder)
+		{
+			const Vector3& vertex = data.Vertices[vertexId];
+			const double coords[3] = { vertex.X() - boxMin.X(), vertex.Y() - boxMin.Y(), vertex.Z() - boxMin.Z() };
+			for (unsigned int axis = 0; axis < 3; axis++)
+			{
+				const int64_t quantized = std::clamp<int64_t>(std::llround(coords[axis] * scale[axis]), 0, static_cast<int64_t>(positionSteps));
+				out = WriteVarint(out, EncodeZigZag(quantized - previousPosition[axis]));
+				previousPosition[axis] = quantized;
+			}
+		}
+
+		// ------ normals ---------------------------------------------------------
+		if (hasNormals)
+		{
+			const double normalSteps = static_cast<double>((1u << normalBits) - 2);
+			int64_t previousU = 0;
+			int64_t previousV = 0;
+			for (const auto vertexId : traversalOrder)
+			{
+				int64_t u, v;
+				EncodeOctahedral(data.VertexNormals[vertexId], normalSteps, u, v);
+				out = WriteVarint(out, EncodeZigZag(u - previousU));
+				out = WriteVarint(out, EncodeZigZag(v - previousV));
+				previousU = u;
+				previousV = v;
+			}
+		}
+
+		result.Bytes.resize(static_cast<size_t>(out - result.Bytes.data()));
+		result.Bytes.shrink_to_fit();
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Decodes the body of a quantized mesh buffer (everything after the fixed prefix).
+	 *  \param[in] in            position after the prefix.
+	 *  \param[in] end           end of input.
+	 *  \param[in] positionBits  bits per position coordinate.
+	 *  \param[in] normalBits    bits per octahedral normal coordinate (0 if there are no normals).
+	 *  \param[out] decodedData  result GeometryIOData.
+	 *  \return true if the data are valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool DecodeBody(const uint8_t* in, const uint8_t* end, const unsigned int positionBits, const unsigned int normalBits, GeometryIOData& decodedData)
+	{
+		// every stored value takes at least one byte, which bounds all counts by the remaining size
+		const auto remaining = [&in, end]() { return static_cast<uint64_t>(end - in); };
+
+		uint64_t nameLength = 0;
+		if (!ReadVarint(in, end, nameLength) || nameLength > remaining())
+			return false;
+
+		decodedData.Name.resize(static_cast<size_t>(nameLength));
+		for (auto& codeUnit : decodedData.Name)
+		{
+			uint64_t value = 0;
+			if (!ReadVarint(in, end, value))
+				return false;
+			codeUnit = static_cast<wchar_t>(value);
+		}
+
+		uint64_t vertexCount = 0;
+		uint64_t polygonCount = 0;
+		uint64_t uniformPolygonSize = 0;
+		if (!ReadVarint(in, end, vertexCount) || !ReadVarint(in, end, polygonCount) || !ReadVarint(in, end, uniformPolygonSize))
+			return false;
+
+		if (vertexCount > std::numeric_limits<uint32_t>::max() || vertexCount > remaining() / 3 || polygonCount > remaining())
+			return false;
+
+		double boxCoords[6];
+		for (auto& coord : boxCoords)
+		{
+			if (!ReadDouble(in, end, coord))
+				return false;
+		}
+
+		// ------ connectivity ----------------------------------------------------
+		decodedData.VertexIndices.resize(static_cast<size_t>(polygonCount));
+		if (uniformPolygonSize > 0)
+		{
+			if (polygonCount > 0 && uniformPolygonSize > remaining() / polygonCount)
+				return false;
+
+			for (auto& polygon : decodedData.VertexIndices)
+				polygon.resize(static_cast<size_t>(uniformPolygonSize));
+		}
+		else
+		{
+			uint64_t cornerCount = 0;
+			for (auto& polygon : decodedData.VertexIndices)
+			{
+				uint64_t polygonSize = 0;
+				if (!ReadVarint(in, end, polygonSize) || polygonSize > remaining() || cornerCount + polygonSize > remaining())
+					return false;
+
+				cornerCount += polygonSize;
+				polygon.resize(static_cast<size_t>(polygonSize));
+			}
+			if (cornerCount > remaining())
+				return false;
+		}
+
+		int64_t nextNewIndex = 0;
+		int64_t previousIndex = 0;
+		for (auto& polygon : decodedData.VertexIndices)
+		{
+			for (auto& vertexId : polygon)
+			{
+				uint64_t code = 0;
+				if (!ReadVarint(in, end, code))
+					return false;
+
+				int64_t index;
+				if (code == 0)
+				{
+					index = nextNewIndex++;
+					if (index >= static_cast<int64_t>(vertexCount))
+						return false;
+				}
+				else
+				{
+					index = previousIndex - DecodeZigZag(code - 1);
+					if (index < 0 || index >= nextNewIndex)
+						return false;
+				}
+				vertexId = static_cast<unsigned int>(index);
+				previousIndex = index;
+			}
+		}
+
+		// ------ positions -------------------------------------------------------
+		const auto positionSteps = static_cast<int64_t>((1u << positionBits) - 1);
+		const Vector3 boxMin(boxCoords[0], boxCoords[1], boxCoords[2]);
+		const double stepSize[3] = {
+			(boxCoords[3] - boxCoords[0]) / static_cast<double>(positionSteps),
+			(boxCoords[4] - boxCoords[1]) / static_cast<double>(positionSteps),
+			(boxCoords[5] - boxCoords[2]) / static_cast<double>(positionSteps) };
+
+		decodedData.Vertices.resize(static_cast<size_t>(vertexCount));
+		int64_t position[3] = { 0, 0, 0 };
+		for (auto& vertex : decodedData.Vertices)
+		{
+			for (auto& coord : position)
+			{
+				uint64_t delta = 0;
+				if (!ReadVarint(in, end, delta))
+					return false;
+
+				coord += DecodeZigZag(delta);
+				if (coord < 0 || coord > positionSteps)
+					return false;
+			}
+			vertex = Vector3(
+				boxMin.X() + static_cast<double>(position[0]) * stepSize[0],
+				boxMin.Y() + static_cast<double>(position[1]) * stepSize[1],
+				boxMin.Z() + static_cast<double>(position[2]) * stepSize[2]);
+		}
+
+		// ------ normals ---------------------------------------------------------
+		if (normalBits > 0)
+		{
+			const auto normalSteps = static_cast<int64_t>((1u << normalBits) - 2);
+			decodedData.VertexNormals.resize(static_cast<size_t>(vertexCount));
+			int64_t u = 0;
+			int64_t v = 0;
+			for (auto& normal : decodedData.VertexNormals)
+			{
+				uint64_t deltaU = 0;
+				uint64_t deltaV = 0;
+				if (!ReadVarint(in, end, deltaU) || !ReadVarint(in, end, deltaV))
+					return false;
+
+				u += DecodeZigZag(deltaU);
+				v += DecodeZigZag(deltaV);
+				if (u < 0 || u > normalSteps || v < 0 || v > normalSteps)
+					return false;
+
+				normal = DecodeOctahedral(u, v, static_cast<double>(normalSteps));
+			}
+		}
+
+		return in == end;
+	}
+
+	ImportStatus QuantizedMeshCodec::Decode(std::span<const uint8_t> bytes, GeometryIOData& decodedData)
+	{
+		decodedData.Clear();
+
+		if (bytes.size() < QUANTIZED_MESH_PREFIX_SIZE || std::memcmp(bytes.data(), QUANTIZED_MESH_MAGIC, sizeof(QUANTIZED_MESH_MAGIC)) != 0)
+		{
+			MSG_CHECK(false, "QuantizedMeshCodec::Decode: not a quantized mesh buffer!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const uint8_t version = bytes[4];
+		const uint8_t flags = bytes[5];
+		const unsigned int positionBits = bytes[6];
+		const unsigned int normalBits = bytes[7];
+		if (version != QUANTIZED_MESH_VERSION)
+		{
+			MSG_CHECK(false, "QuantizedMeshCodec::Decode: unsupported quantized mesh version " + std::to_string(version) + "!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		if ((flags & ~QUANTIZED_MESH_HAS_NORMALS) != 0 ||
+			positionBits < MIN_POSITION_BITS || positionBits > MAX_POSITION_BITS || normalBits < MIN_NORMAL_BITS || normalBits > MAX_NORMAL_BITS)
+		{
+			MSG_CHECK(false, "QuantizedMeshCodec::Decode: invalid quantized mesh header!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		if (!DecodeBody(bytes.data() + QUANTIZED_MESH_PREFIX_SIZE, bytes.data() + bytes.size(),
+			positionBits, (flags & QUANTIZED_MESH_HAS_NORMALS) ? normalBits : 0, decodedData))
+		{
+			MSG_CHECK(false, "QuantizedMeshCodec::Decode: invalid or truncated quantized mesh data!\n");
+			decodedData.Clear();
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		return ImportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*! \file  QuantizedMeshCodec.h
+ *  \brief Compact binary codec for 3D geometry data with quantized positions, octahedral normals and delta-coded connectivity
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+#include "IOHelperTypes.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \struct QuantizedMeshSettings
+	/// \brief Settings for QuantizedMeshCodec
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct QuantizedMeshSettings
+	{
+		unsigned int PositionBits{ 16 };    //!< bits per position coordinate within the mesh bounding box (1 to 30)
+		unsigned int NormalBits{ 12 };      //!< bits per octahedral normal coordinate (2 to 16)
+	};
+
+	//=============================================================================
+	/// \struct QuantizedMeshEncoding
+	/// \brief Result of QuantizedMeshCodec::Encode
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct QuantizedMeshEncoding
+	{
+		std::vector<uint8_t> Bytes{};                 //!< encoded data (empty if encoding failed)
+		size_t               UncompressedByteSize{ 0 };  //!< size of the data as raw binary buffers (double coordinates, 32-bit indices and polygon sizes)
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Compression ratio getter
+		 *  \return UncompressedByteSize / encoded size (0 if encoding failed)
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] double CompressionRatio() const
+		{
+			return Bytes.empty() ? 0.0 : static_cast<double>(UncompressedByteSize) / static_cast<double>(Bytes.size());
+		}
+	};
+
+	//=============================================================================
+	/// \class QuantizedMeshCodec
+	/// \brief Encodes GeometryIOData into a compact byte buffer for transfer or storage, and decodes it back.
+	///        Vertices are re-ordered by their first use in the polygon traversal, so that each polygon corner
+	///        is coded either as "next new vertex" or as a zigzag varint delta from the previous corner's vertex.
+	///        Positions are quantized to PositionBits within the bounding Box3 of the mesh and normals are octahedrally
+	///        encoded with NormalBits per coordinate, both stored as zigzag varint deltas in the traversal order.
+	///        Decoding preserves polygons and their corner order, but the vertex order is the traversal order.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class QuantizedMeshCodec
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Encodes geometry data.
+		 *  \param[in] data                      encoded GeometryIOData (vertex normals are encoded if there is one per vertex).
+		 *  \param[in] settings                  quantization settings.
+		 *  \return encoded bytes with the size of the uncompressed data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] QuantizedMeshEncoding Encode(const GeometryIOData& data, const QuantizedMeshSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Decodes geometry data.
+		 *  \param[in] bytes                     encoded data.
+		 *  \param[out] decodedData              result GeometryIOData.
+		 *  \return Complete, or InvalidFileFormat for invalid or truncated data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Decode(std::span<const uint8_t> bytes, GeometryIOData& decodedData);
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*! \file  QuantizedMeshExporter.cpp
+ *  \brief Implementation of an object for exporting 3D geometry data to compact quantized mesh (*.qmesh) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "QuantizedMeshExporter.h"
+
+#include <fstream>
+
+namespace Symplektis::IOService
+{
+	ExportStatus QuantizedMeshExporter::Export(const GeometryIOData& data, const std::filesystem::path& exportedFileName, const QuantizedMeshSettings& settings)
+	{
+		std::filesystem::path resultPath = exportedFileName;
+
+		if (exportedFileName.extension().empty())
+			resultPath += ".qmesh";
+
+		else if (exportedFileName.extension() != ".qmesh")
+			return ExportStatus::InvalidExtension;
+
+		const auto encoding = QuantizedMeshCodec::Encode(data, settings);
+		if (encoding.Bytes.empty())
+			return ExportStatus::InternalError;
+
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+			return ExportStatus::FileNotCreated;
+
+		fileOStream.write(reinterpret_cast<const char*>(encoding.Bytes.data()), static_cast<std::streamsize>(encoding.Bytes.size()));
+		if (!fileOStream.good())
+			return ExportStatus::InternalError;
+
+		return ExportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
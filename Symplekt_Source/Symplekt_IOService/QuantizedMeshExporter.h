@@ -0,0 +1,46 @@
+/*! \file  QuantizedMeshExporter.h
+ *  \brief Object for exporting 3D geometry data to compact quantized mesh (*.qmesh) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "QuantizedMeshCodec.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class QuantizedMeshExporter
+	/// \brief An exporter singleton object for storing geometry data encoded by QuantizedMeshCodec in a *.qmesh file.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class QuantizedMeshExporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports a *.qmesh file to a given path.
+		 *  \param[in] data                      exported GeometryIOData
+		 *  \param[in] exportedFileName          *.qmesh file name.
+		 *  \param[in] settings                  quantization settings.
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(const GeometryIOData& data, const std::filesystem::path& exportedFileName, const QuantizedMeshSettings& settings = {});
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
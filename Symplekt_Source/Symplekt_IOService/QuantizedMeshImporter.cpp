@@ -0,0 +1,31 @@
+/*! \file  QuantizedMeshImporter.cpp
+ *  \brief Implementation of an object for importing 3D geometry data from compact quantized mesh (*.qmesh) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "QuantizedMeshImporter.h"
+#include "QuantizedMeshCodec.h"
+#include "MemoryMappedFile.h"
+
+namespace Symplektis::IOService
+{
+	ImportStatus QuantizedMeshImporter::Import(const std::filesystem::path& importedFilePath)
+	{
+		if (importedFilePath.empty() || !exists(importedFilePath))
+			return ImportStatus::FileNotFound;
+
+		if (!importedFilePath.has_extension() || importedFilePath.extension() != ".qmesh")
+			return ImportStatus::InvalidExtension;
+
+		const MemoryMappedFile file(importedFilePath);
+		if (!file.IsOpen())
+			return ImportStatus::FileNotOpened;
+
+		const std::span<const uint8_t> bytes(reinterpret_cast<const uint8_t*>(file.Data()), file.Size());
+		return QuantizedMeshCodec::Decode(bytes, m_Data);
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,69 @@
+/*! \file  QuantizedMeshImporter.h
+ *  \brief Object for importing 3D geometry data from compact quantized mesh (*.qmesh) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class QuantizedMeshImporter
+	/// \brief An importer singleton object for loading geometry data from a *.qmesh file.
+	///        The file is memory-mapped and decoded by QuantizedMeshCodec.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class QuantizedMeshImporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.qmesh file from a given path.
+		 *  \param[in] importedFilePath          path to a *.qmesh file.
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath);
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imported data getter
+		 *  \return reference to m_Data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static GeometryIOData& Data()
+		{
+			return m_Data;
+		}
+
+	private:
+		//
+		// ==================================
+		//
+
+		inline static GeometryIOData m_Data{}; //!> imported mesh data
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
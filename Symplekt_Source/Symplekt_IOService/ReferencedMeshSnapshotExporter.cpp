@@ -0,0 +1,290 @@
+/*! \file  ReferencedMeshSnapshotExporter.cpp
+ *  \brief Implementation of an object for exporting referenced mesh geometry data to native binary snapshot (*.rmsnap) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "ReferencedMeshSnapshotExporter.h"
+#include "ReferencedMeshSnapshotTypes.h"
+#include "ChecksumUtils.h"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//!> \brief number of records converted & written at once
+	constexpr size_t record_chunk_size = 4096;
+
+	//=============================================================================
+	/// \class SnapshotStreamWriter
+	/// \brief A helper writing consecutive bytes into a file stream while updating the running checksum.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class SnapshotStreamWriter
+	{
+	public:
+		explicit SnapshotStreamWriter(std::ofstream& stream, const uint64_t startOffset)
+			: m_Stream(stream), m_Offset(startOffset)
+		{
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Writes bytes and updates the checksum.
+		 *  \param[in] data         pointer to the first byte.
+		 *  \param[in] byteCount    number of bytes.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Write(const void* data, const size_t byteCount)
+		{
+			m_Stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(byteCount));
+			m_Checksum = UpdateCRC32(m_Checksum, data, byteCount);
+			m_Offset += byteCount;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Writes zero padding up to a given offset.
+		 *  \param[in] offset       target offset from the beginning of the file.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void PadTo(const uint64_t offset)
+		{
+			constexpr std::array<char, SNAPSHOT_SECTION_ALIGNMENT> zeros{};
+			while (m_Offset < offset)
+				Write(zeros.data(), static_cast<size_t>(std::min<uint64_t>(zeros.size(), offset - m_Offset)));
+		}
+
+		[[nodiscard]] uint32_t Checksum() const
+		{
+			return m_Checksum;
+		}
+
+	private:
+		std::ofstream& m_Stream;                        //!> output file stream
+		uint64_t       m_Offset{ 0 };                   //!> current offset from the beginning of the file
+		uint32_t       m_Checksum{ CRC32_INITIAL_VALUE }; //!> running checksum of written bytes
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts container items to records in chunks and writes them.
+	 *  \param[in] writer       stream writer.
+	 *  \param[in] items        converted container.
+	 *  \param[in] toRecord     item-to-record conversion function.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TRecord, typename TItem, typename TConversion>
+	static void WriteRecords(SnapshotStreamWriter& writer, const std::vector<TItem>& items, const TConversion& toRecord)
+	{
+		std::vector<TRecord> chunk;
+		chunk.reserve(std::min(record_chunk_size, items.size()));
+		for (size_t i = 0; i < items.size(); i += record_chunk_size)
+		{
+			const size_t count = std::min(record_chunk_size, items.size() - i);
+			chunk.clear();
+			for (size_t j = i; j < i + count; j++)
+				chunk.push_back(toRecord(items[j]));
+
+			writer.Write(chunk.data(), count * sizeof(TRecord));
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes triangulation records of all faces in a container.
+	 *  \param[in] writer       stream writer.
+	 *  \param[in] faces        faces (or boundary cycles).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteTriangulationRecords(SnapshotStreamWriter& writer, const std::vector<Face>& faces)
+	{
+		std::vector<SnapshotTriangleRecord> chunk;
+		chunk.reserve(record_chunk_size);
+		for (const auto& face : faces)
+		{
+			for (const auto& [v0, v1, v2] : face.GetTriangulation())
+			{
+				chunk.push_back({ { static_cast<int32_t>(v0.get()), static_cast<int32_t>(v1.get()), static_cast<int32_t>(v2.get()) } });
+				if (chunk.size() < record_chunk_size)
+					continue;
+
+				writer.Write(chunk.data(), chunk.size() * sizeof(SnapshotTriangleRecord));
+				chunk.clear();
+			}
+		}
+
+		if (!chunk.empty())
+			writer.Write(chunk.data(), chunk.size() * sizeof(SnapshotTriangleRecord));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Rounds an offset up to SNAPSHOT_SECTION_ALIGNMENT.
+	 *  \param[in] offset       byte offset.
+	 *  \return aligned offset
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint64_t AlignSectionOffset(const uint64_t offset)
+	{
+		return (offset + SNAPSHOT_SECTION_ALIGNMENT - 1) / SNAPSHOT_SECTION_ALIGNMENT * SNAPSHOT_SECTION_ALIGNMENT;
+	}
+
+	ExportStatus ReferencedMeshSnapshotExporter::Export(const ReferencedMeshGeometryData& data, const std::filesystem::path& exportedFileName)
+	{
+		std::filesystem::path resultPath = exportedFileName;
+
+		if (exportedFileName.extension().empty())
+			resultPath += ".rmsnap";
+
+		else if (exportedFileName.extension() != ".rmsnap")
+			return ExportStatus::InvalidExtension;
+
+		size_t faceTriangleCount = 0;
+		for (const auto& face : data.Faces)
+			faceTriangleCount += face.GetTriangulation().size();
+
+		size_t triangleCount = faceTriangleCount;
+		for (const auto& bdCycle : data.BoundaryCycles)
+			triangleCount += bdCycle.GetTriangulation().size();
+
+		constexpr auto maxRecordCount = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+		if (data.HalfEdges.size() > maxRecordCount || data.Vertices.size() > maxRecordCount || data.Edges.size() > maxRecordCount ||
+			data.Faces.size() > maxRecordCount || data.BoundaryCycles.size() > maxRecordCount || triangleCount > maxRecordCount)
+			return ExportStatus::InternalError; // indices are stored as int32
+
+		// ------ section table ---------------------------------------------------
+		const std::array<std::pair<size_t, size_t>, static_cast<size_t>(ReferencedMeshSnapshotSectionId::Count)> sectionSizes{ {
+			{ sizeof(uint32_t), data.Name.size() },
+			{ sizeof(SnapshotHalfEdgeRecord), data.HalfEdges.size() },
+			{ sizeof(SnapshotVertexRecord), data.Vertices.size() },
+			{ sizeof(SnapshotEdgeRecord), data.Edges.size() },
+			{ sizeof(SnapshotFaceRecord), data.Faces.size() },
+			{ sizeof(SnapshotFaceRecord), data.BoundaryCycles.size() },
+			{ sizeof(SnapshotTriangleRecord), triangleCount },
+			{ sizeof(SnapshotVertexNormalRecord), data.VertexNormals.size() }
+		} };
+
+		std::array<ReferencedMeshSnapshotSectionEntry, static_cast<size_t>(ReferencedMeshSnapshotSectionId::Count)> sectionTable{};
+		uint64_t offset = sizeof(ReferencedMeshSnapshotHeader) + sizeof(sectionTable);
+		for (uint32_t i = 0; i < sectionTable.size(); i++)
+		{
+			offset = AlignSectionOffset(offset);
+			sectionTable[i] = { i, static_cast<uint32_t>(sectionSizes[i].first), offset, sectionSizes[i].second };
+			offset += sectionSizes[i].first * sectionSizes[i].second;
+		}
+		const uint64_t fileSize = offset;
+
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+			return ExportStatus::FileNotCreated;
+
+		ReferencedMeshSnapshotHeader header{};
+		std::memcpy(header.Magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+		header.Version = SNAPSHOT_VERSION;
+		header.EndianTag = SNAPSHOT_ENDIAN_TAG;
+		header.SectionCount = static_cast<uint32_t>(sectionTable.size());
+		header.MeshType = static_cast<uint32_t>(data.Type);
+		header.FileSize = fileSize;
+		fileOStream.write(reinterpret_cast<const char*>(&header), sizeof(header)); // checksum is filled in at the end
+
+		SnapshotStreamWriter writer(fileOStream, sizeof(header));
+		writer.Write(sectionTable.data(), sizeof(sectionTable));
+
+		// ------ payload ---------------------------------------------------------
+		const auto sectionOffset = [&sectionTable](const ReferencedMeshSnapshotSectionId& id) { return sectionTable[static_cast<size_t>(id)].Offset; };
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::Name));
+		for (const auto& character : data.Name)
+		{
+			const auto codeUnit = static_cast<uint32_t>(character);
+			writer.Write(&codeUnit, sizeof(uint32_t));
+		}
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::HalfEdges));
+		WriteRecords<SnapshotHalfEdgeRecord>(writer, data.HalfEdges, [](const HalfEdge& halfEdge)
+		{
+			return SnapshotHalfEdgeRecord{
+				static_cast<int32_t>(halfEdge.NextHalfEdge().get()), static_cast<int32_t>(halfEdge.OppositeHalfEdge().get()),
+				static_cast<int32_t>(halfEdge.TailVertex().get()), static_cast<int32_t>(halfEdge.Edge().get()),
+				static_cast<int32_t>(halfEdge.AdjacentFace().get()), halfEdge.IsBoundary() ? 1u : 0u };
+		});
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::Vertices));
+		WriteRecords<SnapshotVertexRecord>(writer, data.Vertices, [](const Vertex& vertex)
+		{
+			const auto& pos = vertex.Position();
+			return SnapshotVertexRecord{ { pos.X(), pos.Y(), pos.Z() },
+				static_cast<int32_t>(vertex.HalfEdge().get()), vertex.Index(),
+				static_cast<int32_t>(vertex.Normal().get()), vertex.IsBoundary() ? 1u : 0u };
+		});
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::Edges));
+		WriteRecords<SnapshotEdgeRecord>(writer, data.Edges, [](const Edge& edge)
+		{
+			return SnapshotEdgeRecord{ static_cast<int32_t>(edge.HalfEdge().get()), edge.Index() };
+		});
+
+		uint32_t firstTriangle = 0;
+		const auto faceToRecord = [&firstTriangle](const Face& face)
+		{
+			const auto triangleCount = static_cast<uint32_t>(face.GetTriangulation().size());
+			const SnapshotFaceRecord record{ static_cast<int32_t>(face.HalfEdge().get()), face.Index(), firstTriangle, triangleCount };
+			firstTriangle += triangleCount;
+			return record;
+		};
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::Faces));
+		WriteRecords<SnapshotFaceRecord>(writer, data.Faces, faceToRecord);
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::BoundaryCycles));
+		WriteRecords<SnapshotFaceRecord>(writer, data.BoundaryCycles, faceToRecord);
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::Triangles));
+		WriteTriangulationRecords(writer, data.Faces);
+		WriteTriangulationRecords(writer, data.BoundaryCycles);
+
+		writer.PadTo(sectionOffset(ReferencedMeshSnapshotSectionId::VertexNormals));
+		WriteRecords<SnapshotVertexNormalRecord>(writer, data.VertexNormals, [](const VertexNormal& normal)
+		{
+			const auto& vec = normal.Get();
+			return SnapshotVertexNormalRecord{ { vec.X(), vec.Y(), vec.Z() }, static_cast<int32_t>(normal.Vertex().get()), 0 };
+		});
+
+		writer.PadTo(fileSize);
+
+		// ------ finalize header -------------------------------------------------
+		header.Checksum = writer.Checksum();
+		fileOStream.seekp(0);
+		fileOStream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		if (!fileOStream.good())
+			return ExportStatus::InternalError;
+
+		fileOStream.close();
+		return ExportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,49 @@
+/*! \file  ReferencedMeshSnapshotExporter.h
+ *  \brief Object for exporting built referenced (half-edge) mesh geometry data to native binary snapshot (*.rmsnap) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class ReferencedMeshSnapshotExporter
+	/// \brief An exporter singleton object for storing ReferencedMeshGeometryData (including half-edge topology,
+	///        boundary cycles, vertex normals and face triangulations) in a versioned binary *.rmsnap file,
+	///        so that it can be loaded without re-importing and re-building the mesh.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class ReferencedMeshSnapshotExporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports a *.rmsnap snapshot file to a given path. The file is written in a single pass,
+		 *         only the header (with the checksum) is re-written at the end.
+		 *  \param[in] data                      exported ReferencedMeshGeometryData
+		 *  \param[in] exportedFileName          *.rmsnap file name.
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(const GeometryKernel::ReferencedMeshGeometryData& data, const std::filesystem::path& exportedFileName);
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
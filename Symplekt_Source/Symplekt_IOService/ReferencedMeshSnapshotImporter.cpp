@@ -0,0 +1,98 @@
+/*! \file  ReferencedMeshSnapshotImporter.cpp
+ *  \brief Implementation of an object for importing referenced mesh geometry data from native binary snapshot (*.rmsnap) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "ReferencedMeshSnapshotImporter.h"
+#include "ReferencedMeshSnapshotView.h"
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Creates a Face (or a boundary cycle) from a stored record.
+	 *  \param[in] view          snapshot view.
+	 *  \param[in] record        stored face record.
+	 *  \return Face
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static Face ConvertFaceRecord(const ReferencedMeshSnapshotView& view, const SnapshotFaceRecord& record)
+	{
+		Face face(HalfEdgeIndex(record.HalfEdge), record.Index);
+		if (record.TriangleCount == 0)
+			return face;
+
+		auto& triangulation = face.GetTriangulation();
+		triangulation.reserve(record.TriangleCount);
+		for (const auto& triangle : view.Triangulation(record))
+		{
+			triangulation.emplace_back(
+				VertexIndex(triangle.Vertices[0]), VertexIndex(triangle.Vertices[1]), VertexIndex(triangle.Vertices[2]));
+		}
+
+		return face;
+	}
+
+	ReferencedMeshGeometryData ReferencedMeshSnapshotImporter::ConvertViewToReferencedMeshGeometryData(const ReferencedMeshSnapshotView& view)
+	{
+		ReferencedMeshGeometryData result;
+		result.Name = view.Name();
+		result.Type = view.Type();
+
+		result.HalfEdges.reserve(view.HalfEdges().size());
+		for (const auto& record : view.HalfEdges())
+		{
+			result.HalfEdges.emplace_back(HalfEdgeReferenceData{
+				HalfEdgeIndex(record.NextHalfEdge), HalfEdgeIndex(record.OppositeHalfEdge),
+				VertexIndex(record.TailVertex), EdgeIndex(record.Edge), FaceIndex(record.AdjacentFace) },
+				record.IsBoundary != 0);
+		}
+
+		result.Vertices.resize(view.Vertices().size());
+		for (size_t i = 0; i < result.Vertices.size(); i++)
+		{
+			const auto& record = view.Vertices()[i];
+			result.Vertices[i]
+				.Set(HalfEdgeIndex(record.HalfEdge), Vector3(record.Position[0], record.Position[1], record.Position[2]), record.Index)
+				.SetIsBoundary(record.IsBoundary != 0)
+				.SetNormal(VertexNormalIndex(record.Normal));
+		}
+
+		result.Edges.reserve(view.Edges().size());
+		for (const auto& record : view.Edges())
+			result.Edges.emplace_back(HalfEdgeIndex(record.HalfEdge), record.Index);
+
+		result.Faces.reserve(view.Faces().size());
+		for (const auto& record : view.Faces())
+			result.Faces.emplace_back(ConvertFaceRecord(view, record));
+
+		result.BoundaryCycles.reserve(view.BoundaryCycles().size());
+		for (const auto& record : view.BoundaryCycles())
+			result.BoundaryCycles.emplace_back(ConvertFaceRecord(view, record));
+
+		result.VertexNormals.reserve(view.VertexNormals().size());
+		for (const auto& record : view.VertexNormals())
+			result.VertexNormals.emplace_back(Vector3(record.Normal[0], record.Normal[1], record.Normal[2]), VertexIndex(record.Vertex));
+
+		return result;
+	}
+
+	ImportStatus ReferencedMeshSnapshotImporter::Import(const std::filesystem::path& importedFilePath)
+	{
+		ReferencedMeshSnapshotView view;
+		const auto openStatus = view.Open(importedFilePath);
+		if (openStatus != ImportStatus::Complete)
+			return openStatus;
+
+		m_Data = ConvertViewToReferencedMeshGeometryData(view);
+		return ImportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,84 @@
+/*! \file  ReferencedMeshSnapshotImporter.h
+ *  \brief Object for importing built referenced (half-edge) mesh geometry data from native binary snapshot (*.rmsnap) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	class ReferencedMeshSnapshotView;
+
+	//=============================================================================
+	/// \class ReferencedMeshSnapshotImporter
+	/// \brief An importer singleton object for loading ReferencedMeshGeometryData from a *.rmsnap snapshot file.
+	///        The file is memory-mapped and validated by ReferencedMeshSnapshotView, and the mesh elements are filled
+	///        directly from the stored records, i.e.: without parsing and without re-building the half-edge topology.
+	///        Use ReferencedMeshSnapshotView directly for read-only access without copying.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class ReferencedMeshSnapshotImporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.rmsnap file from a given path.
+		 *  \param[in] importedFilePath          path to a *.rmsnap file.
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath);
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Fills ReferencedMeshGeometryData from an opened snapshot view.
+		 *  \param[in] view                      opened and validated ReferencedMeshSnapshotView.
+		 *  \return result ReferencedMeshGeometryData
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] GeometryKernel::ReferencedMeshGeometryData ConvertViewToReferencedMeshGeometryData(const ReferencedMeshSnapshotView& view);
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imported data getter
+		 *  \return reference to m_Data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static GeometryKernel::ReferencedMeshGeometryData& Data()
+		{
+			return m_Data;
+		}
+
+	private:
+		//
+		// ==================================
+		//
+
+		inline static GeometryKernel::ReferencedMeshGeometryData m_Data{}; //!> imported mesh data
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,208 @@
+/*! \file  ReferencedMeshSnapshotTypes.h
+ *  \brief Binary record types of the native referenced (half-edge) mesh snapshot (*.rmsnap) format
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+\verbatim
+-------------------------------------------------------------------------------
+ Layout (native little endian, every section starts at a multiple of SNAPSHOT_SECTION_ALIGNMENT):
+
+   ReferencedMeshSnapshotHeader
+   ReferencedMeshSnapshotSectionEntry[SectionCount]
+   section payloads (arrays of fixed-size records, see ReferencedMeshSnapshotSectionId)
+
+ The header checksum is a CRC-32 of everything following the header.
+ Face triangulations are stored in a shared Triangles section, each face record
+ refers to its range of triangles.
+-------------------------------------------------------------------------------
+\endverbatim
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Symplektis::IOService
+{
+	//!> \brief file signature of the referenced mesh snapshot format
+	constexpr char SNAPSHOT_MAGIC[8] = { 'S', 'Y', 'M', 'R', 'M', 'S', 'H', '\0' };
+	//!> \brief current version of the snapshot format
+	constexpr uint32_t SNAPSHOT_VERSION = 1;
+	//!> \brief byte order tag (written natively, read back as a different value on an opposite-endian machine)
+	constexpr uint32_t SNAPSHOT_ENDIAN_TAG = 0x01020304;
+	//!> \brief alignment of section offsets, so that records can be viewed in place
+	constexpr size_t SNAPSHOT_SECTION_ALIGNMENT = 16;
+
+	//=============================================================================
+	/// \enum ReferencedMeshSnapshotSectionId
+	/// \brief Identifiers of snapshot sections
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class ReferencedMeshSnapshotSectionId : uint32_t
+	{
+		Name           = 0,    //!< mesh name as 32-bit code units
+		HalfEdges      = 1,    //!< SnapshotHalfEdgeRecord array
+		Vertices       = 2,    //!< SnapshotVertexRecord array
+		Edges          = 3,    //!< SnapshotEdgeRecord array
+		Faces          = 4,    //!< SnapshotFaceRecord array
+		BoundaryCycles = 5,    //!< SnapshotFaceRecord array
+		Triangles      = 6,    //!< SnapshotTriangleRecord array (face & boundary cycle triangulations)
+		VertexNormals  = 7,    //!< SnapshotVertexNormalRecord array
+		Count          = 8
+	};
+
+	//=============================================================================
+	/// \struct ReferencedMeshSnapshotHeader
+	/// \brief Fixed-size file header
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct ReferencedMeshSnapshotHeader
+	{
+		char     Magic[8];
+		uint32_t Version;
+		uint32_t EndianTag;
+		uint32_t SectionCount;
+		uint32_t MeshType;          //!< GeometryKernel::PolyMeshType value
+		uint32_t Checksum;          //!< CRC-32 of the section table and all section payloads
+		uint32_t Reserved;
+		uint64_t FileSize;
+	};
+
+	//=============================================================================
+	/// \struct ReferencedMeshSnapshotSectionEntry
+	/// \brief Section table entry
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct ReferencedMeshSnapshotSectionEntry
+	{
+		uint32_t Id;                //!< ReferencedMeshSnapshotSectionId value
+		uint32_t RecordSize;        //!< byte size of a single record
+		uint64_t Offset;            //!< byte offset of the first record from the beginning of the file
+		uint64_t RecordCount;
+	};
+
+	//=============================================================================
+	/// \struct SnapshotHalfEdgeRecord
+	/// \brief Stored GeometryKernel::HalfEdge (indices are -1 for null references)
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SnapshotHalfEdgeRecord
+	{
+		int32_t  NextHalfEdge;
+		int32_t  OppositeHalfEdge;
+		int32_t  TailVertex;
+		int32_t  Edge;
+		int32_t  AdjacentFace;      //!< index to Faces, or to BoundaryCycles if IsBoundary != 0
+		uint32_t IsBoundary;
+	};
+
+	//=============================================================================
+	/// \struct SnapshotVertexRecord
+	/// \brief Stored GeometryKernel::Vertex
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SnapshotVertexRecord
+	{
+		double   Position[3];
+		int32_t  HalfEdge;
+		uint32_t Index;
+		int32_t  Normal;
+		uint32_t IsBoundary;
+	};
+
+	//=============================================================================
+	/// \struct SnapshotEdgeRecord
+	/// \brief Stored GeometryKernel::Edge
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SnapshotEdgeRecord
+	{
+		int32_t  HalfEdge;
+		uint32_t Index;
+	};
+
+	//=============================================================================
+	/// \struct SnapshotFaceRecord
+	/// \brief Stored GeometryKernel::Face (used for both faces and boundary cycles)
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SnapshotFaceRecord
+	{
+		int32_t  HalfEdge;
+		uint32_t Index;
+		uint32_t FirstTriangle;     //!< index of the first triangle in the Triangles section
+		uint32_t TriangleCount;
+	};
+
+	//=============================================================================
+	/// \struct SnapshotTriangleRecord
+	/// \brief Stored triangle of a face triangulation
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SnapshotTriangleRecord
+	{
+		int32_t Vertices[3];
+	};
+
+	//=============================================================================
+	/// \struct SnapshotVertexNormalRecord
+	/// \brief Stored GeometryKernel::VertexNormal
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct SnapshotVertexNormalRecord
+	{
+		double   Normal[3];
+		int32_t  Vertex;
+		uint32_t Reserved;
+	};
+
+	// records are read in place from mapped memory, so their layout must be fixed
+	static_assert(std::is_trivially_copyable_v<ReferencedMeshSnapshotHeader> && sizeof(ReferencedMeshSnapshotHeader) == 40);
+	static_assert(std::is_trivially_copyable_v<ReferencedMeshSnapshotSectionEntry> && sizeof(ReferencedMeshSnapshotSectionEntry) == 24);
+	static_assert(std::is_trivially_copyable_v<SnapshotHalfEdgeRecord> && sizeof(SnapshotHalfEdgeRecord) == 24);
+	static_assert(std::is_trivially_copyable_v<SnapshotVertexRecord> && sizeof(SnapshotVertexRecord) == 40);
+	static_assert(std::is_trivially_copyable_v<SnapshotEdgeRecord> && sizeof(SnapshotEdgeRecord) == 8);
+	static_assert(std::is_trivially_copyable_v<SnapshotFaceRecord> && sizeof(SnapshotFaceRecord) == 16);
+	static_assert(std::is_trivially_copyable_v<SnapshotTriangleRecord> && sizeof(SnapshotTriangleRecord) == 12);
+	static_assert(std::is_trivially_copyable_v<SnapshotVertexNormalRecord> && sizeof(SnapshotVertexNormalRecord) == 32);
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,237 @@
+/*! \file  ReferencedMeshSnapshotView.cpp
+ *  \brief Implementation of a read-only view of a native binary referenced mesh snapshot (*.rmsnap) file
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "ReferencedMeshSnapshotView.h"
+#include "ChecksumUtils.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <cstring>
+
+namespace Symplektis::IOService
+{
+	//-----------------------------------------------------------------------------
+	/*! \brief Verifies that a section entry describes an in-bounds array of a given record type and creates a span over it.
+	 *  \param[in] file          mapped file.
+	 *  \param[in] entry         section table entry.
+	 *  \param[out] records      result span.
+	 *  \return true if the section is valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TRecord>
+	static bool MapSectionRecords(const MemoryMappedFile& file, const ReferencedMeshSnapshotSectionEntry& entry, std::span<const TRecord>& records)
+	{
+		if (entry.RecordSize != sizeof(TRecord) || entry.Offset % SNAPSHOT_SECTION_ALIGNMENT != 0 || entry.Offset > file.Size())
+			return false;
+
+		if (entry.RecordCount > (file.Size() - entry.Offset) / sizeof(TRecord))
+			return false;
+
+		records = std::span<const TRecord>(
+			reinterpret_cast<const TRecord*>(file.Data() + entry.Offset), static_cast<size_t>(entry.RecordCount));
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Checks whether a stored index is null (-1) or points into a container of a given size.
+	 *  \param[in] index         stored index.
+	 *  \param[in] size          container size.
+	 *  \return true if valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool IsNullOrInRange(const int32_t index, const size_t size)
+	{
+		return index == -1 || (index >= 0 && static_cast<size_t>(index) < size);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Checks whether a stored index points into a container of a given size.
+	 *  \param[in] index         stored index.
+	 *  \param[in] size          container size.
+	 *  \return true if valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool IsInRange(const int32_t index, const size_t size)
+	{
+		return index >= 0 && static_cast<size_t>(index) < size;
+	}
+
+	ImportStatus ReferencedMeshSnapshotView::Open(const std::filesystem::path& snapshotFilePath)
+	{
+		Close();
+
+		if (snapshotFilePath.empty() || !exists(snapshotFilePath))
+			return ImportStatus::FileNotFound;
+
+		if (!snapshotFilePath.has_extension() || snapshotFilePath.extension() != ".rmsnap")
+			return ImportStatus::InvalidExtension;
+
+		MemoryMappedFile file(snapshotFilePath);
+		if (!file.IsOpen())
+			return ImportStatus::FileNotOpened;
+
+		ReferencedMeshSnapshotHeader header{};
+		if (file.Size() < sizeof(header))
+			return ImportStatus::InvalidFileFormat;
+
+		std::memcpy(&header, file.Data(), sizeof(header));
+		if (std::memcmp(header.Magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || header.EndianTag != SNAPSHOT_ENDIAN_TAG)
+		{
+			MSG_CHECK(false, "ReferencedMeshSnapshotView::Open: not a native *.rmsnap file!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		if (header.Version != SNAPSHOT_VERSION)
+		{
+			MSG_CHECK(false, "ReferencedMeshSnapshotView::Open: unsupported *.rmsnap version " + std::to_string(header.Version) + "!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const size_t tableSize = static_cast<size_t>(header.SectionCount) * sizeof(ReferencedMeshSnapshotSectionEntry);
+		if (header.FileSize != file.Size() || header.SectionCount < static_cast<uint32_t>(ReferencedMeshSnapshotSectionId::Count) ||
+			tableSize > file.Size() - sizeof(header))
+		{
+			MSG_CHECK(false, "ReferencedMeshSnapshotView::Open: truncated *.rmsnap file!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		if (ComputeCRC32(file.Data() + sizeof(header), file.Size() - sizeof(header)) != header.Checksum)
+		{
+			MSG_CHECK(false, "ReferencedMeshSnapshotView::Open: *.rmsnap checksum mismatch!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const auto* sectionTable = reinterpret_cast<const ReferencedMeshSnapshotSectionEntry*>(file.Data() + sizeof(header));
+		const auto section = [sectionTable](const ReferencedMeshSnapshotSectionId& id) -> const ReferencedMeshSnapshotSectionEntry&
+		{
+			return sectionTable[static_cast<size_t>(id)];
+		};
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(ReferencedMeshSnapshotSectionId::Count); i++)
+		{
+			if (sectionTable[i].Id != i)
+				return ImportStatus::InvalidFileFormat;
+		}
+
+		if (!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::Name), m_Name) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::HalfEdges), m_HalfEdges) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::Vertices), m_Vertices) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::Edges), m_Edges) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::Faces), m_Faces) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::BoundaryCycles), m_BoundaryCycles) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::Triangles), m_Triangles) ||
+			!MapSectionRecords(file, section(ReferencedMeshSnapshotSectionId::VertexNormals), m_VertexNormals))
+		{
+			MSG_CHECK(false, "ReferencedMeshSnapshotView::Open: invalid *.rmsnap section table!\n");
+			Close();
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		m_Type = static_cast<GeometryKernel::PolyMeshType>(header.MeshType);
+		m_File.emplace(std::move(file)); // moving the mapping keeps the mapped address (and all spans) valid
+
+		if (!ValidateIndices())
+		{
+			MSG_CHECK(false, "ReferencedMeshSnapshotView::Open: *.rmsnap file contains out-of-range indices!\n");
+			Close();
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		return ImportStatus::Complete;
+	}
+
+	std::wstring ReferencedMeshSnapshotView::Name() const
+	{
+		std::wstring result;
+		result.reserve(m_Name.size());
+		for (const auto codeUnit : m_Name)
+			result.push_back(static_cast<wchar_t>(codeUnit));
+
+		return result;
+	}
+
+	bool ReferencedMeshSnapshotView::ValidateIndices() const
+	{
+		const size_t nHalfEdges = m_HalfEdges.size();
+		const size_t nVertices = m_Vertices.size();
+		const size_t nEdges = m_Edges.size();
+		const size_t nFaces = m_Faces.size();
+		const size_t nBoundaryCycles = m_BoundaryCycles.size();
+		const size_t nTriangles = m_Triangles.size();
+
+		for (const auto& halfEdge : m_HalfEdges)
+		{
+			if (!IsNullOrInRange(halfEdge.NextHalfEdge, nHalfEdges) || !IsNullOrInRange(halfEdge.OppositeHalfEdge, nHalfEdges) ||
+				!IsNullOrInRange(halfEdge.TailVertex, nVertices) || !IsNullOrInRange(halfEdge.Edge, nEdges) ||
+				!IsNullOrInRange(halfEdge.AdjacentFace, halfEdge.IsBoundary ? nBoundaryCycles : nFaces))
+				return false;
+		}
+
+		// vertex normal indices are default-initialized to 0 (not null) for meshes without normals
+		const bool checkNormals = !m_VertexNormals.empty();
+		for (const auto& vertex : m_Vertices)
+		{
+			if (!IsNullOrInRange(vertex.HalfEdge, nHalfEdges) || (checkNormals && !IsNullOrInRange(vertex.Normal, m_VertexNormals.size())))
+				return false;
+		}
+
+		for (const auto& edge : m_Edges)
+		{
+			if (!IsNullOrInRange(edge.HalfEdge, nHalfEdges))
+				return false;
+		}
+
+		for (const auto faces : { m_Faces, m_BoundaryCycles })
+		{
+			for (const auto& face : faces)
+			{
+				if (!IsNullOrInRange(face.HalfEdge, nHalfEdges) ||
+					face.FirstTriangle > nTriangles || face.TriangleCount > nTriangles - face.FirstTriangle)
+					return false;
+			}
+		}
+
+		for (const auto& triangle : m_Triangles)
+		{
+			if (!IsInRange(triangle.Vertices[0], nVertices) || !IsInRange(triangle.Vertices[1], nVertices) || !IsInRange(triangle.Vertices[2], nVertices))
+				return false;
+		}
+
+		for (const auto& normal : m_VertexNormals)
+		{
+			if (!IsNullOrInRange(normal.Vertex, nVertices))
+				return false;
+		}
+
+		return true;
+	}
+
+	void ReferencedMeshSnapshotView::Close()
+	{
+		m_File.reset();
+		m_Type = GeometryKernel::PolyMeshType::Arbitrary;
+		m_Name = {};
+		m_HalfEdges = {};
+		m_Vertices = {};
+		m_Edges = {};
+		m_Faces = {};
+		m_BoundaryCycles = {};
+		m_Triangles = {};
+		m_VertexNormals = {};
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
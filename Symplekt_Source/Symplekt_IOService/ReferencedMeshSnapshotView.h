@@ -0,0 +1,146 @@
+/*! \file  ReferencedMeshSnapshotView.h
+ *  \brief Read-only zero-copy view of a native binary referenced mesh snapshot (*.rmsnap) file
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "IOHelperTypes.h"
+#include "MemoryMappedFile.h"
+#include "ReferencedMeshSnapshotTypes.h"
+
+#include "Symplekt_GeometryKernel/GeometryHelperTypes.h"
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class ReferencedMeshSnapshotView
+	/// \brief A read-only view of a memory-mapped *.rmsnap file. After a successful Open() the file is fully
+	///        validated (header, checksum, section bounds and all stored indices), and its records can be accessed
+	///        in place through spans, without copying or re-building the mesh. The spans remain valid while the
+	///        view is alive and open.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class ReferencedMeshSnapshotView
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Maps and validates a *.rmsnap file from a given path. Any previously opened file is closed.
+		 *  \param[in] snapshotFilePath          path to a *.rmsnap file.
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] ImportStatus Open(const std::filesystem::path& snapshotFilePath);
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns true if a valid snapshot file is opened.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool IsOpen() const
+		{
+			return m_File.has_value();
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Stored mesh name.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::wstring Name() const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Stored mesh type.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] GeometryKernel::PolyMeshType Type() const
+		{
+			return m_Type;
+		}
+
+		[[nodiscard]] std::span<const SnapshotHalfEdgeRecord> HalfEdges() const { return m_HalfEdges; }
+		[[nodiscard]] std::span<const SnapshotVertexRecord> Vertices() const { return m_Vertices; }
+		[[nodiscard]] std::span<const SnapshotEdgeRecord> Edges() const { return m_Edges; }
+		[[nodiscard]] std::span<const SnapshotFaceRecord> Faces() const { return m_Faces; }
+		[[nodiscard]] std::span<const SnapshotFaceRecord> BoundaryCycles() const { return m_BoundaryCycles; }
+		[[nodiscard]] std::span<const SnapshotVertexNormalRecord> VertexNormals() const { return m_VertexNormals; }
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Triangulation of a stored face or boundary cycle.
+		 *  \param[in] face          face (or boundary cycle) record of this view.
+		 *  \return span of triangle records
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] std::span<const SnapshotTriangleRecord> Triangulation(const SnapshotFaceRecord& face) const
+		{
+			return m_Triangles.subspan(face.FirstTriangle, face.TriangleCount);
+		}
+
+	private:
+		//-----------------------------------------------------------------------------
+		/*! \brief Validates all stored indices, so that they can be dereferenced safely.
+		 *  \return true if valid
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool ValidateIndices() const;
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Releases the mapped file and resets all spans.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		void Close();
+
+		//
+		// ==================================
+		//
+
+		std::optional<MemoryMappedFile>              m_File;              //!> mapped snapshot file (empty if not opened)
+		GeometryKernel::PolyMeshType                 m_Type{ GeometryKernel::PolyMeshType::Arbitrary };
+		std::span<const uint32_t>                    m_Name;
+		std::span<const SnapshotHalfEdgeRecord>      m_HalfEdges;
+		std::span<const SnapshotVertexRecord>        m_Vertices;
+		std::span<const SnapshotEdgeRecord>          m_Edges;
+		std::span<const SnapshotFaceRecord>          m_Faces;
+		std::span<const SnapshotFaceRecord>          m_BoundaryCycles;
+		std::span<const SnapshotTriangleRecord>      m_Triangles;
+		std::span<const SnapshotVertexNormalRecord>  m_VertexNormals;
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
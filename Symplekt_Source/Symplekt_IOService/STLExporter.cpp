@@ -0,0 +1,140 @@
+/*! \file  STLExporter.cpp
+ *  \brief Implementation of an object for exporting 3D triangle mesh data to binary stereolithography STL (*.stl) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "STLExporter.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string_view>
+
+namespace Symplektis::IOService
+{
+	//!> \brief binary STL header comment. Must not start with "solid", so that readers do not mistake the file for an ASCII file.
+	constexpr std::string_view stl_header_comment = "Symplektis binary STL";
+
+	//!> \brief size of a binary STL triangle record (normal, 3 vertices, UInt16 attribute byte count)
+	constexpr size_t stl_binary_triangle_size = 50;
+
+	//!> \brief number of triangle records collected before writing them to the file
+	constexpr size_t chunk_triangle_count = 4096;
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Stores a value in little endian byte order.
+	 *  \param[in] dst             first destination byte.
+	 *  \param[in] value           stored value.
+	 *  \return pointer past the stored value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename T>
+	static char* StoreLittleEndian(char* dst, const T value)
+	{
+		auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+		if constexpr (std::endian::native == std::endian::big)
+			std::reverse(bytes.begin(), bytes.end());
+
+		std::memcpy(dst, bytes.data(), sizeof(T));
+		return dst + sizeof(T);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a 50-byte binary STL triangle record.
+	 *  \param[in] dst             first destination byte.
+	 *  \param[in] vertexCoords    vertex coordinate buffer.
+	 *  \param[in] indices         pointer to three vertex indices.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteTriangleRecord(char* dst, const std::vector<double>& vertexCoords, const unsigned int* indices)
+	{
+		const double* p0 = &vertexCoords[3 * static_cast<size_t>(indices[0])];
+		const double* p1 = &vertexCoords[3 * static_cast<size_t>(indices[1])];
+		const double* p2 = &vertexCoords[3 * static_cast<size_t>(indices[2])];
+
+		const std::array<double, 3> e1{ p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		const std::array<double, 3> e2{ p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		std::array<double, 3> normal{ e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		const double normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		if (normalLength > 0.0)
+		{
+			for (auto& coord : normal)
+				coord /= normalLength;
+		}
+
+		for (const auto& coord : normal)
+			dst = StoreLittleEndian(dst, static_cast<float>(coord));
+
+		for (const double* vertex : { p0, p1, p2 })
+		{
+			for (size_t i = 0; i < 3; i++)
+				dst = StoreLittleEndian(dst, static_cast<float>(vertex[i]));
+		}
+
+		StoreLittleEndian(dst, static_cast<uint16_t>(0));
+	}
+
+	ExportStatus STLExporter::Export(const GeometryKernel::BufferMeshGeometryData& data, const std::filesystem::path& exportedFileName)
+	{
+		std::filesystem::path resultPath = exportedFileName;
+
+		if (exportedFileName.extension().empty())
+			resultPath += ".stl";
+
+		else if (exportedFileName.extension() != ".stl")
+			return ExportStatus::InvalidExtension;
+
+		const size_t triangleCount = data.VertexIndices.size() / 3;
+		const size_t vertexCount = data.VertexCoords.size() / 3;
+		if (triangleCount == 0 || data.VertexIndices.size() % 3 != 0 || triangleCount > std::numeric_limits<uint32_t>::max())
+		{
+			MSG_CHECK(false, "STLExporter::Export: Exporting data without a valid triangle index buffer!\n");
+			return ExportStatus::InternalError;
+		}
+
+		if (std::any_of(data.VertexIndices.begin(), data.VertexIndices.end(), [vertexCount](const unsigned int& index) { return index >= vertexCount; }))
+		{
+			MSG_CHECK(false, "STLExporter::Export: Vertex index out of vertex buffer range!\n");
+			return ExportStatus::InternalError;
+		}
+
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+			return ExportStatus::FileNotCreated;
+
+		std::array<char, 84> header{};
+		std::copy(stl_header_comment.begin(), stl_header_comment.end(), header.begin());
+		StoreLittleEndian(header.data() + 80, static_cast<uint32_t>(triangleCount));
+		fileOStream.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+		std::vector<char> chunk(std::min(chunk_triangle_count, triangleCount) * stl_binary_triangle_size);
+		for (size_t i = 0; i < triangleCount; i += chunk_triangle_count)
+		{
+			const size_t count = std::min(chunk_triangle_count, triangleCount - i);
+			for (size_t j = 0; j < count; j++)
+				WriteTriangleRecord(chunk.data() + j * stl_binary_triangle_size, data.VertexCoords, &data.VertexIndices[3 * (i + j)]);
+
+			fileOStream.write(chunk.data(), static_cast<std::streamsize>(count * stl_binary_triangle_size));
+		}
+
+		fileOStream.close();
+		return ExportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,48 @@
+/*! \file  STLExporter.h
+ *  \brief Object for exporting 3D triangle mesh data to binary stereolithography STL (*.stl) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "IOHelperTypes.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \class STLExporter
+	/// \brief An exporter singleton object for exporting triangulated buffer mesh geometry data to a binary *.stl file.
+	///        Facet normals are computed from triangle vertices.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class STLExporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports a binary *.stl file to a given path.
+		 *  \param[in] data                      exported BufferMeshGeometryData (VertexIndices are read as triangle index triples)
+		 *  \param[in] exportedFileName          *.stl file name.
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(const GeometryKernel::BufferMeshGeometryData& data, const std::filesystem::path& exportedFileName);
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,409 @@
+/*! \file  STLImporter.cpp
+ *  \brief Implementation of an object for importing 3D geometry data from stereolithography STL (*.stl) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "STLImporter.h"
+
+#include "MemoryMappedFile.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+#include "Symplekt_UtilityGeneral/ToleranceSettings.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//!> \brief size of the binary STL header (80 B comment + UInt32 triangle count)
+	constexpr size_t stl_binary_header_size = 84;
+
+	//!> \brief size of a binary STL triangle record (normal, 3 vertices, UInt16 attribute byte count)
+	constexpr size_t stl_binary_triangle_size = 50;
+
+	//!> \brief minimum number of triangles welded on a separate thread
+	constexpr size_t stl_min_triangles_per_chunk = 1 << 14;
+
+	//!> \brief a triangle corner position
+	using STLCorner = std::array<double, 3>;
+
+	//=============================================================================
+	/// \struct STLVertexKey
+	/// \brief Hash table key of a welded vertex: bit patterns of exact coordinates, or quantized coordinates.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct STLVertexKey
+	{
+		std::array<int64_t, 3> Coords{};
+
+		bool operator==(const STLVertexKey& other) const = default;
+	};
+
+	//=============================================================================
+	/// \struct STLVertexKeyHash
+	/// \brief Hash function of STLVertexKey.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct STLVertexKeyHash
+	{
+		size_t operator()(const STLVertexKey& key) const
+		{
+			uint64_t hash = 0xcbf29ce484222325ull;
+			for (const auto& coord : key.Coords)
+			{
+				hash ^= static_cast<uint64_t>(coord);
+				hash *= 0x100000001b3ull;
+				hash ^= hash >> 29;
+			}
+			return static_cast<size_t>(hash);
+		}
+	};
+
+	//!> \brief hash table of welded vertices: key -> vertex index
+	using STLVertexMap = std::unordered_map<STLVertexKey, unsigned int, STLVertexKeyHash>;
+
+	//=============================================================================
+	/// \struct STLWeldedChunk
+	/// \brief Vertices and corner indices of a chunk of triangles welded independently of other chunks.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct STLWeldedChunk
+	{
+		std::vector<STLCorner>    Vertices;          //!> unique vertices in the order of their first occurrence
+		std::vector<STLVertexKey> Keys;              //!> keys of Vertices
+		std::vector<unsigned int> CornerIndices;     //!> chunk-local vertex index of each triangle corner
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parse mesh file name from the imported file path.
+	 *  \param[in] importedFilePath     path to the imported file.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::wstring GetGeometryNameFromFilePath(const std::filesystem::path& importedFilePath)
+	{
+		const auto stem = importedFilePath.stem();
+		return stem.wstring();
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Creates a hash table key of a corner position.
+	 *  \param[in] corner                 corner position.
+	 *  \param[in] inverseTolerance       1 / coordinate tolerance, or 0.0 for exact keys.
+	 *  \return key
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static STLVertexKey MakeVertexKey(const STLCorner& corner, const double inverseTolerance)
+	{
+		STLVertexKey key;
+		for (size_t i = 0; i < 3; i++)
+		{
+			if (inverseTolerance > 0.0)
+				key.Coords[i] = std::llround(corner[i] * inverseTolerance);
+			else
+				key.Coords[i] = std::bit_cast<int64_t>(corner[i] + 0.0); // + 0.0 turns -0.0 into 0.0
+		}
+		return key;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Welds corners of triangles [beginTriangle, endTriangle) into chunk-local vertices.
+	 *  \param[in] readCorner             corner reader: corner index -> position.
+	 *  \param[in] beginTriangle          first triangle of the chunk.
+	 *  \param[in] endTriangle            end of the chunk.
+	 *  \param[in] inverseTolerance       1 / coordinate tolerance, or 0.0 for exact welding.
+	 *  \param[in] chunk                  output welded chunk.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TCornerReader>
+	static void WeldChunk(const TCornerReader& readCorner, const size_t beginTriangle, const size_t endTriangle,
+		const double inverseTolerance, STLWeldedChunk& chunk)
+	{
+		const size_t cornerCount = 3 * (endTriangle - beginTriangle);
+		STLVertexMap vertexMap;
+		vertexMap.reserve(cornerCount / 4);
+		chunk.CornerIndices.reserve(cornerCount);
+
+		for (size_t i = 3 * beginTriangle; i < 3 * endTriangle; i++)
+		{
+			const STLCorner corner = readCorner(i);
+			const STLVertexKey key = MakeVertexKey(corner, inverseTolerance);
+			const auto [it, inserted] = vertexMap.try_emplace(key, static_cast<unsigned int>(chunk.Vertices.size()));
+			if (inserted)
+			{
+				chunk.Vertices.push_back(corner);
+				chunk.Keys.push_back(key);
+			}
+			chunk.CornerIndices.push_back(it->second);
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Welds triangle corners in parallel chunks, and merges the chunks into indexed geometry data.
+	 *  \param[in] readCorner             corner reader: corner index -> position (must be thread-safe).
+	 *  \param[in] triangleCount          number of triangles.
+	 *  \param[in] settings               welding settings.
+	 *  \param[in] data                   output geometry data.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TCornerReader>
+	static void WeldTriangles(const TCornerReader& readCorner, const size_t triangleCount, const STLImportSettings& settings, GeometryIOData& data)
+	{
+		data.VertexIndices.reserve(triangleCount);
+		if (!settings.WeldVertices)
+		{
+			data.Vertices.reserve(3 * triangleCount);
+			for (size_t i = 0; i < triangleCount; i++)
+			{
+				for (size_t j = 0; j < 3; j++)
+				{
+					const STLCorner corner = readCorner(3 * i + j);
+					data.Vertices.emplace_back(Vector3(corner[0], corner[1], corner[2]));
+				}
+				const auto firstIndex = static_cast<unsigned int>(3 * i);
+				data.VertexIndices.push_back({ firstIndex, firstIndex + 1, firstIndex + 2 });
+			}
+			return;
+		}
+
+		const double inverseTolerance = (settings.WeldWithCoordinateTolerance ? 1.0 / Util::GetCoordinateTolerance() : 0.0);
+		const size_t chunkCount = Util::GetParallelChunkCount(triangleCount, stl_min_triangles_per_chunk);
+		std::vector<STLWeldedChunk> chunks(chunkCount);
+		Util::ParallelForChunks(triangleCount, chunkCount,
+			[&](const size_t chunkIndex, const size_t beginTriangle, const size_t endTriangle)
+			{
+				WeldChunk(readCorner, beginTriangle, endTriangle, inverseTolerance, chunks[chunkIndex]);
+			});
+
+		// merging chunks in file order keeps the vertex order independent of the chunk count
+		STLVertexMap vertexMap;
+		vertexMap.reserve(chunks[0].Vertices.size() * chunkCount);
+		std::vector<unsigned int> chunkToGlobal;
+		for (const auto& chunk : chunks)
+		{
+			chunkToGlobal.resize(chunk.Vertices.size());
+			for (size_t i = 0; i < chunk.Vertices.size(); i++)
+			{
+				const auto [it, inserted] = vertexMap.try_emplace(chunk.Keys[i], static_cast<unsigned int>(data.Vertices.size()));
+				if (inserted)
+					data.Vertices.emplace_back(Vector3(chunk.Vertices[i][0], chunk.Vertices[i][1], chunk.Vertices[i][2]));
+				chunkToGlobal[i] = it->second;
+			}
+
+			for (size_t i = 0; i < chunk.CornerIndices.size(); i += 3)
+			{
+				const unsigned int v0 = chunkToGlobal[chunk.CornerIndices[i]];
+				const unsigned int v1 = chunkToGlobal[chunk.CornerIndices[i + 1]];
+				const unsigned int v2 = chunkToGlobal[chunk.CornerIndices[i + 2]];
+				if (v0 == v1 || v1 == v2 || v2 == v0)
+					continue; // degenerate after welding
+
+				data.VertexIndices.push_back({ v0, v1, v2 });
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Returns true if the file size matches the triangle count of a binary STL file.
+	 *  \param[in] contents        file contents.
+	 *  \return true if binary
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool IsBinarySTL(const std::string_view& contents)
+	{
+		if (contents.size() < stl_binary_header_size)
+			return false;
+
+		uint32_t triangleCount = 0;
+		std::memcpy(&triangleCount, contents.data() + 80, sizeof(triangleCount));
+		if constexpr (std::endian::native == std::endian::big)
+			triangleCount = ((triangleCount & 0xFF) << 24) | ((triangleCount & 0xFF00) << 8) | ((triangleCount >> 8) & 0xFF00) | (triangleCount >> 24);
+
+		return contents.size() == stl_binary_header_size + static_cast<size_t>(triangleCount) * stl_binary_triangle_size;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Loads a little endian Float32 value.
+	 *  \param[in] src             first byte of the value.
+	 *  \return loaded value
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static float LoadLittleEndianFloat(const char* src)
+	{
+		std::array<char, sizeof(float)> bytes;
+		std::memcpy(bytes.data(), src, sizeof(float));
+		if constexpr (std::endian::native == std::endian::big)
+			std::reverse(bytes.begin(), bytes.end());
+
+		return std::bit_cast<float>(bytes);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads the next whitespace-separated token from an ASCII *.stl file.
+	 *  \param[in] current        current position (advanced past the token).
+	 *  \param[in] end            end of the contents.
+	 *  \return token (empty at the end of the contents)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::string_view ReadASCIIToken(const char*& current, const char* end)
+	{
+		while (current < end && std::isspace(static_cast<unsigned char>(*current)))
+			current++;
+
+		const char* tokenStart = current;
+		while (current < end && !std::isspace(static_cast<unsigned char>(*current)))
+			current++;
+
+		return { tokenStart, static_cast<size_t>(current - tokenStart) };
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parses corner positions of an ASCII *.stl file. Each facet is required to have exactly three vertices.
+	 *  \param[in] contents        file contents.
+	 *  \param[in] corners         output corner positions (3 per triangle).
+	 *  \return true if the file is valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadASCIICorners(const std::string_view& contents, std::vector<STLCorner>& corners)
+	{
+		const char* current = contents.data();
+		const char* end = contents.data() + contents.size();
+		if (ReadASCIIToken(current, end) != "solid")
+			return false;
+
+		size_t facetCornerCount = 0;
+		for (std::string_view token = ReadASCIIToken(current, end); !token.empty(); token = ReadASCIIToken(current, end))
+		{
+			if (token == "facet")
+			{
+				facetCornerCount = 0;
+				continue;
+			}
+
+			if (token == "endfacet")
+			{
+				if (facetCornerCount != 3)
+					return false;
+				continue;
+			}
+
+			if (token != "vertex")
+				continue; // "normal" coordinates are skipped as unrecognized tokens, as well as the solid name
+
+			STLCorner corner{};
+			for (auto& coord : corner)
+			{
+				const std::string_view value = ReadASCIIToken(current, end);
+				const auto [ptr, errCode] = std::from_chars(value.data(), value.data() + value.size(), coord);
+				if (errCode != std::errc() || ptr != value.data() + value.size())
+					return false;
+			}
+
+			corners.push_back(corner);
+			facetCornerCount++;
+		}
+
+		return corners.size() % 3 == 0;
+	}
+
+	ImportStatus STLImporter::Import(const std::filesystem::path& importedFilePath, const STLImportSettings& settings)
+	{
+		return Import(importedFilePath, m_Data, settings);
+	}
+
+	ImportStatus STLImporter::Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData, const STLImportSettings& settings)
+	{
+		if (importedFilePath.empty() || !exists(importedFilePath))
+			return ImportStatus::FileNotFound;
+
+		if (!importedFilePath.has_extension() || (importedFilePath.extension() != ".stl" && importedFilePath.extension() != ".STL"))
+			return ImportStatus::InvalidExtension;
+
+		const MemoryMappedFile file(importedFilePath);
+		if (!file.IsOpen())
+			return ImportStatus::FileNotOpened;
+
+		importedData.Clear();
+		const std::string_view contents = file.View();
+
+		// ASCII files may start with "solid" just like many binary headers do, so the binary layout is checked first
+		if (IsBinarySTL(contents))
+		{
+			const size_t triangleCount = (contents.size() - stl_binary_header_size) / stl_binary_triangle_size;
+			const char* triangles = contents.data() + stl_binary_header_size;
+			const auto readCorner = [triangles](const size_t cornerIndex) -> STLCorner
+			{
+				// skip the facet normal (3 x Float32) of each triangle record
+				const char* src = triangles + (cornerIndex / 3) * stl_binary_triangle_size + (1 + cornerIndex % 3) * 3 * sizeof(float);
+				return { LoadLittleEndianFloat(src), LoadLittleEndianFloat(src + sizeof(float)), LoadLittleEndianFloat(src + 2 * sizeof(float)) };
+			};
+
+			WeldTriangles(readCorner, triangleCount, settings, importedData);
+		}
+		else
+		{
+			std::vector<STLCorner> corners;
+			if (!ReadASCIICorners(contents, corners))
+			{
+				MSG_CHECK(false, "STLImporter::Import: invalid *.stl file!\n");
+				return ImportStatus::InvalidFileFormat;
+			}
+
+			const auto readCorner = [&corners](const size_t cornerIndex) -> STLCorner { return corners[cornerIndex]; };
+			WeldTriangles(readCorner, corners.size() / 3, settings, importedData);
+		}
+
+		importedData.Name = GetGeometryNameFromFilePath(importedFilePath);
+		return ImportStatus::Complete;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
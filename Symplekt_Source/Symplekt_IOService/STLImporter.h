@@ -0,0 +1,101 @@
+/*! \file  STLImporter.h
+ *  \brief Object for importing 3D geometry data from stereolithography STL (*.stl) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "GeometryIOData.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \struct STLImportSettings
+	/// \brief Settings for STLImporter
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct STLImportSettings
+	{
+		bool WeldVertices{ true };                   //!< if false, every triangle corner becomes a separate vertex
+		bool WeldWithCoordinateTolerance{ false };   //!< if true, corners are welded if they fall into the same cell of a grid with Util::GetCoordinateTolerance() spacing
+	};
+
+	//=============================================================================
+	/// \class STLImporter
+	/// \brief An importer singleton object for importing geometry data from a binary or ASCII *.stl file and storing it as GeometryIOData.
+	///        STL files store a triangle soup, so identical triangle corners are welded into shared vertices while the triangles
+	///        are read from a memory-mapped file. Chunks of triangles are welded in parallel and their vertices are merged
+	///        in file order, so the result does not depend on the number of threads. Triangles which become degenerate
+	///        after welding are discarded, so the result can be passed directly to ReferencedMeshGeometryBuilder.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class STLImporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.stl file from a given path.
+		 *  \param[in] importedFilePath          path to an *.stl file.
+		 *  \param[in] settings                  vertex welding settings (exact welding by default).
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath, const STLImportSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.stl file from a given path into caller-owned data, e.g.: to be imported concurrently with other files.
+		 *  \param[in] importedFilePath          path to an *.stl file.
+		 *  \param[in] importedData              imported data (cleared first).
+		 *  \param[in] settings                  vertex welding settings (exact welding by default).
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData, const STLImportSettings& settings = {});
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imported data getter
+		 *  \return reference to m_Data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static GeometryIOData& Data()
+		{
+			return m_Data;
+		}
+
+	private:
+		//
+		// ==================================
+		//
+
+		inline static GeometryIOData m_Data{}; //!> imported geometry data
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,635 @@
+/*! \file  StreamingMeshProcessor.cpp
+ *  \brief Implementation of an object for out-of-core processing of binary Stanford PLY (*.ply) meshes within a fixed memory budget
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "StreamingMeshProcessor.h"
+
+#include "MemoryMappedFile.h"
+#include "PLYFormatUtils.h"
+
+#include "Symplekt_GeometryKernel/Box3.h"
+#include "Symplekt_GeometryKernel/Matrix3.h"
+#include "Symplekt_GeometryKernel/RectilinearGridBox3.h"
+#include "Symplekt_GeometryKernel/Vector3Utils.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//!> \brief maximum number of coarse grid cells (bounds the memory of the cell histogram)
+	constexpr size_t max_streaming_cell_count = 1 << 18;
+
+	//=============================================================================
+	/// \class PLYVertexReader
+	/// \brief Random access to fixed-size vertex records of a memory-mapped binary *.ply body.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class PLYVertexReader
+	{
+	public:
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		 *  \param[in] header         parsed PLYHeader.
+		 *  \param[in] element        vertex element (without list properties).
+		 *  \param[in] data           first byte of the vertex element body.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		PLYVertexReader(const PLYHeader& header, const PLYElement& element, const char* data)
+			: m_Data(data), m_SwapBytes(header.SwapBytes)
+		{
+			for (const auto& property : element.Properties)
+			{
+				if (const size_t slot = GetVertexSlot(property); slot < vertex_slot_count)
+				{
+					m_HasSlot[slot] = true;
+					m_SlotTypes[slot] = property.Type;
+					m_SlotOffsets[slot] = m_Stride;
+				}
+				m_Stride += GetPropertyTypeSize(property.Type);
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns true if the vertex element has x, y, z properties.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool HasPositions() const
+		{
+			return m_HasSlot[0] && m_HasSlot[1] && m_HasSlot[2];
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Returns true if the vertex element has nx, ny, nz properties.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] bool HasNormals() const
+		{
+			return m_HasSlot[3] && m_HasSlot[4] && m_HasSlot[5];
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Reads the position of a vertex.
+		 *  \param[in] vertexId       vertex index.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] Vector3 Position(const size_t& vertexId) const
+		{
+			return { Value(vertexId, 0), Value(vertexId, 1), Value(vertexId, 2) };
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Reads the normal of a vertex (requires HasNormals()).
+		 *  \param[in] vertexId       vertex index.
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		[[nodiscard]] Vector3 Normal(const size_t& vertexId) const
+		{
+			return { Value(vertexId, 3), Value(vertexId, 4), Value(vertexId, 5) };
+		}
+
+	private:
+		[[nodiscard]] double Value(const size_t& vertexId, const size_t& slot) const
+		{
+			double value = 0.0;
+			ConvertValues(m_SlotTypes[slot], m_Data + vertexId * m_Stride + m_SlotOffsets[slot], 0, 1, m_SwapBytes, &value, 1);
+			return value;
+		}
+
+		const char*                                         m_Data{ nullptr };
+		bool                                                m_SwapBytes{ false };
+		size_t                                              m_Stride{ 0 };
+		std::array<bool, vertex_slot_count>                 m_HasSlot{};
+		std::array<PLYPropertyType, vertex_slot_count>      m_SlotTypes{};
+		std::array<size_t, vertex_slot_count>               m_SlotOffsets{};
+	};
+
+	//=============================================================================
+	/// \struct StreamingGrid
+	/// \brief Coarse grid partitioning the vertices into cells. Cells are ordered x-fastest, so that consecutive cells are spatially coherent.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct StreamingGrid
+	{
+		Vector3 Min{};
+		double  CellSize{ 1.0 };
+		size_t  Nx{ 1 }, Ny{ 1 }, Nz{ 1 };
+
+		[[nodiscard]] size_t CellCount() const
+		{
+			return Nx * Ny * Nz;
+		}
+
+		[[nodiscard]] size_t CellId(const Vector3& point) const
+		{
+			const auto axisCell = [this](const double& coord, const double& minCoord, const size_t& n)
+			{
+				const double cell = std::floor((coord - minCoord) / CellSize);
+				return cell <= 0.0 ? static_cast<size_t>(0) : std::min(static_cast<size_t>(cell), n - 1);
+			};
+			return axisCell(point.X(), Min.X(), Nx) + Nx * (axisCell(point.Y(), Min.Y(), Ny) + Ny * axisCell(point.Z(), Min.Z(), Nz));
+		}
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Walks a binary element record by record, calling listJob(property, firstItem, itemCount) for each list property value.
+	 *  \param[in] header         parsed PLYHeader.
+	 *  \param[in] element        walked element.
+	 *  \param[in] body           remaining file body.
+	 *  \param[in] listJob        job called for each list.
+	 *  \return number of bytes of the element, or std::nullopt if the body is truncated.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TListJob>
+	static std::optional<size_t> WalkBinaryElement(const PLYHeader& header, const PLYElement& element, const std::string_view& body, TListJob&& listJob)
+	{
+		const bool hasLists = std::any_of(element.Properties.begin(), element.Properties.end(),
+			[](const PLYProperty& property) { return property.IsList; });
+		if (!hasLists)
+		{
+			size_t stride = 0;
+			for (const auto& property : element.Properties)
+				stride += GetPropertyTypeSize(property.Type);
+
+			if (stride > 0 && element.Count > body.size() / stride)
+				return std::nullopt;
+
+			return element.Count * stride;
+		}
+
+		size_t offset = 0;
+		for (size_t i = 0; i < element.Count; i++)
+		{
+			for (const auto& property : element.Properties)
+			{
+				if (!property.IsList)
+				{
+					const size_t size = GetPropertyTypeSize(property.Type);
+					if (size > body.size() - offset)
+						return std::nullopt;
+
+					offset += size;
+					continue;
+				}
+
+				const size_t countSize = GetPropertyTypeSize(property.CountType);
+				if (countSize > body.size() - offset)
+					return std::nullopt;
+
+				int64_t count = 0;
+				ConvertValues(property.CountType, body.data() + offset, countSize, 1, header.SwapBytes, &count, 1);
+				offset += countSize;
+
+				const size_t itemSize = GetPropertyTypeSize(property.Type);
+				if (count < 0 || static_cast<size_t>(count) > (body.size() - offset) / itemSize)
+					return std::nullopt;
+
+				listJob(property, body.data() + offset, static_cast<size_t>(count));
+				offset += static_cast<size_t>(count) * itemSize;
+			}
+		}
+
+		return offset;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Streams the polygons of a binary face element, calling polygonJob(polygonVertexIndices) for each of them.
+	 *  \param[in] header         parsed PLYHeader.
+	 *  \param[in] faceElement    face element.
+	 *  \param[in] body           face element body.
+	 *  \param[in] polygonJob     job called for each polygon (the index buffer is reused).
+	 *  \return number of bytes of the element, or std::nullopt if the body is truncated.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename TPolygonJob>
+	static std::optional<size_t> ForEachBinaryPolygon(const PLYHeader& header, const PLYElement& faceElement, const std::string_view& body, TPolygonJob&& polygonJob)
+	{
+		std::vector<unsigned int> polygon;
+		return WalkBinaryElement(header, faceElement, body, [&](const PLYProperty& property, const char* items, const size_t& count)
+		{
+			if (!IsFaceIndexList(property))
+				return;
+
+			polygon.resize(count);
+			ConvertValues(property.Type, items, GetPropertyTypeSize(property.Type), count, header.SwapBytes, polygon.data(), 1);
+			polygonJob(polygon);
+		});
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Creates a coarse grid over the vertex bounding box, with approximately targetCellCount cubic cells.
+	 *  \param[in] bounds             vertex bounding box.
+	 *  \param[in] targetCellCount    requested number of cells.
+	 *  \return StreamingGrid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static StreamingGrid CreateStreamingGrid(const Box3& bounds, const size_t& targetCellCount)
+	{
+		StreamingGrid grid;
+		if (bounds.IsEmpty())
+			return grid;
+
+		const Vector3 extent = bounds.Max() - bounds.Min();
+		const double maxExtent = std::max({ extent.X(), extent.Y(), extent.Z() });
+		const double cellsPerAxis = std::ceil(std::cbrt(static_cast<double>(targetCellCount)));
+		grid.CellSize = (maxExtent > 0.0 ? maxExtent / cellsPerAxis : 1.0);
+
+		const RectilinearGridBox3 gridBox(grid.CellSize, bounds.Min(), bounds.Max());
+		const Vector3 gridSize = gridBox.GetSize();
+		grid.Min = gridBox.Min();
+		grid.Nx = std::max(static_cast<size_t>(std::llround(gridSize.X() / grid.CellSize)), static_cast<size_t>(1));
+		grid.Ny = std::max(static_cast<size_t>(std::llround(gridSize.Y() / grid.CellSize)), static_cast<size_t>(1));
+		grid.Nz = std::max(static_cast<size_t>(std::llround(gridSize.Z() / grid.CellSize)), static_cast<size_t>(1));
+		return grid;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Groups runs of consecutive grid cells into chunks of at most vertexBudget vertices.
+	 *  \param[in] cellVertexCounts   number of vertices in each cell.
+	 *  \param[in] vertexBudget       maximum number of vertices of a chunk (unless a single cell exceeds it).
+	 *  \return chunk cell ranges [begin, end)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::vector<std::pair<size_t, size_t>> CreateChunks(const std::vector<size_t>& cellVertexCounts, const size_t& vertexBudget)
+	{
+		std::vector<std::pair<size_t, size_t>> chunks;
+		size_t chunkBegin = 0;
+		size_t chunkVertexCount = 0;
+		for (size_t cellId = 0; cellId < cellVertexCounts.size(); cellId++)
+		{
+			if (chunkVertexCount > 0 && chunkVertexCount + cellVertexCounts[cellId] > vertexBudget)
+			{
+				chunks.emplace_back(chunkBegin, cellId);
+				chunkBegin = cellId;
+				chunkVertexCount = 0;
+			}
+			chunkVertexCount += cellVertexCounts[cellId];
+		}
+
+		if (chunkVertexCount > 0)
+			chunks.emplace_back(chunkBegin, cellVertexCounts.size());
+
+		return chunks;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes the output *.ply header.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] vertexCount    number of vertices.
+	 *  \param[in] faceCount      number of faces (no face element is declared if 0).
+	 *  \param[in] hasNormals     if true, nx, ny, nz vertex properties are declared.
+	 *  \param[in] countType      face list count type name.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteStreamingHeader(std::ofstream& fileOStream, const size_t& vertexCount, const size_t& faceCount, const bool hasNormals, const std::string& countType)
+	{
+		fileOStream << "ply\n" << "format binary_little_endian 1.0\n" << "comment Symplektis streaming export\n";
+		fileOStream << "element vertex " << vertexCount << "\n";
+		fileOStream << "property double x\n" << "property double y\n" << "property double z\n";
+		if (hasNormals)
+			fileOStream << "property double nx\n" << "property double ny\n" << "property double nz\n";
+
+		if (faceCount > 0)
+		{
+			fileOStream << "element face " << faceCount << "\n";
+			fileOStream << "property list " << countType << " int vertex_indices\n";
+		}
+
+		fileOStream << "end_header\n";
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Returns true if a vertex belongs to a chunk.
+	 *  \param[in] chunkVertexIds     sorted indices of chunk vertices.
+	 *  \param[in] vertexId           vertex index.
+	 *  \param[in] localId            output position of the vertex within the chunk.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool FindChunkVertex(const std::vector<size_t>& chunkVertexIds, const size_t& vertexId, size_t& localId)
+	{
+		const auto it = std::lower_bound(chunkVertexIds.begin(), chunkVertexIds.end(), vertexId);
+		if (it == chunkVertexIds.end() || *it != vertexId)
+			return false;
+
+		localId = static_cast<size_t>(it - chunkVertexIds.begin());
+		return true;
+	}
+
+	StreamingMeshStatistics StreamingMeshProcessor::Process(
+		const std::filesystem::path&   inputFilePath,
+		const std::filesystem::path&   outputFilePath,
+		const StreamingMeshOperation&  operation,
+		const StreamingMeshSettings&   settings)
+	{
+		StreamingMeshStatistics result;
+		if (inputFilePath.empty() || !exists(inputFilePath))
+		{
+			result.ReadStatus = ImportStatus::FileNotFound;
+			return result;
+		}
+
+		if (!inputFilePath.has_extension() || inputFilePath.extension() != ".ply")
+		{
+			result.ReadStatus = ImportStatus::InvalidExtension;
+			return result;
+		}
+
+		const MemoryMappedFile file(inputFilePath);
+		if (!file.IsOpen())
+		{
+			result.ReadStatus = ImportStatus::FileNotOpened;
+			return result;
+		}
+
+		const auto header = ParseHeader(file.View());
+		if (!header || !header->IsBinary)
+		{
+			MSG_CHECK(false, "StreamingMeshProcessor::Process: input is not a binary *.ply file!\n");
+			result.ReadStatus = ImportStatus::InvalidFileFormat;
+			return result;
+		}
+
+		// locate the vertex and face element bodies, and validate the polygons in a single streaming pass
+		const std::string_view body = file.View().substr(header->BodyOffset);
+		const PLYElement* vertexElement = nullptr;
+		const PLYElement* faceElement = nullptr;
+		std::string_view vertexBody;
+		std::string_view faceBody;
+		size_t maxPolygonSize = 0;
+		bool polygonsAreValid = true;
+		size_t offset = 0;
+		for (const auto& element : header->Elements)
+		{
+			const bool isVertex = (element.Name == "vertex" && !vertexElement);
+			const bool isFace = (element.Name == "face" && !faceElement);
+			const size_t vertexCount = (vertexElement ? vertexElement->Count : 0);
+			const auto elementSize = isFace ?
+				ForEachBinaryPolygon(*header, element, body.substr(offset), [&](const std::vector<unsigned int>& polygon)
+				{
+					maxPolygonSize = std::max(maxPolygonSize, polygon.size());
+					polygonsAreValid = polygonsAreValid &&
+						std::all_of(polygon.begin(), polygon.end(), [vertexCount](const unsigned int& index) { return index < vertexCount; });
+				}) :
+				WalkBinaryElement(*header, element, body.substr(offset), [](const PLYProperty&, const char*, const size_t&) {});
+			if (!elementSize)
+			{
+				MSG_CHECK(false, "StreamingMeshProcessor::Process: truncated *.ply body!\n");
+				result.ReadStatus = ImportStatus::InvalidFileFormat;
+				return result;
+			}
+
+			if (isVertex)
+			{
+				vertexElement = &element;
+				vertexBody = body.substr(offset, *elementSize);
+			}
+			if (isFace)
+			{
+				faceElement = &element;
+				faceBody = body.substr(offset, *elementSize);
+			}
+			offset += *elementSize;
+		}
+
+		const bool vertexElementIsValid = vertexElement && std::none_of(vertexElement->Properties.begin(), vertexElement->Properties.end(),
+			[](const PLYProperty& property) { return property.IsList; });
+		const PLYVertexReader vertices(*header, vertexElementIsValid ? *vertexElement : PLYElement{}, vertexBody.data());
+		if (!vertexElementIsValid || !vertices.HasPositions() || !polygonsAreValid)
+		{
+			MSG_CHECK(false, "StreamingMeshProcessor::Process: *.ply file needs a vertex element of fixed-size records with x, y, z and faces with valid vertex indices!\n");
+			result.ReadStatus = ImportStatus::InvalidFileFormat;
+			return result;
+		}
+		result.ReadStatus = ImportStatus::Complete;
+
+		auto outputPath = outputFilePath;
+		if (!outputPath.has_extension())
+			outputPath.replace_extension(".ply");
+		if (outputPath.extension() != ".ply")
+		{
+			result.WriteStatus = ExportStatus::InvalidExtension;
+			return result;
+		}
+
+		std::ofstream fileOStream(outputPath, std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+		{
+			result.WriteStatus = ExportStatus::FileNotCreated;
+			return result;
+		}
+
+		// partition the vertices by a coarse grid, and group consecutive cells into chunks within the vertex budget
+		const size_t vertexCount = vertexElement->Count;
+		const size_t vertexBudget = std::max(settings.ChunkVertexBudget, static_cast<size_t>(1));
+		Box3 bounds;
+		for (size_t i = 0; i < vertexCount; i++)
+			bounds.ExpandByPoint(vertices.Position(i));
+
+		const size_t targetCellCount = std::clamp((vertexCount + vertexBudget - 1) / vertexBudget * std::max(settings.CellsPerChunk, static_cast<size_t>(1)),
+			static_cast<size_t>(1), max_streaming_cell_count);
+		const auto grid = CreateStreamingGrid(bounds, targetCellCount);
+		std::vector<size_t> cellVertexCounts(grid.CellCount(), 0);
+		for (size_t i = 0; i < vertexCount; i++)
+			cellVertexCounts[grid.CellId(vertices.Position(i))]++;
+
+		const auto chunks = CreateChunks(cellVertexCounts, vertexBudget);
+		result.CellCount = grid.CellCount();
+		result.ChunkCount = chunks.size();
+
+		// header and face element (the vertex element is filled chunk by chunk afterwards)
+		const bool outputHasNormals = (operation.Type == StreamingVertexOperationType::ComputeVertexNormals || vertices.HasNormals());
+		const size_t faceCount = (faceElement ? faceElement->Count : 0);
+		const std::string countType = (maxPolygonSize <= std::numeric_limits<uint8_t>::max() ? "uchar" :
+			(maxPolygonSize <= std::numeric_limits<uint16_t>::max() ? "ushort" : "uint"));
+		WriteStreamingHeader(fileOStream, vertexCount, faceCount, outputHasNormals, countType);
+
+		const auto vertexSectionOffset = static_cast<std::streamoff>(fileOStream.tellp());
+		const size_t vertexRecordSize = (outputHasNormals ? 6 : 3) * sizeof(double);
+		PLYBinaryWriter writer(fileOStream, std::endian::native != std::endian::little);
+		if (faceElement)
+		{
+			fileOStream.seekp(vertexSectionOffset + static_cast<std::streamoff>(vertexCount * vertexRecordSize));
+			(void)ForEachBinaryPolygon(*header, *faceElement, faceBody, [&](const std::vector<unsigned int>& polygon)
+			{
+				if (countType == "uchar")
+					writer.Write(static_cast<uint8_t>(polygon.size()));
+				else if (countType == "ushort")
+					writer.Write(static_cast<uint16_t>(polygon.size()));
+				else
+					writer.Write(static_cast<uint32_t>(polygon.size()));
+
+				for (const auto& index : polygon)
+					writer.Write(static_cast<int32_t>(index));
+			});
+			writer.Flush();
+		}
+
+		const Matrix3 normalMatrix(operation.Transformation.Inverse().Transpose());
+		std::vector<size_t> chunkVertexIds;
+		std::vector<Vector3> chunkPositions;
+		std::vector<Vector3> chunkNormals;
+		std::vector<unsigned int> chunkNeighborCounts;
+		for (const auto& [cellBegin, cellEnd] : chunks)
+		{
+			chunkVertexIds.clear();
+			for (size_t i = 0; i < vertexCount; i++)
+			{
+				if (const size_t cellId = grid.CellId(vertices.Position(i)); cellId >= cellBegin && cellId < cellEnd)
+					chunkVertexIds.push_back(i);
+			}
+			result.MaxChunkVertexCount = std::max(result.MaxChunkVertexCount, chunkVertexIds.size());
+
+			chunkPositions.resize(chunkVertexIds.size());
+			chunkNormals.resize(outputHasNormals ? chunkVertexIds.size() : 0);
+			for (size_t localId = 0; localId < chunkVertexIds.size(); localId++)
+			{
+				chunkPositions[localId] = vertices.Position(chunkVertexIds[localId]);
+				if (vertices.HasNormals())
+					chunkNormals[localId] = vertices.Normal(chunkVertexIds[localId]);
+			}
+
+			if (operation.Type == StreamingVertexOperationType::Transform)
+			{
+				for (auto& position : chunkPositions)
+					position *= operation.Transformation;
+				for (auto& normal : chunkNormals)
+					(normal *= normalMatrix).Normalize();
+			}
+			else if (operation.Type == StreamingVertexOperationType::ComputeVertexNormals && faceElement)
+			{
+				std::fill(chunkNormals.begin(), chunkNormals.end(), Vector3());
+				(void)ForEachBinaryPolygon(*header, *faceElement, faceBody, [&](const std::vector<unsigned int>& polygon)
+				{
+					size_t localId = 0;
+					if (std::none_of(polygon.begin(), polygon.end(), [&](const unsigned int& index) { return FindChunkVertex(chunkVertexIds, index, localId); }))
+						return;
+
+					// area-weighted polygon normal (Newell's method), halo vertex positions are read from the mapped file
+					Vector3 polygonNormal;
+					for (size_t i = 0; i < polygon.size(); i++)
+						polygonNormal += CrossProduct(vertices.Position(polygon[i]), vertices.Position(polygon[(i + 1) % polygon.size()]));
+					polygonNormal *= 0.5;
+
+					for (const auto& index : polygon)
+					{
+						if (FindChunkVertex(chunkVertexIds, index, localId))
+							chunkNormals[localId] += polygonNormal;
+					}
+				});
+
+				for (auto& normal : chunkNormals)
+				{
+					if (normal.GetLengthSquared() > 0.0)
+						normal.Normalize();
+				}
+			}
+			else if (operation.Type == StreamingVertexOperationType::LaplacianSmoothing && faceElement)
+			{
+				std::vector<Vector3> neighborSums(chunkVertexIds.size());
+				chunkNeighborCounts.assign(chunkVertexIds.size(), 0);
+				(void)ForEachBinaryPolygon(*header, *faceElement, faceBody, [&](const std::vector<unsigned int>& polygon)
+				{
+					for (size_t i = 0; i < polygon.size(); i++)
+					{
+						size_t localId = 0;
+						if (!FindChunkVertex(chunkVertexIds, polygon[i], localId))
+							continue;
+
+						neighborSums[localId] += vertices.Position(polygon[(i + polygon.size() - 1) % polygon.size()]);
+						neighborSums[localId] += vertices.Position(polygon[(i + 1) % polygon.size()]);
+						chunkNeighborCounts[localId] += 2;
+					}
+				});
+
+				for (size_t localId = 0; localId < chunkVertexIds.size(); localId++)
+				{
+					if (chunkNeighborCounts[localId] == 0)
+						continue;
+
+					const Vector3 average = neighborSums[localId] / static_cast<double>(chunkNeighborCounts[localId]);
+					chunkPositions[localId] += (average - chunkPositions[localId]) * operation.SmoothingFactor;
+				}
+			}
+
+			// write runs of consecutive vertex records at their original positions
+			for (size_t localId = 0; localId < chunkVertexIds.size(); localId++)
+			{
+				if (localId == 0 || chunkVertexIds[localId] != chunkVertexIds[localId - 1] + 1)
+				{
+					writer.Flush();
+					fileOStream.seekp(vertexSectionOffset + static_cast<std::streamoff>(chunkVertexIds[localId] * vertexRecordSize));
+				}
+
+				writer.Write(chunkPositions[localId].X());
+				writer.Write(chunkPositions[localId].Y());
+				writer.Write(chunkPositions[localId].Z());
+				if (!outputHasNormals)
+					continue;
+
+				writer.Write(chunkNormals[localId].X());
+				writer.Write(chunkNormals[localId].Y());
+				writer.Write(chunkNormals[localId].Z());
+			}
+			writer.Flush();
+		}
+
+		fileOStream.close();
+		result.WriteStatus = (fileOStream.fail() ? ExportStatus::InternalError : ExportStatus::Complete);
+		return result;
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
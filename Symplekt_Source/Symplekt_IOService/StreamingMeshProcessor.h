@@ -0,0 +1,125 @@
+/*! \file  StreamingMeshProcessor.h
+ *  \brief Object for out-of-core processing of binary Stanford PLY (*.ply) meshes within a fixed memory budget
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "IOHelperTypes.h"
+
+#include "Symplekt_GeometryKernel/Matrix4.h"
+
+#include <filesystem>
+
+namespace Symplektis::IOService
+{
+	//=============================================================================
+	/// \enum StreamingVertexOperationType
+	/// \brief Per-vertex operations supported by StreamingMeshProcessor.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class StreamingVertexOperationType
+	{
+		Transform            = 0,    //!< vertex positions are multiplied by a transformation matrix (normals by its inverse transpose)
+		ComputeVertexNormals = 1,    //!< vertex normals are computed as normalized sums of area-weighted normals of adjacent polygons
+		LaplacianSmoothing   = 2     //!< a single step of the umbrella operator, with neighbors across each adjacent polygon edge
+	};
+
+	//=============================================================================
+	/// \struct StreamingMeshOperation
+	/// \brief A per-vertex operation applied by StreamingMeshProcessor.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct StreamingMeshOperation
+	{
+		StreamingVertexOperationType  Type{ StreamingVertexOperationType::Transform };
+		GeometryKernel::Matrix4       Transformation{};           //!< transformation matrix (Transform only)
+		double                        SmoothingFactor{ 0.5 };     //!< lambda in p' = p + lambda * (average neighbor - p) (LaplacianSmoothing only)
+	};
+
+	//=============================================================================
+	/// \struct StreamingMeshSettings
+	/// \brief Settings for StreamingMeshProcessor.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct StreamingMeshSettings
+	{
+		size_t ChunkVertexBudget{ 1 << 20 };   //!< maximum number of vertices processed at once (a single grid cell above the budget is processed alone)
+		size_t CellsPerChunk{ 8 };             //!< average number of coarse grid cells per chunk (determines the grid resolution)
+	};
+
+	//=============================================================================
+	/// \struct StreamingMeshStatistics
+	/// \brief Statistics of a StreamingMeshProcessor run.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct StreamingMeshStatistics
+	{
+		ImportStatus ReadStatus{ ImportStatus::InternalError };
+		ExportStatus WriteStatus{ ExportStatus::InternalError };
+		size_t       CellCount{ 0 };              //!< number of coarse grid cells
+		size_t       ChunkCount{ 0 };             //!< number of processed chunks
+		size_t       MaxChunkVertexCount{ 0 };    //!< maximum number of vertices held in memory at once
+	};
+
+	//=============================================================================
+	/// \class StreamingMeshProcessor
+	/// \brief Applies a per-vertex operation to a binary *.ply mesh which might not fit into memory once expanded into
+	///        ReferencedMeshGeometryData. The input file is memory-mapped, and its vertices are partitioned by the cells of a coarse
+	///        RectilinearGridBox3 over their bounding box. Runs of consecutive grid cells form chunks of at most ChunkVertexBudget vertices,
+	///        which are processed one by one: for each chunk, the face element is streamed from the mapped file, and the faces
+	///        touching chunk vertices (together with their halo vertices outside the chunk, read directly from the mapped file)
+	///        contribute to the results of the chunk vertices. Results are written to a binary little-endian *.ply file at the positions
+	///        of the original vertices, so the face element is copied without re-indexing. Only per-chunk data are held in memory,
+	///        at the cost of streaming the vertex and face elements once per chunk.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class StreamingMeshProcessor
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Applies a per-vertex operation to a binary *.ply file and writes the result into a binary *.ply file.
+		 *  \param[in] inputFilePath          path to a binary *.ply file with a vertex element of fixed-size records.
+		 *  \param[in] outputFilePath         path to the output *.ply file (extension is appended if missing).
+		 *  \param[in] operation              per-vertex operation.
+		 *  \param[in] settings               chunking settings.
+		 *  \return statistics with import and export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] StreamingMeshStatistics Process(
+			const std::filesystem::path&   inputFilePath,
+			const std::filesystem::path&   outputFilePath,
+			const StreamingMeshOperation&  operation,
+			const StreamingMeshSettings&   settings = {});
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
 
 #include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/VTKImporter.h"
 #include "Symplekt_IOService/BaseGeometryImportHandle.h"
 
 namespace Symplektis::UnitTests
@@ -184,4 +185,51 @@ namespace Symplektis::UnitTests
 		EXPECT_EQ(meshData.VertexIndices.size(), 912);
 	}
 	
+	TEST(BaseGeometryImportHandle_Suite, SFBunnyWithoutHolesOBJFile_ImportIntoLocalDataAndMoveToBuffGeom_SameBufferGeometryAsCopyPathAndEmptiedIOData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple_no_holes.obj";
+		GeometryIOData importedData;
+		ASSERT_EQ(OBJImporter::Import(fileFullPath), ImportStatus::Complete);
+		const auto& expectedMeshData = ConvertIODataToBufferMeshGeometryData(OBJImporter::Data());
+
+		// Act
+		const auto importStatus = OBJImporter::Import(fileFullPath, importedData);
+		const auto& meshData = ConvertIODataToBufferMeshGeometryData(std::move(importedData));
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(meshData.Name, L"bunnySimple_no_holes");
+		EXPECT_EQ(meshData.Type, expectedMeshData.Type);
+		EXPECT_EQ(meshData.VertexCoords, expectedMeshData.VertexCoords);
+		EXPECT_EQ(meshData.VertexNormalCoords, expectedMeshData.VertexNormalCoords);
+		EXPECT_EQ(meshData.VertexIndices, expectedMeshData.VertexIndices);
+		EXPECT_TRUE(importedData.Vertices.empty());
+		EXPECT_TRUE(importedData.VertexIndices.empty());
+		EXPECT_TRUE(importedData.VertexNormals.empty());
+	}
+
+	TEST(BaseGeometryImportHandle_Suite, SFBunnyVTKFile_ImportIntoLocalDataAndMoveToRefGeom_CorrectReferencedGeometrySFBunnyData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.vtk";
+		GeometryIOData importedData;
+
+		// Act
+		const auto importStatus = VTKImporter::Import(fileFullPath, importedData);
+		const auto& meshData = ConvertIODataToReferencedMeshGeometryData(std::move(importedData));
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(meshData.Name, L"bunnySimple");
+		EXPECT_EQ(meshData.Type, GeometryKernel::PolyMeshType::Triangular);
+		EXPECT_EQ(meshData.Vertices.size(), 2503);
+		EXPECT_EQ(meshData.HalfEdges.size(), 14946);
+		EXPECT_EQ(meshData.Edges.size(), 7473);
+		EXPECT_EQ(meshData.Faces.size(), 4968);
+		EXPECT_EQ(meshData.BoundaryCycles.size(), 4);
+		EXPECT_TRUE(importedData.Vertices.empty());
+		EXPECT_TRUE(importedData.VertexIndices.empty());
+	}
+
 } // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*! \file  BatchMeshImporter_Tests.cpp
+ *  \brief Tests for importing batches of mesh files on multiple threads.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/BatchMeshImporter.h"
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/PLYExporter.h"
+#include "Symplekt_IOService/STLExporter.h"
+
+#include <fstream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	TEST(BatchMeshImporter_TestSuite, MixedFormatsAndInvalidInputs_BatchImport_ResultsInInputOrder)
+	{
+		// Arrange
+		const auto inputPath = symplektRootPath / "Symplekt_ResourceData\\";
+		const auto outputPath = symplektRootPath / "Symplekt_OutputData\\UnitTests";
+		ASSERT_EQ(OBJImporter::Import(inputPath / "bunnySimple.obj"), ImportStatus::Complete);
+		const auto bunnyData = OBJImporter::Data();
+		ASSERT_EQ(PLYExporter::Export(bunnyData, outputPath / "bunnySimple_batch.ply"), ExportStatus::Complete);
+		ASSERT_EQ(STLExporter::Export(ConvertIODataToBufferMeshGeometryData(bunnyData), outputPath / "bunnySimple_batch.stl"), ExportStatus::Complete);
+		const std::vector<std::filesystem::path> filePaths{
+			inputPath / "bunnySimple.obj",
+			inputPath / "bunnySimple.vtk",
+			outputPath / "bunnySimple_batch.ply",
+			outputPath / "bunnySimple_batch.stl",
+			inputPath / "nonExistentFile.obj",
+			inputPath / "arc.obj",
+			inputPath / "Cube.obj"
+		};
+
+		// Act
+		const BatchMeshImporter importer({ 3 });
+		const auto results = importer.Import(filePaths);
+
+		// Assert
+		ASSERT_EQ(results.size(), filePaths.size());
+		for (size_t i = 0; i < 4; i++)
+		{
+			EXPECT_EQ(results[i].FilePath, filePaths[i]);
+			EXPECT_EQ(results[i].Status, ImportStatus::Complete);
+			EXPECT_EQ(results[i].IOData.Vertices.size(), 2503);
+			EXPECT_EQ(results[i].IOData.VertexIndices.size(), 4968);
+		}
+		EXPECT_EQ(results[4].Status, ImportStatus::FileNotFound);
+		EXPECT_EQ(results[5].Status, ImportStatus::Complete);
+		EXPECT_EQ(results[5].IOData.Name, L"arc");
+		EXPECT_EQ(results[6].Status, ImportStatus::Complete);
+		EXPECT_EQ(results[6].IOData.Vertices.size(), 8);
+		EXPECT_TRUE(results[6].MeshData.Vertices.empty());
+	}
+
+	TEST(BatchMeshImporter_TestSuite, DirectoryWithUnsupportedFile_ImportDirectoryWithUnitMemoryBudget_SupportedFilesBuiltSequentially)
+	{
+		// Arrange
+		const auto directoryPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "BatchImport";
+		std::filesystem::remove_all(directoryPath);
+		std::filesystem::create_directories(directoryPath);
+		ASSERT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj"), ImportStatus::Complete);
+		ASSERT_EQ(PLYExporter::Export(OBJImporter::Data(), directoryPath / "a_bunny.ply"), ExportStatus::Complete);
+		ASSERT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "Cube.obj"), ImportStatus::Complete);
+		ASSERT_EQ(STLExporter::Export(ConvertIODataToBufferMeshGeometryData(OBJImporter::Data()), directoryPath / "b_cube.stl"), ExportStatus::Complete);
+		std::ofstream(directoryPath / "c_notes.txt") << "not a mesh";
+		BatchImportSettings settings;
+		settings.ThreadCount = 4;
+		settings.MemoryBudget = 1;
+		settings.BuildMeshes = true;
+
+		// Act
+		const BatchMeshImporter importer(settings);
+		const auto results = importer.ImportDirectory(directoryPath);
+		const auto nonExistentResults = importer.ImportDirectory(directoryPath / "nonExistentDirectory");
+
+		// Assert
+		EXPECT_EQ(importer.Settings().ThreadCount, 4);
+		EXPECT_TRUE(nonExistentResults.empty());
+		ASSERT_EQ(results.size(), 2);
+		EXPECT_EQ(results[0].FilePath.filename(), "a_bunny.ply");
+		EXPECT_EQ(results[0].Status, ImportStatus::Complete);
+		EXPECT_TRUE(results[0].IOData.Vertices.empty());
+		EXPECT_EQ(results[0].MeshData.Vertices.size(), 2503);
+		EXPECT_EQ(results[0].MeshData.Faces.size(), 4968);
+		EXPECT_EQ(results[1].FilePath.filename(), "b_cube.stl");
+		EXPECT_EQ(results[1].Status, ImportStatus::Complete);
+		EXPECT_EQ(results[1].MeshData.Vertices.size(), 8);
+		EXPECT_EQ(results[1].MeshData.Faces.size(), 12);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
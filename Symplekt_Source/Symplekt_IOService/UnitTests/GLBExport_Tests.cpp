@@ -0,0 +1,159 @@
+/*! \file  GLBExport_Tests.cpp
+ *  \brief Tests for exporting triangle mesh data to binary glTF 2.0 (*.glb) files.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/GLBExporter.h"
+#include "Symplekt_IOService/OBJImporter.h"
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+	using namespace GeometryKernel;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static std::string ReadGLBFileContents(const std::filesystem::path& filePath)
+	{
+		std::ifstream fileIStream(filePath, std::ios::in | std::ios::binary);
+		std::stringstream buffer;
+		buffer << fileIStream.rdbuf();
+		return buffer.str();
+	}
+
+	template <typename T>
+	static T ReadGLBValue(const std::string& contents, const size_t position)
+	{
+		T value{};
+		std::memcpy(&value, contents.data() + position, sizeof(T));
+		return value;
+	}
+
+	TEST(GLBExport_TestSuite, SFBunnyBufferMeshData_ExportGLB_ChunksContainFloatVerticesAndShortIndices)
+	{
+		// Arrange
+		const auto objImportStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj");
+		const auto bufferData = ConvertIODataToBufferMeshGeometryData(OBJImporter::Data());
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimple.glb";
+
+		// Act
+		const auto exportStatus = GLBExporter::Export(bufferData, exportFilePath);
+		const auto contents = ReadGLBFileContents(exportFilePath);
+
+		// Assert
+		EXPECT_EQ(objImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		ASSERT_GT(contents.size(), 28);
+		EXPECT_EQ(contents.substr(0, 4), "glTF");
+		EXPECT_EQ(ReadGLBValue<uint32_t>(contents, 4), 2);
+		EXPECT_EQ(ReadGLBValue<uint32_t>(contents, 8), contents.size());
+
+		const auto jsonLength = ReadGLBValue<uint32_t>(contents, 12);
+		EXPECT_EQ(jsonLength % 4, 0);
+		EXPECT_EQ(contents.substr(16, 4), "JSON");
+		const auto json = contents.substr(20, jsonLength);
+		EXPECT_NE(json.find("\"version\":\"2.0\""), std::string::npos);
+		EXPECT_NE(json.find("\"count\":2503,\"type\":\"VEC3\""), std::string::npos);
+		EXPECT_NE(json.find("\"componentType\":5123,\"count\":14904,\"type\":\"SCALAR\""), std::string::npos);
+		EXPECT_NE(json.find("\"min\":["), std::string::npos);
+
+		const size_t binHeaderPos = 20 + jsonLength;
+		const auto binLength = ReadGLBValue<uint32_t>(contents, binHeaderPos);
+		EXPECT_EQ(contents.substr(binHeaderPos + 4, 4), std::string("BIN\0", 4));
+		EXPECT_EQ(binHeaderPos + 8 + binLength, contents.size());
+
+		const size_t binPos = binHeaderPos + 8;
+		for (size_t i = 0; i < bufferData.VertexCoords.size(); i++)
+			ASSERT_EQ(ReadGLBValue<float>(contents, binPos + i * sizeof(float)), static_cast<float>(bufferData.VertexCoords[i]));
+
+		const size_t indicesPos = binPos + (bufferData.VertexCoords.size() + bufferData.VertexNormalCoords.size()) * sizeof(float);
+		for (size_t i = 0; i < bufferData.VertexIndices.size(); i++)
+			ASSERT_EQ(ReadGLBValue<uint16_t>(contents, indicesPos + i * sizeof(uint16_t)), bufferData.VertexIndices[i]);
+	}
+
+	TEST(GLBExport_TestSuite, LargeGridBufferMeshData_ExportGLB_IndicesWrittenAsUInt32)
+	{
+		// Arrange
+		constexpr unsigned int gridSize = 300;
+		BufferMeshGeometryData gridData{ L"largeGrid" };
+		for (unsigned int j = 0; j < gridSize; j++)
+		{
+			for (unsigned int i = 0; i < gridSize; i++)
+				gridData.VertexCoords.insert(gridData.VertexCoords.end(), { static_cast<double>(i), static_cast<double>(j), 0.0 });
+		}
+		for (unsigned int j = 0; j + 1 < gridSize; j++)
+		{
+			for (unsigned int i = 0; i + 1 < gridSize; i++)
+			{
+				const unsigned int v = j * gridSize + i;
+				gridData.VertexIndices.insert(gridData.VertexIndices.end(), { v, v + 1, v + gridSize, v + 1, v + gridSize + 1, v + gridSize });
+			}
+		}
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "largeGridUInt32.glb";
+
+		// Act
+		const auto exportStatus = GLBExporter::Export(gridData, exportFilePath);
+		const auto contents = ReadGLBFileContents(exportFilePath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		const auto jsonLength = ReadGLBValue<uint32_t>(contents, 12);
+		const auto json = contents.substr(20, jsonLength);
+		EXPECT_EQ(json.find("NORMAL"), std::string::npos);
+		EXPECT_NE(json.find("\"componentType\":5125"), std::string::npos);
+		EXPECT_NE(json.find("\"max\":[299,299,0]"), std::string::npos);
+		EXPECT_NE(json.find("\"meshes\":[{\"name\":\"largeGrid\""), std::string::npos);
+
+		const size_t indicesPos = 20 + jsonLength + 8 + gridData.VertexCoords.size() * sizeof(float);
+		EXPECT_EQ(ReadGLBValue<uint32_t>(contents, indicesPos + (gridData.VertexIndices.size() - 1) * sizeof(uint32_t)), gridData.VertexIndices.back());
+	}
+
+	TEST(GLBExport_TestSuite, InvalidInputs_ExportGLB_CorrespondingStatuses)
+	{
+		// Arrange
+		const auto objImportStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "Cube.obj");
+		const auto cubeData = ConvertIODataToBufferMeshGeometryData(OBJImporter::Data());
+		BufferMeshGeometryData invalidData{ L"invalid" };
+		invalidData.VertexCoords = { 0.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+		invalidData.VertexIndices = { 0, 1, 2 };
+		const auto outputPath = symplektRootPath / "Symplekt_OutputData\\UnitTests";
+
+		// Act
+		const auto wrongExtensionStatus = GLBExporter::Export(cubeData, outputPath / "Cube.gltf");
+		const auto invalidDataStatus = GLBExporter::Export(invalidData, outputPath / "invalid.glb");
+		const auto missingExtensionStatus = GLBExporter::Export(cubeData, outputPath / "Cube");
+		auto unnamedData = cubeData;
+		unnamedData.Name.clear();
+		const auto unnamedDataStatus = GLBExporter::Export(unnamedData, outputPath / "unnamedCube.glb");
+		const auto unnamedContents = ReadGLBFileContents(outputPath / "unnamedCube.glb");
+		auto nonFiniteData = cubeData;
+		nonFiniteData.VertexCoords[4] = std::numeric_limits<double>::quiet_NaN();
+		const auto nanCoordStatus = GLBExporter::Export(nonFiniteData, outputPath / "nonFinite.glb");
+		nonFiniteData.VertexCoords[4] = 1e300; // overflows float
+		const auto overflowCoordStatus = GLBExporter::Export(nonFiniteData, outputPath / "nonFinite.glb");
+
+		// Assert
+		EXPECT_EQ(objImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(wrongExtensionStatus, ExportStatus::InvalidExtension);
+		EXPECT_EQ(invalidDataStatus, ExportStatus::InternalError);
+		EXPECT_EQ(missingExtensionStatus, ExportStatus::Complete);
+		EXPECT_EQ(unnamedDataStatus, ExportStatus::Complete);
+		EXPECT_NE(unnamedContents.find("\"meshes\":[{\"name\":\"unnamedCube\""), std::string::npos);
+		EXPECT_EQ(nanCoordStatus, ExportStatus::InternalError);
+		EXPECT_EQ(overflowCoordStatus, ExportStatus::InternalError);
+		EXPECT_TRUE(exists(outputPath / "Cube.glb"));
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,112 @@
+/*! \file  MeshProcessingPipeline_Tests.cpp
+ *  \brief Tests for batch processing of mesh files in a pipeline of concurrent stages.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/Vertex.h"
+
+#include "Symplekt_IOService/MeshProcessingPipeline.h"
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/VTKImporter.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	TEST(MeshProcessingPipeline_Suite, OBJFilesAndInvalidInputs_RunPipelineWithScalingCallback_ScaledVTKFilesWrittenAndFailuresReported)
+	{
+		// Arrange
+		const auto inputPath = symplektRootPath / "Symplekt_ResourceData\\";
+		const auto outputPath = symplektRootPath / "Symplekt_OutputData\\UnitTests";
+		const std::vector<MeshPipelineJob> jobs{
+			{ inputPath / "bunnySimple.obj", outputPath / "bunnySimple_pipeline.vtk" },
+			{ inputPath / "arc.obj", outputPath / "arc_pipeline.vtk" },
+			{ inputPath / "nonExistentFile.obj", outputPath / "nonExistentFile_pipeline.vtk" },
+			{ inputPath / "bunnySimple.vtk", outputPath / "bunnySimpleVTK_pipeline.obj" },
+			{ inputPath / "Cube.obj", outputPath / "Cube_pipeline.stl" }
+		};
+		std::atomic<size_t> processedCount{ 0 };
+		const MeshPipelineSettings settings{ 2, 2, 2, 2, 1 };
+
+		// Act
+		const MeshProcessingPipeline pipeline(settings);
+		const auto results = pipeline.Run(jobs, [&processedCount](GeometryKernel::ReferencedMeshGeometryData& meshData)
+		{
+			for (auto& vertex : meshData.Vertices)
+				vertex.Position() *= 2.0;
+			++processedCount;
+		});
+
+		// Assert
+		ASSERT_EQ(results.size(), jobs.size());
+		EXPECT_EQ(processedCount.load(), 4);
+
+		EXPECT_TRUE(results[0].Completed);
+		EXPECT_TRUE(results[1].Completed);
+		EXPECT_TRUE(results[3].Completed);
+		EXPECT_EQ(results[2].ReadStatus, ImportStatus::FileNotFound);
+		EXPECT_FALSE(results[2].Completed);
+		EXPECT_EQ(results[4].ReadStatus, ImportStatus::Complete);
+		EXPECT_EQ(results[4].WriteStatus, ExportStatus::InvalidExtension);
+		EXPECT_FALSE(results[4].Completed);
+
+		ASSERT_EQ(OBJImporter::Import(jobs[1].InputFilePath), ImportStatus::Complete);
+		const auto originalArcData = OBJImporter::Data();
+		ASSERT_EQ(VTKImporter::Import(jobs[1].OutputFilePath), ImportStatus::Complete);
+		const auto& exportedArcData = VTKImporter::Data();
+		EXPECT_EQ(exportedArcData.VertexIndices.size(), originalArcData.VertexIndices.size());
+		ASSERT_EQ(exportedArcData.Vertices.size(), originalArcData.Vertices.size());
+		for (size_t i = 0; i < originalArcData.Vertices.size(); i++)
+			EXPECT_TRUE((originalArcData.Vertices[i] * 2.0).EqualsWithTolerance(exportedArcData.Vertices[i]));
+
+		ASSERT_EQ(OBJImporter::Import(jobs[3].OutputFilePath), ImportStatus::Complete);
+		EXPECT_EQ(OBJImporter::Data().Vertices.size(), 2503);
+		EXPECT_EQ(OBJImporter::Data().VertexIndices.size(), 4968);
+	}
+
+	TEST(MeshProcessingPipeline_Suite, ManyJobsWithUnitQueueCapacity_RunPipelineWithThrowingCallback_AllOtherJobsCompleted)
+	{
+		// Arrange
+		constexpr size_t jobCount = 16;
+		constexpr size_t failingJobId = 5;
+		std::vector<MeshPipelineJob> jobs;
+		for (size_t i = 0; i < jobCount; i++)
+		{
+			jobs.push_back({
+				symplektRootPath / "Symplekt_ResourceData\\" / (i == failingJobId ? "Cube.obj" : "arc.obj"),
+				symplektRootPath / "Symplekt_OutputData\\UnitTests" / ("arc_pipeline_" + std::to_string(i) + ".ply") });
+		}
+		const MeshPipelineSettings settings{ 3, 0, 3, 2, 1 };
+
+		// Act
+		const MeshProcessingPipeline pipeline(settings);
+		const auto results = pipeline.Run(jobs, [](const GeometryKernel::ReferencedMeshGeometryData& meshData)
+		{
+			if (meshData.Name == L"Cube")
+				throw std::runtime_error("processing failed");
+		});
+
+		// Assert
+		EXPECT_GE(pipeline.Settings().BuildWorkerCount, 1);
+		ASSERT_EQ(results.size(), jobCount);
+		for (size_t i = 0; i < jobCount; i++)
+		{
+			EXPECT_EQ(results[i].ReadStatus, ImportStatus::Complete);
+			EXPECT_EQ(results[i].Completed, i != failingJobId);
+		}
+		EXPECT_EQ(results[failingJobId].ErrorMessage, "processing failed");
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
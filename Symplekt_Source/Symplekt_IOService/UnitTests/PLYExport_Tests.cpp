@@ -0,0 +1,109 @@
+/*! \file  PLYExport_Tests.cpp
+ *  \brief Tests for exporting geometry data to Stanford PLY (*.ply) files.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/PLYExporter.h"
+#include "Symplekt_IOService/PLYImporter.h"
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static void ExpectEqualGeometryIOData(const GeometryIOData& expected, const GeometryIOData& actual, const double tolerance)
+	{
+		ASSERT_EQ(actual.Vertices.size(), expected.Vertices.size());
+		for (size_t i = 0; i < expected.Vertices.size(); i++)
+		{
+			EXPECT_NEAR(actual.Vertices[i].X(), expected.Vertices[i].X(), tolerance);
+			EXPECT_NEAR(actual.Vertices[i].Y(), expected.Vertices[i].Y(), tolerance);
+			EXPECT_NEAR(actual.Vertices[i].Z(), expected.Vertices[i].Z(), tolerance);
+		}
+
+		ASSERT_EQ(actual.VertexNormals.size(), expected.VertexNormals.size());
+		for (size_t i = 0; i < expected.VertexNormals.size(); i++)
+		{
+			EXPECT_NEAR(actual.VertexNormals[i].X(), expected.VertexNormals[i].X(), tolerance);
+			EXPECT_NEAR(actual.VertexNormals[i].Y(), expected.VertexNormals[i].Y(), tolerance);
+			EXPECT_NEAR(actual.VertexNormals[i].Z(), expected.VertexNormals[i].Z(), tolerance);
+		}
+
+		EXPECT_EQ(actual.VertexIndices, expected.VertexIndices);
+	}
+
+	static void ExportAndReimportOBJData(const std::string& objFileName, const std::string& plyFileName, const PLYExportSettings& settings, const double tolerance)
+	{
+		const auto importStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / objFileName);
+		const auto objData = OBJImporter::Data();
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / plyFileName;
+
+		const auto exportStatus = PLYExporter::Export(objData, exportFilePath, settings);
+		const auto plyImportStatus = PLYImporter::Import(exportFilePath);
+
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(plyImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(PLYImporter::Data().Name, exportFilePath.stem().wstring());
+		ExpectEqualGeometryIOData(objData, PLYImporter::Data(), tolerance);
+	}
+
+	TEST(PLYExport_TestSuite, ImportedSFBunnyOBJData_ExportBinaryLittleEndianPLY_ReimportedDataMatches)
+	{
+		ExportAndReimportOBJData("bunnySimple.obj", "bunnySimpleLE.ply", PLYExportSettings{ PLYDataFormat::BinaryLittleEndian, PLYScalarType::Float64 }, 0.0);
+	}
+
+	TEST(PLYExport_TestSuite, ImportedSFBunnyOBJData_ExportBinaryBigEndianPLY_ReimportedDataMatches)
+	{
+		ExportAndReimportOBJData("bunnySimple.obj", "bunnySimpleBE.ply", PLYExportSettings{ PLYDataFormat::BinaryBigEndian, PLYScalarType::Float64 }, 0.0);
+	}
+
+	TEST(PLYExport_TestSuite, ImportedSFBunnyOBJData_ExportASCIIPLY_ReimportedDataMatches)
+	{
+		ExportAndReimportOBJData("bunnySimple.obj", "bunnySimpleASCII.ply", PLYExportSettings{ PLYDataFormat::ASCII, PLYScalarType::Float64 }, 0.0);
+	}
+
+	TEST(PLYExport_TestSuite, ImportedSFBunnyWithNormalsOBJData_ExportFloat32PLY_ReimportedDataMatchesWithinFloatPrecision)
+	{
+		ExportAndReimportOBJData("bunnySimple_no_holes.obj", "bunnySimple_no_holesF32.ply", PLYExportSettings{ PLYDataFormat::BinaryBigEndian, PLYScalarType::Float32 }, 1e-5);
+	}
+
+	TEST(PLYExport_TestSuite, ImportedArcOBJData_ExportPLYWithoutExtension_ReimportedQuadsMatch)
+	{
+		// Arrange
+		const auto importStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "arc.obj");
+		const auto objData = OBJImporter::Data();
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "arcExported";
+
+		// Act
+		const auto exportStatus = PLYExporter::Export(objData, exportFilePath);
+		const auto plyImportStatus = PLYImporter::Import(symplektRootPath / "Symplekt_OutputData\\UnitTests" / "arcExported.ply");
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(plyImportStatus, ImportStatus::Complete);
+		ExpectEqualGeometryIOData(objData, PLYImporter::Data(), 0.0);
+	}
+
+	TEST(PLYExport_TestSuite, GeometryData_ExportToFileWithWrongExtension_InvalidExtension)
+	{
+		// Arrange
+		const auto geomIOData = GeometryIOData{ L"triangle", { {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0} }, { {0, 1, 2} }, {} };
+
+		// Act
+		const auto exportStatus = PLYExporter::Export(geomIOData, symplektRootPath / "Symplekt_OutputData\\UnitTests" / "triangle.obj");
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::InvalidExtension);
+	}
+
+} // namespace Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*! \file  PLYImport_Tests.cpp
+ *  \brief Tests for importing files of Stanford PLY format.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/PLYImporter.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static std::filesystem::path WritePLYFileForTesting(const std::string& fileName, const std::string& contents)
+	{
+		const auto filePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / fileName;
+		std::ofstream fileOStream(filePath.c_str(), std::ios::out | std::ios::binary);
+		fileOStream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+		return filePath;
+	}
+
+	template <typename T>
+	static void AppendBigEndian(std::string& contents, const T value)
+	{
+		std::array<char, sizeof(T)> bytes;
+		std::memcpy(bytes.data(), &value, sizeof(T));
+		if constexpr (std::endian::native == std::endian::little)
+			std::reverse(bytes.begin(), bytes.end());
+
+		contents.append(bytes.data(), bytes.size());
+	}
+
+	static std::string GetBigEndianPLYContentsForTesting()
+	{
+		std::string contents =
+			"ply\n"
+			"format binary_big_endian 1.0\n"
+			"comment quad and triangle with an extra element and per-face color\n"
+			"element vertex 5\n"
+			"property float x\n"
+			"property float y\n"
+			"property float z\n"
+			"property uchar confidence\n"
+			"element material 2\n"
+			"property list uchar float coefficients\n"
+			"element face 2\n"
+			"property list ushort uint vertex_indices\n"
+			"property uchar red\n"
+			"end_header\n";
+
+		for (int i = 0; i < 5; i++)
+		{
+			AppendBigEndian(contents, static_cast<float>(i));
+			AppendBigEndian(contents, static_cast<float>(2 * i));
+			AppendBigEndian(contents, static_cast<float>(-i));
+			AppendBigEndian(contents, static_cast<uint8_t>(255));
+		}
+
+		AppendBigEndian(contents, static_cast<uint8_t>(1));
+		AppendBigEndian(contents, 0.5f);
+		AppendBigEndian(contents, static_cast<uint8_t>(0));
+
+		AppendBigEndian(contents, static_cast<uint16_t>(4));
+		for (const uint32_t index : { 0, 1, 2, 3 })
+			AppendBigEndian(contents, index);
+		AppendBigEndian(contents, static_cast<uint8_t>(128));
+
+		AppendBigEndian(contents, static_cast<uint16_t>(3));
+		for (const uint32_t index : { 2, 3, 4 })
+			AppendBigEndian(contents, index);
+		AppendBigEndian(contents, static_cast<uint8_t>(64));
+
+		return contents;
+	}
+
+	TEST(PLYImport_TestSuite, ASCIIPLYFileWithNormals_Import_ImportedPolygonsAndNormals)
+	{
+		// Arrange
+		const auto fileFullPath = WritePLYFileForTesting("asciiPolygons.ply",
+			"ply\r\n"
+			"format ascii 1.0\r\n"
+			"comment Windows line endings\r\n"
+			"obj_info generated for testing\r\n"
+			"element vertex 4\r\n"
+			"property double x\r\n"
+			"property double y\r\n"
+			"property double z\r\n"
+			"property float nx\r\n"
+			"property float ny\r\n"
+			"property float nz\r\n"
+			"element face 2\r\n"
+			"property list uchar int vertex_index\r\n"
+			"end_header\r\n"
+			"0 0 0 0 0 1\r\n"
+			"1.5 0 0 0 0 1\r\n"
+			"1.5 2.25 0 0 0 1\r\n"
+			"-0.125 2 1e-3 0 0.6 0.8\r\n"
+			"3 0 1 2\r\n"
+			"4 0 1 2 3\r\n");
+
+		// Act
+		const auto importStatus = PLYImporter::Import(fileFullPath);
+		const auto& geomData = PLYImporter::Data();
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(geomData.Name, L"asciiPolygons");
+		ASSERT_EQ(geomData.Vertices.size(), 4);
+		EXPECT_DOUBLE_EQ(geomData.Vertices[2].Y(), 2.25);
+		EXPECT_DOUBLE_EQ(geomData.Vertices[3].X(), -0.125);
+		EXPECT_DOUBLE_EQ(geomData.Vertices[3].Z(), 1e-3);
+		ASSERT_EQ(geomData.VertexNormals.size(), 4);
+		EXPECT_NEAR(geomData.VertexNormals[3].Y(), 0.6, 1e-7);
+		EXPECT_NEAR(geomData.VertexNormals[3].Z(), 0.8, 1e-7);
+		const std::vector<std::vector<unsigned int>> expectedIndices{ {0, 1, 2}, {0, 1, 2, 3} };
+		EXPECT_EQ(geomData.VertexIndices, expectedIndices);
+	}
+
+	TEST(PLYImport_TestSuite, BigEndianPLYFileWithExtraProperties_Import_ImportedPolygons)
+	{
+		// Arrange
+		const auto fileFullPath = WritePLYFileForTesting("bigEndianPolygons.ply", GetBigEndianPLYContentsForTesting());
+
+		// Act
+		const auto importStatus = PLYImporter::Import(fileFullPath);
+		const auto& geomData = PLYImporter::Data();
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ASSERT_EQ(geomData.Vertices.size(), 5);
+		for (size_t i = 0; i < geomData.Vertices.size(); i++)
+		{
+			EXPECT_DOUBLE_EQ(geomData.Vertices[i].X(), static_cast<double>(i));
+			EXPECT_DOUBLE_EQ(geomData.Vertices[i].Y(), 2.0 * static_cast<double>(i));
+			EXPECT_DOUBLE_EQ(geomData.Vertices[i].Z(), -static_cast<double>(i));
+		}
+		EXPECT_TRUE(geomData.VertexNormals.empty());
+		const std::vector<std::vector<unsigned int>> expectedIndices{ {0, 1, 2, 3}, {2, 3, 4} };
+		EXPECT_EQ(geomData.VertexIndices, expectedIndices);
+	}
+
+	TEST(PLYImport_TestSuite, TruncatedBinaryPLYFile_Import_InvalidFileFormat)
+	{
+		// Arrange
+		auto contents = GetBigEndianPLYContentsForTesting();
+		contents.resize(contents.size() - 6);
+		const auto fileFullPath = WritePLYFileForTesting("truncatedPolygons.ply", contents);
+
+		// Act
+		const auto importStatus = PLYImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+		EXPECT_TRUE(PLYImporter::Data().Vertices.empty());
+	}
+
+	TEST(PLYImport_TestSuite, PLYFileWithOutOfRangeIndex_Import_InvalidFileFormat)
+	{
+		// Arrange
+		const auto fileFullPath = WritePLYFileForTesting("outOfRangeIndex.ply",
+			"ply\nformat ascii 1.0\nelement vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+			"element face 1\nproperty list uchar int vertex_indices\nend_header\n"
+			"0 0 0\n1 0 0\n0 1 0\n3 0 1 3\n");
+
+		// Act
+		const auto importStatus = PLYImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+	}
+
+	TEST(PLYImport_TestSuite, PLYFileWithoutVertexCoordinates_Import_InvalidFileFormat)
+	{
+		// Arrange
+		const auto fileFullPath = WritePLYFileForTesting("noCoordinates.ply",
+			"ply\nformat binary_little_endian 1.0\nelement vertex 1\nproperty float u\nproperty float v\nend_header\n01234567");
+
+		// Act
+		const auto importStatus = PLYImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+	}
+
+	TEST(PLYImport_TestSuite, OBJFile_ImportAsPLY_InvalidExtension)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj";
+
+		// Act
+		const auto importStatus = PLYImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidExtension);
+	}
+
+} // namespace Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,171 @@
+/*! \file  QuantizedMesh_Tests.cpp
+ *  \brief Tests for the quantized mesh codec and *.qmesh files.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/QuantizedMeshCodec.h"
+#include "Symplekt_IOService/QuantizedMeshExporter.h"
+#include "Symplekt_IOService/QuantizedMeshImporter.h"
+
+#include "Symplekt_GeometryKernel/Box3.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static GeometryIOData ImportOBJ(const std::string& objFileName)
+	{
+		EXPECT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / objFileName), ImportStatus::Complete);
+		return OBJImporter::Data();
+	}
+
+	// decoding re-orders vertices, so polygons are compared corner by corner
+	static void ExpectSamePolygonsWithinTolerance(const GeometryIOData& originalData, const GeometryIOData& decodedData, const double positionTolerance, const double normalTolerance)
+	{
+		ASSERT_EQ(decodedData.Vertices.size(), originalData.Vertices.size());
+		ASSERT_EQ(decodedData.VertexIndices.size(), originalData.VertexIndices.size());
+		for (size_t i = 0; i < originalData.VertexIndices.size(); i++)
+		{
+			ASSERT_EQ(decodedData.VertexIndices[i].size(), originalData.VertexIndices[i].size());
+			for (size_t j = 0; j < originalData.VertexIndices[i].size(); j++)
+			{
+				const auto originalId = originalData.VertexIndices[i][j];
+				const auto decodedId = decodedData.VertexIndices[i][j];
+				EXPECT_NEAR(decodedData.Vertices[decodedId].X(), originalData.Vertices[originalId].X(), positionTolerance);
+				EXPECT_NEAR(decodedData.Vertices[decodedId].Y(), originalData.Vertices[originalId].Y(), positionTolerance);
+				EXPECT_NEAR(decodedData.Vertices[decodedId].Z(), originalData.Vertices[originalId].Z(), positionTolerance);
+				if (!decodedData.VertexNormals.empty())
+				{
+					const auto originalNormal = originalData.VertexNormals[originalId] / originalData.VertexNormals[originalId].GetLength();
+					EXPECT_NEAR((decodedData.VertexNormals[decodedId] - originalNormal).GetLength(), 0.0, normalTolerance);
+				}
+			}
+		}
+	}
+
+	TEST(QuantizedMesh_TestSuite, SFBunny_EncodeDecode16BitPositions_VerticesWithinQuantizationErrorAndRatioAbove3)
+	{
+		// Arrange
+		const auto originalData = ImportOBJ("bunnySimple.obj");
+		GeometryKernel::Box3 bounds;
+		bounds.ExpandByPoints(originalData.Vertices);
+		const auto extent = bounds.Max() - bounds.Min();
+		const double positionTolerance = 0.5 * std::max({ extent.X(), extent.Y(), extent.Z() }) / 65535.0 + 1e-12;
+		GeometryIOData decodedData;
+
+		// Act
+		const auto encoding = QuantizedMeshCodec::Encode(originalData, { 16, 12 });
+		const auto status = QuantizedMeshCodec::Decode(encoding.Bytes, decodedData);
+
+		// Assert
+		EXPECT_EQ(status, ImportStatus::Complete);
+		EXPECT_EQ(decodedData.Name, originalData.Name);
+		EXPECT_EQ(decodedData.VertexNormals.size(), originalData.VertexNormals.size());
+		EXPECT_EQ(encoding.UncompressedByteSize, 2503 * 24 + 4968 * 16);
+		EXPECT_GT(encoding.CompressionRatio(), 3.0);
+		ExpectSamePolygonsWithinTolerance(originalData, decodedData, positionTolerance, 2e-3);
+	}
+
+	TEST(QuantizedMesh_TestSuite, SFBunny_EncodeWithLowerBitDepth_HigherCompressionRatio)
+	{
+		// Arrange
+		const auto originalData = ImportOBJ("bunnySimple.obj");
+
+		// Act
+		const auto fineEncoding = QuantizedMeshCodec::Encode(originalData, { 20, 16 });
+		const auto coarseEncoding = QuantizedMeshCodec::Encode(originalData, { 10, 8 });
+
+		// Assert
+		EXPECT_EQ(fineEncoding.UncompressedByteSize, coarseEncoding.UncompressedByteSize);
+		EXPECT_GT(coarseEncoding.CompressionRatio(), fineEncoding.CompressionRatio());
+	}
+
+	TEST(QuantizedMesh_TestSuite, PolygonalSphere_ExportImportQMesh_SamePolygonsWithinQuantizationError)
+	{
+		// Arrange
+		const auto originalData = ImportOBJ("PolygonalSphere.obj");
+		const auto qmeshFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "PolygonalSphere.qmesh";
+
+		// Act
+		const auto exportStatus = QuantizedMeshExporter::Export(originalData, qmeshFilePath, { 24, 16 });
+		const auto importStatus = QuantizedMeshImporter::Import(qmeshFilePath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ExpectSamePolygonsWithinTolerance(originalData, QuantizedMeshImporter::Data(), 1e-5, 1e-4);
+	}
+
+	TEST(QuantizedMesh_TestSuite, InvalidInputs_EncodeDecodeExportImport_CorrespondingStatuses)
+	{
+		// Arrange
+		const auto originalData = ImportOBJ("Cube.obj");
+		auto invalidData = originalData;
+		invalidData.VertexIndices.back().back() = 100;
+		const auto outputPath = symplektRootPath / "Symplekt_OutputData\\UnitTests";
+		const auto encoding = QuantizedMeshCodec::Encode(originalData);
+		const std::vector<uint8_t> truncatedBytes(encoding.Bytes.begin(), encoding.Bytes.end() - 1);
+		auto corruptedBytes = encoding.Bytes;
+		corruptedBytes[0] = 'X';
+		GeometryIOData decodedData;
+
+		// Act
+		const auto invalidEncoding = QuantizedMeshCodec::Encode(invalidData);
+		const auto truncatedStatus = QuantizedMeshCodec::Decode(truncatedBytes, decodedData);
+		const auto corruptedStatus = QuantizedMeshCodec::Decode(corruptedBytes, decodedData);
+		const auto wrongExtensionStatus = QuantizedMeshExporter::Export(originalData, outputPath / "CubeQuantized.obj");
+		const auto missingExtensionStatus = QuantizedMeshExporter::Export(originalData, outputPath / "CubeQuantized");
+		const auto missingFileStatus = QuantizedMeshImporter::Import(outputPath / "nonExistentFile.qmesh");
+		const auto importStatus = QuantizedMeshImporter::Import(outputPath / "CubeQuantized.qmesh");
+
+		// Assert
+		EXPECT_TRUE(invalidEncoding.Bytes.empty());
+		EXPECT_EQ(invalidEncoding.CompressionRatio(), 0.0);
+		EXPECT_EQ(truncatedStatus, ImportStatus::InvalidFileFormat);
+		EXPECT_EQ(corruptedStatus, ImportStatus::InvalidFileFormat);
+		EXPECT_TRUE(decodedData.Vertices.empty());
+		EXPECT_EQ(wrongExtensionStatus, ExportStatus::InvalidExtension);
+		EXPECT_EQ(missingExtensionStatus, ExportStatus::Complete);
+		EXPECT_EQ(missingFileStatus, ImportStatus::FileNotFound);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(QuantizedMeshImporter::Data().VertexIndices.size(), originalData.VertexIndices.size());
+	}
+
+	TEST(QuantizedMesh_TestSuite, DISABLED_SFBunny_EncodeDecodeThroughput)
+	{
+		// Arrange
+		const auto originalData = ImportOBJ("bunnySimple.obj");
+		constexpr size_t repeatCount = 200;
+		GeometryIOData decodedData;
+
+		// Act
+		const auto encodeStart = std::chrono::steady_clock::now();
+		QuantizedMeshEncoding encoding;
+		for (size_t i = 0; i < repeatCount; i++)
+			encoding = QuantizedMeshCodec::Encode(originalData);
+		const auto encodeEnd = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < repeatCount; i++)
+			EXPECT_EQ(QuantizedMeshCodec::Decode(encoding.Bytes, decodedData), ImportStatus::Complete);
+		const auto decodeEnd = std::chrono::steady_clock::now();
+
+		// Assert
+		const double megaBytes = static_cast<double>(encoding.UncompressedByteSize * repeatCount) / (1024.0 * 1024.0);
+		std::cout << "compression ratio: " << encoding.CompressionRatio() << "\n";
+		std::cout << "encode: " << megaBytes / std::chrono::duration<double>(encodeEnd - encodeStart).count() << " MB/s\n";
+		std::cout << "decode: " << megaBytes / std::chrono::duration<double>(decodeEnd - encodeEnd).count() << " MB/s\n";
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
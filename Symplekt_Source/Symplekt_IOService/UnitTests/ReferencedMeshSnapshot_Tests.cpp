@@ -0,0 +1,260 @@
+/*! \file  ReferencedMeshSnapshot_Tests.cpp
+ *  \brief Tests for exporting & importing native binary referenced mesh snapshot (*.rmsnap) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/ChecksumUtils.h"
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/ReferencedMeshSnapshotExporter.h"
+#include "Symplekt_IOService/ReferencedMeshSnapshotImporter.h"
+#include "Symplekt_IOService/ReferencedMeshSnapshotView.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+	using namespace GeometryKernel;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static ReferencedMeshGeometryData ImportReferencedMeshFromOBJ(const std::string& fileName)
+	{
+		const auto importStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / fileName);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		return ConvertIODataToReferencedMeshGeometryData(OBJImporter::Data());
+	}
+
+	static void ExpectEqualFaces(const std::vector<Face>& expected, const std::vector<Face>& actual)
+	{
+		ASSERT_EQ(actual.size(), expected.size());
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			EXPECT_EQ(actual[i].HalfEdge(), expected[i].HalfEdge());
+			EXPECT_EQ(actual[i].Index(), expected[i].Index());
+			EXPECT_EQ(actual[i].GetTriangulation(), expected[i].GetTriangulation());
+		}
+	}
+
+	static void ExpectEqualReferencedMeshData(const ReferencedMeshGeometryData& expected, const ReferencedMeshGeometryData& actual)
+	{
+		EXPECT_EQ(actual.Name, expected.Name);
+		EXPECT_EQ(actual.Type, expected.Type);
+
+		ASSERT_EQ(actual.HalfEdges.size(), expected.HalfEdges.size());
+		for (size_t i = 0; i < expected.HalfEdges.size(); i++)
+		{
+			EXPECT_EQ(actual.HalfEdges[i].NextHalfEdge(), expected.HalfEdges[i].NextHalfEdge());
+			EXPECT_EQ(actual.HalfEdges[i].OppositeHalfEdge(), expected.HalfEdges[i].OppositeHalfEdge());
+			EXPECT_EQ(actual.HalfEdges[i].TailVertex(), expected.HalfEdges[i].TailVertex());
+			EXPECT_EQ(actual.HalfEdges[i].Edge(), expected.HalfEdges[i].Edge());
+			EXPECT_EQ(actual.HalfEdges[i].AdjacentFace(), expected.HalfEdges[i].AdjacentFace());
+			EXPECT_EQ(actual.HalfEdges[i].IsBoundary(), expected.HalfEdges[i].IsBoundary());
+		}
+
+		ASSERT_EQ(actual.Vertices.size(), expected.Vertices.size());
+		for (size_t i = 0; i < expected.Vertices.size(); i++)
+		{
+			EXPECT_EQ(actual.Vertices[i].HalfEdge(), expected.Vertices[i].HalfEdge());
+			EXPECT_EQ(actual.Vertices[i].Position(), expected.Vertices[i].Position());
+			EXPECT_EQ(actual.Vertices[i].Index(), expected.Vertices[i].Index());
+			EXPECT_EQ(actual.Vertices[i].IsBoundary(), expected.Vertices[i].IsBoundary());
+			EXPECT_EQ(actual.Vertices[i].Normal(), expected.Vertices[i].Normal());
+		}
+
+		ASSERT_EQ(actual.Edges.size(), expected.Edges.size());
+		for (size_t i = 0; i < expected.Edges.size(); i++)
+		{
+			EXPECT_EQ(actual.Edges[i].HalfEdge(), expected.Edges[i].HalfEdge());
+			EXPECT_EQ(actual.Edges[i].Index(), expected.Edges[i].Index());
+		}
+
+		ExpectEqualFaces(expected.Faces, actual.Faces);
+		ExpectEqualFaces(expected.BoundaryCycles, actual.BoundaryCycles);
+
+		ASSERT_EQ(actual.VertexNormals.size(), expected.VertexNormals.size());
+		for (size_t i = 0; i < expected.VertexNormals.size(); i++)
+		{
+			EXPECT_EQ(actual.VertexNormals[i].Get(), expected.VertexNormals[i].Get());
+			EXPECT_EQ(actual.VertexNormals[i].Vertex(), expected.VertexNormals[i].Vertex());
+		}
+	}
+
+	static std::vector<char> ReadFileBytes(const std::filesystem::path& filePath)
+	{
+		std::ifstream fileIStream(filePath, std::ios::binary);
+		return { std::istreambuf_iterator<char>(fileIStream), std::istreambuf_iterator<char>() };
+	}
+
+	static void WriteFileBytes(const std::filesystem::path& filePath, const std::vector<char>& bytes)
+	{
+		std::ofstream fileOStream(filePath, std::ios::binary);
+		fileOStream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	TEST(ChecksumUtils_Suite, CheckString_ComputeCRC32_StandardCheckValue)
+	{
+		// Arrange
+		const std::string checkString = "123456789";
+
+		// Act
+		const auto wholeCrc = ComputeCRC32(checkString.data(), checkString.size());
+		const auto runningCrc = UpdateCRC32(ComputeCRC32(checkString.data(), 4), checkString.data() + 4, checkString.size() - 4);
+
+		// Assert
+		EXPECT_EQ(wholeCrc, 0xCBF43926u);
+		EXPECT_EQ(runningCrc, 0xCBF43926u);
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, SFBunnyRefGeom_ExportAndImportSnapshot_IdenticalReferencedMeshData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimple.rmsnap";
+		const auto meshData = ImportReferencedMeshFromOBJ("bunnySimple.obj");
+
+		// Act
+		const auto exportStatus = ReferencedMeshSnapshotExporter::Export(meshData, fileFullPath);
+		const auto importStatus = ReferencedMeshSnapshotImporter::Import(fileFullPath);
+		const auto& importedData = ReferencedMeshSnapshotImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(importedData.Vertices.size(), 2503);
+		EXPECT_EQ(importedData.BoundaryCycles.size(), 4);
+		ExpectEqualReferencedMeshData(meshData, importedData);
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, SFBunnyWithoutHolesRefGeom_ExportAndImportSnapshot_IdenticalReferencedMeshDataWithNormals)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimple_no_holes.rmsnap";
+		const auto meshData = ImportReferencedMeshFromOBJ("bunnySimple_no_holes.obj");
+
+		// Act
+		const auto exportStatus = ReferencedMeshSnapshotExporter::Export(meshData, fileFullPath);
+		const auto importStatus = ReferencedMeshSnapshotImporter::Import(fileFullPath);
+		const auto& importedData = ReferencedMeshSnapshotImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(importedData.VertexNormals.size(), 2503);
+		ExpectEqualReferencedMeshData(meshData, importedData);
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, ArcQuadRefGeom_ExportAndImportSnapshot_IdenticalReferencedMeshDataWithTriangulations)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "arc";
+		const auto meshData = ImportReferencedMeshFromOBJ("arc.obj");
+
+		// Act
+		const auto exportStatus = ReferencedMeshSnapshotExporter::Export(meshData, fileFullPath);
+		const auto importStatus = ReferencedMeshSnapshotImporter::Import(symplektRootPath / "Symplekt_OutputData\\UnitTests" / "arc.rmsnap");
+		const auto& importedData = ReferencedMeshSnapshotImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(importedData.Type, PolyMeshType::Quadrilateral);
+		EXPECT_EQ(importedData.Faces[0].GetTriangulation().size(), 2);
+		ExpectEqualReferencedMeshData(meshData, importedData);
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, SFBunnySnapshot_OpenView_RecordsMatchReferencedMeshData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleView.rmsnap";
+		const auto meshData = ImportReferencedMeshFromOBJ("bunnySimple.obj");
+		const auto exportStatus = ReferencedMeshSnapshotExporter::Export(meshData, fileFullPath);
+		ReferencedMeshSnapshotView view;
+
+		// Act
+		const auto openStatus = view.Open(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		ASSERT_EQ(openStatus, ImportStatus::Complete);
+		EXPECT_TRUE(view.IsOpen());
+		EXPECT_EQ(view.Name(), L"bunnySimple");
+		ASSERT_EQ(view.HalfEdges().size(), meshData.HalfEdges.size());
+		ASSERT_EQ(view.Vertices().size(), meshData.Vertices.size());
+		EXPECT_EQ(view.Edges().size(), meshData.Edges.size());
+		ASSERT_EQ(view.Faces().size(), meshData.Faces.size());
+		EXPECT_EQ(view.BoundaryCycles().size(), meshData.BoundaryCycles.size());
+		EXPECT_EQ(view.HalfEdges()[100].NextHalfEdge, meshData.HalfEdges[100].NextHalfEdge().get());
+		EXPECT_EQ(view.Vertices()[42].Position[1], meshData.Vertices[42].Position().Y());
+		EXPECT_EQ(view.Triangulation(view.Faces()[7]).size(), meshData.Faces[7].GetTriangulation().size());
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, CorruptedSnapshotPayload_Import_InvalidFileFormat)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleCorrupted.rmsnap";
+		const auto meshData = ImportReferencedMeshFromOBJ("bunnySimple.obj");
+		const auto exportStatus = ReferencedMeshSnapshotExporter::Export(meshData, fileFullPath);
+		auto bytes = ReadFileBytes(fileFullPath);
+		bytes[bytes.size() / 2] ^= 0x5A;
+		WriteFileBytes(fileFullPath, bytes);
+
+		// Act
+		const auto importStatus = ReferencedMeshSnapshotImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, SnapshotWithOutOfRangeIndexAndValidChecksum_Import_InvalidFileFormat)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleInvalidIndex.rmsnap";
+		const auto meshData = ImportReferencedMeshFromOBJ("bunnySimple.obj");
+		const auto exportStatus = ReferencedMeshSnapshotExporter::Export(meshData, fileFullPath);
+		auto bytes = ReadFileBytes(fileFullPath);
+
+		ReferencedMeshSnapshotSectionEntry halfEdgeSection{};
+		std::memcpy(&halfEdgeSection, bytes.data() + sizeof(ReferencedMeshSnapshotHeader) +
+			static_cast<size_t>(ReferencedMeshSnapshotSectionId::HalfEdges) * sizeof(ReferencedMeshSnapshotSectionEntry), sizeof(halfEdgeSection));
+		const int32_t invalidIndex = static_cast<int32_t>(meshData.HalfEdges.size()) + 1;
+		std::memcpy(bytes.data() + halfEdgeSection.Offset, &invalidIndex, sizeof(int32_t)); // first NextHalfEdge
+
+		ReferencedMeshSnapshotHeader header{};
+		std::memcpy(&header, bytes.data(), sizeof(header));
+		header.Checksum = ComputeCRC32(bytes.data() + sizeof(header), bytes.size() - sizeof(header));
+		std::memcpy(bytes.data(), &header, sizeof(header));
+		WriteFileBytes(fileFullPath, bytes);
+
+		// Act
+		const auto importStatus = ReferencedMeshSnapshotImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+	}
+
+	TEST(ReferencedMeshSnapshot_Suite, OBJFile_ImportSnapshot_InvalidExtension)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj";
+
+		// Act
+		const auto importStatus = ReferencedMeshSnapshotImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidExtension);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*! \file  STLExport_Tests.cpp
+ *  \brief Tests for exporting triangle mesh data to binary stereolithography STL (*.stl) files.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/STLExporter.h"
+#include "Symplekt_IOService/STLImporter.h"
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+	using namespace GeometryKernel;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	TEST(STLExport_TestSuite, SFBunnyBufferMeshData_ExportAndImportSTL_WeldedTrianglesMatchOriginal)
+	{
+		// Arrange
+		const auto objImportStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj");
+		const auto objData = OBJImporter::Data();
+		const auto bufferData = ConvertIODataToBufferMeshGeometryData(objData);
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimple.stl";
+
+		// Act
+		const auto exportStatus = STLExporter::Export(bufferData, exportFilePath);
+		const auto stlImportStatus = STLImporter::Import(exportFilePath);
+		const auto& stlData = STLImporter::Data();
+
+		// Assert
+		EXPECT_EQ(objImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(stlImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(stlData.Name, L"bunnySimple");
+		EXPECT_EQ(stlData.Vertices.size(), 2503);
+		ASSERT_EQ(stlData.VertexIndices.size(), 4968);
+		for (size_t i = 0; i < objData.VertexIndices.size(); i++)
+		{
+			ASSERT_EQ(stlData.VertexIndices[i].size(), 3);
+			for (size_t j = 0; j < 3; j++)
+			{
+				const auto& expected = objData.Vertices[objData.VertexIndices[i][j]];
+				const auto& actual = stlData.Vertices[stlData.VertexIndices[i][j]];
+				EXPECT_NEAR(actual.X(), expected.X(), 1e-5);
+				EXPECT_NEAR(actual.Y(), expected.Y(), 1e-5);
+				EXPECT_NEAR(actual.Z(), expected.Z(), 1e-5);
+			}
+		}
+	}
+
+	TEST(STLExport_TestSuite, SFBunnySTLData_ConvertToReferencedMesh_SameTopologyAsOBJ)
+	{
+		// Arrange
+		const auto objImportStatus = OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj");
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleTopology";
+		const auto exportStatus = STLExporter::Export(ConvertIODataToBufferMeshGeometryData(OBJImporter::Data()), exportFilePath);
+
+		// Act
+		const auto stlImportStatus = STLImporter::Import(symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleTopology.stl");
+		const auto meshData = ConvertIODataToReferencedMeshGeometryData(STLImporter::Data());
+
+		// Assert
+		EXPECT_EQ(objImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(stlImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(meshData.Vertices.size(), 2503);
+		EXPECT_EQ(meshData.HalfEdges.size(), 14946);
+		EXPECT_EQ(meshData.Edges.size(), 7473);
+		EXPECT_EQ(meshData.Faces.size(), 4968);
+		EXPECT_EQ(meshData.BoundaryCycles.size(), 4);
+	}
+
+	TEST(STLExport_TestSuite, LargeGridBufferMeshData_ExportAndImportSTL_AllChunksWeldedInFileOrder)
+	{
+		// Arrange
+		constexpr unsigned int gridSize = 200;
+		BufferMeshGeometryData data(L"grid");
+		for (unsigned int j = 0; j <= gridSize; j++)
+		{
+			for (unsigned int i = 0; i <= gridSize; i++)
+				data.VertexCoords.insert(data.VertexCoords.end(), { 0.5 * i, 0.25 * j, 0.01 * (i % 7) });
+		}
+		for (unsigned int j = 0; j < gridSize; j++)
+		{
+			for (unsigned int i = 0; i < gridSize; i++)
+			{
+				const unsigned int v00 = j * (gridSize + 1) + i;
+				const unsigned int v10 = v00 + 1;
+				const unsigned int v01 = v00 + gridSize + 1;
+				const unsigned int v11 = v01 + 1;
+				data.VertexIndices.insert(data.VertexIndices.end(), { v00, v10, v11, v00, v11, v01 });
+			}
+		}
+		const auto exportFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "grid.stl";
+
+		// Act
+		const auto exportStatus = STLExporter::Export(data, exportFilePath);
+		const auto importStatus = STLImporter::Import(exportFilePath);
+		const auto& stlData = STLImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(stlData.Vertices.size(), (gridSize + 1) * (gridSize + 1));
+		ASSERT_EQ(stlData.VertexIndices.size(), 2 * gridSize * gridSize);
+
+		// vertices are numbered in the order of their first occurrence in the file
+		unsigned int nextNewVertex = 0;
+		for (const auto& triangle : stlData.VertexIndices)
+		{
+			for (const auto& index : triangle)
+			{
+				EXPECT_LE(index, nextNewVertex);
+				if (index == nextNewVertex)
+					nextNewVertex++;
+			}
+		}
+		EXPECT_EQ(nextNewVertex, stlData.Vertices.size());
+	}
+
+	TEST(STLExport_TestSuite, BufferMeshData_ExportToFileWithWrongExtension_InvalidExtension)
+	{
+		// Arrange
+		BufferMeshGeometryData data(L"triangle");
+		data.VertexCoords = { 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0 };
+		data.VertexIndices = { 0, 1, 2 };
+
+		// Act
+		const auto exportStatus = STLExporter::Export(data, symplektRootPath / "Symplekt_OutputData\\UnitTests" / "triangle.obj");
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::InvalidExtension);
+	}
+
+} // namespace Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*! \file  STLImport_Tests.cpp
+ *  \brief Tests for importing files of stereolithography STL format.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/STLImporter.h"
+
+#include <fstream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static std::filesystem::path WriteSTLFileForTesting(const std::string& fileName, const std::string& contents)
+	{
+		const auto filePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / fileName;
+		std::ofstream fileOStream(filePath.c_str(), std::ios::out | std::ios::binary);
+		fileOStream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+		return filePath;
+	}
+
+	static std::string GetASCIITetrahedronForTesting(const std::string& perturbation)
+	{
+		const std::string v0 = "0 0 0";
+		const std::string v1 = "1 0 0";
+		const std::string v2 = "0 1 0";
+		const std::string v3 = "0 0 1.0";
+		const auto facet = [](const std::string& a, const std::string& b, const std::string& c)
+		{
+			return "  facet normal 0 0 0\n    outer loop\n      vertex " + a + "\n      vertex " + b + "\n      vertex " + c + "\n    endloop\n  endfacet\n";
+		};
+
+		return "solid tetrahedron\n" +
+			facet(v0, v2, v1) + facet(v0, v1, v3) + facet(v1, v2, v3 + perturbation) + facet(v2, v0, v3) +
+			"endsolid tetrahedron\n";
+	}
+
+	TEST(STLImport_TestSuite, ASCIITetrahedronSTLFile_Import_WeldedTetrahedron)
+	{
+		// Arrange
+		const auto fileFullPath = WriteSTLFileForTesting("asciiTetrahedron.stl", GetASCIITetrahedronForTesting(""));
+
+		// Act
+		const auto importStatus = STLImporter::Import(fileFullPath);
+		const auto& geomData = STLImporter::Data();
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(geomData.Name, L"asciiTetrahedron");
+		ASSERT_EQ(geomData.Vertices.size(), 4);
+		const std::vector<std::vector<unsigned int>> expectedIndices{ {0, 1, 2}, {0, 2, 3}, {2, 1, 3}, {1, 0, 3} };
+		EXPECT_EQ(geomData.VertexIndices, expectedIndices);
+		EXPECT_DOUBLE_EQ(geomData.Vertices[3].Z(), 1.0);
+	}
+
+	TEST(STLImport_TestSuite, PerturbedASCIITetrahedronSTLFile_ImportWithAndWithoutTolerance_WeldedByTolerance)
+	{
+		// Arrange
+		const auto fileFullPath = WriteSTLFileForTesting("perturbedTetrahedron.stl", GetASCIITetrahedronForTesting("000000001"));
+
+		// Act
+		const auto exactImportStatus = STLImporter::Import(fileFullPath);
+		const size_t exactVertexCount = STLImporter::Data().Vertices.size();
+		const auto toleranceImportStatus = STLImporter::Import(fileFullPath, STLImportSettings{ true, true });
+		const size_t toleranceVertexCount = STLImporter::Data().Vertices.size();
+		const auto soupImportStatus = STLImporter::Import(fileFullPath, STLImportSettings{ false, false });
+		const size_t soupVertexCount = STLImporter::Data().Vertices.size();
+
+		// Assert
+		EXPECT_EQ(exactImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(toleranceImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(soupImportStatus, ImportStatus::Complete);
+		EXPECT_EQ(exactVertexCount, 5);
+		EXPECT_EQ(toleranceVertexCount, 4);
+		EXPECT_EQ(soupVertexCount, 12);
+	}
+
+	TEST(STLImport_TestSuite, ASCIISTLFileWithIncompleteFacet_Import_InvalidFileFormat)
+	{
+		// Arrange
+		const auto fileFullPath = WriteSTLFileForTesting("incompleteFacet.stl",
+			"solid broken\nfacet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex 1 0 0\nendloop\nendfacet\nendsolid broken\n");
+
+		// Act
+		const auto importStatus = STLImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+	}
+
+	TEST(STLImport_TestSuite, OBJFile_ImportAsSTL_InvalidExtension)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj";
+
+		// Act
+		const auto importStatus = STLImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidExtension);
+	}
+
+} // namespace Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,232 @@
+/*! \file  ScalarGridVTI_Import_Tests.cpp
+ *  \brief Tests for importing scalar field image data from *.vti files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_GeometryKernel/Box3.h"
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h"
+#include "Symplekt_GeometryKernel/ScalarGridInit.h"
+#include "Symplekt_GeometryKernel/SparseScalarGridData.h"
+
+#include "Symplekt_IOService/VTIExporter.h"
+#include "Symplekt_IOService/VTIImporter.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <cmath>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+	using namespace GeometryKernel;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	// defined in ScalarGridVTI_Export_Tests.cpp
+	ScalarGridData InitializeAndFillScalarGridData(const BaseScalarGridInputData& inputData, const std::function<double(double, double, double)>& fXYZ);
+
+	static ScalarGridData InitializeTestScalarGridData(const std::wstring& name)
+	{
+		auto boundingBox = Box3{
+			{-20.3, -20.1, 0.21},
+			{20.123, 20.35, 29.96}
+		};
+		const double cellSize = 1.25;
+		auto gridData = InitializeAndFillScalarGridData(
+			BaseScalarGridInputData{ name, boundingBox , cellSize, 0.0 },
+			[](double x, double y, double z) -> double { return sin(0.1 * x) * cos(0.3 * y) + 1e-3 * z * z * z; });
+
+		for (size_t i = 0; i < gridData.CellIsFrozen.size(); i += 7)
+			gridData.CellIsFrozen[i] = true;
+
+		return gridData;
+	}
+
+	static void ExpectEqualGridDimensions(const ScalarGridData& expected, const ScalarGridData& actual)
+	{
+		EXPECT_EQ(actual.XCellCount, expected.XCellCount);
+		EXPECT_EQ(actual.YCellCount, expected.YCellCount);
+		EXPECT_EQ(actual.ZCellCount, expected.ZCellCount);
+		EXPECT_DOUBLE_EQ(actual.CellSize, expected.CellSize);
+		EXPECT_NEAR(actual.BoundingBox.Min().X(), expected.BoundingBox.Min().X(), 1e-12);
+		EXPECT_NEAR(actual.BoundingBox.Min().Y(), expected.BoundingBox.Min().Y(), 1e-12);
+		EXPECT_NEAR(actual.BoundingBox.Min().Z(), expected.BoundingBox.Min().Z(), 1e-12);
+		EXPECT_NEAR(actual.BoundingBox.Max().X(), expected.BoundingBox.Max().X(), 1e-12);
+		EXPECT_NEAR(actual.BoundingBox.Max().Y(), expected.BoundingBox.Max().Y(), 1e-12);
+		EXPECT_NEAR(actual.BoundingBox.Max().Z(), expected.BoundingBox.Max().Z(), 1e-12);
+		ASSERT_EQ(actual.CellData.size(), expected.CellData.size());
+		ASSERT_EQ(actual.CellIsFrozen.size(), expected.CellIsFrozen.size());
+	}
+
+	TEST(ScalarGridVTIImport_Suite, AppendedRawFloat64VTI_Import_ExactScalarGridData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "appendedRawFloat64ScalarField.vti";
+		const auto scalarData = InitializeTestScalarGridData(L"appendedRawFloat64ScalarField");
+		const auto exportStatus = VTIExporter::Export(scalarData, fileFullPath, { VTIDataFormat::AppendedRaw, VTIScalarType::Float64, true });
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+		const auto& importedData = VTIImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		EXPECT_EQ(importedData.Name, L"appendedRawFloat64ScalarField");
+		ExpectEqualGridDimensions(scalarData, importedData);
+		EXPECT_EQ(importedData.CellData, scalarData.CellData);
+		EXPECT_EQ(importedData.CellIsFrozen, scalarData.CellIsFrozen);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, AppendedRawFloat32VTI_Import_SinglePrecisionScalarGridData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "appendedRawFloat32ScalarField.vti";
+		const auto scalarData = InitializeTestScalarGridData(L"appendedRawFloat32ScalarField");
+		const auto exportStatus = VTIExporter::Export(scalarData, fileFullPath, { VTIDataFormat::AppendedRaw, VTIScalarType::Float32, false });
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+		const auto& importedData = VTIImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ExpectEqualGridDimensions(scalarData, importedData);
+		for (size_t i = 0; i < scalarData.CellData.size(); i++)
+			ASSERT_EQ(importedData.CellData[i], static_cast<double>(static_cast<float>(scalarData.CellData[i])));
+		EXPECT_EQ(std::count(importedData.CellIsFrozen.begin(), importedData.CellIsFrozen.end(), true), 0);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, Base64InlineFloat64VTI_Import_ExactScalarGridData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "base64Float64ScalarField.vti";
+		const auto scalarData = InitializeTestScalarGridData(L"base64Float64ScalarField");
+		const auto exportStatus = VTIExporter::Export(scalarData, fileFullPath, { VTIDataFormat::Base64, VTIScalarType::Float64, true });
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+		const auto& importedData = VTIImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ExpectEqualGridDimensions(scalarData, importedData);
+		EXPECT_EQ(importedData.CellData, scalarData.CellData);
+		EXPECT_EQ(importedData.CellIsFrozen, scalarData.CellIsFrozen);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, ASCIIFloat64VTI_Import_ExactScalarGridData)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "asciiFloat64ScalarField.vti";
+		const auto scalarData = InitializeTestScalarGridData(L"asciiFloat64ScalarField");
+		const auto exportStatus = VTIExporter::Export(scalarData, fileFullPath, { VTIDataFormat::ASCII, VTIScalarType::Float64, true });
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+		const auto& importedData = VTIImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ExpectEqualGridDimensions(scalarData, importedData);
+		EXPECT_EQ(importedData.CellData, scalarData.CellData);
+		EXPECT_EQ(importedData.CellIsFrozen, scalarData.CellIsFrozen);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, SparseGridAppendedRawVTI_Import_EqualToDenseConversion)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "sparseScalarField.vti";
+		const auto denseData = InitializeTestScalarGridData(L"sparseScalarField");
+		auto sparseData = ConvertScalarGridDataToSparse(denseData, 0.0);
+		for (size_t j = 0; j < sparseData.YCellCount; j++)
+			sparseData.Deactivate(3, j, 5);
+		const auto expectedData = ConvertSparseToScalarGridData(sparseData);
+		const auto exportStatus = VTIExporter::Export(sparseData, fileFullPath, { VTIDataFormat::AppendedRaw, VTIScalarType::Float64, true });
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+		const auto& importedData = VTIImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ExpectEqualGridDimensions(expectedData, importedData);
+		EXPECT_EQ(importedData.CellData, expectedData.CellData);
+		EXPECT_EQ(importedData.CellIsFrozen, expectedData.CellIsFrozen);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, SparseGridASCIIFloat32VTI_Import_EqualToDenseConversion)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "sparseASCIIScalarField.vti";
+		SparseScalarGridData sparseData(BaseScalarGridInputData{ L"sparseASCIIScalarField", Box3{ Vector3{ 0.0, 0.0, 0.0 }, Vector3{ 20.0, 12.0, 10.0 } }, 1.0, 0.5 });
+		sparseData.SetValue(2, 3, 4, -1.5);
+		sparseData.SetValue(19, 11, 9, 4.25);
+		sparseData.SetFrozen(19, 11, 9, true);
+		const auto expectedData = ConvertSparseToScalarGridData(sparseData);
+		const auto exportStatus = VTIExporter::Export(sparseData, fileFullPath, { VTIDataFormat::ASCII, VTIScalarType::Float32, true });
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+		const auto& importedData = VTIImporter::Data();
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::Complete);
+		ExpectEqualGridDimensions(expectedData, importedData);
+		EXPECT_EQ(importedData.CellData, expectedData.CellData);
+		EXPECT_EQ(importedData.CellIsFrozen, expectedData.CellIsFrozen);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, TruncatedAppendedRawVTI_Import_InvalidFileFormat)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "truncatedScalarField.vti";
+		const auto scalarData = InitializeTestScalarGridData(L"truncatedScalarField");
+		const auto exportStatus = VTIExporter::Export(scalarData, fileFullPath);
+		std::filesystem::resize_file(fileFullPath, std::filesystem::file_size(fileFullPath) / 2);
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_EQ(importStatus, ImportStatus::InvalidFileFormat);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, NonExistentVTI_Import_FileNotFound)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "nonExistentScalarField.vti";
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::FileNotFound);
+	}
+
+	TEST(ScalarGridVTIImport_Suite, OBJFile_ImportVTI_InvalidExtension)
+	{
+		// Arrange
+		const auto fileFullPath = symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj";
+
+		// Act
+		const auto importStatus = VTIImporter::Import(fileFullPath);
+
+		// Assert
+		EXPECT_EQ(importStatus, ImportStatus::InvalidExtension);
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*! \file  StreamingMeshProcessor_Tests.cpp
+ *  \brief Tests for out-of-core processing of binary Stanford PLY (*.ply) meshes.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/PLYExporter.h"
+#include "Symplekt_IOService/PLYImporter.h"
+#include "Symplekt_IOService/StreamingMeshProcessor.h"
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static std::filesystem::path ExportOBJToBinaryPLY(const std::string& objFileName, const std::string& plyFileName, const PLYExportSettings& settings = {})
+	{
+		const auto plyFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / plyFileName;
+		EXPECT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / objFileName), ImportStatus::Complete);
+		EXPECT_EQ(PLYExporter::Export(OBJImporter::Data(), plyFilePath, settings), ExportStatus::Complete);
+		return plyFilePath;
+	}
+
+	static GeometryIOData ProcessAndReimport(const std::filesystem::path& inputFilePath, const std::string& outputFileName,
+		const StreamingMeshOperation& operation, const StreamingMeshSettings& settings, StreamingMeshStatistics& statistics)
+	{
+		const auto outputFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / outputFileName;
+		statistics = StreamingMeshProcessor::Process(inputFilePath, outputFilePath, operation, settings);
+		EXPECT_EQ(PLYImporter::Import(outputFilePath), ImportStatus::Complete);
+		return PLYImporter::Data();
+	}
+
+	TEST(StreamingMeshProcessor_TestSuite, SFBunnyPLY_StreamScalingTransformInSmallChunks_ScaledVerticesAndSameFaces)
+	{
+		// Arrange
+		const auto inputFilePath = ExportOBJToBinaryPLY("bunnySimple.obj", "bunnySimpleStreamInput.ply");
+		const auto originalData = OBJImporter::Data();
+		StreamingMeshOperation operation;
+		operation.Transformation = GeometryKernel::Matrix4(
+			2.0, 0.0, 0.0, 0.0,
+			0.0, 3.0, 0.0, 0.0,
+			0.0, 0.0, 0.5, 0.0,
+			0.0, 0.0, 0.0, 1.0);
+		StreamingMeshStatistics statistics;
+
+		// Act
+		const auto resultData = ProcessAndReimport(inputFilePath, "bunnySimpleStreamScaled.ply", operation, { 300, 8 }, statistics);
+
+		// Assert
+		EXPECT_EQ(statistics.ReadStatus, ImportStatus::Complete);
+		EXPECT_EQ(statistics.WriteStatus, ExportStatus::Complete);
+		EXPECT_GT(statistics.ChunkCount, 8);
+		EXPECT_LE(statistics.MaxChunkVertexCount, 300);
+		EXPECT_EQ(resultData.VertexIndices, originalData.VertexIndices);
+		EXPECT_TRUE(resultData.VertexNormals.empty());
+		ASSERT_EQ(resultData.Vertices.size(), originalData.Vertices.size());
+		for (size_t i = 0; i < originalData.Vertices.size(); i++)
+		{
+			EXPECT_DOUBLE_EQ(resultData.Vertices[i].X(), 2.0 * originalData.Vertices[i].X());
+			EXPECT_DOUBLE_EQ(resultData.Vertices[i].Y(), 3.0 * originalData.Vertices[i].Y());
+			EXPECT_DOUBLE_EQ(resultData.Vertices[i].Z(), 0.5 * originalData.Vertices[i].Z());
+		}
+	}
+
+	TEST(StreamingMeshProcessor_TestSuite, SFBunnyPLY_StreamVertexNormalsInSmallAndSingleChunks_SameUnitNormals)
+	{
+		// Arrange
+		const auto inputFilePath = ExportOBJToBinaryPLY("bunnySimple.obj", "bunnySimpleStreamInput.ply", { PLYDataFormat::BinaryBigEndian, PLYScalarType::Float32 });
+		StreamingMeshOperation operation;
+		operation.Type = StreamingVertexOperationType::ComputeVertexNormals;
+		StreamingMeshStatistics chunkedStatistics;
+		StreamingMeshStatistics singleChunkStatistics;
+
+		// Act
+		const auto chunkedData = ProcessAndReimport(inputFilePath, "bunnySimpleStreamNormalsChunked.ply", operation, { 200, 8 }, chunkedStatistics);
+		const auto singleChunkData = ProcessAndReimport(inputFilePath, "bunnySimpleStreamNormals.ply", operation, {}, singleChunkStatistics);
+
+		// Assert
+		EXPECT_GT(chunkedStatistics.ChunkCount, 1);
+		EXPECT_EQ(singleChunkStatistics.ChunkCount, 1);
+		EXPECT_EQ(singleChunkStatistics.MaxChunkVertexCount, 2503);
+		EXPECT_EQ(chunkedData.Vertices, singleChunkData.Vertices);
+		ASSERT_EQ(chunkedData.VertexNormals.size(), 2503);
+		ASSERT_EQ(singleChunkData.VertexNormals.size(), 2503);
+		for (size_t i = 0; i < chunkedData.VertexNormals.size(); i++)
+		{
+			EXPECT_EQ(chunkedData.VertexNormals[i], singleChunkData.VertexNormals[i]);
+			EXPECT_NEAR(chunkedData.VertexNormals[i].GetLength(), 1.0, 1e-9);
+		}
+	}
+
+	TEST(StreamingMeshProcessor_TestSuite, ArcPLY_StreamLaplacianSmoothingInSmallAndSingleChunks_SameSmoothedVertices)
+	{
+		// Arrange
+		const auto inputFilePath = ExportOBJToBinaryPLY("arc.obj", "arcStreamInput.ply");
+		const auto originalData = OBJImporter::Data();
+		StreamingMeshOperation operation;
+		operation.Type = StreamingVertexOperationType::LaplacianSmoothing;
+		StreamingMeshStatistics chunkedStatistics;
+		StreamingMeshStatistics singleChunkStatistics;
+
+		// Act
+		const auto chunkedData = ProcessAndReimport(inputFilePath, "arcStreamSmoothedChunked.ply", operation, { 50, 4 }, chunkedStatistics);
+		const auto singleChunkData = ProcessAndReimport(inputFilePath, "arcStreamSmoothed.ply", operation, {}, singleChunkStatistics);
+
+		// Assert
+		EXPECT_GT(chunkedStatistics.ChunkCount, 1);
+		EXPECT_EQ(chunkedData.Vertices, singleChunkData.Vertices);
+		EXPECT_EQ(chunkedData.VertexNormals.size(), originalData.VertexNormals.size());
+		EXPECT_EQ(chunkedData.VertexIndices, originalData.VertexIndices);
+		EXPECT_NE(chunkedData.Vertices, originalData.Vertices);
+	}
+
+	TEST(StreamingMeshProcessor_TestSuite, InvalidInputsAndOutputs_Process_CorrespondingStatuses)
+	{
+		// Arrange
+		const auto asciiFilePath = ExportOBJToBinaryPLY("Cube.obj", "CubeStreamASCII.ply", { PLYDataFormat::ASCII, PLYScalarType::Float64 });
+		const auto binaryFilePath = ExportOBJToBinaryPLY("Cube.obj", "CubeStreamInput.ply");
+		const auto outputPath = symplektRootPath / "Symplekt_OutputData\\UnitTests";
+
+		// Act
+		const auto missingInput = StreamingMeshProcessor::Process(outputPath / "nonExistentFile.ply", outputPath / "CubeStreamOutput.ply", {});
+		const auto asciiInput = StreamingMeshProcessor::Process(asciiFilePath, outputPath / "CubeStreamOutput.ply", {});
+		const auto wrongOutputExtension = StreamingMeshProcessor::Process(binaryFilePath, outputPath / "CubeStreamOutput.obj", {});
+		const auto missingOutputExtension = StreamingMeshProcessor::Process(binaryFilePath, outputPath / "CubeStreamOutput", {});
+
+		// Assert
+		EXPECT_EQ(missingInput.ReadStatus, ImportStatus::FileNotFound);
+		EXPECT_EQ(asciiInput.ReadStatus, ImportStatus::InvalidFileFormat);
+		EXPECT_EQ(wrongOutputExtension.ReadStatus, ImportStatus::Complete);
+		EXPECT_EQ(wrongOutputExtension.WriteStatus, ExportStatus::InvalidExtension);
+		EXPECT_EQ(missingOutputExtension.WriteStatus, ExportStatus::Complete);
+		EXPECT_TRUE(exists(outputPath / "CubeStreamOutput.ply"));
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*! \file  VTPExporter_Tests.cpp
+ *  \brief Tests for exporting mesh geometry data to VTK XML PolyData (*.vtp) files.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_IOService/BaseGeometryExportHandle.h"
+#include "Symplekt_IOService/BaseGeometryImportHandle.h"
+#include "Symplekt_IOService/OBJImporter.h"
+#include "Symplekt_IOService/VTPExporter.h"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace Symplektis::UnitTests
+{
+	using namespace IOService;
+
+	// set up root directory
+	const std::filesystem::path symplektRootPath = DSYMPLEKTIS_ROOT_DIR;
+
+	static std::string ReadFileContents(const std::filesystem::path& filePath)
+	{
+		std::ifstream fileIStream(filePath, std::ios::in | std::ios::binary);
+		std::stringstream buffer;
+		buffer << fileIStream.rdbuf();
+		return buffer.str();
+	}
+
+	// finds a DataArray by name and returns its appended raw block (without the UInt64 size header)
+	template <typename T>
+	static std::vector<T> ReadAppendedArray(const std::string& contents, const std::string& name)
+	{
+		const size_t tagPos = contents.find("Name=\"" + name + "\"");
+		const size_t offsetPos = contents.find("offset=\"", tagPos) + 8;
+		const size_t dataStart = contents.find("<AppendedData encoding=\"raw\">");
+		if (tagPos == std::string::npos || dataStart == std::string::npos)
+			return {};
+
+		const size_t blockPos = contents.find('_', dataStart) + 1 + std::stoull(contents.substr(offsetPos));
+		uint64_t byteCount = 0;
+		std::memcpy(&byteCount, contents.data() + blockPos, sizeof(uint64_t));
+		std::vector<T> result(byteCount / sizeof(T));
+		std::memcpy(result.data(), contents.data() + blockPos + sizeof(uint64_t), byteCount);
+		return result;
+	}
+
+	TEST(VTPExporter_TestSuite, SFBunnyBufferData_ExportVTPWithVertexAndFaceArrays_BuffersWrittenAsAppendedRawBlocks)
+	{
+		// Arrange
+		ASSERT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj"), ImportStatus::Complete);
+		const auto meshData = ConvertIODataToBufferMeshGeometryData(OBJImporter::Data());
+		const size_t vertexCount = meshData.VertexCoords.size() / 3;
+		const size_t triangleCount = meshData.VertexIndices.size() / 3;
+		std::vector<double> heights(vertexCount);
+		for (size_t i = 0; i < vertexCount; i++)
+			heights[i] = meshData.VertexCoords[3 * i + 2];
+		std::vector<double> triangleIds(triangleCount);
+		for (size_t i = 0; i < triangleCount; i++)
+			triangleIds[i] = static_cast<double>(i);
+		const std::vector<VTPDataArray> dataArrays{
+			{ "Height", VTPArrayAssociation::Vertices, 1, heights },
+			{ "TriangleId", VTPArrayAssociation::Faces, 1, triangleIds } };
+		const auto vtpFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleBuffer.vtp";
+
+		// Act
+		const auto exportStatus = VTPExporter::Export(meshData, vtpFilePath, dataArrays);
+		const auto contents = ReadFileContents(vtpFilePath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_NE(contents.find("NumberOfPoints=\"2503\""), std::string::npos);
+		EXPECT_NE(contents.find("NumberOfPolys=\"4968\""), std::string::npos);
+		EXPECT_EQ(ReadAppendedArray<double>(contents, "Points"), meshData.VertexCoords);
+		EXPECT_EQ(ReadAppendedArray<uint32_t>(contents, "connectivity"), meshData.VertexIndices);
+		EXPECT_EQ(ReadAppendedArray<double>(contents, "Height"), heights);
+		EXPECT_EQ(ReadAppendedArray<double>(contents, "TriangleId"), triangleIds);
+		const auto offsets = ReadAppendedArray<uint64_t>(contents, "offsets");
+		ASSERT_EQ(offsets.size(), triangleCount);
+		EXPECT_EQ(offsets.front(), 3);
+		EXPECT_EQ(offsets.back(), meshData.VertexIndices.size());
+	}
+
+	TEST(VTPExporter_TestSuite, SFBunnyReferencedData_ExportVTPFloat32_FacePolygonsAndPointsWritten)
+	{
+		// Arrange
+		ASSERT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "bunnySimple.obj"), ImportStatus::Complete);
+		const auto meshData = ConvertIODataToReferencedMeshGeometryData(OBJImporter::Data());
+		const auto ioData = ConvertReferencedMeshGeometryDataToIOData(meshData);
+		std::vector<uint32_t> expectedConnectivity;
+		for (const auto& polygon : ioData.VertexIndices)
+			expectedConnectivity.insert(expectedConnectivity.end(), polygon.begin(), polygon.end());
+		const auto vtpFilePath = symplektRootPath / "Symplekt_OutputData\\UnitTests" / "bunnySimpleReferenced.vtp";
+
+		// Act
+		const auto exportStatus = VTPExporter::Export(meshData, vtpFilePath, {}, { VTPScalarType::Float32, true });
+		const auto contents = ReadFileContents(vtpFilePath);
+
+		// Assert
+		EXPECT_EQ(exportStatus, ExportStatus::Complete);
+		EXPECT_NE(contents.find("<DataArray type=\"Float32\" Name=\"Points\" NumberOfComponents=\"3\""), std::string::npos);
+		EXPECT_EQ(ReadAppendedArray<uint32_t>(contents, "connectivity"), expectedConnectivity);
+		EXPECT_EQ(ReadAppendedArray<uint64_t>(contents, "offsets").size(), meshData.Faces.size());
+		const auto points = ReadAppendedArray<float>(contents, "Points");
+		ASSERT_EQ(points.size(), 3 * meshData.Vertices.size());
+		for (size_t i = 0; i < meshData.Vertices.size(); i++)
+		{
+			EXPECT_EQ(points[3 * i], static_cast<float>(meshData.Vertices[i].Position().X()));
+			EXPECT_EQ(points[3 * i + 1], static_cast<float>(meshData.Vertices[i].Position().Y()));
+			EXPECT_EQ(points[3 * i + 2], static_cast<float>(meshData.Vertices[i].Position().Z()));
+		}
+	}
+
+	TEST(VTPExporter_TestSuite, InvalidInputs_ExportVTP_CorrespondingStatuses)
+	{
+		// Arrange
+		ASSERT_EQ(OBJImporter::Import(symplektRootPath / "Symplekt_ResourceData\\" / "Cube.obj"), ImportStatus::Complete);
+		const auto meshData = ConvertIODataToBufferMeshGeometryData(OBJImporter::Data());
+		const std::vector<double> tooShortArray(2, 1.0);
+		const auto outputPath = symplektRootPath / "Symplekt_OutputData\\UnitTests";
+
+		// Act
+		const auto wrongExtensionStatus = VTPExporter::Export(meshData, outputPath / "CubeBuffer.vtk");
+		const auto invalidArrayStatus = VTPExporter::Export(meshData, outputPath / "CubeBuffer.vtp", { { "Values", VTPArrayAssociation::Vertices, 1, tooShortArray } });
+		const auto missingExtensionStatus = VTPExporter::Export(meshData, outputPath / "CubeBuffer");
+
+		// Assert
+		EXPECT_EQ(wrongExtensionStatus, ExportStatus::InvalidExtension);
+		EXPECT_EQ(invalidArrayStatus, ExportStatus::InternalError);
+		EXPECT_EQ(missingExtensionStatus, ExportStatus::Complete);
+		EXPECT_TRUE(exists(outputPath / "CubeBuffer.vtp"));
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
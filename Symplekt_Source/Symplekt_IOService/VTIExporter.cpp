@@ -7,38 +7,248 @@
  */
 
 #include "VTIExporter.h"
+#include "Base64Utils.h"
 
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <cstdint>
 #include <fstream>
+#include <functional>
+#include <sstream>
 
 namespace Symplektis::IOService
 {
 	//!> \brief precision for double values written into .vti image data file
-	constexpr unsigned int stream_precision = 16;
+	constexpr unsigned int stream_precision = 17;
+
+	//!> \brief precision for float values written into .vti image data file
+	constexpr unsigned int stream_precision_float = 9;
+
+	//!> \brief number of array elements converted & written at once. A multiple of 3, so that base64-encoded chunks need no padding.
+	constexpr size_t chunk_element_count = 3 * 4096;
+
+	//!> \brief binary block header type (header_type="UInt64")
+	using VTIBlockHeader = uint64_t;
+
+	//!> \brief callback receiving consecutive chunks of an array's binary representation
+	using ByteChunkWriter = std::function<void(const char*, size_t)>;
+
+	//=============================================================================
+	/// \struct VTIGridSource
+	/// \brief Grid geometry and readers of consecutive ranges of cell values (in linear x-fastest order) of an exported grid,
+	///        so that dense and sparse grids can be streamed into a file in chunks.
+	//=============================================================================
+	struct VTIGridSource
+	{
+		const GeometryKernel::RectilinearGridBox3* BoundingBox{ nullptr };
+		double CellSize{ 0.0 };
+		size_t XCellCount{ 0 };
+		size_t YCellCount{ 0 };
+		size_t ZCellCount{ 0 };
+
+		const double* ContiguousValues{ nullptr };                           //!< all values in one array (if available, Float64 values are written without copying)
+		std::function<void(size_t, size_t, double*)> ReadValues{};           //!< reads values of cells [first, first + count)
+		std::function<void(size_t, size_t, uint8_t*)> ReadFrozenFlags{};     //!< reads frozen flags of cells [first, first + count) (empty if not exported)
+
+		[[nodiscard]] size_t CellCount() const
+		{
+			return XCellCount * YCellCount * ZCellCount;
+		}
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Passes consecutive chunks of grid values (read into a buffer) to a callback.
+	 *  \param[in] source         exported grid source.
+	 *  \param[in] visitValues    callback receiving a pointer to chunk values and their count.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void VisitValueChunks(const VTIGridSource& source, const std::function<void(const double*, size_t)>& visitValues)
+	{
+		const size_t cellCount = source.CellCount();
+		if (source.ContiguousValues)
+		{
+			for (size_t i = 0; i < cellCount; i += chunk_element_count)
+				visitValues(source.ContiguousValues + i, std::min(chunk_element_count, cellCount - i));
+			return;
+		}
+
+		std::vector<double> chunk(std::min(chunk_element_count, cellCount));
+		for (size_t i = 0; i < cellCount; i += chunk_element_count)
+		{
+			const size_t count = std::min(chunk_element_count, cellCount - i);
+			source.ReadValues(i, count, chunk.data());
+			visitValues(chunk.data(), count);
+		}
+	}
 
 	//-----------------------------------------------------------------------------
 	/*! \brief Finds scalar field range min-max values.
-	 *  \param[in] data           Input ScalarGridData.
+	 *  \param[in] source         exported grid source.
 	 *  \return pair {min, max}
 	*
 	*   \author M. Cavarga (MCInversion)
 	*   \date   24.10.2021
 	*/
 	//-----------------------------------------------------------------------------
-	static std::pair<double, double> EvaluateScalarFieldRangeBounds(const GeometryKernel::ScalarGridData& data)
+	static std::pair<double, double> EvaluateScalarFieldRangeBounds(const VTIGridSource& source)
 	{
 		double min = DBL_MAX;
-		double max = DBL_MIN;
-		for (const auto& value : data.CellData)
+		double max = -DBL_MAX;
+		VisitValueChunks(source, [&min, &max](const double* values, const size_t count)
 		{
-			if (value < min) min = value;
-			if (value > max) max = value;
-		}
+			for (size_t i = 0; i < count; i++)
+			{
+				if (values[i] < min) min = values[i];
+				if (values[i] > max) max = values[i];
+			}
+		});
 
 		return { min, max };
 	}
 
-    ExportStatus VTIExporter::Export(const GeometryKernel::ScalarGridData& data, const std::filesystem::path& exportedFileName)
-    {
+	//-----------------------------------------------------------------------------
+	/*! \brief Byte size of the binary representation of scalar field values.
+	 *  \param[in] source         exported grid source.
+	 *  \param[in] scalarType     exported scalar type.
+	 *  \return number of bytes
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static size_t GetScalarArrayByteCount(const VTIGridSource& source, const VTIScalarType& scalarType)
+	{
+		return source.CellCount() * (scalarType == VTIScalarType::Float32 ? sizeof(float) : sizeof(double));
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Passes the binary representation of scalar field values to a writer in chunks. Contiguous Float64 values are passed without copying.
+	 *  \param[in] source         exported grid source.
+	 *  \param[in] scalarType     exported scalar type.
+	 *  \param[in] writeChunk     chunk writer callback.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void VisitScalarArrayBytes(const VTIGridSource& source, const VTIScalarType& scalarType, const ByteChunkWriter& writeChunk)
+	{
+		if (scalarType == VTIScalarType::Float64)
+		{
+			VisitValueChunks(source, [&writeChunk](const double* values, const size_t count)
+			{
+				writeChunk(reinterpret_cast<const char*>(values), count * sizeof(double));
+			});
+			return;
+		}
+
+		std::vector<float> chunk(std::min(chunk_element_count, source.CellCount()));
+		VisitValueChunks(source, [&writeChunk, &chunk](const double* values, const size_t count)
+		{
+			std::transform(values, values + count, chunk.begin(), [](const double& value) { return static_cast<float>(value); });
+			writeChunk(reinterpret_cast<const char*>(chunk.data()), count * sizeof(float));
+		});
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Passes frozen cell flags as UInt8 values to a writer in chunks.
+	 *  \param[in] source         exported grid source.
+	 *  \param[in] writeChunk     chunk writer callback.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void VisitFrozenFlagBytes(const VTIGridSource& source, const ByteChunkWriter& writeChunk)
+	{
+		const size_t cellCount = source.CellCount();
+		std::vector<uint8_t> chunk(std::min(chunk_element_count, cellCount));
+		for (size_t i = 0; i < cellCount; i += chunk_element_count)
+		{
+			const size_t count = std::min(chunk_element_count, cellCount - i);
+			source.ReadFrozenFlags(i, count, chunk.data());
+			writeChunk(reinterpret_cast<const char*>(chunk.data()), count);
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a binary DataArray block as raw bytes: UInt64 byte count header followed by data.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] byteCount      number of data bytes.
+	 *  \param[in] visitBytes     function passing data bytes to a chunk writer.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteRawBlock(std::ofstream& fileOStream, const size_t byteCount, const std::function<void(const ByteChunkWriter&)>& visitBytes)
+	{
+		const VTIBlockHeader header = byteCount;
+		fileOStream.write(reinterpret_cast<const char*>(&header), sizeof(VTIBlockHeader));
+		visitBytes([&fileOStream](const char* bytes, const size_t count) { fileOStream.write(bytes, static_cast<std::streamsize>(count)); });
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a binary DataArray block base64-encoded: the UInt64 header and the data are encoded separately (as expected by VTK readers).
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] byteCount      number of data bytes.
+	 *  \param[in] visitBytes     function passing data bytes to a chunk writer.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteBase64Block(std::ofstream& fileOStream, const size_t byteCount, const std::function<void(const ByteChunkWriter&)>& visitBytes)
+	{
+		const VTIBlockHeader header = byteCount;
+		fileOStream << EncodeBase64(&header, sizeof(VTIBlockHeader));
+		visitBytes([&fileOStream](const char* bytes, const size_t count) { fileOStream << EncodeBase64(bytes, count); });
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a DataArray element opening tag.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] type           VTK type name.
+	 *  \param[in] name           DataArray name.
+	 *  \param[in] format         data format.
+	 *  \param[in] offset         byte offset in the appended data section (used only for VTIDataFormat::AppendedRaw).
+	 *  \param[in] rangeAttribs   optional range attributes.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteDataArrayTag(std::ofstream& fileOStream, const std::string& type, const std::string& name,
+		const VTIDataFormat& format, const size_t offset, const std::string& rangeAttribs)
+	{
+		fileOStream << "				<DataArray type=\"" << type << "\" Name=\"" << name << "\" format=\"";
+		if (format == VTIDataFormat::ASCII)
+			fileOStream << "ascii\"";
+		else if (format == VTIDataFormat::Base64)
+			fileOStream << "binary\"";
+		else
+			fileOStream << "appended\" offset=\"" << offset << "\"";
+
+		fileOStream << rangeAttribs << (format == VTIDataFormat::AppendedRaw ? "/>\n" : ">\n");
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Exports a grid source into a *.vti image data file.
+	 *  \param[in] source                    exported grid source.
+	 *  \param[in] exportedFileName          *.vti file name.
+	 *  \param[in] settings                  data format settings.
+	 *  \return Export status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   24.10.2021
+	*/
+	//-----------------------------------------------------------------------------
+	static ExportStatus ExportGridSource(const VTIGridSource& source, const std::filesystem::path& exportedFileName, const VTIExportSettings& settings)
+	{
 		std::filesystem::path resultPath = exportedFileName;
 
 		if (exportedFileName.extension().empty())
@@ -47,36 +257,130 @@ namespace Symplektis::IOService
 		else if (exportedFileName.extension() != ".vti")
 			return ExportStatus::InvalidExtension;
 
-		std::ofstream fileOStream(resultPath.c_str());
+		const size_t cellCount = source.CellCount();
+		if (cellCount == 0)
+			return ExportStatus::InternalError;
+
+		const bool exportFrozenFlags = settings.ExportFrozenFlags && source.ReadFrozenFlags;
+
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
 		if (!fileOStream.is_open())
 			return ExportStatus::FileNotCreated;
 
-		fileOStream << VTI_ImageDataHeader;
+		fileOStream << (std::endian::native == std::endian::big ? VTI_ImageDataHeaderBigEndian : VTI_ImageDataHeader);
 
-		const auto& gridOrigin = data.BoundingBox.Min();
-		const auto cellSize = data.CellSize;
+		const auto& gridOrigin = source.BoundingBox->Min();
+		const auto cellSize = source.CellSize;
 
-		const size_t Nx = data.XCellCount - 1;
-		const size_t Ny = data.YCellCount - 1;
-		const size_t Nz = data.ZCellCount - 1;
+		const size_t Nx = source.XCellCount - 1;
+		const size_t Ny = source.YCellCount - 1;
+		const size_t Nz = source.ZCellCount - 1;
 
-		const auto [valMin, valMax] = EvaluateScalarFieldRangeBounds(data);
+		const auto [valMin, valMax] = EvaluateScalarFieldRangeBounds(source);
 
+		fileOStream.precision(stream_precision);
 		fileOStream << "	<ImageData WholeExtent=\"0 " << Nx << " 0 " << Ny << " 0 " << Nz <<
 			"\" Origin=\""	<< gridOrigin.X() + 0.5 * cellSize << " " << gridOrigin.Y() + 0.5 * cellSize << " " << gridOrigin.Z() + 0.5 * cellSize <<
 			"\" Spacing=\"" << cellSize << " " << cellSize << " " << cellSize << "\">\n";
 		fileOStream << "		<Piece Extent=\"0 " << Nx << " 0 " << Ny << " 0 " << Nz << "\">\n";
-		fileOStream << "			<PointData Scalars=\"Scalars_\">\n";
-		fileOStream << "				<DataArray type=\"Float32\" Name=\"Scalars_\" format=\"ascii\" RangeMin=\"" << valMin << "\" RangeMax=\"" << valMax << "\">\n";
+		fileOStream << "			<PointData Scalars=\"" << VTI_ScalarsArrayName << "\">\n";
 
-		fileOStream.precision(stream_precision);
-		for (const auto& value : data.CellData)
-			fileOStream << value << "\n";
+		const std::string scalarTypeName = (settings.ScalarType == VTIScalarType::Float32 ? "Float32" : "Float64");
+		const size_t scalarByteCount = GetScalarArrayByteCount(source, settings.ScalarType);
+		const auto visitScalarBytes = [&source, &settings](const ByteChunkWriter& writeChunk) { VisitScalarArrayBytes(source, settings.ScalarType, writeChunk); };
+		const auto visitFrozenFlagBytes = [&source](const ByteChunkWriter& writeChunk) { VisitFrozenFlagBytes(source, writeChunk); };
+
+		std::stringstream rangeAttribs;
+		rangeAttribs.precision(stream_precision);
+		rangeAttribs << " RangeMin=\"" << valMin << "\" RangeMax=\"" << valMax << "\"";
+		WriteDataArrayTag(fileOStream, scalarTypeName, VTI_ScalarsArrayName, settings.Format, 0, rangeAttribs.str());
+
+		if (settings.Format == VTIDataFormat::ASCII)
+		{
+			fileOStream.precision(settings.ScalarType == VTIScalarType::Float32 ? stream_precision_float : stream_precision);
+			VisitValueChunks(source, [&fileOStream, &settings](const double* values, const size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+					fileOStream << (settings.ScalarType == VTIScalarType::Float32 ? static_cast<float>(values[i]) : values[i]) << "\n";
+			});
+		}
+		else if (settings.Format == VTIDataFormat::Base64)
+		{
+			WriteBase64Block(fileOStream, scalarByteCount, visitScalarBytes);
+			fileOStream << "\n";
+		}
+
+		if (settings.Format != VTIDataFormat::AppendedRaw)
+			fileOStream << "				</DataArray>\n";
+
+		if (exportFrozenFlags)
+		{
+			WriteDataArrayTag(fileOStream, "UInt8", VTI_FrozenFlagsArrayName, settings.Format, sizeof(VTIBlockHeader) + scalarByteCount, "");
+
+			if (settings.Format == VTIDataFormat::ASCII)
+			{
+				visitFrozenFlagBytes([&fileOStream](const char* flags, const size_t count)
+				{
+					for (size_t i = 0; i < count; i++)
+						fileOStream << (flags[i] ? "1\n" : "0\n");
+				});
+			}
+			else if (settings.Format == VTIDataFormat::Base64)
+			{
+				WriteBase64Block(fileOStream, cellCount, visitFrozenFlagBytes);
+				fileOStream << "\n";
+			}
+
+			if (settings.Format != VTIDataFormat::AppendedRaw)
+				fileOStream << "				</DataArray>\n";
+		}
 
 		fileOStream << VTI_ImageDataScopeClose;
 
+		if (settings.Format == VTIDataFormat::AppendedRaw)
+		{
+			fileOStream << "	<AppendedData encoding=\"raw\">\n		_";
+			WriteRawBlock(fileOStream, scalarByteCount, visitScalarBytes);
+			if (exportFrozenFlags)
+				WriteRawBlock(fileOStream, cellCount, visitFrozenFlagBytes);
+			fileOStream << "\n	</AppendedData>\n";
+		}
+
+		fileOStream << VTI_FileScopeClose;
+
+		if (!fileOStream.good())
+			return ExportStatus::InternalError;
+
 		fileOStream.close();
 		return ExportStatus::Complete;
-    }
+	}
+
+	ExportStatus VTIExporter::Export(const GeometryKernel::ScalarGridData& data, const std::filesystem::path& exportedFileName, const VTIExportSettings& settings)
+	{
+		const size_t cellCount = data.XCellCount * data.YCellCount * data.ZCellCount;
+		if (data.CellData.size() != cellCount)
+			return ExportStatus::InternalError;
+
+		VTIGridSource source{ &data.BoundingBox, data.CellSize, data.XCellCount, data.YCellCount, data.ZCellCount, data.CellData.data() };
+		if (data.CellIsFrozen.size() == cellCount)
+		{
+			source.ReadFrozenFlags = [&data](const size_t first, const size_t count, uint8_t* flags)
+			{
+				for (size_t i = 0; i < count; i++)
+					flags[i] = data.CellIsFrozen[first + i] ? 1 : 0;
+			};
+		}
+
+		return ExportGridSource(source, exportedFileName, settings);
+	}
+
+	ExportStatus VTIExporter::Export(const GeometryKernel::SparseScalarGridData& data, const std::filesystem::path& exportedFileName, const VTIExportSettings& settings)
+	{
+		VTIGridSource source{ &data.BoundingBox, data.CellSize, data.XCellCount, data.YCellCount, data.ZCellCount };
+		source.ReadValues = [&data](const size_t first, const size_t count, double* values) { data.ReadLinearRange(first, count, values, nullptr); };
+		source.ReadFrozenFlags = [&data](const size_t first, const size_t count, uint8_t* flags) { data.ReadLinearRange(first, count, nullptr, flags); };
+
+		return ExportGridSource(source, exportedFileName, settings);
+	}
 
 } // Symplektis::IOService
\ No newline at end of file
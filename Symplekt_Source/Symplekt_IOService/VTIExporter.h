@@ -9,16 +9,72 @@
 #pragma once
 
 #include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h" // TODO: use a local struct instead of GeometryKernel::ScalarGridData
+#include "Symplekt_GeometryKernel/SparseScalarGridData.h"
 #include "IOHelperTypes.h"
 
 #include <filesystem>
 
 namespace Symplektis::IOService
 {
-	//!> \brief Header string for VTI image data file.
-	const std::string VTI_ImageDataHeader{ "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">" };
-	//!> \brief Scope-close string for VTI image data file.
-	const std::string VTI_ImageDataScopeClose{ "				</DataArray>\n			</PointData>\n		<CellData>\n		</CellData>\n	</Piece>\n	</ImageData>\n</VTKFile>" };
+	//!> \brief Header string for VTI image data file (little endian data).
+	const std::string VTI_ImageDataHeader{ "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n" };
+	//!> \brief Header string for VTI image data file (big endian data).
+	const std::string VTI_ImageDataHeaderBigEndian{ "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n" };
+	//!> \brief Scope-close string for VTI image data piece.
+	const std::string VTI_ImageDataScopeClose{ "			</PointData>\n		<CellData>\n		</CellData>\n	</Piece>\n	</ImageData>\n" };
+	//!> \brief Scope-close string for VTI file.
+	const std::string VTI_FileScopeClose{ "</VTKFile>\n" };
+	//!> \brief Name of the exported scalar field DataArray.
+	const std::string VTI_ScalarsArrayName{ "Scalars_" };
+	//!> \brief Name of the exported (optional) frozen cell flags DataArray.
+	const std::string VTI_FrozenFlagsArrayName{ "IsFrozen" };
+
+	//=============================================================================
+	/// \enum VTIDataFormat
+	/// \brief Storage format of the DataArrays written into a *.vti file
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class VTIDataFormat
+	{
+		ASCII       = 0,    //!< human-readable values (format="ascii"), slow and large.
+		Base64      = 1,    //!< base64-encoded binary data inlined in the DataArray element (format="binary").
+		AppendedRaw = 2,    //!< raw binary data in the <AppendedData encoding="raw"> section (format="appended").
+	};
+
+	//=============================================================================
+	/// \enum VTIScalarType
+	/// \brief Floating point type of the exported scalar field values
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class VTIScalarType
+	{
+		Float32 = 0,    //!< values are converted to single precision (half the size, lossy).
+		Float64 = 1,    //!< values are written as they are (lossless, suitable for checkpoints).
+	};
+
+	//=============================================================================
+	/// \struct VTIExportSettings
+	/// \brief Settings for VTIExporter
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTIExportSettings
+	{
+		VTIDataFormat Format{ VTIDataFormat::AppendedRaw };
+		VTIScalarType ScalarType{ VTIScalarType::Float64 };
+		bool          ExportFrozenFlags{ false };   //!< if true, ScalarGridData::CellIsFrozen is written as a UInt8 DataArray
+	};
 
 	//=============================================================================
 	/// \class VTIExporter
@@ -39,13 +95,28 @@ namespace Symplektis::IOService
 		/*! \brief Exports a *.vti image data file to a given path.
 		 *  \param[in] data                      exported ScalarGridData
 		 *  \param[in] exportedFileName          *.vti file name.
+		 *  \param[in] settings                  data format settings (appended raw Float64 by default).
 		 *  \return Import status
 		*
 		*   \author M. Cavarga (MCInversion)
 		*   \date   24.10.2021
 		*/
 		//-----------------------------------------------------------------------------
-		static [[nodiscard]] ExportStatus Export(const GeometryKernel::ScalarGridData& data, const std::filesystem::path& exportedFileName);		
+		static [[nodiscard]] ExportStatus Export(const GeometryKernel::ScalarGridData& data, const std::filesystem::path& exportedFileName, const VTIExportSettings& settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports a sparse scalar grid as a dense *.vti image data file. Values are read from the bricks in chunks,
+		 *         so the dense grid is never allocated (inactive cells are written with the background value).
+		 *  \param[in] data                      exported SparseScalarGridData
+		 *  \param[in] exportedFileName          *.vti file name.
+		 *  \param[in] settings                  data format settings (appended raw Float64 by default).
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(const GeometryKernel::SparseScalarGridData& data, const std::filesystem::path& exportedFileName, const VTIExportSettings& settings = {});
 	};
 
 } // Symplektis::IOService
\ No newline at end of file
@@ -8,8 +8,586 @@
 
 #include "VTIImporter.h"
 
+#include "Base64Utils.h"
+#include "MemoryMappedFile.h"
+
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
 namespace Symplektis::IOService
 {
+	using namespace GeometryKernel;
+
+	//!> \brief relative tolerance for comparing grid spacing components
+	constexpr double spacing_relative_tolerance = 1e-9;
+
+	//=============================================================================
+	/// \struct VTIDataArrayInfo
+	/// \brief Attributes & location of a parsed <DataArray> element.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTIDataArrayInfo
+	{
+		std::string_view Type;
+		std::string_view Name;
+		std::string_view Format;
+		size_t           Offset{ 0 };           //!> offset into the appended data section (format="appended")
+		size_t           ComponentCount{ 1 };
+		std::string_view Contents;              //!> element contents (format="ascii" or "binary")
+	};
+
+	//=============================================================================
+	/// \struct VTIFileLayout
+	/// \brief File-wide properties needed for decoding binary data.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTIFileLayout
+	{
+		bool             SwapBytes{ false };    //!> true if file byte order differs from native byte order
+		size_t           HeaderSize{ 4 };       //!> size of binary block headers (UInt32 by default)
+		std::string_view AppendedData;          //!> raw appended data section (starting after '_')
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Finds the value of an attribute within an xml element tag.
+	 *  \param[in] tag            element tag contents (between '<' and '>').
+	 *  \param[in] name           attribute name.
+	 *  \return attribute value if found
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::optional<std::string_view> FindAttribute(const std::string_view& tag, const std::string_view& name)
+	{
+		size_t pos = 0;
+		while ((pos = tag.find(name, pos)) != std::string_view::npos)
+		{
+			const size_t valueStart = pos + name.size();
+			const bool isWholeName = (pos > 0 && std::isspace(static_cast<unsigned char>(tag[pos - 1])));
+			if (!isWholeName || valueStart + 1 >= tag.size() || tag[valueStart] != '=' || tag[valueStart + 1] != '"')
+			{
+				pos = valueStart;
+				continue;
+			}
+
+			const size_t valueEnd = tag.find('"', valueStart + 2);
+			if (valueEnd == std::string_view::npos)
+				return std::nullopt;
+
+			return tag.substr(valueStart + 2, valueEnd - valueStart - 2);
+		}
+
+		return std::nullopt;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Finds an opening xml element tag.
+	 *  \param[in] xml            searched xml text.
+	 *  \param[in] elementName    element name (e.g.: "ImageData").
+	 *  \param[in] startPos       position from which the search starts.
+	 *  \return {tag position, tag contents (between '<' and '>')} if found
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::optional<std::pair<size_t, std::string_view>> FindElementTag(const std::string_view& xml, const std::string_view& elementName, const size_t startPos = 0)
+	{
+		size_t pos = startPos;
+		while ((pos = xml.find('<', pos)) != std::string_view::npos)
+		{
+			const std::string_view rest = xml.substr(pos + 1);
+			if (rest.substr(0, elementName.size()) != elementName ||
+				rest.size() <= elementName.size() ||
+				!(std::isspace(static_cast<unsigned char>(rest[elementName.size()])) || rest[elementName.size()] == '>' || rest[elementName.size()] == '/'))
+			{
+				pos++;
+				continue;
+			}
+
+			const size_t tagEnd = xml.find('>', pos);
+			if (tagEnd == std::string_view::npos)
+				return std::nullopt;
+
+			return std::pair{ pos, xml.substr(pos + 1, tagEnd - pos - 1) };
+		}
+
+		return std::nullopt;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parses a whitespace-separated list of numbers.
+	 *  \param[in] text           parsed text.
+	 *  \param[in] values         output values.
+	 *  \return true if all values were parsed
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename T, size_t N>
+	static bool ParseNumberList(const std::string_view& text, std::array<T, N>& values)
+	{
+		const char* current = text.data();
+		const char* end = text.data() + text.size();
+		for (auto& value : values)
+		{
+			while (current < end && std::isspace(static_cast<unsigned char>(*current)))
+				current++;
+
+			const auto [ptr, errCode] = std::from_chars(current, end, value);
+			if (errCode != std::errc())
+				return false;
+
+			current = ptr;
+		}
+
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parses a <DataArray> element starting at a given tag.
+	 *  \param[in] xml            xml text.
+	 *  \param[in] tagPos         DataArray tag position.
+	 *  \param[in] tag            DataArray tag contents.
+	 *  \return parsed VTIDataArrayInfo, or std::nullopt if the element is invalid.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::optional<VTIDataArrayInfo> ParseDataArrayElement(const std::string_view& xml, const size_t tagPos, const std::string_view& tag)
+	{
+		VTIDataArrayInfo result;
+		const auto type = FindAttribute(tag, "type");
+		const auto format = FindAttribute(tag, "format");
+		if (!type || !format)
+			return std::nullopt;
+
+		result.Type = *type;
+		result.Format = *format;
+		result.Name = FindAttribute(tag, "Name").value_or("");
+
+		if (const auto components = FindAttribute(tag, "NumberOfComponents"))
+		{
+			std::array<size_t, 1> value{};
+			if (!ParseNumberList(*components, value))
+				return std::nullopt;
+			result.ComponentCount = value[0];
+		}
+
+		if (result.Format == "appended")
+		{
+			const auto offset = FindAttribute(tag, "offset");
+			std::array<size_t, 1> value{};
+			if (!offset || !ParseNumberList(*offset, value))
+				return std::nullopt;
+			result.Offset = value[0];
+			return result;
+		}
+
+		if (!tag.empty() && tag.back() == '/') // empty element
+			return result;
+
+		const size_t contentsStart = tagPos + tag.size() + 2;
+		const size_t contentsEnd = xml.find("</DataArray>", contentsStart);
+		if (contentsEnd == std::string_view::npos)
+			return std::nullopt;
+
+		result.Contents = xml.substr(contentsStart, contentsEnd - contentsStart);
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads an unsigned integer binary block header.
+	 *  \param[in] bytes          pointer to the header bytes.
+	 *  \param[in] layout         file layout.
+	 *  \return header value (data byte count)
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static uint64_t ReadBlockHeader(const unsigned char* bytes, const VTIFileLayout& layout)
+	{
+		std::array<unsigned char, sizeof(uint64_t)> headerBytes{};
+		std::memcpy(headerBytes.data(), bytes, layout.HeaderSize);
+		if (layout.SwapBytes)
+			std::reverse(headerBytes.begin(), headerBytes.begin() + layout.HeaderSize);
+
+		if (layout.HeaderSize == sizeof(uint32_t))
+		{
+			uint32_t value;
+			std::memcpy(&value, headerBytes.data(), sizeof(uint32_t));
+			return value;
+		}
+
+		uint64_t value;
+		std::memcpy(&value, headerBytes.data(), sizeof(uint64_t));
+		return value;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts binary values of type T to doubles.
+	 *  \param[in] bytes          pointer to the first value.
+	 *  \param[in] count          number of values.
+	 *  \param[in] swapBytes      if true, byte order of values is reversed.
+	 *  \param[in] output         output values (already allocated).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	template <typename T>
+	static void ConvertBinaryValues(const unsigned char* bytes, const size_t count, const bool swapBytes, double* output)
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			if (!swapBytes)
+			{
+				std::memcpy(output, bytes, count * sizeof(double));
+				return;
+			}
+		}
+
+		std::array<unsigned char, sizeof(T)> valueBytes{};
+		for (size_t i = 0; i < count; i++)
+		{
+			std::memcpy(valueBytes.data(), bytes + i * sizeof(T), sizeof(T));
+			if (swapBytes)
+				std::reverse(valueBytes.begin(), valueBytes.end());
+
+			T value;
+			std::memcpy(&value, valueBytes.data(), sizeof(T));
+			output[i] = static_cast<double>(value);
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Returns the byte size of a VTK data type name.
+	 *  \param[in] type           VTK type name (e.g.: "Float32").
+	 *  \return byte size, 0 for unsupported types.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static size_t GetTypeSize(const std::string_view& type)
+	{
+		if (type == "Float64" || type == "Int64" || type == "UInt64") return 8;
+		if (type == "Float32" || type == "Int32" || type == "UInt32") return 4;
+		if (type == "Int16" || type == "UInt16") return 2;
+		if (type == "Int8" || type == "UInt8") return 1;
+		return 0;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Converts binary values of a given VTK type to doubles.
+	 *  \param[in] type           VTK type name.
+	 *  \param[in] bytes          pointer to the first value.
+	 *  \param[in] count          number of values.
+	 *  \param[in] swapBytes      if true, byte order of values is reversed.
+	 *  \param[in] output         output values (already allocated).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void ConvertBinaryValues(const std::string_view& type, const unsigned char* bytes, const size_t count, const bool swapBytes, double* output)
+	{
+		if (type == "Float64") ConvertBinaryValues<double>(bytes, count, swapBytes, output);
+		else if (type == "Float32") ConvertBinaryValues<float>(bytes, count, swapBytes, output);
+		else if (type == "Int64") ConvertBinaryValues<int64_t>(bytes, count, swapBytes, output);
+		else if (type == "UInt64") ConvertBinaryValues<uint64_t>(bytes, count, swapBytes, output);
+		else if (type == "Int32") ConvertBinaryValues<int32_t>(bytes, count, swapBytes, output);
+		else if (type == "UInt32") ConvertBinaryValues<uint32_t>(bytes, count, swapBytes, output);
+		else if (type == "Int16") ConvertBinaryValues<int16_t>(bytes, count, swapBytes, output);
+		else if (type == "UInt16") ConvertBinaryValues<uint16_t>(bytes, count, swapBytes, output);
+		else if (type == "Int8") ConvertBinaryValues<int8_t>(bytes, count, swapBytes, output);
+		else if (type == "UInt8") ConvertBinaryValues<uint8_t>(bytes, count, swapBytes, output);
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Reads DataArray values into a double buffer. Appended raw data is read directly from the mapped file.
+	 *  \param[in] info           DataArray info.
+	 *  \param[in] layout         file layout.
+	 *  \param[in] count          expected number of values.
+	 *  \param[in] output         output values (already allocated).
+	 *  \return true if successful
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ReadDataArrayValues(const VTIDataArrayInfo& info, const VTIFileLayout& layout, const size_t count, double* output)
+	{
+		if (info.ComponentCount != 1)
+			return false;
+
+		if (info.Format == "ascii")
+		{
+			const char* current = info.Contents.data();
+			const char* end = info.Contents.data() + info.Contents.size();
+			for (size_t i = 0; i < count; i++)
+			{
+				while (current < end && std::isspace(static_cast<unsigned char>(*current)))
+					current++;
+
+				const auto [ptr, errCode] = std::from_chars(current, end, output[i]);
+				if (errCode != std::errc())
+					return false;
+
+				current = ptr;
+			}
+			return true;
+		}
+
+		const size_t typeSize = GetTypeSize(info.Type);
+		if (typeSize == 0)
+			return false;
+
+		const size_t expectedByteCount = count * typeSize;
+
+		if (info.Format == "appended")
+		{
+			const auto& appended = layout.AppendedData;
+			if (info.Offset + layout.HeaderSize > appended.size())
+				return false;
+
+			const auto* blockBytes = reinterpret_cast<const unsigned char*>(appended.data() + info.Offset);
+			const uint64_t byteCount = ReadBlockHeader(blockBytes, layout);
+			if (byteCount != expectedByteCount || info.Offset + layout.HeaderSize + byteCount > appended.size())
+				return false;
+
+			ConvertBinaryValues(info.Type, blockBytes + layout.HeaderSize, count, layout.SwapBytes, output);
+			return true;
+		}
+
+		if (info.Format != "binary")
+			return false;
+
+		// VTK writers encode the header and the data separately, but a single stream (header + data) is also valid.
+		const auto firstChar = info.Contents.find_first_not_of(" \t\r\n");
+		if (firstChar == std::string_view::npos)
+			return false;
+
+		const std::string_view encoded = info.Contents.substr(firstChar);
+		const size_t encodedHeaderLength = GetBase64EncodedLength(layout.HeaderSize);
+		std::vector<unsigned char> decoded;
+		if (!DecodeBase64(encoded.substr(0, encodedHeaderLength), decoded) || decoded.size() < layout.HeaderSize)
+			return false;
+
+		const uint64_t byteCount = ReadBlockHeader(decoded.data(), layout);
+		if (byteCount != expectedByteCount)
+			return false;
+
+		decoded.clear();
+		if (DecodeBase64(encoded.substr(encodedHeaderLength), decoded) && decoded.size() == byteCount)
+		{
+			ConvertBinaryValues(info.Type, decoded.data(), count, layout.SwapBytes, output);
+			return true;
+		}
+
+		decoded.clear();
+		if (!DecodeBase64(encoded, decoded) || decoded.size() < layout.HeaderSize + byteCount)
+			return false;
+
+		ConvertBinaryValues(info.Type, decoded.data() + layout.HeaderSize, count, layout.SwapBytes, output);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Parse scalar grid name from the imported file path.
+	 *  \param[in] importedFilePath     path to the imported file.
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::wstring GetGridNameFromFilePath(const std::filesystem::path& importedFilePath)
+	{
+		const auto stem = importedFilePath.stem();
+		return stem.wstring();
+	}
+
+	ImportStatus VTIImporter::Import(const std::filesystem::path& importedFilePath)
+	{
+		if (importedFilePath.empty() || !exists(importedFilePath))
+			return ImportStatus::FileNotFound;
+
+		if (!importedFilePath.has_extension() || importedFilePath.extension() != ".vti")
+			return ImportStatus::InvalidExtension;
+
+		const MemoryMappedFile mappedFile(importedFilePath);
+		if (!mappedFile.IsOpen())
+			return ImportStatus::FileNotOpened;
+
+		ClearIOData();
+
+		// raw appended data may contain any bytes, so xml parsing is restricted to the part before it
+		const std::string_view fileView = mappedFile.View();
+		std::string_view xml = fileView;
+		VTIFileLayout layout;
+		if (const auto appendedTag = FindElementTag(fileView, "AppendedData"))
+		{
+			const auto& [appendedPos, appendedTagContents] = *appendedTag;
+			if (FindAttribute(appendedTagContents, "encoding").value_or("") != "raw")
+			{
+				MSG_CHECK(false, "VTIImporter::Import: only raw <AppendedData> encoding is supported!\n");
+				return ImportStatus::InvalidFileFormat;
+			}
+
+			const size_t dataStart = fileView.find('_', appendedPos + appendedTagContents.size() + 2);
+			if (dataStart == std::string_view::npos)
+				return ImportStatus::InvalidFileFormat;
+
+			xml = fileView.substr(0, appendedPos);
+			layout.AppendedData = fileView.substr(dataStart + 1);
+		}
+
+		const auto fileTag = FindElementTag(xml, "VTKFile");
+		if (!fileTag || FindAttribute(fileTag->second, "type").value_or("") != "ImageData")
+		{
+			MSG_CHECK(false, "VTIImporter::Import: not a VTKFile of type ImageData!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		if (FindAttribute(fileTag->second, "compressor"))
+		{
+			MSG_CHECK(false, "VTIImporter::Import: compressed *.vti files are not supported!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const auto byteOrder = FindAttribute(fileTag->second, "byte_order").value_or("LittleEndian");
+		layout.SwapBytes = (byteOrder == "BigEndian") != (std::endian::native == std::endian::big);
+		layout.HeaderSize = (FindAttribute(fileTag->second, "header_type").value_or("UInt32") == "UInt64" ? sizeof(uint64_t) : sizeof(uint32_t));
+
+		const auto imageDataTag = FindElementTag(xml, "ImageData");
+		if (!imageDataTag)
+			return ImportStatus::InvalidFileFormat;
+
+		std::array<long long, 6> extent{};
+		std::array<double, 3> origin{};
+		std::array<double, 3> spacing{};
+		const auto& imageDataAttribs = imageDataTag->second;
+		if (!ParseNumberList(FindAttribute(imageDataAttribs, "WholeExtent").value_or(""), extent) ||
+			!ParseNumberList(FindAttribute(imageDataAttribs, "Origin").value_or("0 0 0"), origin) ||
+			!ParseNumberList(FindAttribute(imageDataAttribs, "Spacing").value_or("1 1 1"), spacing))
+		{
+			MSG_CHECK(false, "VTIImporter::Import: invalid <ImageData> attributes!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const double cellSize = spacing[0];
+		if (cellSize <= 0.0 ||
+			std::fabs(spacing[1] - cellSize) > spacing_relative_tolerance * cellSize ||
+			std::fabs(spacing[2] - cellSize) > spacing_relative_tolerance * cellSize)
+		{
+			MSG_CHECK(false, "VTIImporter::Import: only positive isotropic spacing is supported by ScalarGridData!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		if (extent[1] < extent[0] || extent[3] < extent[2] || extent[5] < extent[4])
+			return ImportStatus::InvalidFileFormat;
+
+		const auto pointDataTag = FindElementTag(xml, "PointData", imageDataTag->first);
+		if (!pointDataTag)
+		{
+			MSG_CHECK(false, "VTIImporter::Import: no <PointData> found!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		const size_t pointDataEnd = std::min(xml.find("</PointData>", pointDataTag->first), xml.size());
+		const auto scalarsName = FindAttribute(pointDataTag->second, "Scalars");
+
+		std::optional<VTIDataArrayInfo> scalarsInfo;
+		std::optional<VTIDataArrayInfo> frozenFlagsInfo;
+		size_t searchPos = pointDataTag->first;
+		while (const auto dataArrayTag = FindElementTag(xml, "DataArray", searchPos))
+		{
+			if (dataArrayTag->first >= pointDataEnd)
+				break;
+
+			searchPos = dataArrayTag->first + 1;
+			const auto info = ParseDataArrayElement(xml, dataArrayTag->first, dataArrayTag->second);
+			if (!info)
+				return ImportStatus::InvalidFileFormat;
+
+			if (info->Name == "IsFrozen")
+				frozenFlagsInfo = info;
+			else if (!scalarsInfo || (scalarsName && info->Name == *scalarsName))
+				scalarsInfo = info;
+		}
+
+		if (!scalarsInfo)
+		{
+			MSG_CHECK(false, "VTIImporter::Import: no scalar <DataArray> found!\n");
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		m_Data.Name = GetGridNameFromFilePath(importedFilePath);
+		m_Data.CellSize = cellSize;
+		m_Data.XCellCount = static_cast<size_t>(extent[1] - extent[0] + 1);
+		m_Data.YCellCount = static_cast<size_t>(extent[3] - extent[2] + 1);
+		m_Data.ZCellCount = static_cast<size_t>(extent[5] - extent[4] + 1);
+
+		// values are stored at cell centers, the grid box is therefore half a cell larger than the point extent
+		const Vector3 boxMin{
+			origin[0] + (static_cast<double>(extent[0]) - 0.5) * cellSize,
+			origin[1] + (static_cast<double>(extent[2]) - 0.5) * cellSize,
+			origin[2] + (static_cast<double>(extent[4]) - 0.5) * cellSize };
+		const Vector3 boxMax{
+			boxMin.X() + static_cast<double>(m_Data.XCellCount) * cellSize,
+			boxMin.Y() + static_cast<double>(m_Data.YCellCount) * cellSize,
+			boxMin.Z() + static_cast<double>(m_Data.ZCellCount) * cellSize };
+		m_Data.BoundingBox = RectilinearGridBox3{ cellSize, boxMin, boxMax };
+		m_Data.BoundingBox.Min() = boxMin; // keep exact bounds even if they're not aligned with the global grid
+		m_Data.BoundingBox.Max() = boxMax;
+
+		const size_t cellCount = m_Data.XCellCount * m_Data.YCellCount * m_Data.ZCellCount;
+		m_Data.CellData.resize(cellCount);
+		if (!ReadDataArrayValues(*scalarsInfo, layout, cellCount, m_Data.CellData.data()))
+		{
+			MSG_CHECK(false, "VTIImporter::Import: failed reading scalar <DataArray> values!\n");
+			ClearIOData();
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		m_Data.CellIsFrozen = std::vector<bool>(cellCount, false);
+		if (!frozenFlagsInfo)
+			return ImportStatus::Complete;
+
+		std::vector<double> frozenFlagValues(cellCount);
+		if (!ReadDataArrayValues(*frozenFlagsInfo, layout, cellCount, frozenFlagValues.data()))
+		{
+			MSG_CHECK(false, "VTIImporter::Import: failed reading IsFrozen <DataArray> values!\n");
+			ClearIOData();
+			return ImportStatus::InvalidFileFormat;
+		}
+
+		for (size_t i = 0; i < cellCount; i++)
+			m_Data.CellIsFrozen[i] = (frozenFlagValues[i] != 0.0);
 
+		return ImportStatus::Complete;
+	}
 
 } // Symplektis::IOService
\ No newline at end of file
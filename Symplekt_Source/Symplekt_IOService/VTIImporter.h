@@ -8,8 +8,75 @@
 
 #pragma once
 
+#include "Symplekt_GeometryKernel/ImplicitGeometryDataTypes.h" // TODO: use a local struct instead of GeometryKernel::ScalarGridData
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+
 namespace Symplektis::IOService
 {
+	//=============================================================================
+	/// \class VTIImporter
+	/// \brief An importer singleton object for importing scalar grid data from a *.vti image data file and storing it as ScalarGridData.
+	///        The file is memory-mapped and binary (appended raw or inline base64) DataArrays are converted directly into
+	///        ScalarGridData::CellData. Uncompressed single-piece files with isotropic spacing are supported.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class VTIImporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.vti file from a given path.
+		 *  \param[in] importedFilePath          path to a *.vti file.
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path& importedFilePath);
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Imported data getter
+		 *  \return reference to m_Data
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static GeometryKernel::ScalarGridData& Data()
+		{
+			return m_Data;
+		}
+
+	private:
+		//-----------------------------------------------------------------------------
+		/*! \brief Simple data clear
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static void ClearIOData()
+		{
+			m_Data = GeometryKernel::ScalarGridData{};
+		}
+
+		//
+		// ==================================
+		//
 
+		inline static GeometryKernel::ScalarGridData m_Data{}; //!> imported scalar grid data
+	};
 
 } // Symplektis::IOService
\ No newline at end of file
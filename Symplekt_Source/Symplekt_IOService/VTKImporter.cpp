@@ -52,6 +52,11 @@ namespace Symplektis::IOService
 	}
 	
     ImportStatus VTKImporter::Import(const std::filesystem::path& importedFilePath)
+    {
+		return Import(importedFilePath, m_Data);
+    }
+
+    ImportStatus VTKImporter::Import(const std::filesystem::path& importedFilePath, GeometryIOData& importedData)
     {
 		if (importedFilePath.empty() || !exists(importedFilePath))
 			return ImportStatus::FileNotFound;
@@ -63,8 +68,8 @@ namespace Symplektis::IOService
 		if (!fileInStream.is_open())
 			return ImportStatus::FileNotOpened;
 
-		ClearIOData();
-		m_Data.Name = GetGeometryNameFromFilePath(importedFilePath);
+		importedData.Clear();
+		importedData.Name = GetGeometryNameFromFilePath(importedFilePath);
 
 		// iterate towards the points header
 		std::string line;
@@ -89,7 +94,7 @@ namespace Symplektis::IOService
 
 		const size_t nVertices = std::stoi(ptsToken);
 		ASSERT(nVertices > 0, "VTKImporter::Import, Load points header: invalid number of vertices!\n");
-		m_Data.Vertices.reserve(nVertices);
+		importedData.Vertices.reserve(nVertices);
 
 		// iterate towards the points block
 		do
@@ -112,7 +117,7 @@ namespace Symplektis::IOService
 			double x, y, z;
 			sStream >> x >> y >> z;
 
-			m_Data.Vertices.emplace_back(Vector3(x, y, z));
+			importedData.Vertices.emplace_back(Vector3(x, y, z));
 
 			if (!std::getline(fileInStream, line))
 			{
@@ -143,7 +148,7 @@ namespace Symplektis::IOService
 
 		const size_t nPolygons = std::stoi(polysToken);
 		ASSERT(nPolygons > 0, "VTKImporter::Import, Load polygons: invalid number of polygons!\n");
-		m_Data.VertexIndices.reserve(nPolygons);
+		importedData.VertexIndices.reserve(nPolygons);
 
 		// iterate towards the polygons block
 		do
@@ -185,7 +190,7 @@ namespace Symplektis::IOService
 				indicesInPolygon.push_back(idInPoly);
 			}
 
-			m_Data.VertexIndices.push_back(indicesInPolygon);
+			importedData.VertexIndices.push_back(std::move(indicesInPolygon));
 
 			if (!std::getline(fileInStream, line) && i < nPolygons - 1)
 			{
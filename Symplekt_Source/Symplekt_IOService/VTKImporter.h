@@ -42,6 +42,18 @@ namespace Symplektis::IOService
 		//-----------------------------------------------------------------------------
 		static [[nodiscard]] ImportStatus Import(const std::filesystem::path & importedFilePath);
 
+		//-----------------------------------------------------------------------------
+		/*! \brief Imports *.vtk file from a given path into caller-owned data, e.g.: to be moved into a geometry builder afterwards.
+		 *  \param[in] importedFilePath          path to a *.vtk file.
+		 *  \param[in] importedData              imported data (cleared first).
+		 *  \return Import status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ImportStatus Import(const std::filesystem::path & importedFilePath, GeometryIOData& importedData);
+
 		/// @{
 		/// \name Getters
 
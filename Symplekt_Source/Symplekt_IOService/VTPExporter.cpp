@@ -0,0 +1,464 @@
+/*! \file  VTPExporter.cpp
+ *  \brief Implementation of an object for exporting mesh geometry data to Kitware VTK XML PolyData (*.vtp) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "VTPExporter.h"
+
+#include "Symplekt_GeometryKernel/Face.h"
+#include "Symplekt_GeometryKernel/HalfEdge.h"
+#include "Symplekt_GeometryKernel/Vertex.h"
+#include "Symplekt_GeometryKernel/VertexNormal.h"
+#include "Symplekt_UtilityGeneral/Assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+
+namespace Symplektis::IOService
+{
+	using namespace GeometryKernel;
+
+	//!> \brief number of array elements converted & written at once
+	constexpr size_t vtp_chunk_element_count = 3 * 4096;
+
+	//!> \brief binary block header type (header_type="UInt64")
+	using VTPBlockHeader = uint64_t;
+
+	//!> \brief callback receiving consecutive chunks of an array's binary representation
+	using ByteChunkWriter = std::function<void(const char*, size_t)>;
+
+	//!> \brief function passing an array's binary representation to a chunk writer
+	using ByteVisitor = std::function<void(const ByteChunkWriter&)>;
+
+	//!> \brief function filling the components of the i-th tuple of a generated scalar array
+	using TupleGenerator = std::function<void(size_t, double*)>;
+
+	static_assert(sizeof(unsigned int) == sizeof(uint32_t), "VTPExporter: vertex indices are written as UInt32!");
+
+	//=============================================================================
+	/// \struct VTPAppendedBlock
+	/// \brief A DataArray written as a raw block into the <AppendedData> section.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTPAppendedBlock
+	{
+		std::string   Type{};
+		std::string   Name{};
+		unsigned int  ComponentCount{ 1 };
+		size_t        ByteCount{ 0 };
+		ByteVisitor   VisitBytes{};
+	};
+
+	//=============================================================================
+	/// \struct VTPPieceBlocks
+	/// \brief All DataArrays of a single poly data <Piece>.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTPPieceBlocks
+	{
+		size_t                         PointCount{ 0 };
+		size_t                         PolyCount{ 0 };
+		bool                           HasNormals{ false };
+		std::vector<VTPAppendedBlock>  PointData{};
+		std::vector<VTPAppendedBlock>  CellData{};
+		VTPAppendedBlock               Points{};
+		VTPAppendedBlock               Connectivity{};
+		VTPAppendedBlock               Offsets{};
+	};
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Appends the *.vtp extension to a file name without one.
+	 *  \param[in] exportedFileName     exported file name.
+	 *  \param[out] resultPath          path with extension.
+	 *  \return false if the file name has a different extension
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool ResolveExportPath(const std::filesystem::path& exportedFileName, std::filesystem::path& resultPath)
+	{
+		resultPath = exportedFileName;
+
+		if (exportedFileName.extension().empty())
+			resultPath += ".vtp";
+
+		else if (exportedFileName.extension() != ".vtp")
+			return false;
+
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief VTK type name of exported floating point values.
+	 *  \param[in] scalarType     exported scalar type.
+	 *  \return type name
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static std::string GetScalarTypeName(const VTPScalarType& scalarType)
+	{
+		return scalarType == VTPScalarType::Float32 ? "Float32" : "Float64";
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Creates a floating point block over a contiguous buffer. Float64 values are passed without copying.
+	 *  \param[in] name              DataArray name.
+	 *  \param[in] componentCount    number of components per tuple.
+	 *  \param[in] values            source values.
+	 *  \param[in] scalarType        exported scalar type.
+	 *  \return appended block
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static VTPAppendedBlock CreateBufferScalarBlock(const std::string& name, const unsigned int componentCount,
+		const std::span<const double> values, const VTPScalarType& scalarType)
+	{
+		const bool isFloat32 = scalarType == VTPScalarType::Float32;
+		return {
+			GetScalarTypeName(scalarType), name, componentCount, values.size() * (isFloat32 ? sizeof(float) : sizeof(double)),
+			[values, isFloat32](const ByteChunkWriter& writeChunk)
+			{
+				if (!isFloat32)
+				{
+					writeChunk(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+					return;
+				}
+
+				std::vector<float> chunk(std::min(vtp_chunk_element_count, values.size()));
+				for (size_t i = 0; i < values.size(); i += vtp_chunk_element_count)
+				{
+					const size_t count = std::min(vtp_chunk_element_count, values.size() - i);
+					std::transform(values.begin() + i, values.begin() + i + count, chunk.begin(),
+						[](const double& value) { return static_cast<float>(value); });
+					writeChunk(reinterpret_cast<const char*>(chunk.data()), count * sizeof(float));
+				}
+			} };
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Creates a floating point block whose tuples are generated (e.g.: from mesh elements) in chunks.
+	 *  \param[in] name              DataArray name.
+	 *  \param[in] componentCount    number of components per tuple.
+	 *  \param[in] tupleCount        number of tuples.
+	 *  \param[in] scalarType        exported scalar type.
+	 *  \param[in] generateTuple     tuple generator.
+	 *  \return appended block
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static VTPAppendedBlock CreateGeneratedScalarBlock(const std::string& name, const unsigned int componentCount,
+		const size_t tupleCount, const VTPScalarType& scalarType, TupleGenerator generateTuple)
+	{
+		const bool isFloat32 = scalarType == VTPScalarType::Float32;
+		return {
+			GetScalarTypeName(scalarType), name, componentCount, tupleCount * componentCount * (isFloat32 ? sizeof(float) : sizeof(double)),
+			[componentCount, tupleCount, isFloat32, generateTuple = std::move(generateTuple)](const ByteChunkWriter& writeChunk)
+			{
+				const size_t chunkTupleCount = vtp_chunk_element_count / componentCount;
+				std::vector<double> chunk(std::min(chunkTupleCount, tupleCount) * componentCount);
+				std::vector<float> floatChunk(isFloat32 ? chunk.size() : 0);
+				for (size_t i = 0; i < tupleCount; i += chunkTupleCount)
+				{
+					const size_t count = std::min(chunkTupleCount, tupleCount - i);
+					for (size_t j = 0; j < count; j++)
+						generateTuple(i + j, chunk.data() + j * componentCount);
+
+					if (!isFloat32)
+					{
+						writeChunk(reinterpret_cast<const char*>(chunk.data()), count * componentCount * sizeof(double));
+						continue;
+					}
+
+					std::transform(chunk.begin(), chunk.begin() + count * componentCount, floatChunk.begin(),
+						[](const double& value) { return static_cast<float>(value); });
+					writeChunk(reinterpret_cast<const char*>(floatChunk.data()), count * componentCount * sizeof(float));
+				}
+			} };
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Creates a UInt64 "offsets" block of polygons given by a polygon size getter.
+	 *  \param[in] polyCount         number of polygons.
+	 *  \param[in] getPolySize       polygon size getter.
+	 *  \return appended block
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static VTPAppendedBlock CreateOffsetsBlock(const size_t polyCount, std::function<size_t(size_t)> getPolySize)
+	{
+		return {
+			"UInt64", "offsets", 1, polyCount * sizeof(uint64_t),
+			[polyCount, getPolySize = std::move(getPolySize)](const ByteChunkWriter& writeChunk)
+			{
+				std::vector<uint64_t> chunk(std::min(vtp_chunk_element_count, polyCount));
+				uint64_t offset = 0;
+				for (size_t i = 0; i < polyCount; i += vtp_chunk_element_count)
+				{
+					const size_t count = std::min(vtp_chunk_element_count, polyCount - i);
+					for (size_t j = 0; j < count; j++)
+					{
+						offset += getPolySize(i + j);
+						chunk[j] = offset;
+					}
+					writeChunk(reinterpret_cast<const char*>(chunk.data()), count * sizeof(uint64_t));
+				}
+			} };
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Verifies sizes of additional data arrays and appends them to the piece blocks.
+	 *  \param[in] dataArrays        additional data arrays.
+	 *  \param[in] scalarType        exported scalar type.
+	 *  \param[in,out] blocks        piece blocks (with PointCount and PolyCount set).
+	 *  \return true if all arrays are valid
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static bool AppendDataArrayBlocks(const std::vector<VTPDataArray>& dataArrays, const VTPScalarType& scalarType, VTPPieceBlocks& blocks)
+	{
+		for (const auto& dataArray : dataArrays)
+		{
+			const bool isVertexArray = dataArray.Association == VTPArrayAssociation::Vertices;
+			const size_t tupleCount = isVertexArray ? blocks.PointCount : blocks.PolyCount;
+			if (dataArray.Name.empty() || dataArray.ComponentCount == 0 || dataArray.Values.size() != tupleCount * dataArray.ComponentCount)
+			{
+				MSG_CHECK(false, "VTPExporter::Export: invalid data array \"" + dataArray.Name + "\"!\n");
+				return false;
+			}
+
+			(isVertexArray ? blocks.PointData : blocks.CellData).emplace_back(
+				CreateBufferScalarBlock(dataArray.Name, dataArray.ComponentCount, dataArray.Values, scalarType));
+		}
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a DataArray element referencing the appended data section.
+	 *  \param[in] fileOStream    output file stream.
+	 *  \param[in] block          appended block.
+	 *  \param[in,out] offset     offset of the block in the appended data section (moved past the block).
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static void WriteDataArrayTag(std::ofstream& fileOStream, const VTPAppendedBlock& block, size_t& offset)
+	{
+		fileOStream << "				<DataArray type=\"" << block.Type << "\" Name=\"" << block.Name << "\"";
+		if (block.ComponentCount > 1)
+			fileOStream << " NumberOfComponents=\"" << block.ComponentCount << "\"";
+
+		fileOStream << " format=\"appended\" offset=\"" << offset << "\"/>\n";
+		offset += sizeof(VTPBlockHeader) + block.ByteCount;
+	}
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Writes a *.vtp file with a single poly data piece.
+	 *  \param[in] resultPath     output file path.
+	 *  \param[in] blocks         piece blocks.
+	 *  \return Export status
+	*
+	*   \author M. Cavarga (MCInversion)
+	*   \date   18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	static ExportStatus WritePolyDataFile(const std::filesystem::path& resultPath, const VTPPieceBlocks& blocks)
+	{
+		std::ofstream fileOStream(resultPath.c_str(), std::ios::out | std::ios::binary);
+		if (!fileOStream.is_open())
+			return ExportStatus::FileNotCreated;
+
+		fileOStream << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"" <<
+			(std::endian::native == std::endian::big ? "BigEndian" : "LittleEndian") << "\" header_type=\"UInt64\">\n";
+		fileOStream << "	<PolyData>\n";
+		fileOStream << "		<Piece NumberOfPoints=\"" << blocks.PointCount << "\" NumberOfVerts=\"0\" NumberOfLines=\"0\" NumberOfStrips=\"0\" NumberOfPolys=\"" << blocks.PolyCount << "\">\n";
+
+		size_t offset = 0;
+		fileOStream << "			<PointData" << (blocks.HasNormals ? " Normals=\"" + VTP_NormalsArrayName + "\"" : "") << ">\n";
+		for (const auto& block : blocks.PointData)
+			WriteDataArrayTag(fileOStream, block, offset);
+		fileOStream << "			</PointData>\n";
+
+		fileOStream << "			<CellData>\n";
+		for (const auto& block : blocks.CellData)
+			WriteDataArrayTag(fileOStream, block, offset);
+		fileOStream << "			</CellData>\n";
+
+		fileOStream << "			<Points>\n";
+		WriteDataArrayTag(fileOStream, blocks.Points, offset);
+		fileOStream << "			</Points>\n";
+
+		fileOStream << "			<Polys>\n";
+		WriteDataArrayTag(fileOStream, blocks.Connectivity, offset);
+		WriteDataArrayTag(fileOStream, blocks.Offsets, offset);
+		fileOStream << "			</Polys>\n";
+		fileOStream << "		</Piece>\n	</PolyData>\n";
+
+		const auto writeRawBlock = [&fileOStream](const VTPAppendedBlock& block)
+		{
+			const VTPBlockHeader header = block.ByteCount;
+			fileOStream.write(reinterpret_cast<const char*>(&header), sizeof(VTPBlockHeader));
+			block.VisitBytes([&fileOStream](const char* bytes, const size_t count) { fileOStream.write(bytes, static_cast<std::streamsize>(count)); });
+		};
+
+		fileOStream << "	<AppendedData encoding=\"raw\">\n		_";
+		for (const auto& block : blocks.PointData)
+			writeRawBlock(block);
+		for (const auto& block : blocks.CellData)
+			writeRawBlock(block);
+		writeRawBlock(blocks.Points);
+		writeRawBlock(blocks.Connectivity);
+		writeRawBlock(blocks.Offsets);
+		fileOStream << "\n	</AppendedData>\n";
+		fileOStream << "</VTKFile>\n";
+
+		if (!fileOStream.good())
+			return ExportStatus::InternalError;
+
+		fileOStream.close();
+		return ExportStatus::Complete;
+	}
+
+	ExportStatus VTPExporter::Export(const BufferMeshGeometryData& data, const std::filesystem::path& exportedFileName,
+		const std::vector<VTPDataArray>& dataArrays, const VTPExportSettings& settings)
+	{
+		std::filesystem::path resultPath;
+		if (!ResolveExportPath(exportedFileName, resultPath))
+			return ExportStatus::InvalidExtension;
+
+		const size_t vertexCount = data.VertexCoords.size() / 3;
+		if (data.VertexCoords.size() % 3 != 0 || data.VertexIndices.size() % 3 != 0 ||
+			std::ranges::any_of(data.VertexIndices, [vertexCount](const unsigned int& index) { return index >= vertexCount; }))
+		{
+			MSG_CHECK(false, "VTPExporter::Export: invalid vertex or triangle index buffer!\n");
+			return ExportStatus::InternalError;
+		}
+
+		VTPPieceBlocks blocks;
+		blocks.PointCount = vertexCount;
+		blocks.PolyCount = data.VertexIndices.size() / 3;
+		blocks.HasNormals = settings.ExportNormals && !data.VertexNormalCoords.empty() && data.VertexNormalCoords.size() == data.VertexCoords.size();
+		if (blocks.HasNormals)
+			blocks.PointData.emplace_back(CreateBufferScalarBlock(VTP_NormalsArrayName, 3, data.VertexNormalCoords, settings.ScalarType));
+
+		if (!AppendDataArrayBlocks(dataArrays, settings.ScalarType, blocks))
+			return ExportStatus::InternalError;
+
+		blocks.Points = CreateBufferScalarBlock("Points", 3, data.VertexCoords, settings.ScalarType);
+
+		const std::span<const unsigned int> indices(data.VertexIndices);
+		blocks.Connectivity = {
+			"UInt32", "connectivity", 1, indices.size() * sizeof(uint32_t),
+			[indices](const ByteChunkWriter& writeChunk) { writeChunk(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(uint32_t)); } };
+		blocks.Offsets = CreateOffsetsBlock(blocks.PolyCount, [](const size_t) { return size_t{ 3 }; });
+
+		return WritePolyDataFile(resultPath, blocks);
+	}
+
+	ExportStatus VTPExporter::Export(const ReferencedMeshGeometryData& data, const std::filesystem::path& exportedFileName,
+		const std::vector<VTPDataArray>& dataArrays, const VTPExportSettings& settings)
+	{
+		std::filesystem::path resultPath;
+		if (!ResolveExportPath(exportedFileName, resultPath))
+			return ExportStatus::InvalidExtension;
+
+		// polygon sizes are needed for the "connectivity" byte count before writing it
+		std::vector<unsigned int> polySizes(data.Faces.size());
+		size_t cornerCount = 0;
+		for (size_t faceId = 0; faceId < data.Faces.size(); faceId++)
+		{
+			const auto& baseHeId = data.Faces[faceId].HalfEdge();
+			auto heId = baseHeId;
+			do
+			{
+				polySizes[faceId]++;
+				heId = data.HalfEdges[heId.get()].NextHalfEdge();
+			}
+			while (heId != baseHeId);
+			cornerCount += polySizes[faceId];
+		}
+
+		VTPPieceBlocks blocks;
+		blocks.PointCount = data.Vertices.size();
+		blocks.PolyCount = data.Faces.size();
+		blocks.HasNormals = settings.ExportNormals && !data.Vertices.empty() && !data.VertexNormals.empty();
+		if (blocks.HasNormals)
+		{
+			blocks.PointData.emplace_back(CreateGeneratedScalarBlock(VTP_NormalsArrayName, 3, data.Vertices.size(), settings.ScalarType,
+				[&data](const size_t vertexId, double* normal)
+				{
+					const auto& vector = data.VertexNormals[data.Vertices[vertexId].Normal().get()].Get();
+					normal[0] = vector.X();
+					normal[1] = vector.Y();
+					normal[2] = vector.Z();
+				}));
+		}
+
+		if (!AppendDataArrayBlocks(dataArrays, settings.ScalarType, blocks))
+			return ExportStatus::InternalError;
+
+		blocks.Points = CreateGeneratedScalarBlock("Points", 3, data.Vertices.size(), settings.ScalarType,
+			[&data](const size_t vertexId, double* position)
+			{
+				const auto& vector = data.Vertices[vertexId].Position();
+				position[0] = vector.X();
+				position[1] = vector.Y();
+				position[2] = vector.Z();
+			});
+
+		blocks.Connectivity = {
+			"UInt32", "connectivity", 1, cornerCount * sizeof(uint32_t),
+			[&data](const ByteChunkWriter& writeChunk)
+			{
+				std::vector<uint32_t> chunk;
+				chunk.reserve(vtp_chunk_element_count);
+				for (const auto& face : data.Faces)
+				{
+					const auto& baseHeId = face.HalfEdge();
+					auto heId = baseHeId;
+					do
+					{
+						chunk.push_back(static_cast<uint32_t>(data.HalfEdges[heId.get()].TailVertex().get()));
+						heId = data.HalfEdges[heId.get()].NextHalfEdge();
+					}
+					while (heId != baseHeId);
+
+					if (chunk.size() >= vtp_chunk_element_count)
+					{
+						writeChunk(reinterpret_cast<const char*>(chunk.data()), chunk.size() * sizeof(uint32_t));
+						chunk.clear();
+					}
+				}
+				writeChunk(reinterpret_cast<const char*>(chunk.data()), chunk.size() * sizeof(uint32_t));
+			} };
+		blocks.Offsets = CreateOffsetsBlock(blocks.PolyCount, [&polySizes](const size_t faceId) { return static_cast<size_t>(polySizes[faceId]); });
+
+		return WritePolyDataFile(resultPath, blocks);
+	}
+
+} // Symplektis::IOService
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*! \file  VTPExporter.h
+ *  \brief Object for exporting mesh geometry data to Kitware VTK XML PolyData (*.vtp) files
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#pragma once
+
+#include "Symplekt_GeometryKernel/MeshGeometryDataTypes.h"
+#include "IOHelperTypes.h"
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Symplektis::IOService
+{
+	//!> \brief Name of the exported vertex normals DataArray.
+	const std::string VTP_NormalsArrayName{ "Normals" };
+
+	//=============================================================================
+	/// \enum VTPArrayAssociation
+	/// \brief Mesh elements a VTPDataArray is attached to
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class VTPArrayAssociation
+	{
+		Vertices = 0,    //!< one tuple per vertex (<PointData>).
+		Faces    = 1,    //!< one tuple per exported polygon (<CellData>), i.e.: per triangle for BufferMeshGeometryData.
+	};
+
+	//=============================================================================
+	/// \enum VTPScalarType
+	/// \brief Floating point type of the exported point coordinates and data arrays
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	enum class VTPScalarType
+	{
+		Float32 = 0,    //!< values are converted to single precision in chunks (half the size, lossy).
+		Float64 = 1,    //!< values are written directly from the source buffers (lossless).
+	};
+
+	//=============================================================================
+	/// \struct VTPDataArray
+	/// \brief A named per-vertex or per-face field exported into a *.vtp file. Values are referenced, not copied.
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTPDataArray
+	{
+		std::string              Name{};
+		VTPArrayAssociation      Association{ VTPArrayAssociation::Vertices };
+		unsigned int             ComponentCount{ 1 };
+		std::span<const double>  Values{};      //!< ComponentCount values per associated element
+	};
+
+	//=============================================================================
+	/// \struct VTPExportSettings
+	/// \brief Settings for VTPExporter
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	struct VTPExportSettings
+	{
+		VTPScalarType ScalarType{ VTPScalarType::Float64 };
+		bool          ExportNormals{ true };    //!< if true, vertex normals (if there is one per vertex) are written as the "Normals" point data
+	};
+
+	//=============================================================================
+	/// \class VTPExporter
+	/// \brief An exporter singleton object for exporting mesh geometry data to a *.vtp poly data file.
+	///        Points, Polys (connectivity & offsets), vertex normals and additional VTPDataArrays are written as raw binary
+	///        blocks into the <AppendedData> section, directly from the mesh data buffers (or in small chunks where the mesh
+	///        elements are not stored as contiguous scalars).
+	///
+	/// \ingroup IO_SERVICE
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	class VTPExporter
+	{
+	public:
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports triangles of BufferMeshGeometryData to a *.vtp file.
+		 *  \param[in] data                      exported BufferMeshGeometryData
+		 *  \param[in] exportedFileName          *.vtp file name.
+		 *  \param[in] dataArrays                additional per-vertex or per-triangle arrays.
+		 *  \param[in] settings                  export settings.
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(
+			const GeometryKernel::BufferMeshGeometryData&  data,
+			const std::filesystem::path&                   exportedFileName,
+			const std::vector<VTPDataArray>&               dataArrays = {},
+			const VTPExportSettings&                       settings = {});
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Exports faces (polygons) of ReferencedMeshGeometryData to a *.vtp file.
+		 *  \param[in] data                      exported ReferencedMeshGeometryData
+		 *  \param[in] exportedFileName          *.vtp file name.
+		 *  \param[in] dataArrays                additional per-vertex or per-face arrays.
+		 *  \param[in] settings                  export settings.
+		 *  \return Export status
+		*
+		*   \author M. Cavarga (MCInversion)
+		*   \date   18.10.2026
+		*/
+		//-----------------------------------------------------------------------------
+		static [[nodiscard]] ExportStatus Export(
+			const GeometryKernel::ReferencedMeshGeometryData&  data,
+			const std::filesystem::path&                       exportedFileName,
+			const std::vector<VTPDataArray>&                   dataArrays = {},
+			const VTPExportSettings&                           settings = {});
+	};
+
+} // Symplektis::IOService
\ No newline at end of file
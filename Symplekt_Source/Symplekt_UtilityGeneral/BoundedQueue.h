@@ -0,0 +1,143 @@
+/*! \file BoundedQueue.h
+*   \brief A thread-safe FIFO queue of limited capacity, used for passing work items between pipeline stages
+*
+\verbatim
+-------------------------------------------------------------------------------
+created  : 18.10.2026 : M.Cavarga (MCInversion) :
+-------------------------------------------------------------------------------
+
+-------------------------------------------------------------------------------
+\endverbatim
+*/
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace Symplektis::Util
+{
+	//=============================================================================
+	/// \class BoundedQueue
+	/// \brief A thread-safe FIFO queue of limited capacity. Push() blocks while the queue is full (backpressure
+	///        on the producers), Pop() blocks while the queue is empty. After Close() is called, pushing fails,
+	///        and Pop() returns the remaining items followed by std::nullopt, so that consumers can finish.
+	///
+	/// \ingroup UTILITY_GENERAL
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	template <typename T>
+	class BoundedQueue
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		 *  \param[in] capacity       maximum number of queued items (at least 1).
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		explicit BoundedQueue(const size_t& capacity)
+			: m_Capacity(capacity > 0 ? capacity : 1) { }
+
+		BoundedQueue(const BoundedQueue&) = delete;
+		BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Appends an item, waiting until there is free capacity.
+		 *  \param[in] item       item to be moved into the queue.
+		 *  \return false if the queue was closed (the item is discarded)
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		bool Push(T&& item)
+		{
+			std::unique_lock lock(m_Mutex);
+			m_NotFull.wait(lock, [this] { return m_Closed || m_Items.size() < m_Capacity; });
+			if (m_Closed)
+				return false;
+
+			m_Items.push_back(std::move(item));
+			lock.unlock();
+			m_NotEmpty.notify_one();
+			return true;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Removes the front item, waiting until there is one.
+		 *  \return front item, or std::nullopt if the queue is closed and empty
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		[[nodiscard]] std::optional<T> Pop()
+		{
+			std::unique_lock lock(m_Mutex);
+			m_NotEmpty.wait(lock, [this] { return m_Closed || !m_Items.empty(); });
+			if (m_Items.empty())
+				return std::nullopt;
+
+			std::optional<T> result(std::move(m_Items.front()));
+			m_Items.pop_front();
+			lock.unlock();
+			m_NotFull.notify_one();
+			return result;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Closes the queue: wakes up all waiting producers and consumers.
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		void Close()
+		{
+			{
+				std::scoped_lock lock(m_Mutex);
+				m_Closed = true;
+			}
+			m_NotFull.notify_all();
+			m_NotEmpty.notify_all();
+		}
+
+		/// @{
+		/// \name Getters
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Queue capacity getter.
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		[[nodiscard]] size_t Capacity() const
+		{
+			return m_Capacity;
+		}
+
+	private:
+
+		size_t                   m_Capacity;           //!> maximum number of queued items
+		std::deque<T>            m_Items{};            //!> queued items
+		bool                     m_Closed{ false };    //!> if true, no more items will be pushed
+		std::mutex               m_Mutex{};
+		std::condition_variable  m_NotFull{};
+		std::condition_variable  m_NotEmpty{};
+	};
+
+} // Symplektis::Util
\ No newline at end of file
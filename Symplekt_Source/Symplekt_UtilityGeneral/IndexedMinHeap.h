@@ -0,0 +1,200 @@
+/*! \file IndexedMinHeap.h
+*   \brief A binary min-heap of items with indices from a fixed range, supporting key decrease
+*
+\verbatim
+-------------------------------------------------------------------------------
+created  : 18.10.2026 : M.Cavarga (MCInversion) :
+-------------------------------------------------------------------------------
+
+-------------------------------------------------------------------------------
+\endverbatim
+*/
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Symplektis::Util
+{
+	//=============================================================================
+	/// \class IndexedMinHeap
+	/// \brief A binary min-heap of item indices in [0, itemCount) ordered by keys. The heap position of every item is kept
+	///        in an array allocated once in the constructor, so Push() can decrease the key of a contained item
+	///        in O(log n) without duplicate entries, and no memory is allocated per item (e.g.: in fast marching).
+	///
+	/// \ingroup UTILITY_GENERAL
+	///
+	/// \author M. Cavarga (MCInversion)
+	/// \date   18.10.2026
+	//=============================================================================
+	template <typename Key>
+	class IndexedMinHeap
+	{
+	public:
+		/// @{
+		/// \name Constructors
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Constructor.
+		 *  \param[in] itemCount       size of the range of item indices.
+		 *  \param[in] capacity        number of heap entries to reserve.
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		explicit IndexedMinHeap(const size_t& itemCount, const size_t& capacity = 0)
+			: m_Positions(itemCount, not_in_heap)
+		{
+			m_Entries.reserve(capacity);
+		}
+
+		/// @{
+		/// \name Functionality
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Inserts an item, or decreases its key if it is contained with a larger key.
+		 *  \param[in] item       item index.
+		 *  \param[in] key        item key.
+		 *  \return true if the item was inserted or its key decreased
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		bool Push(const size_t& item, const Key& key)
+		{
+			size_t position = m_Positions[item];
+			if (position == not_in_heap)
+			{
+				position = m_Entries.size();
+				m_Entries.emplace_back(key, item);
+			}
+			else if (key < m_Entries[position].first)
+				m_Entries[position].first = key;
+			else
+				return false;
+
+			SiftUp(position);
+			return true;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Removes the item with the smallest key (the heap must not be empty).
+		 *  \return {key, item}
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		std::pair<Key, size_t> Pop()
+		{
+			const auto top = m_Entries.front();
+			m_Positions[top.second] = not_in_heap;
+			if (m_Entries.size() > 1)
+			{
+				m_Entries.front() = m_Entries.back();
+				m_Entries.pop_back();
+				m_Positions[m_Entries.front().second] = 0;
+				SiftDown(0);
+			}
+			else
+				m_Entries.pop_back();
+
+			return top;
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief The entry with the smallest key (the heap must not be empty).
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		[[nodiscard]] const std::pair<Key, size_t>& Top() const
+		{
+			return m_Entries.front();
+		}
+
+		[[nodiscard]] bool Contains(const size_t& item) const
+		{
+			return m_Positions[item] != not_in_heap;
+		}
+
+		[[nodiscard]] bool Empty() const
+		{
+			return m_Entries.empty();
+		}
+
+		[[nodiscard]] size_t Size() const
+		{
+			return m_Entries.size();
+		}
+
+		//-----------------------------------------------------------------------------
+		/*! \brief Removes all items (keeps allocated memory).
+		 *
+		 *   \author M. Cavarga (MCInversion)
+		 *   \date   18.10.2026
+		 */
+		 //-----------------------------------------------------------------------------
+		void Clear()
+		{
+			for (const auto& entry : m_Entries)
+				m_Positions[entry.second] = not_in_heap;
+			m_Entries.clear();
+		}
+
+	private:
+		void SiftUp(size_t position)
+		{
+			const auto entry = m_Entries[position];
+			while (position > 0)
+			{
+				const size_t parent = (position - 1) / 2;
+				if (!(entry.first < m_Entries[parent].first))
+					break;
+
+				m_Entries[position] = m_Entries[parent];
+				m_Positions[m_Entries[position].second] = position;
+				position = parent;
+			}
+			m_Entries[position] = entry;
+			m_Positions[entry.second] = position;
+		}
+
+		void SiftDown(size_t position)
+		{
+			const auto entry = m_Entries[position];
+			const size_t size = m_Entries.size();
+			while (true)
+			{
+				size_t child = 2 * position + 1;
+				if (child >= size)
+					break;
+				if (child + 1 < size && m_Entries[child + 1].first < m_Entries[child].first)
+					child++;
+				if (!(m_Entries[child].first < entry.first))
+					break;
+
+				m_Entries[position] = m_Entries[child];
+				m_Positions[m_Entries[position].second] = position;
+				position = child;
+			}
+			m_Entries[position] = entry;
+			m_Positions[entry.second] = position;
+		}
+
+		//
+		// ==================================
+		//
+
+		static constexpr size_t not_in_heap = std::numeric_limits<size_t>::max();
+
+		std::vector<std::pair<Key, size_t>> m_Entries;    //!> heap entries {key, item}
+		std::vector<size_t>                 m_Positions;  //!> heap position of each item (not_in_heap if not contained)
+	};
+
+} // Symplektis::Util
\ No newline at end of file
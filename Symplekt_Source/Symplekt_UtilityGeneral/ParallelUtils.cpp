@@ -0,0 +1,71 @@
+/*! \file ParallelUtils.cpp
+*   \brief Implementations of utils for splitting work into chunks processed on multiple threads
+*
+\verbatim
+-------------------------------------------------------------------------------
+created  : 18.10.2026 : M.Cavarga (MCInversion) :
+-------------------------------------------------------------------------------
+
+-------------------------------------------------------------------------------
+\endverbatim
+*/
+
+#include "ParallelUtils.h"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Symplektis::Util
+{
+	size_t GetParallelThreadCount()
+	{
+		return std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+	}
+
+	size_t GetParallelChunkCount(const size_t& count, const size_t& minChunkSize)
+	{
+		const size_t maxChunkCount = count / std::max(minChunkSize, static_cast<size_t>(1));
+		return std::clamp(maxChunkCount, static_cast<size_t>(1), GetParallelThreadCount());
+	}
+
+	void ParallelForChunks(const size_t& count, const size_t& chunkCount, const std::function<void(size_t, size_t, size_t)>& chunkJob)
+	{
+		if (chunkCount <= 1)
+		{
+			chunkJob(0, 0, count);
+			return;
+		}
+
+		std::exception_ptr firstException = nullptr;
+		std::mutex exceptionMutex;
+		const auto runChunk = [&](const size_t chunkIndex)
+		{
+			try
+			{
+				chunkJob(chunkIndex, count * chunkIndex / chunkCount, count * (chunkIndex + 1) / chunkCount);
+			}
+			catch (...)
+			{
+				std::lock_guard lock(exceptionMutex);
+				if (!firstException)
+					firstException = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(chunkCount - 1);
+		for (size_t chunkIndex = 1; chunkIndex < chunkCount; chunkIndex++)
+			threads.emplace_back(runChunk, chunkIndex);
+
+		runChunk(0);
+		for (auto& thread : threads)
+			thread.join();
+
+		if (firstException)
+			std::rethrow_exception(firstException);
+	}
+
+} // Symplektis::Util
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*! \file ParallelUtils.h
+*   \brief Utils for splitting work into chunks processed on multiple threads
+*
+\verbatim
+-------------------------------------------------------------------------------
+created  : 18.10.2026 : M.Cavarga (MCInversion) :
+-------------------------------------------------------------------------------
+
+-------------------------------------------------------------------------------
+\endverbatim
+*/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Symplektis::Util
+{
+	//-----------------------------------------------------------------------------
+	/*! \brief Number of threads available for parallel jobs (at least 1)
+	*	\return thread count
+	*
+	*   \ingroup UTILITY_GENERAL
+	*
+	*   \author M.Cavarga (MCInversion)
+	*   \date 18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	size_t GetParallelThreadCount();
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Number of chunks into which a range of items should be split, so that no chunk is smaller than minChunkSize
+	*          and no more chunks than GetParallelThreadCount() are created.
+	*   \param[in] count          - number of items
+	*   \param[in] minChunkSize   - minimum number of items worth processing on a separate thread
+	*	\return chunk count (at least 1)
+	*
+	*   \ingroup UTILITY_GENERAL
+	*
+	*   \author M.Cavarga (MCInversion)
+	*   \date 18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	size_t GetParallelChunkCount(const size_t& count, const size_t& minChunkSize);
+
+	//-----------------------------------------------------------------------------
+	/*! \brief Splits the range [0, count) into chunkCount contiguous chunks of (almost) equal size, and calls
+	*          chunkJob(chunkIndex, begin, end) for each chunk on a separate thread. The first chunk is processed
+	*          on the calling thread. Returns after all chunks are processed. If a job throws, the first exception
+	*          is re-thrown on the calling thread.
+	*   \param[in] count          - number of items
+	*   \param[in] chunkCount     - number of chunks (e.g.: from GetParallelChunkCount)
+	*   \param[in] chunkJob       - job processing items [begin, end) of chunk chunkIndex
+	*
+	*   \ingroup UTILITY_GENERAL
+	*
+	*   \author M.Cavarga (MCInversion)
+	*   \date 18.10.2026
+	*/
+	//-----------------------------------------------------------------------------
+	void ParallelForChunks(const size_t& count, const size_t& chunkCount, const std::function<void(size_t, size_t, size_t)>& chunkJob);
+
+} // Symplektis::Util
\ No newline at end of file
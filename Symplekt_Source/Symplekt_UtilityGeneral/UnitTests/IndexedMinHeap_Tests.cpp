@@ -0,0 +1,64 @@
+/*! \file  IndexedMinHeap_Tests.cpp
+ *  \brief Tests for the indexed min-heap.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_UtilityGeneral/IndexedMinHeap.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Symplektis::UnitTests
+{
+	using namespace Util;
+
+	TEST(IndexedMinHeap_TestSuite, ShuffledKeys_PushAndPop_ItemsInKeyOrder)
+	{
+		// Arrange
+		constexpr size_t itemCount = 1000;
+		IndexedMinHeap<double> heap(itemCount);
+		for (size_t item = 0; item < itemCount; item++)
+			heap.Push(item, static_cast<double>((item * 7919) % itemCount));
+
+		// Act
+		std::vector<double> poppedKeys;
+		while (!heap.Empty())
+			poppedKeys.push_back(heap.Pop().first);
+
+		// Assert
+		EXPECT_EQ(poppedKeys.size(), itemCount);
+		EXPECT_TRUE(std::is_sorted(poppedKeys.begin(), poppedKeys.end()));
+	}
+
+	TEST(IndexedMinHeap_TestSuite, ContainedItem_PushWithSmallerAndLargerKey_OnlyDecreased)
+	{
+		// Arrange
+		IndexedMinHeap<double> heap(10);
+		heap.Push(3, 5.0);
+		heap.Push(7, 4.0);
+		heap.Push(1, 6.0);
+
+		// Act
+		const bool isDecreased = heap.Push(1, 1.0);
+		const bool isIncreased = heap.Push(7, 10.0);
+
+		// Assert
+		EXPECT_TRUE(isDecreased);
+		EXPECT_FALSE(isIncreased);
+		EXPECT_EQ(heap.Size(), 3);
+		EXPECT_EQ(heap.Top().second, 1);
+		EXPECT_EQ(heap.Pop(), std::make_pair(1.0, size_t{ 1 }));
+		EXPECT_EQ(heap.Pop(), std::make_pair(4.0, size_t{ 7 }));
+		EXPECT_FALSE(heap.Contains(7));
+		EXPECT_TRUE(heap.Contains(3));
+		heap.Clear();
+		EXPECT_TRUE(heap.Empty());
+		EXPECT_FALSE(heap.Contains(3));
+	}
+
+} // Symplektis::UnitTests
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*! \file  Parallel_Tests.cpp
+ *  \brief Tests for parallel chunk processing utilities.
+ *
+ *   \author M. Cavarga (MCInversion)
+ *   \date   18.10.2026
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include "Symplekt_UtilityGeneral/BoundedQueue.h"
+#include "Symplekt_UtilityGeneral/ParallelUtils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Symplektis::UnitTests
+{
+	using namespace Util;
+
+	TEST(Parallel_TestSuite, SmallItemCount_GetParallelChunkCount_SingleChunk)
+	{
+		EXPECT_EQ(GetParallelChunkCount(0, 100), 1);
+		EXPECT_EQ(GetParallelChunkCount(99, 100), 1);
+		EXPECT_LE(GetParallelChunkCount(1000000, 100), GetParallelThreadCount());
+	}
+
+	TEST(Parallel_TestSuite, ItemRange_ParallelForChunks_EachItemProcessedOnce)
+	{
+		// Arrange
+		constexpr size_t itemCount = 100003;
+		constexpr size_t chunkCount = 7;
+		std::vector<unsigned int> processCount(itemCount, 0);
+		std::vector<size_t> chunkSizes(chunkCount, 0);
+
+		// Act
+		ParallelForChunks(itemCount, chunkCount, [&](const size_t chunkIndex, const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+				processCount[i]++;
+			chunkSizes[chunkIndex] = end - begin;
+		});
+
+		// Assert
+		EXPECT_TRUE(std::all_of(processCount.begin(), processCount.end(), [](const unsigned int& count) { return count == 1; }));
+		EXPECT_EQ(std::accumulate(chunkSizes.begin(), chunkSizes.end(), static_cast<size_t>(0)), itemCount);
+		for (const auto& size : chunkSizes)
+			EXPECT_NEAR(static_cast<double>(size), static_cast<double>(itemCount) / chunkCount, 1.0);
+	}
+
+	TEST(Parallel_TestSuite, ThrowingJob_ParallelForChunks_ExceptionRethrown)
+	{
+		EXPECT_THROW(
+			ParallelForChunks(100, 4, [](const size_t chunkIndex, size_t, size_t)
+			{
+				if (chunkIndex == 2)
+					throw std::runtime_error("chunk failed");
+			}),
+			std::runtime_error);
+	}
+
+	TEST(Parallel_TestSuite, SmallCapacityQueue_PushFromProducerPopFromConsumer_AllItemsInOrder)
+	{
+		// Arrange
+		constexpr int itemCount = 10000;
+		BoundedQueue<int> queue(3);
+		std::vector<int> poppedItems;
+
+		// Act
+		std::thread producer([&queue]()
+		{
+			for (int i = 0; i < itemCount; i++)
+				queue.Push(int{ i });
+			queue.Close();
+		});
+		while (const auto item = queue.Pop())
+			poppedItems.push_back(*item);
+		producer.join();
+
+		// Assert
+		ASSERT_EQ(poppedItems.size(), itemCount);
+		for (int i = 0; i < itemCount; i++)
+			EXPECT_EQ(poppedItems[i], i);
+	}
+
+	TEST(Parallel_TestSuite, ClosedQueue_PushAndPop_RemainingItemsPoppedAndPushRejected)
+	{
+		// Arrange
+		BoundedQueue<int> queue(0);
+		const bool pushedBeforeClose = queue.Push(1);
+
+		// Act
+		queue.Close();
+		const bool pushedAfterClose = queue.Push(2);
+		const auto firstItem = queue.Pop();
+		const auto secondItem = queue.Pop();
+
+		// Assert
+		EXPECT_EQ(queue.Capacity(), 1);
+		EXPECT_TRUE(pushedBeforeClose);
+		EXPECT_FALSE(pushedAfterClose);
+		ASSERT_TRUE(firstItem.has_value());
+		EXPECT_EQ(*firstItem, 1);
+		EXPECT_FALSE(secondItem.has_value());
+	}
+
+} // namespace Symplektis::UnitTests
\ No newline at end of file